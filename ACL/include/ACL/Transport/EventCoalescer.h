@@ -0,0 +1,169 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_ACL_INCLUDE_ACL_TRANSPORT_EVENTCOALESCER_H_
+#define ALEXA_CLIENT_SDK_ACL_INCLUDE_ACL_TRANSPORT_EVENTCOALESCER_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <AVSCommon/AVS/MessageRequest.h>
+#include <AVSCommon/Utils/Metrics/MetricRecorderInterface.h>
+
+namespace alexaClientSDK {
+namespace acl {
+
+/**
+ * A stage in front of the request queue which holds events for a short window, so that an event which is superseded
+ * by a later event with the same coalescing key (see @c MessageRequest::setCoalescingKey()) is never sent.
+ *
+ * The first held event starts the window.  When it ends, the surviving events are passed on in the order they were
+ * first submitted: a request takes the place of the request it supersedes.  A request without a coalescing key, or
+ * with attachments, is never held: any held events are passed on first, and then the request itself, so the relative
+ * order of events which are not coalesced is preserved.
+ *
+ * Requests are passed on without holding the internal lock.  When several threads pass on requests at the same time,
+ * the first one passes on the requests of the others too, so that the order is kept.
+ *
+ * A superseded request completes with the status (and exception, if any) of the request which replaced it.  The number
+ * of events and bytes saved is recorded in metrics.
+ *
+ * This class is thread-safe.
+ */
+class EventCoalescer {
+public:
+    /// The function used to pass on requests, in order.
+    using SendFunction = std::function<void(std::shared_ptr<avsCommon::avs::MessageRequest> request)>;
+
+    /**
+     * Constructor.
+     *
+     * @param window How long to hold the first event of a batch before passing on the batch.  Must be greater than
+     * zero.
+     * @param sendFunction The function used to pass on requests.  It is called by one thread at a time, without any
+     * internal lock held.
+     * @param metricRecorder The metric recorder used to count what coalescing saved.  May be @c nullptr.
+     */
+    EventCoalescer(
+        std::chrono::milliseconds window,
+        SendFunction sendFunction,
+        std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder = nullptr);
+
+    /**
+     * Destructor.  Calls @c shutdown().
+     */
+    ~EventCoalescer();
+
+    /**
+     * Submit a request, which is either held or passed on at once.
+     *
+     * @param request The request.
+     */
+    void submit(std::shared_ptr<avsCommon::avs::MessageRequest> request);
+
+    /**
+     * Pass on all held requests now.  Returns once they have been passed on.
+     */
+    void flush();
+
+    /**
+     * Pass on all held requests, and stop holding new ones.  Requests submitted after this call are passed on at once.
+     * Returns once the held requests have been passed on.
+     */
+    void shutdown();
+
+private:
+    /// A request held by the coalescer.
+    struct HeldRequest {
+        /// The request which will be sent.
+        std::shared_ptr<avsCommon::avs::MessageRequest> request;
+
+        /// The requests it superseded, in the order they were submitted.
+        std::vector<std::shared_ptr<avsCommon::avs::MessageRequest>> superseded;
+    };
+
+    /**
+     * Move all held requests to @c m_outgoing.  @c m_mutex must be locked to call this method.
+     */
+    void flushLocked();
+
+    /**
+     * Pass on the requests in @c m_outgoing, unless another thread is already doing so, in which case it passes them
+     * on instead.  @c m_mutex is unlocked while the requests are passed on.
+     *
+     * @param lock The lock on @c m_mutex, which must be locked to call this method.
+     */
+    void sendOutgoing(std::unique_lock<std::mutex>& lock);
+
+    /**
+     * Wait until no other thread is passing on requests.
+     *
+     * @param lock The lock on @c m_mutex, which must be locked to call this method.
+     */
+    void waitForOutgoing(std::unique_lock<std::mutex>& lock);
+
+    /// The main loop of the thread which ends the windows.
+    void windowLoop();
+
+    /// How long to hold the first event of a batch.
+    const std::chrono::milliseconds m_window;
+
+    /// The function used to pass on requests.
+    const SendFunction m_sendFunction;
+
+    /// The metric recorder.
+    const std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> m_metricRecorder;
+
+    /// Serializes access to the members below.
+    std::mutex m_mutex;
+
+    /// Notified when a window starts or the coalescer shuts down.
+    std::condition_variable m_wakeTrigger;
+
+    /// Notified when a thread stops passing on requests.
+    std::condition_variable m_sendTrigger;
+
+    /// The held requests, in the order they were first submitted.
+    std::vector<HeldRequest> m_heldRequests;
+
+    /// The requests waiting to be passed on, in order.
+    std::vector<std::shared_ptr<avsCommon::avs::MessageRequest>> m_outgoing;
+
+    /// Whether a thread is passing on requests.
+    bool m_isSending;
+
+    /// The thread passing on requests.  Only meaningful while @c m_isSending is true.
+    std::thread::id m_sendingThreadId;
+
+    /// When the current window ends.  Only meaningful while @c m_heldRequests is not empty.
+    std::chrono::steady_clock::time_point m_windowEnd;
+
+    /// Whether @c shutdown() has been called.
+    bool m_isShutdown;
+
+    /// The thread which ends the windows.  Declared last so that it starts after everything else is initialized.
+    std::thread m_windowThread;
+};
+
+}  // namespace acl
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_ACL_INCLUDE_ACL_TRANSPORT_EVENTCOALESCER_H_
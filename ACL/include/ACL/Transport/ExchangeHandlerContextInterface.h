@@ -20,6 +20,7 @@
 #include <string>
 
 #include <AVSCommon/AVS/MessageRequest.h>
+#include <AVSCommon/SDKInterfaces/MessageRequestObserverInterface.h>
 #include <AVSCommon/Utils/HTTP2/HTTP2RequestConfig.h>
 #include <AVSCommon/Utils/HTTP2/HTTP2RequestInterface.h>
 
@@ -62,6 +63,20 @@ public:
      */
     virtual void onMessageRequestAcknowledged(const std::shared_ptr<avsCommon::avs::MessageRequest>& request) = 0;
 
+    /**
+     * Notification that a @c MessageRequest finished without receiving a response from AVS.  This is called before
+     * the request is reported as acknowledged, so that the context can decide how to handle the failure before
+     * sending anything else.
+     *
+     * @param request The request which failed.
+     * @param status The status the request failed with.
+     * @return Whether the context takes over the request, in which case the caller must not complete it, because the
+     * context will either send it again or complete it itself.
+     */
+    virtual bool onMessageRequestFailedWithoutResponse(
+        const std::shared_ptr<avsCommon::avs::MessageRequest>& request,
+        avsCommon::sdkInterfaces::MessageRequestObserverInterface::Status status);
+
     /**
      * Notification tht a message request has finished it's exchange with AVS.
      */
@@ -107,6 +122,12 @@ public:
     virtual std::string getAVSGateway() = 0;
 };
 
+inline bool ExchangeHandlerContextInterface::onMessageRequestFailedWithoutResponse(
+    const std::shared_ptr<avsCommon::avs::MessageRequest>& request,
+    avsCommon::sdkInterfaces::MessageRequestObserverInterface::Status status) {
+    return false;
+}
+
 }  // namespace acl
 }  // namespace alexaClientSDK
 
@@ -24,6 +24,7 @@
 #include <string>
 #include <thread>
 #include <unordered_set>
+#include <vector>
 
 #include <AVSCommon/AVS/Attachment/AttachmentManagerInterface.h>
 #include <AVSCommon/SDKInterfaces/AuthDelegateInterface.h>
@@ -31,6 +32,7 @@
 #include <AVSCommon/SDKInterfaces/MessageSenderInterface.h>
 #include <AVSCommon/Utils/HTTP2/HTTP2ConnectionInterface.h>
 #include <AVSCommon/Utils/HTTP2/HTTP2ConnectionObserverInterface.h>
+#include <AVSCommon/Utils/Metrics/AggregatingMetricRecorder.h>
 #include <AVSCommon/Utils/Metrics/MetricRecorderInterface.h>
 #include <AVSCommon/Utils/Power/PowerResource.h>
 #include <AVSCommon/Utils/Timing/DistantFuture.h>
@@ -69,6 +71,14 @@ public:
 
         /// The elapsed time without any activity before sending out a ping.
         std::chrono::seconds inactivityTimeout;
+
+        /**
+         * The number of serialized messages which may be sent before the first of them is acknowledged.  The default
+         * of 1 sends serialized messages strictly one at a time.  Larger values enable ordered pipelining: serialized
+         * messages are sent in order on separate streams (up to the number of streams available for messages), and
+         * those that fail without a response behind an earlier failure are sent again, in order.
+         */
+        unsigned int maxSerializedMessagesInFlight;
     };
 
     /**
@@ -162,6 +172,9 @@ public:
     void onMessageRequestSent(const std::shared_ptr<avsCommon::avs::MessageRequest>& request) override;
     void onMessageRequestTimeout() override;
     void onMessageRequestAcknowledged(const std::shared_ptr<avsCommon::avs::MessageRequest>& request) override;
+    bool onMessageRequestFailedWithoutResponse(
+        const std::shared_ptr<avsCommon::avs::MessageRequest>& request,
+        avsCommon::sdkInterfaces::MessageRequestObserverInterface::Status status) override;
     void onMessageRequestFinished() override;
     void onPingRequestAcknowledged(bool success) override;
     void onPingTimeout() override;
@@ -205,6 +218,18 @@ private:
     // Friend to allow access to enum class State.
     friend std::ostream& operator<<(std::ostream& stream, HTTP2Transport::State state);
 
+    /// A serialized @c MessageRequest sent while pipelining, tagged with the order it was sent in.
+    struct PipelinedRequest {
+        /// The position of the request in the order serialized requests were sent.
+        uint64_t sequence;
+
+        /// The request.
+        std::shared_ptr<avsCommon::avs::MessageRequest> request;
+
+        /// The status the request failed with, if it failed without a response.
+        avsCommon::sdkInterfaces::MessageRequestObserverInterface::Status status;
+    };
+
     /**
      * HTTP2Transport Constructor.
      *
@@ -364,6 +389,20 @@ private:
      */
     void notifyObserversOnServerSideDisconnect();
 
+    /**
+     * Removes a request from @c m_pipelinedRequests once it is acknowledged.  When the last request in flight is
+     * removed after some of them failed without a response, the earliest failure is returned to be completed, the
+     * later ones are put back at the front of the shared queue in the order they were first sent, and sending
+     * serialized requests resumes.
+     *
+     * @note Must be called while @c m_mutex is held by the calling thread.
+     *
+     * @param request The acknowledged request.
+     * @return The request to complete as failed, if any.
+     */
+    std::shared_ptr<PipelinedRequest> removePipelinedRequestLocked(
+        const std::shared_ptr<avsCommon::avs::MessageRequest>& request);
+
     /**
      * Get m_state in a thread-safe manner.
      *
@@ -371,9 +410,35 @@ private:
      */
     State getState();
 
+    /**
+     * Capture metric for Disconnects along with Disconnect reason.
+     *
+     * @param reason The @c ConnectionStatusObserverInterface::ChangedReason for disconnection.
+     */
+    void submitDisconnectReasonMetric(
+        avsCommon::sdkInterfaces::ConnectionStatusObserverInterface::ChangedReason reason);
+
+    /**
+     * Capture metric for cases where there are internal message send errors or timeouts.
+     *
+     * @param status The @c MessageRequestObserverInterface::Status of the message.
+     */
+    void submitMessageSendErrorMetric(avsCommon::sdkInterfaces::MessageRequestObserverInterface::Status status);
+
     /// The metric recorder.
     std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> m_metricRecorder;
 
+    /// The metric recorder, if it aggregates counters.  The disconnect reason and message send error counters are
+    /// aggregated by it.
+    std::shared_ptr<avsCommon::utils::metrics::AggregatingMetricRecorder> m_aggregatingMetricRecorder;
+
+    /// The ids of the disconnect reason counters in @c m_aggregatingMetricRecorder, indexed by @c ChangedReason.
+    std::vector<avsCommon::utils::metrics::AggregatingMetricRecorder::MetricId> m_disconnectReasonCounters;
+
+    /// The ids of the message send error counters in @c m_aggregatingMetricRecorder, indexed by
+    /// @c MessageRequestObserverInterface::Status.
+    std::vector<avsCommon::utils::metrics::AggregatingMetricRecorder::MetricId> m_messageSendErrorCounters;
+
     /// Mutex for accessing @c m_state and @c m_messageQueue
     std::mutex m_mutex;
 
@@ -440,6 +505,18 @@ private:
     /// The runtime HTTP2/2 connection settings.
     const Configuration m_configuration;
 
+    /// The number of serialized messages which may be in flight at once, limited to the streams available.
+    const size_t m_maxSerializedMessagesInFlight;
+
+    /// The sequence number to give the next serialized request sent while pipelining.  Serialized by @c m_mutex.
+    uint64_t m_nextPipelineSequence;
+
+    /// Serialized requests sent while pipelining which are not yet acknowledged, in order.  Serialized by @c m_mutex.
+    std::deque<PipelinedRequest> m_pipelinedRequests;
+
+    /// Pipelined requests which failed without a response, held until the rest finish.  Serialized by @c m_mutex.
+    std::vector<PipelinedRequest> m_failedPipelinedRequests;
+
     /// The reason for disconnecting.
     avsCommon::sdkInterfaces::ConnectionStatusObserverInterface::ChangedReason m_disconnectReason;
 
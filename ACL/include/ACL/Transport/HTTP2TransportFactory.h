@@ -90,7 +90,7 @@ private:
     /// Save a pointer to the object used to create instances of the PostConnectInterface.
     std::shared_ptr<PostConnectFactoryInterface> m_postConnectFactory;
 
-    /// The metric recorder.
+    /// The metric recorder, wrapped in an @c AggregatingMetricRecorder.
     std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> m_metricRecorder;
 
     /// The @c EventTracerInterface object used to pass in the tracer to HTTP2Transport.
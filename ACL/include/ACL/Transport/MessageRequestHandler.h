@@ -75,6 +75,7 @@ public:
     avsCommon::utils::http2::HTTP2GetMimeHeadersResult getMimePartHeaderLines() override;
     std::vector<std::string> getRequestHeaderLines() override;
     avsCommon::utils::http2::HTTP2SendDataResult onSendMimePartData(char* bytes, size_t size) override;
+    bool setDataAvailableCallback(std::function<void()> callback) override;
     /// @}
 
     /// @name MimeResponseStatusHandlerInterface
@@ -20,6 +20,7 @@
 #include <memory>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <AVSCommon/AVS/MessageRequest.h>
 #include <AVSCommon/Utils/functional/hash.h>
@@ -50,13 +51,26 @@ public:
     bool isMessageRequestAvailable() const override;
     void setWaitingForSendAcknowledgement() override;
     void clearWaitingForSendAcknowledgement() override;
+    void resetWaitingForSendAcknowledgement() override;
+    void setMaxSerializedRequestsInFlight(size_t maxRequests) override;
+    void requeueRequests(const std::vector<std::shared_ptr<avsCommon::avs::MessageRequest>>& messageRequests) override;
     bool empty() const override;
     void clear() override;
     /// @}
 
 private:
-    /// Flag indicating whether to block sending serialized messages.
-    bool m_isWaitingForAcknowledgement;
+    /**
+     * Checks whether another serialized @c MessageRequest may be sent.
+     *
+     * @return Whether fewer serialized requests than @c m_maxSerializedRequestsInFlight are waiting.
+     */
+    bool canSendSerializedRequest() const;
+
+    /// The number of serialized messages sent and waiting to be acknowledged.
+    size_t m_countOfSerializedRequestsInFlight;
+
+    /// The number of serialized messages which may be waiting to be acknowledged before sending more is blocked.
+    size_t m_maxSerializedRequestsInFlight;
 
     /// The queue of @c MessageRequests to be sent, paired with the time that each request was added to the queue.
     std::deque<
@@ -20,6 +20,7 @@
 #include <deque>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include <AVSCommon/AVS/MessageRequest.h>
 #include <AVSCommon/Utils/Optional.h>
@@ -74,15 +75,37 @@ public:
     virtual bool isMessageRequestAvailable() const = 0;
 
     /**
-     * Sets the flag indicating that the queue is waiting for a send to be acknowledged.
+     * Records that a serialized @c MessageRequest was sent and the queue is waiting for it to be acknowledged.
      */
     virtual void setWaitingForSendAcknowledgement() = 0;
 
     /**
-     * Clear the flag indicating that the queue is waiting for a send to be acknowledged.
+     * Records that a serialized @c MessageRequest the queue was waiting for has been acknowledged.
      */
     virtual void clearWaitingForSendAcknowledgement() = 0;
 
+    /**
+     * Forget about all serialized @c MessageRequests the queue is waiting for.
+     */
+    virtual void resetWaitingForSendAcknowledgement() = 0;
+
+    /**
+     * Sets the number of serialized @c MessageRequests which may be waiting to be acknowledged at once.  The default
+     * is 1, which sends serialized requests strictly one at a time.  0 holds back all serialized requests.
+     *
+     * @param maxRequests The number of serialized requests which may be waiting to be acknowledged.
+     */
+    virtual void setMaxSerializedRequestsInFlight(size_t maxRequests) = 0;
+
+    /**
+     * Puts @c MessageRequests which need to be sent again back at the front of the queue, ahead of everything
+     * already queued.
+     *
+     * @param messageRequests The requests to requeue, oldest first.
+     */
+    virtual void requeueRequests(
+        const std::vector<std::shared_ptr<avsCommon::avs::MessageRequest>>& messageRequests) = 0;
+
     /**
      * Checks if there are any queued @c MessageRequests.
      *
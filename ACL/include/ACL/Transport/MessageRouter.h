@@ -25,9 +25,11 @@
 #include <AVSCommon/AVS/Attachment/AttachmentManagerInterface.h>
 #include <AVSCommon/AVS/MessageRequest.h>
 #include <AVSCommon/SDKInterfaces/AuthDelegateInterface.h>
+#include <AVSCommon/Utils/Metrics/MetricRecorderInterface.h>
 #include <AVSCommon/Utils/Threading/Executor.h>
 #include <AVSCommon/Utils/Timing/Timer.h>
 
+#include "ACL/Transport/EventCoalescer.h"
 #include "ACL/Transport/MessageConsumerInterface.h"
 #include "ACL/Transport/MessageRouterInterface.h"
 #include "ACL/Transport/MessageRouterObserverInterface.h"
@@ -56,17 +58,28 @@ public:
     /**
      * Factory function for creating an instance of MessageRouterInterface.
      *
+     * The window used to coalesce events is read from the @c messageRouter configuration node, and coalescing is
+     * disabled unless it is greater than zero:
+     *
+     * @code{.json}
+     *     "messageRouter": {
+     *         "eventCoalescingWindowMs": 50
+     *     }
+     * @endcode
+     *
      * @param shutdownNotifier The object with which to register to be told when to shut down.
      * @param authDelegate An implementation of an AuthDelegate, which will provide valid access tokens with which
      * the MessageRouter can authorize the client to AVS.
      * @param attachmentManager The AttachmentManager, which allows ACL to write attachments received from AVS.
      * @param transportFactory Factory used to create new transport objects.
+     * @param metricRecorder The metric recorder used to count the events saved by coalescing.
      */
     static std::shared_ptr<MessageRouterInterface> createMessageRouterInterface(
         const std::shared_ptr<acsdkShutdownManagerInterfaces::ShutdownNotifierInterface>& shutdownNotifier,
         const std::shared_ptr<avsCommon::sdkInterfaces::AuthDelegateInterface>& authDelegate,
         const std::shared_ptr<avsCommon::avs::attachment::AttachmentManagerInterface>& attachmentManager,
-        const std::shared_ptr<TransportFactoryInterface>& transportFactory);
+        const std::shared_ptr<TransportFactoryInterface>& transportFactory,
+        const std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface>& metricRecorder);
 
     /**
      * Constructor.
@@ -83,6 +96,9 @@ public:
      * ENGINE_TYPE_ALEXA_VOICE_SERVICES.
      * @param serverSideDisconnectGracePeriod How long to allow for an automatic reconnection before reporting
      * a server side disconnect to our observer.
+     * @param eventCoalescingWindow How long to hold events which have a coalescing key, so that superseded events are
+     * not sent (see @c EventCoalescer).  Zero, the default, disables coalescing.
+     * @param metricRecorder The metric recorder used to count the events saved by coalescing.  May be @c nullptr.
      */
     MessageRouter(
         std::shared_ptr<avsCommon::sdkInterfaces::AuthDelegateInterface> authDelegate,
@@ -90,7 +106,9 @@ public:
         std::shared_ptr<TransportFactoryInterface> transportFactory,
         const std::string& avsGateway = "",
         int engineType = avsCommon::sdkInterfaces::ENGINE_TYPE_ALEXA_VOICE_SERVICES,
-        std::chrono::milliseconds serverSideDisconnectGracePeriod = DEFAULT_SERVER_SIDE_DISCONNECT_GRACE_PERIOD);
+        std::chrono::milliseconds serverSideDisconnectGracePeriod = DEFAULT_SERVER_SIDE_DISCONNECT_GRACE_PERIOD,
+        std::chrono::milliseconds eventCoalescingWindow = std::chrono::milliseconds::zero(),
+        std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder = nullptr);
 
     /// @name MessageRouterInterface methods.
     /// @{
@@ -165,6 +183,14 @@ private:
      */
     void notifyObserverOnReceive(const std::string& contextId, const std::string& message);
 
+    /**
+     * Add a request to the queue shared by the transports, and notify the active transport.  If there is no active
+     * transport, the request completes with @c NOT_CONNECTED.
+     *
+     * @param request The request to send.
+     */
+    void enqueueRequest(std::shared_ptr<avsCommon::avs::MessageRequest> request);
+
     /**
      * Creates a new transport, and begins the connection process. The new transport immediately becomes the active
      * transport. @c m_connectionMutex must be locked to call this method.
@@ -257,6 +283,9 @@ private:
     /// Amount of time to allow for an automatic reconnect before notifying of a server side disconnect.
     const std::chrono::milliseconds m_serverSideReconnectGracePeriod;
 
+    /// The stage which coalesces superseded events before they are queued.  @c nullptr if coalescing is disabled.
+    std::unique_ptr<EventCoalescer> m_eventCoalescer;
+
 protected:
     /**
      * Executor to perform asynchronous operations:
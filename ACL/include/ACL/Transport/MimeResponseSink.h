@@ -60,6 +60,7 @@ public:
     bool onReceiveResponseCode(long responseCode) override;
     bool onReceiveHeaderLine(const std::string& line) override;
     bool onBeginMimePart(const std::multimap<std::string, std::string>& headers) override;
+    bool onBeginMimePartHeaders(const avsCommon::utils::http2::HTTP2MimePartHeaders& headers) override;
     avsCommon::utils::http2::HTTP2ReceiveDataStatus onReceiveMimeData(const char* bytes, size_t size) override;
     bool onEndMimePart() override;
     avsCommon::utils::http2::HTTP2ReceiveDataStatus onReceiveNonMimeData(const char* bytes, size_t size) override;
@@ -77,6 +78,17 @@ private:
         ATTACHMENT
     };
 
+    /**
+     * Handle the start of a new mime part, for both forms of its headers.
+     *
+     * @param contentType The value of the Content-Type header of the part, or @c nullptr if it has none.
+     * @param contentId The value of the Content-ID header of the part, or @c nullptr unless it has exactly one.
+     * @return Whether receipt of the response should continue.
+     */
+    bool beginMimePart(
+        const avsCommon::utils::http2::HTTP2MimePartHeaders::Text* contentType,
+        const avsCommon::utils::http2::HTTP2MimePartHeaders::Text* contentId);
+
     /**
      * Write received data to the currently accumulating attachment.
      *
@@ -52,6 +52,9 @@ public:
     bool isMessageRequestAvailable() const override;
     void setWaitingForSendAcknowledgement() override;
     void clearWaitingForSendAcknowledgement() override;
+    void resetWaitingForSendAcknowledgement() override;
+    void setMaxSerializedRequestsInFlight(size_t maxRequests) override;
+    void requeueRequests(const std::vector<std::shared_ptr<avsCommon::avs::MessageRequest>>& messageRequests) override;
     bool empty() const override;
     void clear() override;
     /// @}
@@ -0,0 +1,258 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <AVSCommon/Utils/Logger/Logger.h>
+#include <AVSCommon/Utils/Metrics/DataPointCounterBuilder.h>
+#include <AVSCommon/Utils/Metrics/MetricEventBuilder.h>
+
+#include "ACL/Transport/EventCoalescer.h"
+
+namespace alexaClientSDK {
+namespace acl {
+
+using namespace avsCommon::avs;
+using namespace avsCommon::sdkInterfaces;
+using namespace avsCommon::utils::metrics;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("EventCoalescer");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param event The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// Prefix used to identify metrics published by this module.
+static const std::string EVENT_COALESCER_METRIC_SOURCE_PREFIX = "EVENT_COALESCER-";
+
+/// Metric identifier for events which were not sent because they were superseded.
+static const std::string EVENTS_COALESCED = "EVENTS_COALESCED";
+
+/// Name of the data point counting the events which were not sent.
+static const std::string EVENT_COUNT = "EVENT_COUNT";
+
+/// Name of the data point counting the bytes of JSON content which were not sent.
+static const std::string BYTES_SAVED = "BYTES_SAVED";
+
+/**
+ * Observer added to a request which superseded other requests, to complete them along with it.
+ */
+class SupersededRequestsObserver : public MessageRequestObserverInterface {
+public:
+    /**
+     * Constructor.
+     *
+     * @param superseded The requests to complete along with the observed request.
+     */
+    explicit SupersededRequestsObserver(std::vector<std::shared_ptr<MessageRequest>> superseded) :
+            m_superseded{std::move(superseded)} {
+    }
+
+    /// @name MessageRequestObserverInterface methods.
+    /// @{
+    void onResponseStatusReceived(MessageRequestObserverInterface::Status status) override {
+        for (const auto& request : m_superseded) {
+            request->responseStatusReceived(status);
+        }
+    }
+
+    void onSendCompleted(MessageRequestObserverInterface::Status status) override {
+        for (const auto& request : m_superseded) {
+            request->sendCompleted(status);
+        }
+    }
+
+    void onExceptionReceived(const std::string& exceptionMessage) override {
+        for (const auto& request : m_superseded) {
+            request->exceptionReceived(exceptionMessage);
+        }
+    }
+    /// @}
+
+private:
+    /// The requests to complete along with the observed request.
+    const std::vector<std::shared_ptr<MessageRequest>> m_superseded;
+};
+
+/**
+ * Record how many events and bytes were saved by coalescing.
+ *
+ * @param metricRecorder The metric recorder object.
+ * @param eventCount The number of events which were not sent.
+ * @param bytesSaved The number of bytes of JSON content which were not sent.
+ */
+static void submitEventsCoalescedMetric(
+    const std::shared_ptr<MetricRecorderInterface>& metricRecorder,
+    uint64_t eventCount,
+    uint64_t bytesSaved) {
+    if (!metricRecorder || 0 == eventCount) {
+        return;
+    }
+
+    auto metricEvent = MetricEventBuilder{}
+                           .setActivityName(EVENT_COALESCER_METRIC_SOURCE_PREFIX + EVENTS_COALESCED)
+                           .addDataPoint(DataPointCounterBuilder{}.setName(EVENT_COUNT).increment(eventCount).build())
+                           .addDataPoint(DataPointCounterBuilder{}.setName(BYTES_SAVED).increment(bytesSaved).build())
+                           .build();
+
+    if (!metricEvent) {
+        ACSDK_ERROR(LX("submitEventsCoalescedMetricFailed").d("reason", "invalid metric event"));
+        return;
+    }
+
+    recordMetric(metricRecorder, metricEvent);
+}
+
+EventCoalescer::EventCoalescer(
+    std::chrono::milliseconds window,
+    SendFunction sendFunction,
+    std::shared_ptr<MetricRecorderInterface> metricRecorder) :
+        m_window{window},
+        m_sendFunction{std::move(sendFunction)},
+        m_metricRecorder{std::move(metricRecorder)},
+        m_isSending{false},
+        m_isShutdown{false} {
+    m_windowThread = std::thread(&EventCoalescer::windowLoop, this);
+}
+
+EventCoalescer::~EventCoalescer() {
+    shutdown();
+}
+
+void EventCoalescer::submit(std::shared_ptr<MessageRequest> request) {
+    if (!request) {
+        ACSDK_ERROR(LX("submitFailed").d("reason", "nullRequest"));
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock{m_mutex};
+    auto key = request->getCoalescingKey();
+    if (m_isShutdown || key.empty() || request->attachmentReadersCount() > 0) {
+        flushLocked();
+        m_outgoing.push_back(std::move(request));
+        sendOutgoing(lock);
+        return;
+    }
+
+    for (auto& held : m_heldRequests) {
+        if (held.request->getCoalescingKey() == key) {
+            ACSDK_DEBUG9(LX("requestSuperseded").d("key", key).d("supersededCount", held.superseded.size() + 1));
+            held.superseded.push_back(std::move(held.request));
+            held.request = std::move(request);
+            return;
+        }
+    }
+
+    if (m_heldRequests.empty()) {
+        m_windowEnd = std::chrono::steady_clock::now() + m_window;
+        m_wakeTrigger.notify_one();
+    }
+    m_heldRequests.push_back({std::move(request), {}});
+}
+
+void EventCoalescer::flush() {
+    std::unique_lock<std::mutex> lock{m_mutex};
+    flushLocked();
+    sendOutgoing(lock);
+    waitForOutgoing(lock);
+}
+
+void EventCoalescer::shutdown() {
+    {
+        std::unique_lock<std::mutex> lock{m_mutex};
+        m_isShutdown = true;
+        flushLocked();
+        sendOutgoing(lock);
+        waitForOutgoing(lock);
+    }
+    m_wakeTrigger.notify_one();
+    if (m_windowThread.joinable() && m_windowThread.get_id() != std::this_thread::get_id()) {
+        m_windowThread.join();
+    }
+}
+
+void EventCoalescer::flushLocked() {
+    if (m_heldRequests.empty()) {
+        return;
+    }
+
+    uint64_t eventCount = 0;
+    uint64_t bytesSaved = 0;
+    for (auto& held : m_heldRequests) {
+        if (!held.superseded.empty()) {
+            for (const auto& superseded : held.superseded) {
+                bytesSaved += superseded->getJsonContent().size();
+            }
+            eventCount += held.superseded.size();
+            held.request->addObserver(std::make_shared<SupersededRequestsObserver>(std::move(held.superseded)));
+        }
+    }
+    for (auto& held : m_heldRequests) {
+        m_outgoing.push_back(std::move(held.request));
+    }
+    m_heldRequests.clear();
+
+    if (eventCount > 0) {
+        ACSDK_DEBUG5(LX("eventsCoalesced").d("eventCount", eventCount).d("bytesSaved", bytesSaved));
+    }
+    submitEventsCoalescedMetric(m_metricRecorder, eventCount, bytesSaved);
+}
+
+void EventCoalescer::sendOutgoing(std::unique_lock<std::mutex>& lock) {
+    if (m_isSending) {
+        return;
+    }
+
+    m_isSending = true;
+    m_sendingThreadId = std::this_thread::get_id();
+    while (!m_outgoing.empty()) {
+        std::vector<std::shared_ptr<MessageRequest>> outgoing;
+        outgoing.swap(m_outgoing);
+        lock.unlock();
+        for (auto& request : outgoing) {
+            m_sendFunction(std::move(request));
+        }
+        lock.lock();
+    }
+    m_isSending = false;
+    m_sendTrigger.notify_all();
+}
+
+void EventCoalescer::waitForOutgoing(std::unique_lock<std::mutex>& lock) {
+    if (m_isSending && m_sendingThreadId == std::this_thread::get_id()) {
+        // Called back from the send function: the requests are passed on when it returns.
+        return;
+    }
+    m_sendTrigger.wait(lock, [this] { return !m_isSending; });
+}
+
+void EventCoalescer::windowLoop() {
+    std::unique_lock<std::mutex> lock{m_mutex};
+    while (!m_isShutdown) {
+        if (m_heldRequests.empty()) {
+            m_wakeTrigger.wait(lock, [this] { return m_isShutdown || !m_heldRequests.empty(); });
+        } else if (std::chrono::steady_clock::now() < m_windowEnd) {
+            m_wakeTrigger.wait_until(lock, m_windowEnd);
+        } else {
+            flushLocked();
+            sendOutgoing(lock);
+        }
+    }
+}
+
+}  // namespace acl
+}  // namespace alexaClientSDK
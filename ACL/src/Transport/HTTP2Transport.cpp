@@ -13,12 +13,14 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
 #include <chrono>
 #include <functional>
 
 #include <AVSCommon/Utils/Error/FinallyGuard.h>
 #include <AVSCommon/Utils/HTTP2/HTTP2MimeRequestEncoder.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
+#include <AVSCommon/Utils/Metrics/AggregatingMetricRecorder.h>
 #include <AVSCommon/Utils/Metrics/MetricEventBuilder.h>
 #include <AVSCommon/Utils/Metrics/DataPointCounterBuilder.h>
 #include <AVSCommon/Utils/Power/PowerMonitor.h>
@@ -82,75 +84,11 @@ static const std::string MESSAGE_SEND_ERROR = "ERROR.MESSAGE_SEND_FAILED";
 /// Metric identifier for disconnect reason.
 static const std::string DISCONNECT_REASON = "DISCONNECT_REASON";
 
-/**
- * Capture metric for Disconnects along with Disconnect reason.
- *
- * @param metricRecorder The metric recorder object.
- * @param reason The @c ConnectionStatusObserverInterface::ChangedReason for disconnection.
- */
-static void submitDisconnectReasonMetric(
-    const std::shared_ptr<MetricRecorderInterface>& metricRecorder,
-    ConnectionStatusObserverInterface::ChangedReason reason) {
-    if (!metricRecorder) {
-        return;
-    }
-
-    if (ConnectionStatusObserverInterface::ChangedReason::SUCCESS == reason ||
-        ConnectionStatusObserverInterface::ChangedReason::ACL_CLIENT_REQUEST == reason) {
-        return;
-    }
-
-    std::stringstream ss;
-    ss << reason;
-
-    auto metricEvent = MetricEventBuilder{}
-                           .setActivityName(HTTP2TRANSPORT_METRIC_SOURCE_PREFIX + DISCONNECT_REASON)
-                           .addDataPoint(DataPointCounterBuilder{}.setName(ss.str()).increment(1).build())
-                           .build();
-
-    if (!metricEvent) {
-        ACSDK_ERROR(LX("submitDisconnectReasonMetricFailed").d("reason", "invalid metric event"));
-        return;
-    }
-
-    recordMetric(metricRecorder, metricEvent);
-}
-
-/**
- * Capture metric for cases where there are internal message send errors or timeouts.
- *
- * @param metricRecorder The metric recorder object.
- * @param status The @c MessageRequestObserverInterface::Status of the message.
- */
-static void submitMessageSendErrorMetric(
-    const std::shared_ptr<MetricRecorderInterface>& metricRecorder,
-    MessageRequestObserverInterface::Status status) {
-    if (!metricRecorder) {
-        return;
-    }
-
-    std::stringstream ss;
-    switch (status) {
-        case MessageRequestObserverInterface::Status::INTERNAL_ERROR:
-        case MessageRequestObserverInterface::Status::TIMEDOUT:
-            ss << status;
-            break;
-        default:
-            return;
-    }
+/// The last @c ConnectionStatusObserverInterface::ChangedReason value, used to size the disconnect reason counters.
+static const auto LAST_CHANGED_REASON = ConnectionStatusObserverInterface::ChangedReason::SERVER_ENDPOINT_CHANGED;
 
-    auto metricEvent = MetricEventBuilder{}
-                           .setActivityName(HTTP2TRANSPORT_METRIC_SOURCE_PREFIX + MESSAGE_SEND_ERROR)
-                           .addDataPoint(DataPointCounterBuilder{}.setName(ss.str()).increment(1).build())
-                           .build();
-
-    if (!metricEvent) {
-        ACSDK_ERROR(LX("submitMessageSendErrorMetricFailed").d("reason", "invalid metric event"));
-        return;
-    }
-
-    recordMetric(metricRecorder, metricEvent);
-}
+/// The last @c MessageRequestObserverInterface::Status value, used to size the message send error counters.
+static const auto LAST_STATUS = MessageRequestObserverInterface::Status::SERVER_OTHER_ERROR;
 
 /**
  * Write a @c HTTP2Transport::State value to an @c ostream as a string.
@@ -183,7 +121,9 @@ std::ostream& operator<<(std::ostream& stream, HTTP2Transport::State state) {
     return stream << "";
 }
 
-HTTP2Transport::Configuration::Configuration() : inactivityTimeout{INACTIVITY_TIMEOUT} {
+HTTP2Transport::Configuration::Configuration() :
+        inactivityTimeout{INACTIVITY_TIMEOUT},
+        maxSerializedMessagesInFlight{1} {
 }
 
 std::shared_ptr<HTTP2Transport> HTTP2Transport::create(
@@ -285,9 +225,38 @@ HTTP2Transport::HTTP2Transport(
         m_countOfUnfinishedMessageHandlers{0},
         m_postConnected{false},
         m_configuration{configuration},
+        m_maxSerializedMessagesInFlight{std::min(
+            static_cast<size_t>(std::max(configuration.maxSerializedMessagesInFlight, 1u)),
+            static_cast<size_t>(MAX_MESSAGE_HANDLERS))},
+        m_nextPipelineSequence{0},
         m_disconnectReason{ConnectionStatusObserverInterface::ChangedReason::NONE} {
     m_observers.insert(transportObserver);
 
+    // Register the aggregated counters up front, so that counting them does not look up their names.
+    m_aggregatingMetricRecorder = std::dynamic_pointer_cast<AggregatingMetricRecorder>(m_metricRecorder);
+    if (m_aggregatingMetricRecorder) {
+        for (int i = 0; i <= static_cast<int>(LAST_CHANGED_REASON); ++i) {
+            std::stringstream ss;
+            ss << static_cast<ConnectionStatusObserverInterface::ChangedReason>(i);
+            m_disconnectReasonCounters.push_back(m_aggregatingMetricRecorder->getCounter(
+                HTTP2TRANSPORT_METRIC_SOURCE_PREFIX + DISCONNECT_REASON, ss.str()));
+        }
+        m_messageSendErrorCounters.resize(
+            static_cast<size_t>(LAST_STATUS) + 1, AggregatingMetricRecorder::INVALID_METRIC_ID);
+        for (auto status :
+             {MessageRequestObserverInterface::Status::INTERNAL_ERROR, MessageRequestObserverInterface::Status::TIMEDOUT}) {
+            std::stringstream ss;
+            ss << status;
+            m_messageSendErrorCounters[static_cast<size_t>(status)] = m_aggregatingMetricRecorder->getCounter(
+                HTTP2TRANSPORT_METRIC_SOURCE_PREFIX + MESSAGE_SEND_ERROR, ss.str());
+        }
+    }
+
+    if (m_maxSerializedMessagesInFlight > 1) {
+        ACSDK_INFO(LX_P("pipeliningEnabled").d("maxSerializedMessagesInFlight", m_maxSerializedMessagesInFlight));
+        m_sharedRequestQueue->setMaxSerializedRequestsInFlight(m_maxSerializedMessagesInFlight);
+    }
+
     m_mainLoopPowerResource = PowerMonitor::getInstance()->createLocalPowerResource(TAG + "_mainLoop");
 
     m_requestActivityPowerResource =
@@ -420,7 +389,7 @@ void HTTP2Transport::sendMessage(std::shared_ptr<MessageRequest> request) {
         lock.unlock();
         auto status = MessageRequestObserverInterface::Status::NOT_CONNECTED;
         request->sendCompleted(status);
-        submitMessageSendErrorMetric(m_metricRecorder, status);
+        submitMessageSendErrorMetric(status);
     }
 }
 
@@ -566,6 +535,11 @@ void HTTP2Transport::onMessageRequestSent(const std::shared_ptr<avsCommon::avs::
     std::lock_guard<std::mutex> lock(m_mutex);
     if (request->getIsSerialized()) {
         m_sharedRequestQueue->setWaitingForSendAcknowledgement();
+        // Only requests from the shared queue are tracked; post-connect requests are never sent again.
+        if (m_maxSerializedMessagesInFlight > 1 && State::CONNECTED == m_state) {
+            m_pipelinedRequests.push_back(
+                {m_nextPipelineSequence++, request, MessageRequestObserverInterface::Status::PENDING});
+        }
     }
     m_countOfUnfinishedMessageHandlers++;
     ACSDK_DEBUG7(
@@ -580,11 +554,48 @@ void HTTP2Transport::onMessageRequestTimeout() {
 
 void HTTP2Transport::onMessageRequestAcknowledged(const std::shared_ptr<avsCommon::avs::MessageRequest>& request) {
     ACSDK_DEBUG7(LX_P("onMessageRequestAcknowledged"));
+    std::shared_ptr<PipelinedRequest> failedRequest;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (request->getIsSerialized()) {
+            m_sharedRequestQueue->clearWaitingForSendAcknowledgement();
+            failedRequest = removePipelinedRequestLocked(request);
+        }
+        m_wakeEvent.notifyAll();
+    }
+
+    if (failedRequest) {
+        failedRequest->request->responseStatusReceived(failedRequest->status);
+        failedRequest->request->sendCompleted(failedRequest->status);
+        submitMessageSendErrorMetric(failedRequest->status);
+    }
+}
+
+bool HTTP2Transport::onMessageRequestFailedWithoutResponse(
+    const std::shared_ptr<avsCommon::avs::MessageRequest>& request,
+    MessageRequestObserverInterface::Status status) {
+    if (!request->getIsSerialized()) {
+        return false;
+    }
+
     std::lock_guard<std::mutex> lock(m_mutex);
-    if (request->getIsSerialized()) {
-        m_sharedRequestQueue->clearWaitingForSendAcknowledgement();
+    auto it = std::find_if(
+        m_pipelinedRequests.begin(), m_pipelinedRequests.end(), [&request](const PipelinedRequest& pipelined) {
+            return pipelined.request == request;
+        });
+    if (it == m_pipelinedRequests.end()) {
+        return false;
     }
-    m_wakeEvent.notifyAll();
+
+    ACSDK_DEBUG5(LX_P("onMessageRequestFailedWithoutResponse").d("sequence", it->sequence).d("status", status));
+    if (m_failedPipelinedRequests.empty()) {
+        // Requests sent after this one may fail too.  Hold back serialized requests until they have all finished,
+        // so that any that need to be sent again go out before anything newer.
+        m_sharedRequestQueue->setMaxSerializedRequestsInFlight(0);
+    }
+    it->status = status;
+    m_failedPipelinedRequests.push_back(*it);
+    return true;
 }
 
 void HTTP2Transport::onMessageRequestFinished() {
@@ -787,8 +798,7 @@ HTTP2Transport::State HTTP2Transport::handleConnected() {
 HTTP2Transport::State HTTP2Transport::handleServerSideDisconnect() {
     ACSDK_INFO(LX_P("handleServerSideDisconnect"));
     notifyObserversOnServerSideDisconnect();
-    submitDisconnectReasonMetric(
-        m_metricRecorder, ConnectionStatusObserverInterface::ChangedReason::SERVER_SIDE_DISCONNECT);
+    submitDisconnectReasonMetric(ConnectionStatusObserverInterface::ChangedReason::SERVER_SIDE_DISCONNECT);
     return State::DISCONNECTING;
 }
 
@@ -809,7 +819,7 @@ HTTP2Transport::State HTTP2Transport::handleShutdown() {
         std::lock_guard<std::mutex> lock(m_mutex);
 
         // Flags are stored in the shared queue but the local request queue is drained.
-        m_sharedRequestQueue->clearWaitingForSendAcknowledgement();
+        m_sharedRequestQueue->resetWaitingForSendAcknowledgement();
         while (!m_requestQueue.empty()) {
             auto request = m_requestQueue.dequeueOldestRequest();
             if (request != nullptr) {
@@ -823,7 +833,7 @@ HTTP2Transport::State HTTP2Transport::handleShutdown() {
     m_http2Connection->disconnect();
 
     notifyObserversOnDisconnect(m_disconnectReason);
-    submitDisconnectReasonMetric(m_metricRecorder, m_disconnectReason);
+    submitDisconnectReasonMetric(m_disconnectReason);
 
     return State::SHUTDOWN;
 }
@@ -851,7 +861,7 @@ HTTP2Transport::State HTTP2Transport::monitorSharedQueueWhileWaiting(
             auto request = m_sharedRequestQueue->dequeueOldestRequest();
             auto status = MessageRequestObserverInterface::Status::TIMEDOUT;
             request->sendCompleted(status);
-            submitMessageSendErrorMetric(m_metricRecorder, status);
+            submitMessageSendErrorMetric(status);
         }
 
         auto messageRequestTime = m_sharedRequestQueue->peekRequestTime();
@@ -916,7 +926,7 @@ HTTP2Transport::State HTTP2Transport::sendMessagesAndPings(
                 if (!handler) {
                     auto status = MessageRequestObserverInterface::Status::INTERNAL_ERROR;
                     messageRequest->sendCompleted(status);
-                    submitMessageSendErrorMetric(m_metricRecorder, status);
+                    submitMessageSendErrorMetric(status);
                 }
             } else {
                 ACSDK_ERROR(LX_P("failedToCreateMessageHandler").d("reason", "invalidAuth"));
@@ -1072,10 +1082,115 @@ void HTTP2Transport::notifyObserversOnServerSideDisconnect() {
     }
 }
 
+std::shared_ptr<HTTP2Transport::PipelinedRequest> HTTP2Transport::removePipelinedRequestLocked(
+    const std::shared_ptr<avsCommon::avs::MessageRequest>& request) {
+    auto it = std::find_if(
+        m_pipelinedRequests.begin(), m_pipelinedRequests.end(), [&request](const PipelinedRequest& pipelined) {
+            return pipelined.request == request;
+        });
+    if (it == m_pipelinedRequests.end()) {
+        return nullptr;
+    }
+    m_pipelinedRequests.erase(it);
+
+    if (!m_pipelinedRequests.empty() || m_failedPipelinedRequests.empty()) {
+        return nullptr;
+    }
+
+    std::sort(
+        m_failedPipelinedRequests.begin(),
+        m_failedPipelinedRequests.end(),
+        [](const PipelinedRequest& lhs, const PipelinedRequest& rhs) { return lhs.sequence < rhs.sequence; });
+
+    // The earliest failure is reported as it would have been without pipelining.  The requests sent after it would
+    // still have been waiting in the queue, so they are sent again.
+    auto failedRequest = std::make_shared<PipelinedRequest>(m_failedPipelinedRequests.front());
+    std::vector<std::shared_ptr<MessageRequest>> replayRequests;
+    for (auto replayIt = m_failedPipelinedRequests.begin() + 1; replayIt != m_failedPipelinedRequests.end();
+         replayIt++) {
+        replayRequests.push_back(replayIt->request);
+    }
+    m_failedPipelinedRequests.clear();
+
+    ACSDK_INFO(LX_P("replayingPipelinedRequests")
+                   .d("failedSequence", failedRequest->sequence)
+                   .d("count", replayRequests.size()));
+    m_sharedRequestQueue->requeueRequests(replayRequests);
+    m_sharedRequestQueue->setMaxSerializedRequestsInFlight(m_maxSerializedMessagesInFlight);
+    m_wakeEvent.notifyAll();
+
+    return failedRequest;
+}
+
 HTTP2Transport::State HTTP2Transport::getState() {
     std::lock_guard<std::mutex> lock(m_mutex);
     return m_state;
 }
 
+void HTTP2Transport::submitDisconnectReasonMetric(ConnectionStatusObserverInterface::ChangedReason reason) {
+    if (!m_metricRecorder) {
+        return;
+    }
+
+    if (ConnectionStatusObserverInterface::ChangedReason::SUCCESS == reason ||
+        ConnectionStatusObserverInterface::ChangedReason::ACL_CLIENT_REQUEST == reason) {
+        return;
+    }
+
+    if (m_aggregatingMetricRecorder) {
+        m_aggregatingMetricRecorder->increment(m_disconnectReasonCounters[static_cast<size_t>(reason)]);
+        return;
+    }
+
+    std::stringstream ss;
+    ss << reason;
+
+    auto metricEvent = MetricEventBuilder{}
+                           .setActivityName(HTTP2TRANSPORT_METRIC_SOURCE_PREFIX + DISCONNECT_REASON)
+                           .addDataPoint(DataPointCounterBuilder{}.setName(ss.str()).increment(1).build())
+                           .build();
+
+    if (!metricEvent) {
+        ACSDK_ERROR(LX("submitDisconnectReasonMetricFailed").d("reason", "invalid metric event"));
+        return;
+    }
+
+    recordMetric(m_metricRecorder, metricEvent);
+}
+
+void HTTP2Transport::submitMessageSendErrorMetric(MessageRequestObserverInterface::Status status) {
+    if (!m_metricRecorder) {
+        return;
+    }
+
+    switch (status) {
+        case MessageRequestObserverInterface::Status::INTERNAL_ERROR:
+        case MessageRequestObserverInterface::Status::TIMEDOUT:
+            break;
+        default:
+            return;
+    }
+
+    if (m_aggregatingMetricRecorder) {
+        m_aggregatingMetricRecorder->increment(m_messageSendErrorCounters[static_cast<size_t>(status)]);
+        return;
+    }
+
+    std::stringstream ss;
+    ss << status;
+
+    auto metricEvent = MetricEventBuilder{}
+                           .setActivityName(HTTP2TRANSPORT_METRIC_SOURCE_PREFIX + MESSAGE_SEND_ERROR)
+                           .addDataPoint(DataPointCounterBuilder{}.setName(ss.str()).increment(1).build())
+                           .build();
+
+    if (!metricEvent) {
+        ACSDK_ERROR(LX("submitMessageSendErrorMetricFailed").d("reason", "invalid metric event"));
+        return;
+    }
+
+    recordMetric(m_metricRecorder, metricEvent);
+}
+
 }  // namespace acl
 }  // namespace alexaClientSDK
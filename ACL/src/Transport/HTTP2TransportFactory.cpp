@@ -15,6 +15,7 @@
 
 #include <AVSCommon/Utils/Threading/Executor.h>
 #include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
+#include <AVSCommon/Utils/Metrics/AggregatingMetricRecorder.h>
 
 #include "ACL/Transport/HTTP2TransportFactory.h"
 #include "ACL/Transport/HTTP2Transport.h"
@@ -36,6 +37,33 @@ static const std::string TAG("HTTP2TransportFactory");
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
+/// Name of the root configuration node for @c HTTP2Transport.
+static const std::string HTTP2_TRANSPORT_CONFIG_KEY = "http2Transport";
+
+/// Name of the @c HTTP2Transport::Configuration::maxSerializedMessagesInFlight value in the configuration.
+static const std::string MAX_SERIALIZED_MESSAGES_IN_FLIGHT_KEY = "maxSerializedMessagesInFlight";
+
+/**
+ * Wrap a metric recorder in an @c AggregatingMetricRecorder, so that the disconnect reason and message send error
+ * counters of the transports are aggregated before they reach the sinks.  Other metrics, such as the per-event timing
+ * markers, are passed through to the sinks as they are recorded.
+ *
+ * @param metricRecorder The metric recorder to wrap.
+ * @return The wrapping @c AggregatingMetricRecorder, or @c metricRecorder if it is null or could not be wrapped.
+ */
+static std::shared_ptr<metrics::MetricRecorderInterface> aggregateMetrics(
+    std::shared_ptr<metrics::MetricRecorderInterface> metricRecorder) {
+    if (!metricRecorder || std::dynamic_pointer_cast<metrics::AggregatingMetricRecorder>(metricRecorder)) {
+        return metricRecorder;
+    }
+    auto aggregatingRecorder = metrics::AggregatingMetricRecorder::create(metricRecorder);
+    if (!aggregatingRecorder) {
+        ACSDK_WARN(LX("aggregateMetricsFailed").d("reason", "createAggregatingMetricRecorderFailed"));
+        return metricRecorder;
+    }
+    return aggregatingRecorder;
+}
+
 std::shared_ptr<TransportFactoryInterface> HTTP2TransportFactory::createTransportFactoryInterface(
     const std::shared_ptr<avsCommon::utils::http2::HTTP2ConnectionFactoryInterface>& connectionFactory,
     const std::shared_ptr<PostConnectFactoryInterface>& postConnectFactory,
@@ -64,6 +92,20 @@ std::shared_ptr<TransportInterface> HTTP2TransportFactory::createTransport(
         return nullptr;
     }
 
+    HTTP2Transport::Configuration configuration;
+    int maxSerializedMessagesInFlight = 0;
+    configuration::ConfigurationNode::getRoot()[HTTP2_TRANSPORT_CONFIG_KEY].getInt(
+        MAX_SERIALIZED_MESSAGES_IN_FLIGHT_KEY,
+        &maxSerializedMessagesInFlight,
+        static_cast<int>(configuration.maxSerializedMessagesInFlight));
+    if (maxSerializedMessagesInFlight > 0) {
+        configuration.maxSerializedMessagesInFlight = static_cast<unsigned int>(maxSerializedMessagesInFlight);
+    } else {
+        ACSDK_WARN(LX("createTransport")
+                       .d("reason", "invalidMaxSerializedMessagesInFlight")
+                       .d("value", maxSerializedMessagesInFlight));
+    }
+
     return HTTP2Transport::create(
         authDelegate,
         avsGateway,
@@ -73,7 +115,7 @@ std::shared_ptr<TransportInterface> HTTP2TransportFactory::createTransport(
         transportObserverInterface,
         m_postConnectFactory,
         sharedMessageRequestQueue,
-        HTTP2Transport::Configuration(),
+        configuration,
         m_metricRecorder,
         m_eventTracer);
 }
@@ -85,7 +127,7 @@ HTTP2TransportFactory::HTTP2TransportFactory(
     std::shared_ptr<avsCommon::sdkInterfaces::EventTracerInterface> eventTracer) :
         m_connectionFactory{std::move(connectionFactory)},
         m_postConnectFactory{std::move(postConnectFactory)},
-        m_metricRecorder{std::move(metricRecorder)},
+        m_metricRecorder{aggregateMetrics(std::move(metricRecorder))},
         m_eventTracer{eventTracer} {
 }
 
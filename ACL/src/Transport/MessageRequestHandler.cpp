@@ -180,23 +180,25 @@ void MessageRequestHandler::recordStreamMetric(int bytes) {
         return;
     }
     m_streamBytesRead += bytes;
-    std::string metricName{m_messageRequest->getStreamMetricName()};
+    // This is called for every chunk of the stream, so only copy the metric name once the threshold is reached.
     auto threshold = m_messageRequest->getStreamBytesThreshold();
-    if (metricName == "" || threshold == 0) {
+    if (threshold == 0 || threshold > m_streamBytesRead) {
         return;
     }
-    if (threshold <= m_streamBytesRead) {
-        auto metricEvent = MetricEventBuilder{}
-                               .setActivityName(ACL_METRIC_SOURCE_PREFIX + metricName)
-                               .addDataPoint(DataPointCounterBuilder{}.setName(metricName).increment(1).build())
-                               .build();
-        if (!metricEvent) {
-            ACSDK_ERROR(LX("recordStreamMetric").m("submitMetricFailed").d("reason", "invalid metric event"));
-            return;
-        }
-        recordMetric(m_metricRecorder, metricEvent);
-        m_recordedStreamMetric = true;
+    std::string metricName{m_messageRequest->getStreamMetricName()};
+    if (metricName == "") {
+        return;
     }
+    auto metricEvent = MetricEventBuilder{}
+                           .setActivityName(ACL_METRIC_SOURCE_PREFIX + metricName)
+                           .addDataPoint(DataPointCounterBuilder{}.setName(metricName).increment(1).build())
+                           .build();
+    if (!metricEvent) {
+        ACSDK_ERROR(LX("recordStreamMetric").m("submitMetricFailed").d("reason", "invalid metric event"));
+        return;
+    }
+    recordMetric(m_metricRecorder, metricEvent);
+    m_recordedStreamMetric = true;
 }
 
 void MessageRequestHandler::recordStartOfEventMetric() {
@@ -340,6 +342,17 @@ std::vector<std::string> MessageRequestHandler::getRequestHeaderLines() {
     return result;
 }
 
+bool MessageRequestHandler::setDataAvailableCallback(std::function<void()> callback) {
+    bool result = true;
+    for (int i = 0; i < m_messageRequest->attachmentReadersCount(); ++i) {
+        auto namedReader = m_messageRequest->getAttachmentReader(i);
+        if (namedReader && namedReader->reader && !namedReader->reader->setDataAvailableCallback(callback)) {
+            result = false;
+        }
+    }
+    return result;
+}
+
 HTTP2GetMimeHeadersResult MessageRequestHandler::getMimePartHeaderLines() {
     ACSDK_DEBUG9(LX("getMimePartHeaderLines"));
 
@@ -469,13 +482,6 @@ void MessageRequestHandler::onResponseFinished(HTTP2ResponseFinishedStatus statu
         m_context->onMessageRequestTimeout();
     }
 
-    reportMessageRequestAcknowledged();
-    reportMessageRequestFinished();
-
-    if ((intToHTTPResponseCode(m_responseCode) != HTTPResponseCode::SUCCESS_OK) && !nonMimeBody.empty()) {
-        m_messageRequest->exceptionReceived(nonMimeBody);
-    }
-
     bool receivedResponseCode = MessageRequestObserverInterface::Status::PENDING != m_resultStatus;
 
     // Map HTTP2ResponseFinishedStatus to a MessageRequestObserverInterface::Status.
@@ -500,6 +506,21 @@ void MessageRequestHandler::onResponseFinished(HTTP2ResponseFinishedStatus statu
             m_resultStatus = MessageRequestObserverInterface::Status::INTERNAL_ERROR;
     }
 
+    // Let the context decide what to do with a request AVS never answered before reporting it acknowledged.
+    if (!receivedResponseCode && m_context->onMessageRequestFailedWithoutResponse(m_messageRequest, m_resultStatus)) {
+        ACSDK_DEBUG7(LX("onResponseFinished").m("handedOverToContext"));
+        reportMessageRequestAcknowledged();
+        reportMessageRequestFinished();
+        return;
+    }
+
+    reportMessageRequestAcknowledged();
+    reportMessageRequestFinished();
+
+    if ((intToHTTPResponseCode(m_responseCode) != HTTPResponseCode::SUCCESS_OK) && !nonMimeBody.empty()) {
+        m_messageRequest->exceptionReceived(nonMimeBody);
+    }
+
     if (!receivedResponseCode) {
         m_messageRequest->responseStatusReceived(m_resultStatus);
     }
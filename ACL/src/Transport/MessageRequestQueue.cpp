@@ -33,7 +33,9 @@ static const std::string TAG("MessageRequestQueue");
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
-MessageRequestQueue::MessageRequestQueue() : m_isWaitingForAcknowledgement{false} {
+MessageRequestQueue::MessageRequestQueue() :
+        m_countOfSerializedRequestsInFlight{0},
+        m_maxSerializedRequestsInFlight{1} {
 }
 
 void MessageRequestQueue::enqueueRequest(std::shared_ptr<MessageRequest> messageRequest) {
@@ -64,7 +66,7 @@ std::shared_ptr<MessageRequest> MessageRequestQueue::dequeueOldestRequest() {
 
 std::shared_ptr<avsCommon::avs::MessageRequest> MessageRequestQueue::dequeueSendableRequest() {
     for (auto it = m_queue.begin(); it != m_queue.end(); it++) {
-        if (!m_isWaitingForAcknowledgement || !it->second->getIsSerialized()) {
+        if (canSendSerializedRequest() || !it->second->getIsSerialized()) {
             auto result = it->second;
             m_queue.erase(it);
             return result;
@@ -75,7 +77,7 @@ std::shared_ptr<avsCommon::avs::MessageRequest> MessageRequestQueue::dequeueSend
 
 bool MessageRequestQueue::isMessageRequestAvailable() const {
     for (auto it = m_queue.begin(); it != m_queue.end(); it++) {
-        if (!m_isWaitingForAcknowledgement || !it->second->getIsSerialized()) {
+        if (canSendSerializedRequest() || !it->second->getIsSerialized()) {
             return true;
         }
     }
@@ -83,11 +85,36 @@ bool MessageRequestQueue::isMessageRequestAvailable() const {
 }
 
 void MessageRequestQueue::setWaitingForSendAcknowledgement() {
-    m_isWaitingForAcknowledgement = true;
+    m_countOfSerializedRequestsInFlight++;
 }
 
 void MessageRequestQueue::clearWaitingForSendAcknowledgement() {
-    m_isWaitingForAcknowledgement = false;
+    if (m_countOfSerializedRequestsInFlight > 0) {
+        m_countOfSerializedRequestsInFlight--;
+    }
+}
+
+void MessageRequestQueue::resetWaitingForSendAcknowledgement() {
+    m_countOfSerializedRequestsInFlight = 0;
+}
+
+void MessageRequestQueue::setMaxSerializedRequestsInFlight(size_t maxRequests) {
+    m_maxSerializedRequestsInFlight = maxRequests;
+}
+
+void MessageRequestQueue::requeueRequests(const std::vector<std::shared_ptr<MessageRequest>>& messageRequests) {
+    auto now = std::chrono::steady_clock::now();
+    for (auto it = messageRequests.rbegin(); it != messageRequests.rend(); it++) {
+        if (*it != nullptr) {
+            m_queue.push_front({now, *it});
+        } else {
+            ACSDK_ERROR(LX("requeueRequests").d("reason", "nullMessageRequest"));
+        }
+    }
+}
+
+bool MessageRequestQueue::canSendSerializedRequest() const {
+    return m_countOfSerializedRequestsInFlight < m_maxSerializedRequestsInFlight;
 }
 
 bool MessageRequestQueue::empty() const {
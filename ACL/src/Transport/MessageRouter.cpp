@@ -16,6 +16,7 @@
 #include <algorithm>
 #include <curl/curl.h>
 
+#include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
 #include <AVSCommon/Utils/Memory/Memory.h>
 #include <AVSCommon/Utils/Threading/Executor.h>
@@ -38,6 +39,12 @@ static constexpr const char* KEY_SIZEOF_TRANSPORTS = "sizeOf m_transports";
 
 const std::chrono::milliseconds MessageRouter::DEFAULT_SERVER_SIDE_DISCONNECT_GRACE_PERIOD(15000);
 
+/// Name of the root configuration node for @c MessageRouter.
+static const std::string MESSAGE_ROUTER_CONFIG_KEY = "messageRouter";
+
+/// Name of the event coalescing window value in the configuration.
+static const std::string EVENT_COALESCING_WINDOW_KEY = "eventCoalescingWindowMs";
+
 /**
  * Create a LogEntry using this file's TAG and the specified event string.
  *
@@ -49,7 +56,8 @@ std::shared_ptr<MessageRouterInterface> MessageRouter::createMessageRouterInterf
     const std::shared_ptr<acsdkShutdownManagerInterfaces::ShutdownNotifierInterface>& shutdownNotifier,
     const std::shared_ptr<avsCommon::sdkInterfaces::AuthDelegateInterface>& authDelegate,
     const std::shared_ptr<avsCommon::avs::attachment::AttachmentManagerInterface>& attachmentManager,
-    const std::shared_ptr<TransportFactoryInterface>& transportFactory) {
+    const std::shared_ptr<TransportFactoryInterface>& transportFactory,
+    const std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface>& metricRecorder) {
     if (!shutdownNotifier) {
         ACSDK_ERROR(LX("createMessageRouterInterfaceFailed").d("reason", "nullShutdownNotifier"));
         return nullptr;
@@ -66,7 +74,26 @@ std::shared_ptr<MessageRouterInterface> MessageRouter::createMessageRouterInterf
         ACSDK_ERROR(LX("createMessageRouterInterfaceFailed").d("reason", "nullTransportFactory"));
         return nullptr;
     }
-    auto messageRouter = std::make_shared<MessageRouter>(authDelegate, attachmentManager, transportFactory);
+
+    std::chrono::milliseconds eventCoalescingWindow;
+    configuration::ConfigurationNode::getRoot()[MESSAGE_ROUTER_CONFIG_KEY].getDuration<std::chrono::milliseconds>(
+        EVENT_COALESCING_WINDOW_KEY, &eventCoalescingWindow, std::chrono::milliseconds::zero());
+    if (eventCoalescingWindow < std::chrono::milliseconds::zero()) {
+        ACSDK_WARN(LX("createMessageRouterInterface")
+                       .d("reason", "invalidEventCoalescingWindow")
+                       .d("value", eventCoalescingWindow.count()));
+        eventCoalescingWindow = std::chrono::milliseconds::zero();
+    }
+
+    auto messageRouter = std::make_shared<MessageRouter>(
+        authDelegate,
+        attachmentManager,
+        transportFactory,
+        "",
+        ENGINE_TYPE_ALEXA_VOICE_SERVICES,
+        DEFAULT_SERVER_SIDE_DISCONNECT_GRACE_PERIOD,
+        eventCoalescingWindow,
+        metricRecorder);
     shutdownNotifier->addObserver(messageRouter);
     return messageRouter;
 }
@@ -77,7 +104,9 @@ MessageRouter::MessageRouter(
     std::shared_ptr<TransportFactoryInterface> transportFactory,
     const std::string& avsGateway,
     int engineType,
-    std::chrono::milliseconds serverSideDisconnectGracePeriod) :
+    std::chrono::milliseconds serverSideDisconnectGracePeriod,
+    std::chrono::milliseconds eventCoalescingWindow,
+    std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder) :
         MessageRouterInterface{"MessageRouter"},
         m_avsGateway{avsGateway},
         m_authDelegate{authDelegate},
@@ -91,6 +120,13 @@ MessageRouter::MessageRouter(
         m_serverSideDisconnectNotificationPending{false},
         m_lastReportedConnectionStatus{ConnectionStatusObserverInterface::Status::DISCONNECTED},
         m_serverSideReconnectGracePeriod{serverSideDisconnectGracePeriod} {
+    if (eventCoalescingWindow > std::chrono::milliseconds::zero()) {
+        ACSDK_INFO(LX("eventCoalescingEnabled").d("windowMs", eventCoalescingWindow.count()));
+        m_eventCoalescer = avsCommon::utils::memory::make_unique<EventCoalescer>(
+            eventCoalescingWindow,
+            [this](std::shared_ptr<MessageRequest> request) { enqueueRequest(request); },
+            std::move(metricRecorder));
+    }
 }
 
 MessageRouterInterface::ConnectionStatus MessageRouter::getConnectionStatus() {
@@ -120,6 +156,9 @@ void MessageRouter::enable() {
 }
 
 void MessageRouter::doShutdown() {
+    if (m_eventCoalescer) {
+        m_eventCoalescer->shutdown();
+    }
     disable();
     // The above call will release all the transports. If m_requestQueue is non-empty once all of the transports
     // have been released, any outstanding MessageRequest instances must receive an onCompleted(NOT_CONNECTED)
@@ -155,6 +194,14 @@ void MessageRouter::sendMessage(std::shared_ptr<MessageRequest> request) {
         return;
     }
 
+    if (m_eventCoalescer) {
+        m_eventCoalescer->submit(request);
+    } else {
+        enqueueRequest(request);
+    }
+}
+
+void MessageRouter::enqueueRequest(std::shared_ptr<MessageRequest> request) {
     std::unique_lock<std::mutex> lock{m_connectionMutex};
     if (m_activeTransport) {
         m_requestQueue->enqueueRequest(request);
@@ -66,19 +66,31 @@ static const std::string TAG("MimeResponseSink");
  * @param mimeContentId The raw content ID value in MIME header.
  * @return The sanitized content ID.
  */
-static std::string sanitizeContentId(const std::string& mimeContentId) {
+static std::string sanitizeContentId(const HTTP2MimePartHeaders::Text& mimeContentId) {
     std::string sanitizedContentId;
-    if (mimeContentId.empty()) {
+    if (0 == mimeContentId.size) {
         ACSDK_ERROR(LX("sanitizeContentIdFailed").d("reason", "emptyMimeContentId"));
-    } else if (('<' == mimeContentId.front()) && ('>' == mimeContentId.back())) {
+    } else if (
+        mimeContentId.size >= 2 && ('<' == mimeContentId.data[0]) &&
+        ('>' == mimeContentId.data[mimeContentId.size - 1])) {
         // Getting attachment ID within angle bracket <>.
-        sanitizedContentId = mimeContentId.substr(1, mimeContentId.size() - 2);
+        sanitizedContentId.assign(mimeContentId.data + 1, mimeContentId.size - 2);
     } else {
-        sanitizedContentId = mimeContentId;
+        sanitizedContentId.assign(mimeContentId.data, mimeContentId.size);
     }
     return sanitizedContentId;
 }
 
+/**
+ * Refer to the value of a header in a multimap, in the form used by @c HTTP2MimePartHeaders.
+ *
+ * @param value The value.
+ * @return A reference to @c value.
+ */
+static HTTP2MimePartHeaders::Text toText(const std::string& value) {
+    return HTTP2MimePartHeaders::Text{value.data(), value.size()};
+}
+
 MimeResponseSink::MimeResponseSink(
     std::shared_ptr<MimeResponseStatusHandlerInterface> handler,
     std::shared_ptr<MessageConsumerInterface> messageConsumer,
@@ -118,28 +130,50 @@ bool MimeResponseSink::onReceiveHeaderLine(const std::string& line) {
 }
 
 bool MimeResponseSink::onBeginMimePart(const std::multimap<std::string, std::string>& headers) {
+    auto contentType = headers.find(MIME_CONTENT_TYPE_FIELD_NAME);
+    if (headers.end() == contentType) {
+        return beginMimePart(nullptr, nullptr);
+    }
+    auto contentTypeText = toText(contentType->second);
+    if (1 != headers.count(MIME_CONTENT_ID_FIELD_NAME)) {
+        return beginMimePart(&contentTypeText, nullptr);
+    }
+    auto contentIdText = toText(headers.find(MIME_CONTENT_ID_FIELD_NAME)->second);
+    return beginMimePart(&contentTypeText, &contentIdText);
+}
+
+bool MimeResponseSink::onBeginMimePartHeaders(const HTTP2MimePartHeaders& headers) {
+    HTTP2MimePartHeaders::Text contentType;
+    if (!headers.find(MIME_CONTENT_TYPE_FIELD_NAME, &contentType)) {
+        return beginMimePart(nullptr, nullptr);
+    }
+    HTTP2MimePartHeaders::Text contentId;
+    if (1 != headers.count(MIME_CONTENT_ID_FIELD_NAME) || !headers.find(MIME_CONTENT_ID_FIELD_NAME, &contentId)) {
+        return beginMimePart(&contentType, nullptr);
+    }
+    return beginMimePart(&contentType, &contentId);
+}
+
+bool MimeResponseSink::beginMimePart(
+    const HTTP2MimePartHeaders::Text* contentType,
+    const HTTP2MimePartHeaders::Text* contentId) {
     ACSDK_DEBUG9(LX("onBeginMimePart"));
 
     if (m_handler) {
         m_handler->onActivity();
     }
 
-    auto it = headers.find(MIME_CONTENT_TYPE_FIELD_NAME);
-    if (headers.end() == it) {
+    if (!contentType) {
         ACSDK_WARN(LX("noContent-Type"));
         return true;
     }
 
-    auto contentType = it->second;
-    if (contentType.find(MIME_JSON_CONTENT_TYPE) != std::string::npos) {
+    if (contentType->contains(MIME_JSON_CONTENT_TYPE)) {
         m_contentType = ContentType::JSON;
         ACSDK_DEBUG9(LX("JsonContentDetected"));
-    } else if (
-        m_attachmentManager && contentType.find(MIME_OCTET_STREAM_CONTENT_TYPE) != std::string::npos &&
-        1 == headers.count(MIME_CONTENT_ID_FIELD_NAME)) {
-        auto iy = headers.find(MIME_CONTENT_ID_FIELD_NAME);
-        auto contentId = sanitizeContentId(iy->second);
-        auto attachmentId = m_attachmentManager->generateAttachmentId(m_attachmentContextId, contentId);
+    } else if (m_attachmentManager && contentType->contains(MIME_OCTET_STREAM_CONTENT_TYPE) && contentId) {
+        auto sanitizedContentId = sanitizeContentId(*contentId);
+        auto attachmentId = m_attachmentManager->generateAttachmentId(m_attachmentContextId, sanitizedContentId);
         if (!m_attachmentWriter && attachmentId != m_attachmentIdBeingReceived) {
             m_attachmentWriter = m_attachmentManager->createWriter(attachmentId);
             if (!m_attachmentWriter) {
@@ -147,11 +181,11 @@ bool MimeResponseSink::onBeginMimePart(const std::multimap<std::string, std::str
                     LX("onBeginMimePartFailed").d("reason", "createWriterFailed").d("attachmentId", attachmentId));
                 return false;
             }
-            ACSDK_DEBUG9(LX("attachmentContentDetected").d("contentId", contentId));
+            ACSDK_DEBUG9(LX("attachmentContentDetected").d("contentId", sanitizedContentId));
         }
         m_contentType = ContentType::ATTACHMENT;
     } else {
-        ACSDK_WARN(LX("unhandledContent-Type").d("Content-Type", contentType));
+        ACSDK_WARN(LX("unhandledContent-Type").d("Content-Type", contentType->str()));
         m_contentType = ContentType::NONE;
     }
     return true;
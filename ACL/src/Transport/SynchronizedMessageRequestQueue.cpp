@@ -34,7 +34,7 @@ static const std::string TAG("SynchronizedMessageRequestQueue");
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
 SynchronizedMessageRequestQueue::~SynchronizedMessageRequestQueue() {
-    clearWaitingForSendAcknowledgement();
+    resetWaitingForSendAcknowledgement();
     clear();
 }
 
@@ -74,6 +74,22 @@ void SynchronizedMessageRequestQueue::clearWaitingForSendAcknowledgement() {
     m_requestQueue.clearWaitingForSendAcknowledgement();
 }
 
+void SynchronizedMessageRequestQueue::resetWaitingForSendAcknowledgement() {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_requestQueue.resetWaitingForSendAcknowledgement();
+}
+
+void SynchronizedMessageRequestQueue::setMaxSerializedRequestsInFlight(size_t maxRequests) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_requestQueue.setMaxSerializedRequestsInFlight(maxRequests);
+}
+
+void SynchronizedMessageRequestQueue::requeueRequests(
+    const std::vector<std::shared_ptr<MessageRequest>>& messageRequests) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_requestQueue.requeueRequests(messageRequests);
+}
+
 bool SynchronizedMessageRequestQueue::empty() const {
     std::lock_guard<std::mutex> lock{m_mutex};
     return m_requestQueue.empty();
@@ -0,0 +1,277 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <ACL/Transport/EventCoalescer.h>
+#include <AVSCommon/AVS/MessageRequest.h>
+#include <AVSCommon/Utils/Metrics/MockMetricRecorder.h>
+
+#include "TestMessageRequestObserver.h"
+
+namespace alexaClientSDK {
+namespace acl {
+namespace test {
+
+using namespace avsCommon::avs;
+using namespace avsCommon::sdkInterfaces;
+using namespace avsCommon::utils::metrics;
+using namespace avsCommon::utils::metrics::test;
+using namespace avsCommon::utils::observer::test;
+using namespace ::testing;
+
+/// A window long enough that it does not end during a test, unless the test waits for it.
+static const std::chrono::milliseconds LONG_WINDOW{60000};
+
+/// A window short enough for a test to wait for it.
+static const std::chrono::milliseconds SHORT_WINDOW{20};
+
+/// How long to wait for something that should happen.
+static const std::chrono::milliseconds WAIT_TIMEOUT{2000};
+
+/// A coalescing key.
+static const std::string KEY_A = "Speaker.VolumeChanged";
+
+/// Another coalescing key.
+static const std::string KEY_B = "EqualizerController.EqualizerChanged";
+
+/// Test harness for @c EventCoalescer.
+class EventCoalescerTest : public Test {
+protected:
+    void TearDown() override;
+
+    /**
+     * Create the coalescer under test.
+     *
+     * @param window The coalescing window.
+     */
+    void createCoalescer(std::chrono::milliseconds window);
+
+    /**
+     * Create a request.
+     *
+     * @param content The JSON content of the request.
+     * @param key The coalescing key of the request.
+     * @return The request.
+     */
+    std::shared_ptr<MessageRequest> createRequest(const std::string& content, const std::string& key = "");
+
+    /**
+     * Get the JSON content of the requests passed on so far, in order.
+     *
+     * @return The JSON content of the requests.
+     */
+    std::vector<std::string> getSentContent();
+
+    /**
+     * Wait until a number of requests have been passed on.
+     *
+     * @param count The number of requests.
+     * @return Whether the requests were passed on before the timeout.
+     */
+    bool waitForSentCount(size_t count);
+
+    /// The metric recorder.
+    std::shared_ptr<NiceMock<MockMetricRecorder>> m_metricRecorder;
+
+    /// The coalescer under test.
+    std::unique_ptr<EventCoalescer> m_coalescer;
+
+    /// Serializes access to @c m_sent.
+    std::mutex m_mutex;
+
+    /// Notified when a request is passed on.
+    std::condition_variable m_sentTrigger;
+
+    /// The requests passed on so far.
+    std::vector<std::shared_ptr<MessageRequest>> m_sent;
+};
+
+void EventCoalescerTest::TearDown() {
+    m_coalescer.reset();
+}
+
+void EventCoalescerTest::createCoalescer(std::chrono::milliseconds window) {
+    m_metricRecorder = std::make_shared<NiceMock<MockMetricRecorder>>();
+    m_coalescer.reset(new EventCoalescer(
+        window,
+        [this](std::shared_ptr<MessageRequest> request) {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            m_sent.push_back(request);
+            m_sentTrigger.notify_all();
+        },
+        m_metricRecorder));
+}
+
+std::shared_ptr<MessageRequest> EventCoalescerTest::createRequest(const std::string& content, const std::string& key) {
+    auto request = std::make_shared<MessageRequest>(content);
+    request->setCoalescingKey(key);
+    return request;
+}
+
+std::vector<std::string> EventCoalescerTest::getSentContent() {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    std::vector<std::string> content;
+    for (const auto& request : m_sent) {
+        content.push_back(request->getJsonContent());
+    }
+    return content;
+}
+
+bool EventCoalescerTest::waitForSentCount(size_t count) {
+    std::unique_lock<std::mutex> lock{m_mutex};
+    return m_sentTrigger.wait_for(lock, WAIT_TIMEOUT, [this, count] { return m_sent.size() >= count; });
+}
+
+/**
+ * Verify that a request without a coalescing key is passed on at once.
+ */
+TEST_F(EventCoalescerTest, test_requestWithoutKeyIsNotHeld) {
+    createCoalescer(LONG_WINDOW);
+    m_coalescer->submit(createRequest("a"));
+    EXPECT_EQ(getSentContent(), std::vector<std::string>({"a"}));
+}
+
+/**
+ * Verify that a held request is superseded by a later request with the same key, and that only the requests which
+ * were not superseded are passed on, in the place of the first request with each key, when the window ends.
+ */
+TEST_F(EventCoalescerTest, test_supersededRequestIsNotSent) {
+    createCoalescer(SHORT_WINDOW);
+    m_coalescer->submit(createRequest("a1", KEY_A));
+    m_coalescer->submit(createRequest("b1", KEY_B));
+    m_coalescer->submit(createRequest("a2", KEY_A));
+    EXPECT_TRUE(getSentContent().empty());
+
+    ASSERT_TRUE(waitForSentCount(2));
+    EXPECT_EQ(getSentContent(), std::vector<std::string>({"a2", "b1"}));
+}
+
+/**
+ * Verify that a request without a key passes on the held requests first, so that it is not reordered with them.
+ */
+TEST_F(EventCoalescerTest, test_requestWithoutKeyFlushesHeldRequests) {
+    createCoalescer(LONG_WINDOW);
+    m_coalescer->submit(createRequest("a1", KEY_A));
+    m_coalescer->submit(createRequest("a2", KEY_A));
+    m_coalescer->submit(createRequest("c"));
+    m_coalescer->submit(createRequest("a3", KEY_A));
+    EXPECT_EQ(getSentContent(), std::vector<std::string>({"a2", "c"}));
+
+    m_coalescer->flush();
+    EXPECT_EQ(getSentContent(), std::vector<std::string>({"a2", "c", "a3"}));
+}
+
+/**
+ * Verify that superseded requests complete with the status and exception of the request which replaced them.
+ */
+TEST_F(EventCoalescerTest, test_supersededRequestsCompleteWithSurvivor) {
+    createCoalescer(LONG_WINDOW);
+    auto first = createRequest("a1", KEY_A);
+    auto second = createRequest("a2", KEY_A);
+    auto third = createRequest("a3", KEY_A);
+    auto firstObserver = std::make_shared<TestMessageRequestObserver>();
+    auto secondObserver = std::make_shared<TestMessageRequestObserver>();
+    first->addObserver(firstObserver);
+    second->addObserver(secondObserver);
+
+    m_coalescer->submit(first);
+    m_coalescer->submit(second);
+    m_coalescer->submit(third);
+    m_coalescer->flush();
+    ASSERT_EQ(getSentContent(), std::vector<std::string>({"a3"}));
+
+    third->exceptionReceived("exception");
+    third->sendCompleted(MessageRequestObserverInterface::Status::SUCCESS);
+    for (const auto& observer : {firstObserver, secondObserver}) {
+        ASSERT_TRUE(observer->m_exception.waitFor(WAIT_TIMEOUT));
+        EXPECT_EQ(observer->m_exception.getValue(), "exception");
+        ASSERT_TRUE(observer->m_status.waitFor(WAIT_TIMEOUT));
+        EXPECT_EQ(observer->m_status.getValue(), MessageRequestObserverInterface::Status::SUCCESS);
+    }
+}
+
+/**
+ * Verify that what coalescing saved is recorded in metrics.
+ */
+TEST_F(EventCoalescerTest, test_coalescedEventsAreCounted) {
+    createCoalescer(LONG_WINDOW);
+#ifdef ACSDK_ENABLE_METRICS_RECORDING
+    std::shared_ptr<MetricEvent> recorded;
+    EXPECT_CALL(*m_metricRecorder, recordMetric(_)).WillOnce(SaveArg<0>(&recorded));
+#endif
+
+    m_coalescer->submit(createRequest("a1", KEY_A));
+    m_coalescer->submit(createRequest("a22", KEY_A));
+    m_coalescer->submit(createRequest("a333", KEY_A));
+    m_coalescer->flush();
+    EXPECT_EQ(getSentContent(), std::vector<std::string>({"a333"}));
+
+#ifdef ACSDK_ENABLE_METRICS_RECORDING
+    ASSERT_TRUE(recorded);
+    auto eventCount = recorded->getDataPoint("EVENT_COUNT", DataType::COUNTER);
+    ASSERT_TRUE(eventCount.hasValue());
+    EXPECT_EQ(eventCount.value().getValue(), "2");
+    auto bytesSaved = recorded->getDataPoint("BYTES_SAVED", DataType::COUNTER);
+    ASSERT_TRUE(bytesSaved.hasValue());
+    EXPECT_EQ(bytesSaved.value().getValue(), "5");
+#endif
+}
+
+/**
+ * Verify that the send function is called without the internal lock held, so that it can submit requests itself, and
+ * that those are passed on after the request being passed on.
+ */
+TEST_F(EventCoalescerTest, test_sendFunctionCanSubmitRequests) {
+    std::vector<std::string> sent;
+    m_coalescer.reset(new EventCoalescer(LONG_WINDOW, [this, &sent](std::shared_ptr<MessageRequest> request) {
+        sent.push_back(request->getJsonContent());
+        if ("a1" == request->getJsonContent()) {
+            m_coalescer->submit(createRequest("c"));
+            m_coalescer->flush();
+        }
+    }));
+
+    m_coalescer->submit(createRequest("a1", KEY_A));
+    m_coalescer->submit(createRequest("b1", KEY_B));
+    m_coalescer->flush();
+    EXPECT_EQ(sent, std::vector<std::string>({"a1", "b1", "c"}));
+    m_coalescer.reset();
+}
+
+/**
+ * Verify that shutting down passes on the held requests, and that later requests are not held.
+ */
+TEST_F(EventCoalescerTest, test_shutdownFlushesHeldRequests) {
+    createCoalescer(LONG_WINDOW);
+    m_coalescer->submit(createRequest("a1", KEY_A));
+    m_coalescer->shutdown();
+    EXPECT_EQ(getSentContent(), std::vector<std::string>({"a1"}));
+
+    m_coalescer->submit(createRequest("a2", KEY_A));
+    EXPECT_EQ(getSentContent(), std::vector<std::string>({"a1", "a2"}));
+}
+
+}  // namespace test
+}  // namespace acl
+}  // namespace alexaClientSDK
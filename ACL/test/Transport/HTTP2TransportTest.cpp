@@ -13,10 +13,13 @@
  * permissions and limitations under the License.
  */
 
+#include <atomic>
+#include <deque>
 #include <future>
 #include <iterator>
 #include <memory>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <vector>
 
@@ -154,6 +157,18 @@ static const unsigned MAX_AVS_STREAMS = 10;
 // Maximum allowed of POST streams
 static const unsigned MAX_POST_STREAMS = MAX_AVS_STREAMS - MAX_DOWNCHANNEL_STREAMS - MAX_PING_STREAMS;
 
+// The number of serialized messages allowed in flight when testing pipelining.
+static const unsigned int PIPELINED_MESSAGES_IN_FLIGHT = 4;
+
+// The number of messages sent by the send benchmarks.
+static const unsigned int BENCHMARK_MESSAGE_COUNT = 40;
+
+// The round trip time added by the stand-in server of the send benchmarks.
+static const auto BENCHMARK_ROUND_TRIP_TIME = std::chrono::milliseconds(20);
+
+// How often the stand-in server of the send benchmarks checks for requests to answer.
+static const auto BENCHMARK_SERVER_POLL_INTERVAL = std::chrono::milliseconds(1);
+
 /// Test harness for @c HTTP2Transport class.
 class HTTP2TransportTest : public Test {
 public:
@@ -164,6 +179,21 @@ public:
     void TearDown() override;
 
 protected:
+    /**
+     * Helper function to create @c m_http2Transport.
+     *
+     * @param configuration The configuration to create the transport with.
+     */
+    void createTransport(const HTTP2Transport::Configuration& configuration);
+
+    /**
+     * Helper function to send serialized messages to a stand-in server which answers each POST request after a fixed
+     * round trip time, and wait for all of them to complete.
+     *
+     * @param maxSerializedMessagesInFlight The number of serialized messages which may be in flight at once.
+     */
+    void sendSerializedMessagesWithRoundTrip(unsigned int maxSerializedMessagesInFlight);
+
     /**
      * Helper function to send @c Refreshed Auth State to the @c HTTP2Transport observer.
      * It also checks that a proper Auth observer has been registered by @c HTTP2Transport.
@@ -253,8 +283,14 @@ void HTTP2TransportTest::SetUp() {
     m_mockPostConnect = std::make_shared<NiceMock<MockPostConnect>>();
     m_mockMetricRecorder = std::make_shared<NiceMock<MockMetricRecorder>>();
     m_mockAuthDelegate->setAuthToken(CBL_AUTHORIZATION_TOKEN);
-    HTTP2Transport::Configuration cfg;
     m_synchronizedMessageRequestQueue = std::make_shared<SynchronizedMessageRequestQueue>();
+    createTransport(HTTP2Transport::Configuration());
+}
+
+void HTTP2TransportTest::createTransport(const HTTP2Transport::Configuration& configuration) {
+    if (m_http2Transport) {
+        m_http2Transport->shutdown();
+    }
     m_http2Transport = HTTP2Transport::create(
         m_mockAuthDelegate,
         TEST_AVS_GATEWAY_STRING,
@@ -264,7 +300,7 @@ void HTTP2TransportTest::SetUp() {
         m_mockTransportObserver,
         m_mockPostConnectFactory,
         m_synchronizedMessageRequestQueue,
-        cfg,
+        configuration,
         m_mockMetricRecorder,
         m_mockEventTracer);
 
@@ -368,6 +404,47 @@ void HTTP2TransportTest::authorizeAndConnect() {
     ASSERT_TRUE(m_transportConnected.waitFor(LONG_RESPONSE_TIMEOUT));
 }
 
+void HTTP2TransportTest::sendSerializedMessagesWithRoundTrip(unsigned int maxSerializedMessagesInFlight) {
+    HTTP2Transport::Configuration configuration;
+    configuration.maxSerializedMessagesInFlight = maxSerializedMessagesInFlight;
+    createTransport(configuration);
+    authorizeAndConnect();
+
+    // The stand-in server answers each POST request once the round trip time has passed.
+    std::atomic<bool> stopServer{false};
+    std::thread server([this, &stopServer] {
+        std::deque<std::pair<std::chrono::steady_clock::time_point, std::shared_ptr<MockHTTP2Request>>> pending;
+        while (!stopServer) {
+            auto request = m_mockHttp2Connection->dequePostRequest(BENCHMARK_SERVER_POLL_INTERVAL);
+            auto now = std::chrono::steady_clock::now();
+            if (request) {
+                pending.push_back({now + BENCHMARK_ROUND_TRIP_TIME, request});
+            }
+            while (!pending.empty() && pending.front().first <= now) {
+                pending.front().second->getSink()->onReceiveResponseCode(HTTPResponseCode::SUCCESS_NO_CONTENT);
+                pending.front().second->getSink()->onResponseFinished(HTTP2ResponseFinishedStatus::COMPLETE);
+                pending.pop_front();
+            }
+        }
+    });
+
+    std::vector<std::shared_ptr<TestMessageRequestObserver>> messageObservers;
+    for (unsigned int messageNum = 0; messageNum < BENCHMARK_MESSAGE_COUNT; messageNum++) {
+        auto messageReq = std::make_shared<MessageRequest>(TEST_MESSAGE + std::to_string(messageNum));
+        auto messageObserver = std::make_shared<TestMessageRequestObserver>();
+        messageObservers.push_back(messageObserver);
+        messageReq->addObserver(messageObserver);
+        m_synchronizedMessageRequestQueue->enqueueRequest(messageReq);
+        m_http2Transport->onRequestEnqueued();
+    }
+    for (auto& messageObserver : messageObservers) {
+        EXPECT_TRUE(messageObserver->m_status.waitFor(LONG_RESPONSE_TIMEOUT));
+    }
+
+    stopServer = true;
+    server.join();
+}
+
 /**
  * Test non-authorization on empty auth token.
  */
@@ -880,6 +957,134 @@ TEST_F(HTTP2TransportTest, messageRequests_concurrentSend) {
     ASSERT_EQ(messagesCanceled + messagesRemaining, messagesCount);
 }
 
+/**
+ * Test that with pipelining enabled, several serialized MessageRequests are sent before the first is acknowledged.
+ */
+TEST_F(HTTP2TransportTest, test_pipeliningSendsSerializedRequestsConcurrently) {
+    HTTP2Transport::Configuration configuration;
+    configuration.maxSerializedMessagesInFlight = PIPELINED_MESSAGES_IN_FLIGHT;
+    createTransport(configuration);
+    authorizeAndConnect();
+
+    std::vector<std::shared_ptr<TestMessageRequestObserver>> messageObservers;
+    unsigned int messagesCount = PIPELINED_MESSAGES_IN_FLIGHT + 1;
+    for (unsigned int messageNum = 0; messageNum < messagesCount; messageNum++) {
+        auto messageReq = std::make_shared<MessageRequest>(TEST_MESSAGE);
+        auto messageObserver = std::make_shared<TestMessageRequestObserver>();
+        messageObservers.push_back(messageObserver);
+        messageReq->addObserver(messageObserver);
+        m_synchronizedMessageRequestQueue->enqueueRequest(messageReq);
+        m_http2Transport->onRequestEnqueued();
+    }
+
+    // The first requests are all sent without waiting for acknowledgements.
+    std::vector<std::shared_ptr<MockHTTP2Request>> requests;
+    for (unsigned int i = 0; i < PIPELINED_MESSAGES_IN_FLIGHT; i++) {
+        auto request = m_mockHttp2Connection->dequePostRequest(RESPONSE_TIMEOUT);
+        ASSERT_NE(request, nullptr);
+        requests.push_back(request);
+    }
+
+    // The last one waits until one of them is acknowledged.
+    ASSERT_EQ(m_mockHttp2Connection->dequePostRequest(ONE_HUNDRED_MILLISECOND_DELAY), nullptr);
+    requests[0]->getSink()->onReceiveResponseCode(HTTPResponseCode::SUCCESS_OK);
+    requests[0]->getSink()->onResponseFinished(HTTP2ResponseFinishedStatus::COMPLETE);
+    auto lastRequest = m_mockHttp2Connection->dequePostRequest(RESPONSE_TIMEOUT);
+    ASSERT_NE(lastRequest, nullptr);
+    requests.push_back(lastRequest);
+
+    for (unsigned int i = 1; i < requests.size(); i++) {
+        requests[i]->getSink()->onReceiveResponseCode(HTTPResponseCode::SUCCESS_OK);
+        requests[i]->getSink()->onResponseFinished(HTTP2ResponseFinishedStatus::COMPLETE);
+    }
+    for (auto& messageObserver : messageObservers) {
+        ASSERT_TRUE(messageObserver->m_status.waitFor(RESPONSE_TIMEOUT));
+        ASSERT_EQ(messageObserver->m_status.getValue(), MessageRequestObserverInterface::Status::SUCCESS);
+    }
+}
+
+/**
+ * Test that when pipelined serialized MessageRequests fail without a response, the earliest failure is reported and
+ * the later failures are sent again, in order, before any newer serialized MessageRequest.
+ */
+TEST_F(HTTP2TransportTest, test_pipeliningReplaysRequestsAfterFailure) {
+    std::mutex tracedMutex;
+    std::vector<std::string> tracedMessages;
+    EXPECT_CALL(*m_mockEventTracer, traceEvent(_)).WillRepeatedly(Invoke([&](const std::string& content) {
+        std::lock_guard<std::mutex> lock(tracedMutex);
+        tracedMessages.push_back(content);
+    }));
+
+    HTTP2Transport::Configuration configuration;
+    configuration.maxSerializedMessagesInFlight = PIPELINED_MESSAGES_IN_FLIGHT;
+    createTransport(configuration);
+    authorizeAndConnect();
+
+    std::vector<std::shared_ptr<TestMessageRequestObserver>> messageObservers;
+    auto enqueueMessage = [this, &messageObservers](const std::string& content) {
+        auto messageReq = std::make_shared<MessageRequest>(content);
+        auto messageObserver = std::make_shared<TestMessageRequestObserver>();
+        messageObservers.push_back(messageObserver);
+        messageReq->addObserver(messageObserver);
+        m_synchronizedMessageRequestQueue->enqueueRequest(messageReq);
+        m_http2Transport->onRequestEnqueued();
+    };
+    enqueueMessage("A");
+    enqueueMessage("B");
+    enqueueMessage("C");
+
+    auto requestA = m_mockHttp2Connection->dequePostRequest(RESPONSE_TIMEOUT);
+    auto requestB = m_mockHttp2Connection->dequePostRequest(RESPONSE_TIMEOUT);
+    auto requestC = m_mockHttp2Connection->dequePostRequest(RESPONSE_TIMEOUT);
+    ASSERT_NE(requestA, nullptr);
+    ASSERT_NE(requestB, nullptr);
+    ASSERT_NE(requestC, nullptr);
+
+    // C fails first, then A.  Nothing else serialized is sent while B is still in flight.
+    requestC->getSink()->onResponseFinished(HTTP2ResponseFinishedStatus::INTERNAL_ERROR);
+    enqueueMessage("D");
+    requestA->getSink()->onResponseFinished(HTTP2ResponseFinishedStatus::INTERNAL_ERROR);
+    ASSERT_EQ(m_mockHttp2Connection->dequePostRequest(ONE_HUNDRED_MILLISECOND_DELAY), nullptr);
+    ASSERT_FALSE(messageObservers[0]->m_status.waitFor(TEN_MILLISECOND_DELAY));
+
+    // Once B finishes, A is reported as failed, and C is sent again ahead of D.
+    requestB->getSink()->onReceiveResponseCode(HTTPResponseCode::SUCCESS_OK);
+    requestB->getSink()->onResponseFinished(HTTP2ResponseFinishedStatus::COMPLETE);
+    ASSERT_TRUE(messageObservers[0]->m_status.waitFor(RESPONSE_TIMEOUT));
+    ASSERT_EQ(messageObservers[0]->m_status.getValue(), MessageRequestObserverInterface::Status::INTERNAL_ERROR);
+    ASSERT_TRUE(messageObservers[1]->m_status.waitFor(RESPONSE_TIMEOUT));
+    ASSERT_EQ(messageObservers[1]->m_status.getValue(), MessageRequestObserverInterface::Status::SUCCESS);
+    ASSERT_FALSE(messageObservers[2]->m_status.waitFor(TEN_MILLISECOND_DELAY));
+
+    for (int i = 0; i < 2; i++) {
+        auto request = m_mockHttp2Connection->dequePostRequest(RESPONSE_TIMEOUT);
+        ASSERT_NE(request, nullptr);
+        request->getSink()->onReceiveResponseCode(HTTPResponseCode::SUCCESS_OK);
+        request->getSink()->onResponseFinished(HTTP2ResponseFinishedStatus::COMPLETE);
+    }
+    ASSERT_TRUE(messageObservers[2]->m_status.waitFor(RESPONSE_TIMEOUT));
+    ASSERT_EQ(messageObservers[2]->m_status.getValue(), MessageRequestObserverInterface::Status::SUCCESS);
+    ASSERT_TRUE(messageObservers[3]->m_status.waitFor(RESPONSE_TIMEOUT));
+    ASSERT_EQ(messageObservers[3]->m_status.getValue(), MessageRequestObserverInterface::Status::SUCCESS);
+
+    std::lock_guard<std::mutex> lock(tracedMutex);
+    ASSERT_EQ(tracedMessages, std::vector<std::string>({"A", "B", "C", "C", "D"}));
+}
+
+/**
+ * Benchmark sending serialized MessageRequests one at a time to a server with a 20ms round trip time.
+ */
+TEST_F(HTTP2TransportTest, testSlow_benchmarkSerializedSendWithRoundTrip) {
+    sendSerializedMessagesWithRoundTrip(1);
+}
+
+/**
+ * Benchmark sending pipelined serialized MessageRequests to a server with a 20ms round trip time.
+ */
+TEST_F(HTTP2TransportTest, testSlow_benchmarkPipelinedSendWithRoundTrip) {
+    sendSerializedMessagesWithRoundTrip(MAX_POST_STREAMS);
+}
+
 /**
  * Test notification of onSendCompleted (check mapping of all cases and their mapping to
  * MessageRequestObserverInterface::Status).
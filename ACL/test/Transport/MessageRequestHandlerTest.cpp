@@ -13,10 +13,13 @@
  * permissions and limitations under the License.
  */
 
+#include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include <ACL/Transport/MessageRequestHandler.h>
 #include <AVSCommon/Utils/HTTP2/HTTP2RequestInterface.h>
+#include <AVSCommon/Utils/Metrics/AggregatingMetricRecorder.h>
+#include <AVSCommon/Utils/Metrics/MockMetricRecorder.h>
 
 namespace alexaClientSDK {
 namespace acl {
@@ -25,7 +28,12 @@ namespace test {
 static const std::string AUTHORIZATION_HEADER = "Authorization: Bearer ";
 static const std::string AUTH_TOKEN = "authToken";
 
+/// The activity name of the metric recorded when an event starts being sent to the cloud.
+static const std::string START_EVENT_SENT_TO_CLOUD_ACTIVITY = "ACL-START_EVENT_SENT_TO_CLOUD";
+
 using namespace ::testing;
+using namespace avsCommon::utils::metrics;
+using namespace avsCommon::utils::metrics::test;
 
 class MessageRequestHandlerTest : public Test {};
 
@@ -88,6 +96,39 @@ TEST_F(MessageRequestHandlerTest, test_headers) {
     std::vector<std::string> expected{AUTHORIZATION_HEADER + AUTH_TOKEN, "k1: v1", "k2: v2"};
     EXPECT_EQ(actual, expected);
 }
+
+/**
+ * Test that the metric marking the start of an event is recorded as the event is sent, even when the metric recorder
+ * aggregates counters.
+ */
+TEST_F(MessageRequestHandlerTest, test_startOfEventMetricNotAggregated) {
+    auto mockMetricRecorder = std::make_shared<NiceMock<MockMetricRecorder>>();
+    auto aggregatingMetricRecorder = AggregatingMetricRecorder::create(mockMetricRecorder);
+    ASSERT_TRUE(aggregatingMetricRecorder);
+
+    auto messageRequest = std::make_shared<avsCommon::avs::MessageRequest>("{}");
+    auto classUnderTest = MessageRequestHandler::create(
+        std::make_shared<MockExchangeHandlerContext>(),
+        AUTH_TOKEN,
+        messageRequest,
+        std::shared_ptr<MessageConsumerInterface>(),
+        std::shared_ptr<avsCommon::avs::attachment::AttachmentManagerInterface>(),
+        aggregatingMetricRecorder);
+    ASSERT_TRUE(classUnderTest);
+
+#ifdef ACSDK_ENABLE_METRICS_RECORDING
+    EXPECT_CALL(
+        *mockMetricRecorder,
+        recordMetric(Truly([](std::shared_ptr<MetricEvent> metricEvent) {
+            return metricEvent && metricEvent->getActivityName() == START_EVENT_SENT_TO_CLOUD_ACTIVITY;
+        })))
+        .Times(1);
+#endif
+
+    char buffer[16];
+    classUnderTest->onSendMimePartData(buffer, sizeof(buffer));
+    Mock::VerifyAndClearExpectations(mockMetricRecorder.get());
+}
 }  // namespace test
 }  // namespace transport
 }  // namespace acl
@@ -18,8 +18,10 @@
 
 #include <array>
 #include <condition_variable>
+#include <cstdint>
 #include <deque>
 #include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <set>
@@ -30,6 +32,7 @@
 #include <AVSCommon/AVS/AVSDirective.h>
 #include <AVSCommon/SDKInterfaces/DirectiveHandlerInterface.h>
 #include <AVSCommon/Utils/Threading/ConditionVariableWrapper.h>
+#include <AVSCommon/Utils/Threading/WorkStealingThreadPool.h>
 #include <AVSCommon/Utils/Power/PowerResource.h>
 
 #include "ADSL/DirectiveRouter.h"
@@ -61,15 +64,36 @@ namespace adsl {
  * @c BLOCKING @c AVSDirective indicates that handling has completed or failed. Otherwise handleDirective() is
  * invoked, the @c AVSDirective is popped from the front of the queue, and processing of queued @c AVSDirective's
  * continues.
+ * @par
+ * If a @c DirectiveProcessor is given a way to obtain a pre-handling pool, directives whose handler returns @c true
+ * from @c supportsConcurrentPreHandle() are pre-handled on that pool, so @c onDirective() does not wait for their
+ * @c preHandleDirective() calls to return.  Each directive keeps its place in the handling queue while it is being
+ * pre-handled, and no directive queued after it is handled until its pre-handling has finished.  Directives are
+ * therefore handled in the same order as when they are pre-handled one at a time.
  */
 class DirectiveProcessor {
 public:
+    /// The type of the function called when pre-handling a directive on the pre-handling pool fails.
+    using PreHandleFailedCallback = std::function<void(std::shared_ptr<avsCommon::avs::AVSDirective>)>;
+
+    /// The type of the function called to obtain the pre-handling pool.
+    using PreHandlePoolProvider = std::function<std::shared_ptr<avsCommon::utils::threading::WorkStealingThreadPool>()>;
+
     /**
      * Constructor.
      *
      * @param directiveRouter An object used to route directives to their registered handler.
+     * @param getPreHandlePool The function which obtains the pool used to pre-handle directives whose handler
+     * supports concurrent pre-handling.  It is called when the first such directive arrives, so no pool is created
+     * unless a handler needs one.  If empty, or it returns @c nullptr, every directive is pre-handled by
+     * @c onDirective().
+     * @param onPreHandleFailed The function to call when pre-handling a directive on the pre-handling pool fails, in
+     * place of @c onDirective() returning @c false.
      */
-    DirectiveProcessor(DirectiveRouter* directiveRouter);
+    DirectiveProcessor(
+        DirectiveRouter* directiveRouter,
+        PreHandlePoolProvider getPreHandlePool = nullptr,
+        PreHandleFailedCallback onPreHandleFailed = nullptr);
 
     /**
      * Destructor.
@@ -138,6 +162,12 @@ private:
     /// The type of the handling queue items.
     using DirectiveAndPolicy = std::pair<std::shared_ptr<avsCommon::avs::AVSDirective>, avsCommon::avs::BlockingPolicy>;
 
+    /// The type of the handling queue, whose items are keyed by the order in which they were queued.
+    using HandlingQueue = std::map<uint64_t, DirectiveAndPolicy>;
+
+    /// The number of distinct sets of @c BlockingPolicy::Mediums.
+    static constexpr size_t MEDIUM_SETS_COUNT = 1 << avsCommon::avs::BlockingPolicy::Medium::COUNT;
+
     /**
      * Implementation of @c DirectiveHandlerResultInterface that forwards the completion / failure status
      * to the @c DirectiveProcessor from which it originated.
@@ -189,6 +219,26 @@ private:
      */
     void removeDirectiveLocked(std::shared_ptr<avsCommon::avs::AVSDirective> directive);
 
+    /**
+     * Obtain @c m_preHandlePool from @c m_getPreHandlePool, the first time it is needed.
+     * @note This method must only be called by threads that have acquired @c m_mutex.
+     *
+     * @return Whether there is a pre-handling pool.
+     */
+    bool getPreHandlePoolLocked();
+
+    /**
+     * Pre-handle a directive on @c m_preHandlePool and queue it for handling.
+     *
+     * @param key The key reserved for the directive in @c m_handlingQueue.
+     * @param directive The @c AVSDirective to pre-handle.
+     * @param policy The @c BlockingPolicy of the directive.
+     */
+    void preHandleConcurrently(
+        uint64_t key,
+        std::shared_ptr<avsCommon::avs::AVSDirective> directive,
+        avsCommon::avs::BlockingPolicy policy);
+
     /**
      * Thread method for m_processingThread.
      */
@@ -276,9 +326,49 @@ private:
     /**
      * Get the next unblocked @c DirectiveAndPolicy form the handling queue.
      *
+     * A directive is unblocked if no directive queued before it is still being pre-handled, and none of its mediums is
+     * used by a directive being handled or by a blocking directive queued before it.  Within directives that use the same set of mediums the first one is unblocked if any is, so
+     * only the first directive of each set of mediums needs to be checked.
+     *
      * @return An @c std::iterator to the next unblocked @c DirectiveAndPolicy.
      */
-    std::deque<DirectiveAndPolicy>::iterator getNextUnblockedDirectiveLocked();
+    HandlingQueue::iterator getNextUnblockedDirectiveLocked();
+
+    /**
+     * Add a directive to the handling queue, and to its indexes.
+     *
+     * @param key The key reserved for the directive in @c m_handlingQueue when its pre-handling started.
+     * @param directive The @c AVSDirective to queue.
+     * @param policy The @c BlockingPolicy of the directive.
+     */
+    void pushHandlingQueueLocked(
+        uint64_t key,
+        const std::shared_ptr<avsCommon::avs::AVSDirective>& directive,
+        const avsCommon::avs::BlockingPolicy& policy);
+
+    /**
+     * Remove a directive from the handling queue, and from its indexes.
+     *
+     * @param it An iterator to the directive in @c m_handlingQueue.
+     * @return An iterator to the directive following the removed one.
+     */
+    HandlingQueue::iterator eraseHandlingQueueLocked(HandlingQueue::iterator it);
+
+    /**
+     * Find a directive in the handling queue.
+     *
+     * @param directive The @c AVSDirective to find.
+     * @return An iterator to the directive in @c m_handlingQueue, or @c m_handlingQueue.end() if it is not queued.
+     */
+    HandlingQueue::iterator findInHandlingQueueLocked(const std::shared_ptr<avsCommon::avs::AVSDirective>& directive);
+
+    /**
+     * Get the index of the set of mediums used by a policy in @c m_queuedByMediums.
+     *
+     * @param policy The @c BlockingPolicy.
+     * @return The index of the set of mediums used by @c policy.
+     */
+    static size_t getMediumSetIndex(const avsCommon::avs::BlockingPolicy& policy);
 
     /// Handle value identifying this instance.
     int m_handle;
@@ -301,15 +391,38 @@ private:
     /// Queue of @c AVSDirectives waiting to be canceled.
     std::deque<std::shared_ptr<avsCommon::avs::AVSDirective>> m_cancelingQueue;
 
-    /// The directive (if any) for which a preHandleDirective() call is in progress.
-    std::shared_ptr<avsCommon::avs::AVSDirective> m_directiveBeingPreHandled;
+    /// The directives for which a preHandleDirective() call is in progress, by the key reserved in @c m_handlingQueue.
+    std::map<uint64_t, std::shared_ptr<avsCommon::avs::AVSDirective>> m_directivesBeingPreHandled;
 
-    /**
-     * Queue of @c AVSDirectives waiting to be handled.
-     * @Note: A queue per channel would be more efficient, but as we don't expect more than few
-     * directives on the queue, we prefer simplicity.
-     */
-    std::deque<DirectiveAndPolicy> m_handlingQueue;
+    /// The function which obtains @c m_preHandlePool, or empty once it has been called.
+    PreHandlePoolProvider m_getPreHandlePool;
+
+    /// The pool used to pre-handle directives whose handler supports concurrent pre-handling, or @c nullptr.
+    std::shared_ptr<avsCommon::utils::threading::WorkStealingThreadPool> m_preHandlePool;
+
+    /// The function to call when pre-handling a directive on @c m_preHandlePool fails.
+    PreHandleFailedCallback m_onPreHandleFailed;
+
+    /// The number of tasks submitted to @c m_preHandlePool which have not finished.
+    size_t m_preHandleTasksCount;
+
+    /// Condition variable notified when @c m_preHandleTasksCount drops to zero.
+    std::condition_variable m_preHandleTasksDone;
+
+    /// Queue of @c AVSDirectives waiting to be handled, in the order they were queued.
+    HandlingQueue m_handlingQueue;
+
+    /// The key reserved for the next directive to be pre-handled.
+    uint64_t m_nextHandlingQueueKey;
+
+    /// The keys in @c m_handlingQueue of the queued directives, by messageId.
+    std::unordered_multimap<std::string, uint64_t> m_handlingQueueIndex;
+
+    /// The keys in @c m_handlingQueue of the queued directives, split by the set of mediums their policy uses.
+    std::array<std::set<uint64_t>, MEDIUM_SETS_COUNT> m_queuedByMediums;
+
+    /// The keys in @c m_handlingQueue of the queued blocking directives which use each medium.
+    std::array<std::set<uint64_t>, avsCommon::avs::BlockingPolicy::Medium::COUNT> m_queuedBlockingByMedium;
 
     /// Condition variable used to wake @c processingLoop() when it is waiting.
     avsCommon::utils::threading::ConditionVariableWrapper m_wakeProcessingLoop;
@@ -104,6 +104,15 @@ public:
      */
     avsCommon::avs::BlockingPolicy getPolicy(const std::shared_ptr<avsCommon::avs::AVSDirective>& directive);
 
+    /**
+     * Get whether the handler registered for the given directive supports concurrent calls to
+     * @c preHandleDirective().
+     *
+     * @param directive The directive to check.
+     * @return @c true if a handler is registered for the directive and it supports concurrent pre-handling.
+     */
+    bool supportsConcurrentPreHandle(const std::shared_ptr<avsCommon::avs::AVSDirective>& directive);
+
 private:
     void doShutdown() override;
 
@@ -107,6 +107,13 @@ private:
      */
     void receiveDirectiveLocked(std::unique_lock<std::mutex>& lock);
 
+    /**
+     * Send an @c ExceptionEncountered message for a directive which could not be handled.
+     *
+     * @param directive The directive which could not be handled.
+     */
+    void sendUnsupportedOperationException(const std::shared_ptr<avsCommon::avs::AVSDirective>& directive);
+
     /// Serializes access to data members (besides m_directiveRouter and m_directiveProcessor).
     std::mutex m_mutex;
 
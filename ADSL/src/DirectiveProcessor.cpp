@@ -45,11 +45,19 @@ using namespace avsCommon::utils;
 std::mutex DirectiveProcessor::m_handleMapMutex;
 DirectiveProcessor::ProcessorHandle DirectiveProcessor::m_nextProcessorHandle = 0;
 std::unordered_map<DirectiveProcessor::ProcessorHandle, DirectiveProcessor*> DirectiveProcessor::m_handleMap;
+constexpr size_t DirectiveProcessor::MEDIUM_SETS_COUNT;
 
-DirectiveProcessor::DirectiveProcessor(DirectiveRouter* directiveRouter) :
+DirectiveProcessor::DirectiveProcessor(
+    DirectiveRouter* directiveRouter,
+    PreHandlePoolProvider getPreHandlePool,
+    PreHandleFailedCallback onPreHandleFailed) :
         m_directiveRouter{directiveRouter},
         m_isShuttingDown{false},
-        m_isEnabled{true} {
+        m_isEnabled{true},
+        m_getPreHandlePool{std::move(getPreHandlePool)},
+        m_onPreHandleFailed{onPreHandleFailed},
+        m_preHandleTasksCount{0},
+        m_nextHandlingQueueKey{0} {
     std::lock_guard<std::mutex> lock(m_handleMapMutex);
     m_handle = ++m_nextProcessorHandle;
     m_handleMap[m_handle] = this;
@@ -105,40 +113,97 @@ bool DirectiveProcessor::onDirective(std::shared_ptr<AVSDirective> directive) {
 
     auto policy = m_directiveRouter->getPolicy(directive);
 
-    m_directiveBeingPreHandled = directive;
+    auto key = m_nextHandlingQueueKey++;
+    m_directivesBeingPreHandled[key] = directive;
+
+    if ((m_preHandlePool || m_getPreHandlePool) && m_directiveRouter->supportsConcurrentPreHandle(directive) &&
+        getPreHandlePoolLocked()) {
+        ++m_preHandleTasksCount;
+        if (m_preHandlePool->submit(
+                [this, key, directive, policy]() { preHandleConcurrently(key, directive, policy); })) {
+            return true;
+        }
+        --m_preHandleTasksCount;
+        ACSDK_WARN(LX("preHandleConcurrentlyFailed")
+                       .d("messageId", directive->getMessageId())
+                       .d("reason", "submitFailed")
+                       .d("action", "preHandlingInline"));
+    }
 
     lock.unlock();
     auto preHandled = m_directiveRouter->preHandleDirective(
         directive, utils::memory::make_unique<DirectiveHandlerResult>(m_handle, directive));
     lock.lock();
 
-    if (!m_directiveBeingPreHandled && preHandled) {
+    auto it = m_directivesBeingPreHandled.find(key);
+    if (it == m_directivesBeingPreHandled.end() && preHandled) {
         return true;
     }
 
-    m_directiveBeingPreHandled.reset();
+    if (it != m_directivesBeingPreHandled.end()) {
+        m_directivesBeingPreHandled.erase(it);
+    }
+
+    // Directives queued behind this one may have been waiting for its pre-handling to finish.
+    m_wakeProcessingLoop.notifyOne();
 
     if (!preHandled) {
         return false;
     }
 
-    auto item = std::make_pair(directive, policy);
-    m_handlingQueue.push_back(item);
-    m_wakeProcessingLoop.notifyOne();
+    pushHandlingQueueLocked(key, directive, policy);
 
     return true;
 }
 
+bool DirectiveProcessor::getPreHandlePoolLocked() {
+    if (m_getPreHandlePool) {
+        m_preHandlePool = m_getPreHandlePool();
+        m_getPreHandlePool = nullptr;
+    }
+    return m_preHandlePool != nullptr;
+}
+
+void DirectiveProcessor::preHandleConcurrently(
+    uint64_t key,
+    std::shared_ptr<AVSDirective> directive,
+    BlockingPolicy policy) {
+    auto preHandled = m_directiveRouter->preHandleDirective(
+        directive, utils::memory::make_unique<DirectiveHandlerResult>(m_handle, directive));
+
+    if (!preHandled) {
+        ACSDK_WARN(LX("preHandleConcurrentlyFailed").d("messageId", directive->getMessageId()));
+        if (m_onPreHandleFailed) {
+            m_onPreHandleFailed(directive);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_directivesBeingPreHandled.find(key);
+    if (it != m_directivesBeingPreHandled.end()) {
+        m_directivesBeingPreHandled.erase(it);
+        if (preHandled) {
+            pushHandlingQueueLocked(key, directive, policy);
+        }
+        m_wakeProcessingLoop.notifyOne();
+    }
+
+    if (--m_preHandleTasksCount == 0) {
+        m_preHandleTasksDone.notify_all();
+    }
+}
+
 void DirectiveProcessor::shutdown() {
     {
         std::lock_guard<std::mutex> lock(m_handleMapMutex);
         m_handleMap.erase(m_handle);
     }
     {
-        std::lock_guard<std::mutex> lock(m_mutex);
+        std::unique_lock<std::mutex> lock(m_mutex);
         queueAllDirectivesForCancellationLocked();
         m_isShuttingDown = true;
         m_wakeProcessingLoop.notifyOne();
+        m_preHandleTasksDone.wait(lock, [this] { return 0 == m_preHandleTasksCount; });
     }
     if (m_processingThread.joinable()) {
         m_processingThread.join();
@@ -190,8 +255,7 @@ void DirectiveProcessor::onHandlingCompleted(std::shared_ptr<AVSDirective> direc
     std::lock_guard<std::mutex> lock(m_mutex);
     ACSDK_DEBUG(LX("onHandlingCompeted")
                     .d("messageId", directive->getMessageId())
-                    .d("directiveBeingPreHandled",
-                       m_directiveBeingPreHandled ? m_directiveBeingPreHandled->getMessageId() : "(nullptr)"));
+                    .d("directivesBeingPreHandled", m_directivesBeingPreHandled.size()));
 
     removeDirectiveLocked(directive);
 }
@@ -202,8 +266,7 @@ void DirectiveProcessor::onHandlingFailed(std::shared_ptr<AVSDirective> directiv
                     .d("messageId", directive->getMessageId())
                     .d("namespace", directive->getNamespace())
                     .d("name", directive->getName())
-                    .d("directiveBeingPreHandled",
-                       m_directiveBeingPreHandled ? m_directiveBeingPreHandled->getMessageId() : "(nullptr)")
+                    .d("directivesBeingPreHandled", m_directivesBeingPreHandled.size())
                     .d("description", description));
 
     removeDirectiveLocked(directive);
@@ -212,19 +275,21 @@ void DirectiveProcessor::onHandlingFailed(std::shared_ptr<AVSDirective> directiv
 
 void DirectiveProcessor::removeDirectiveLocked(std::shared_ptr<AVSDirective> directive) {
     auto matches = [directive](std::shared_ptr<AVSDirective> item) { return item == directive; };
-    auto handlingMatches = [directive](std::pair<std::shared_ptr<AVSDirective>, BlockingPolicy> directiveAndPolicy) {
-        return directiveAndPolicy.first == directive;
-    };
 
     m_cancelingQueue.erase(
         std::remove_if(m_cancelingQueue.begin(), m_cancelingQueue.end(), matches), m_cancelingQueue.end());
 
-    if (matches(m_directiveBeingPreHandled)) {
-        m_directiveBeingPreHandled.reset();
+    for (auto it = m_directivesBeingPreHandled.begin(); it != m_directivesBeingPreHandled.end(); ++it) {
+        if (matches(it->second)) {
+            m_directivesBeingPreHandled.erase(it);
+            break;
+        }
     }
 
-    m_handlingQueue.erase(
-        std::remove_if(m_handlingQueue.begin(), m_handlingQueue.end(), handlingMatches), m_handlingQueue.end());
+    auto it = findInHandlingQueueLocked(directive);
+    if (it != m_handlingQueue.end()) {
+        eraseHandlingQueueLocked(it);
+    }
 
     if (m_directivesBeingHandled[BlockingPolicy::Medium::AUDIO] &&
         matches(m_directivesBeingHandled[BlockingPolicy::Medium::AUDIO])) {
@@ -284,44 +349,103 @@ std::set<std::shared_ptr<AVSDirective>> DirectiveProcessor::clearDirectiveBeingH
     return freed;
 }
 
-std::deque<DirectiveProcessor::DirectiveAndPolicy>::iterator DirectiveProcessor::getNextUnblockedDirectiveLocked() {
-    // A medium is considered blocked if a previous blocking directive hasn't been completed yet.
-    std::array<bool, BlockingPolicy::Medium::COUNT> blockedMediums;
+size_t DirectiveProcessor::getMediumSetIndex(const BlockingPolicy& policy) {
+    return static_cast<size_t>(policy.getMediums().to_ulong());
+}
 
-    // Mark mediums used by blocking directives being handled as blocked.
-    blockedMediums[BlockingPolicy::Medium::AUDIO] =
-        (m_directivesBeingHandled[BlockingPolicy::Medium::AUDIO] != nullptr);
-    blockedMediums[BlockingPolicy::Medium::VISUAL] =
-        (m_directivesBeingHandled[BlockingPolicy::Medium::VISUAL] != nullptr);
+void DirectiveProcessor::pushHandlingQueueLocked(
+    uint64_t key,
+    const std::shared_ptr<AVSDirective>& directive,
+    const BlockingPolicy& policy) {
+    m_handlingQueue.emplace(key, std::make_pair(directive, policy));
+    m_handlingQueueIndex.emplace(directive->getMessageId(), key);
+    m_queuedByMediums[getMediumSetIndex(policy)].insert(key);
+    if (policy.isBlocking()) {
+        auto mediums = policy.getMediums();
+        for (size_t medium = 0; medium < BlockingPolicy::Medium::COUNT; ++medium) {
+            if (mediums[medium]) {
+                m_queuedBlockingByMedium[medium].insert(key);
+            }
+        }
+    }
+}
 
-    for (auto it = m_handlingQueue.begin(); it != m_handlingQueue.end(); it++) {
-        auto policy = it->second;
-        bool currentUsingAudio = false;
-        bool currentUsingVisual = false;
+DirectiveProcessor::HandlingQueue::iterator DirectiveProcessor::eraseHandlingQueueLocked(HandlingQueue::iterator it) {
+    auto key = it->first;
+    const auto& directive = it->second.first;
+    const auto& policy = it->second.second;
 
-        if (policy.getMediums()[BlockingPolicy::Medium::AUDIO]) {
-            currentUsingAudio = true;
+    auto range = m_handlingQueueIndex.equal_range(directive->getMessageId());
+    for (auto indexIt = range.first; indexIt != range.second; ++indexIt) {
+        if (indexIt->second == key) {
+            m_handlingQueueIndex.erase(indexIt);
+            break;
+        }
+    }
+    m_queuedByMediums[getMediumSetIndex(policy)].erase(key);
+    if (policy.isBlocking()) {
+        auto mediums = policy.getMediums();
+        for (size_t medium = 0; medium < BlockingPolicy::Medium::COUNT; ++medium) {
+            if (mediums[medium]) {
+                m_queuedBlockingByMedium[medium].erase(key);
+            }
         }
+    }
+    return m_handlingQueue.erase(it);
+}
 
-        if (policy.getMediums()[BlockingPolicy::Medium::VISUAL]) {
-            currentUsingVisual = true;
+DirectiveProcessor::HandlingQueue::iterator DirectiveProcessor::findInHandlingQueueLocked(
+    const std::shared_ptr<AVSDirective>& directive) {
+    if (!directive) {
+        return m_handlingQueue.end();
+    }
+    auto range = m_handlingQueueIndex.equal_range(directive->getMessageId());
+    for (auto indexIt = range.first; indexIt != range.second; ++indexIt) {
+        auto it = m_handlingQueue.find(indexIt->second);
+        if (it != m_handlingQueue.end() && it->second.first == directive) {
+            return it;
         }
+    }
+    return m_handlingQueue.end();
+}
+
+DirectiveProcessor::HandlingQueue::iterator DirectiveProcessor::getNextUnblockedDirectiveLocked() {
+    // A medium is considered blocked if a blocking directive using it is being handled.  Directives queued after a
+    // queued blocking directive are also blocked on its mediums, since it will block them once it is handled.
+    std::array<bool, BlockingPolicy::Medium::COUNT> blockedMediums;
+    std::array<uint64_t, BlockingPolicy::Medium::COUNT> firstBlockingKey;
+    for (size_t medium = 0; medium < BlockingPolicy::Medium::COUNT; ++medium) {
+        blockedMediums[medium] = (m_directivesBeingHandled[medium] != nullptr);
+        firstBlockingKey[medium] = m_queuedBlockingByMedium[medium].empty() ? UINT64_MAX
+                                                                            : *m_queuedBlockingByMedium[medium].begin();
+    }
 
-        if ((currentUsingAudio && blockedMediums[BlockingPolicy::Medium::AUDIO]) ||
-            (currentUsingVisual && blockedMediums[BlockingPolicy::Medium::VISUAL])) {
-            // if the current directive is blocking, block its Mediums.
-            if (it->second.isBlocking()) {
-                blockedMediums[BlockingPolicy::Medium::AUDIO] =
-                    (blockedMediums[BlockingPolicy::Medium::AUDIO] || currentUsingAudio);
-                blockedMediums[BlockingPolicy::Medium::VISUAL] =
-                    (blockedMediums[BlockingPolicy::Medium::VISUAL] || currentUsingVisual);
+    // Nothing queued after a directive which is still being pre-handled may be handled before it.
+    auto firstPreHandlingKey =
+        m_directivesBeingPreHandled.empty() ? UINT64_MAX : m_directivesBeingPreHandled.begin()->first;
+
+    auto next = m_handlingQueue.end();
+    for (size_t mediumSet = 0; mediumSet < MEDIUM_SETS_COUNT; ++mediumSet) {
+        if (m_queuedByMediums[mediumSet].empty()) {
+            continue;
+        }
+        auto key = *m_queuedByMediums[mediumSet].begin();
+        if (key > firstPreHandlingKey || (next != m_handlingQueue.end() && next->first < key)) {
+            continue;
+        }
+        bool isBlocked = false;
+        for (size_t medium = 0; medium < BlockingPolicy::Medium::COUNT; ++medium) {
+            if ((mediumSet & (1 << medium)) && (blockedMediums[medium] || firstBlockingKey[medium] < key)) {
+                isBlocked = true;
+                break;
             }
-        } else {
-            return it;
+        }
+        if (!isBlocked) {
+            next = m_handlingQueue.find(key);
         }
     }
 
-    return m_handlingQueue.end();
+    return next;
 }
 
 void DirectiveProcessor::processingLoop() {
@@ -394,11 +518,11 @@ bool DirectiveProcessor::handleQueuedDirectivesLocked(std::unique_lock<std::mute
             ACSDK_DEBUG9(LX("handleQueuedDirectivesLocked").m("all queued directives are blocked"));
             break;
         }
-        auto directive = it->first;
-        auto policy = it->second;
+        auto directive = it->second.first;
+        auto policy = it->second.second;
 
         setDirectiveBeingHandledLocked(directive, policy);
-        m_handlingQueue.erase((it));
+        eraseHandlingQueueLocked(it);
 
         ACSDK_DEBUG9(LX("handleQueuedDirectivesLocked")
                          .d("proceeding with directive", directive->getMessageId())
@@ -454,12 +578,14 @@ void DirectiveProcessor::scrubDialogRequestIdLocked(const std::string& dialogReq
 
     // If a matching directive is in the midst of a preHandleDirective() call (i.e. before the
     // directive is added to the m_handlingQueue) queue it for canceling instead.
-    if (m_directiveBeingPreHandled) {
-        auto id = m_directiveBeingPreHandled->getDialogRequestId();
+    for (auto it = m_directivesBeingPreHandled.begin(); it != m_directivesBeingPreHandled.end();) {
+        auto id = it->second->getDialogRequestId();
         if (!id.empty() && id == dialogRequestId) {
-            m_cancelingQueue.push_back(m_directiveBeingPreHandled);
-            m_directiveBeingPreHandled.reset();
+            m_cancelingQueue.push_back(it->second);
+            it = m_directivesBeingPreHandled.erase(it);
             changed = true;
+        } else {
+            ++it;
         }
     }
 
@@ -478,17 +604,16 @@ void DirectiveProcessor::scrubDialogRequestIdLocked(const std::string& dialogReq
     }
 
     // Filter matching directives from m_handlingQueue and put them in m_cancelingQueue.
-    std::deque<DirectiveAndPolicy> temp;
-    for (const auto& directiveAndPolicy : m_handlingQueue) {
-        auto id = (directiveAndPolicy.first)->getDialogRequestId();
+    for (auto it = m_handlingQueue.begin(); it != m_handlingQueue.end();) {
+        auto id = it->second.first->getDialogRequestId();
         if (!id.empty() && id == dialogRequestId) {
-            m_cancelingQueue.push_back(directiveAndPolicy.first);
+            m_cancelingQueue.push_back(it->second.first);
+            it = eraseHandlingQueueLocked(it);
             changed = true;
         } else {
-            temp.push_back(directiveAndPolicy);
+            ++it;
         }
     }
-    std::swap(temp, m_handlingQueue);
 
     // If the dialogRequestId to scrub is the current value, reset the current value.
     if (dialogRequestId == m_dialogRequestId) {
@@ -517,20 +642,25 @@ void DirectiveProcessor::queueAllDirectivesForCancellationLocked() {
     }
 
     if (!m_handlingQueue.empty()) {
-        std::transform(
-            m_handlingQueue.begin(),
-            m_handlingQueue.end(),
-            std::back_inserter(m_cancelingQueue),
-            [](DirectiveAndPolicy directiveAndPolicy) { return directiveAndPolicy.first; });
+        for (const auto& item : m_handlingQueue) {
+            m_cancelingQueue.push_back(item.second.first);
+        }
 
         m_handlingQueue.clear();
+        m_handlingQueueIndex.clear();
+        for (auto& keys : m_queuedByMediums) {
+            keys.clear();
+        }
+        for (auto& keys : m_queuedBlockingByMedium) {
+            keys.clear();
+        }
         changed = true;
     }
 
-    if (m_directiveBeingPreHandled) {
-        m_cancelingQueue.push_back(m_directiveBeingPreHandled);
-        m_directiveBeingPreHandled.reset();
+    for (const auto& item : m_directivesBeingPreHandled) {
+        m_cancelingQueue.push_back(item.second);
     }
+    m_directivesBeingPreHandled.clear();
 
     if (changed) {
         ACSDK_DEBUG9(LX("notifyingProcessingLoop"));
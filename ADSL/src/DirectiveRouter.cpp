@@ -319,6 +319,12 @@ BlockingPolicy DirectiveRouter::getPolicy(const std::shared_ptr<AVSDirective>& d
     return getHandlerAndPolicyLocked(directive).policy;
 }
 
+bool DirectiveRouter::supportsConcurrentPreHandle(const std::shared_ptr<AVSDirective>& directive) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto handler = getHandlerLocked(directive);
+    return handler && handler->supportsConcurrentPreHandle();
+}
+
 HandlerAndPolicy DirectiveRouter::getHandlerAndPolicyLocked(const std::shared_ptr<AVSDirective>& directive) {
     if (!directive) {
         ACSDK_ERROR(LX("getConfiguredHandlerAndPolicyLockedFailed").d("reason", "nullptrDirective"));
@@ -123,7 +123,10 @@ DirectiveSequencer::DirectiveSequencer(
         m_powerResource->acquire();
     }
 
-    m_directiveProcessor = std::make_shared<DirectiveProcessor>(&m_directiveRouter);
+    m_directiveProcessor = std::make_shared<DirectiveProcessor>(
+        &m_directiveRouter,
+        &threading::WorkStealingThreadPool::getDefaultThreadPool,
+        [this](std::shared_ptr<AVSDirective> directive) { sendUnsupportedOperationException(directive); });
     m_receivingThread = std::thread(&DirectiveSequencer::receivingLoop, this);
 }
 
@@ -209,12 +212,16 @@ void DirectiveSequencer::receiveDirectiveLocked(std::unique_lock<std::mutex>& lo
 #endif
 
     if (!handled) {
-        ACSDK_INFO(LX("sendingExceptionEncountered").d("messageId", directive->getMessageId()));
-        m_exceptionSender->sendExceptionEncountered(
-            directive->getUnparsedDirective(), ExceptionErrorType::UNSUPPORTED_OPERATION, "Unsupported operation");
+        sendUnsupportedOperationException(directive);
     }
     lock.lock();
 }
 
+void DirectiveSequencer::sendUnsupportedOperationException(const std::shared_ptr<AVSDirective>& directive) {
+    ACSDK_INFO(LX("sendingExceptionEncountered").d("messageId", directive->getMessageId()));
+    m_exceptionSender->sendExceptionEncountered(
+        directive->getUnparsedDirective(), ExceptionErrorType::UNSUPPORTED_OPERATION, "Unsupported operation");
+}
+
 }  // namespace adsl
 }  // namespace alexaClientSDK
\ No newline at end of file
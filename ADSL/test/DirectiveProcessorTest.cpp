@@ -15,6 +15,7 @@
 
 // @file DirectiveProcessorTest.cpp
 
+#include <atomic>
 #include <chrono>
 #include <future>
 #include <memory>
@@ -710,6 +711,173 @@ TEST_F(DirectiveProcessorTest, test_nonBlockingQueuedDirectivIsNotBlocking) {
     visualBlockingHandler->waitUntilCompleted();
 }
 
+/**
+ * Register two handlers which support concurrent pre-handling, for a blocking audio directive and a non-blocking visual
+ * directive.  Hold up the pre-handling of the first directive and send both.  Expect @c onDirective() to return for
+ * both, the second directive to be pre-handled while the first is still being pre-handled, and the second directive to
+ * be handled only after the first, even though they use different mediums.
+ */
+TEST_F(DirectiveProcessorTest, test_concurrentPreHandleKeepsHandlingOrder) {
+    auto pool = std::make_shared<utils::threading::WorkStealingThreadPool>(2);
+    auto processor = std::make_shared<DirectiveProcessor>(m_router.get(), [pool] { return pool; });
+
+    DirectiveHandlerConfiguration handler0Config;
+    handler0Config[NamespaceAndName{NAMESPACE_AND_NAME_0_0}] = BlockingPolicy(BlockingPolicy::MEDIUM_AUDIO, true);
+    auto handler0 = MockDirectiveHandler::create(handler0Config);
+    ON_CALL(*(handler0.get()), supportsConcurrentPreHandle()).WillByDefault(Return(true));
+
+    DirectiveHandlerConfiguration handler1Config;
+    handler1Config[NamespaceAndName{NAMESPACE_AND_NAME_0_1}] = BlockingPolicy(BlockingPolicy::MEDIUM_VISUAL, false);
+    auto handler1 = MockDirectiveHandler::create(handler1Config);
+    ON_CALL(*(handler1.get()), supportsConcurrentPreHandle()).WillByDefault(Return(true));
+
+    ASSERT_TRUE(m_router->addDirectiveHandler(handler0));
+    ASSERT_TRUE(m_router->addDirectiveHandler(handler1));
+
+    std::promise<void> preHandleGatePromise;
+    std::shared_future<void> preHandleGate = preHandleGatePromise.get_future();
+    EXPECT_CALL(*(handler0.get()), preHandleDirective(m_directive_0_0, _))
+        .WillOnce(Invoke([&handler0, preHandleGate](
+                             std::shared_ptr<AVSDirective> directive,
+                             std::shared_ptr<sdkInterfaces::DirectiveHandlerResultInterface> result) {
+            preHandleGate.wait();
+            handler0->mockPreHandleDirective(directive, result);
+        }));
+    EXPECT_CALL(*(handler1.get()), preHandleDirective(m_directive_0_1, _)).Times(1);
+    EXPECT_CALL(*(handler0.get()), cancelDirective(_)).Times(0);
+    EXPECT_CALL(*(handler1.get()), cancelDirective(_)).Times(0);
+
+    ::testing::Sequence s1;
+    EXPECT_CALL(*(handler0.get()), handleDirective(MESSAGE_ID_0_0)).Times(1).InSequence(s1);
+    EXPECT_CALL(*(handler1.get()), handleDirective(MESSAGE_ID_0_1)).Times(1).InSequence(s1);
+
+    processor->setDialogRequestId(DIALOG_REQUEST_ID_0);
+    ASSERT_TRUE(processor->onDirective(m_directive_0_0));
+    ASSERT_TRUE(processor->onDirective(m_directive_0_1));
+
+    EXPECT_TRUE(handler1->waitUntilPreHandling());
+    preHandleGatePromise.set_value();
+
+    EXPECT_TRUE(handler0->waitUntilCompleted());
+    EXPECT_TRUE(handler1->waitUntilCompleted());
+    processor->shutdown();
+}
+
+/**
+ * Register a handler which supports concurrent pre-handling and send a directive for it while the pre-handling pool is
+ * busy.  Remove the handler before the directive is pre-handled.  Expect the failure callback to be called for the
+ * directive.
+ */
+TEST_F(DirectiveProcessorTest, test_concurrentPreHandleFailureReported) {
+    auto pool = std::make_shared<utils::threading::WorkStealingThreadPool>(1);
+    std::promise<std::shared_ptr<AVSDirective>> failedPromise;
+    auto failedFuture = failedPromise.get_future();
+    auto processor = std::make_shared<DirectiveProcessor>(
+        m_router.get(), [pool] { return pool; }, [&failedPromise](std::shared_ptr<AVSDirective> directive) {
+            failedPromise.set_value(directive);
+        });
+
+    DirectiveHandlerConfiguration handler0Config;
+    handler0Config[NamespaceAndName{NAMESPACE_AND_NAME_0_0}] = BlockingPolicy(BlockingPolicy::MEDIUM_AUDIO, true);
+    auto handler0 = MockDirectiveHandler::create(handler0Config);
+    ON_CALL(*(handler0.get()), supportsConcurrentPreHandle()).WillByDefault(Return(true));
+    ASSERT_TRUE(m_router->addDirectiveHandler(handler0));
+
+    EXPECT_CALL(*(handler0.get()), preHandleDirective(_, _)).Times(0);
+    EXPECT_CALL(*(handler0.get()), handleDirective(_)).Times(0);
+
+    std::promise<void> poolGatePromise;
+    std::shared_future<void> poolGate = poolGatePromise.get_future();
+    ASSERT_TRUE(pool->submit([poolGate]() { poolGate.wait(); }));
+
+    processor->setDialogRequestId(DIALOG_REQUEST_ID_0);
+    ASSERT_TRUE(processor->onDirective(m_directive_0_0));
+    ASSERT_TRUE(m_router->removeDirectiveHandler(handler0));
+    poolGatePromise.set_value();
+
+    ASSERT_EQ(failedFuture.wait_for(MockDirectiveHandler::DEFAULT_DONE_TIMEOUT_MS), std::future_status::ready);
+    ASSERT_EQ(failedFuture.get(), m_directive_0_0);
+    processor->shutdown();
+}
+
+/**
+ * Register a handler which supports concurrent pre-handling.  Change the @c dialogRequestId while its directive is
+ * being pre-handled.  Expect the directive to be cancelled and not handled.
+ */
+TEST_F(DirectiveProcessorTest, test_cancelDuringConcurrentPreHandle) {
+    auto pool = std::make_shared<utils::threading::WorkStealingThreadPool>(1);
+    auto processor = std::make_shared<DirectiveProcessor>(m_router.get(), [pool] { return pool; });
+
+    DirectiveHandlerConfiguration handler0Config;
+    handler0Config[NamespaceAndName{NAMESPACE_AND_NAME_0_0}] = BlockingPolicy(BlockingPolicy::MEDIUM_AUDIO, true);
+    auto handler0 = MockDirectiveHandler::create(handler0Config);
+    ON_CALL(*(handler0.get()), supportsConcurrentPreHandle()).WillByDefault(Return(true));
+    ASSERT_TRUE(m_router->addDirectiveHandler(handler0));
+
+    std::promise<void> preHandleStartedPromise;
+    std::promise<void> preHandleGatePromise;
+    std::shared_future<void> preHandleGate = preHandleGatePromise.get_future();
+    EXPECT_CALL(*(handler0.get()), preHandleDirective(m_directive_0_0, _))
+        .WillOnce(Invoke([&handler0, &preHandleStartedPromise, preHandleGate](
+                             std::shared_ptr<AVSDirective> directive,
+                             std::shared_ptr<sdkInterfaces::DirectiveHandlerResultInterface> result) {
+            preHandleStartedPromise.set_value();
+            preHandleGate.wait();
+            handler0->mockPreHandleDirective(directive, result);
+        }));
+    std::promise<void> cancelPromise;
+    EXPECT_CALL(*(handler0.get()), cancelDirective(MESSAGE_ID_0_0))
+        .WillOnce(Invoke([&cancelPromise](const std::string& messageId) { cancelPromise.set_value(); }));
+    EXPECT_CALL(*(handler0.get()), handleDirective(_)).Times(0);
+
+    processor->setDialogRequestId(DIALOG_REQUEST_ID_0);
+    ASSERT_TRUE(processor->onDirective(m_directive_0_0));
+    preHandleStartedPromise.get_future().wait();
+
+    processor->setDialogRequestId(DIALOG_REQUEST_ID_1);
+    EXPECT_EQ(
+        cancelPromise.get_future().wait_for(MockDirectiveHandler::DEFAULT_DONE_TIMEOUT_MS), std::future_status::ready);
+    preHandleGatePromise.set_value();
+    processor->shutdown();
+}
+
+/**
+ * Register a handler which does not support concurrent pre-handling and one which does, and send a directive for
+ * each.  Expect the pre-handling pool to be obtained only when the directive for the second handler arrives.
+ */
+TEST_F(DirectiveProcessorTest, test_preHandlePoolObtainedOnlyWhenNeeded) {
+    auto pool = std::make_shared<utils::threading::WorkStealingThreadPool>(1);
+    std::atomic<int> poolRequests{0};
+    auto processor = std::make_shared<DirectiveProcessor>(m_router.get(), [pool, &poolRequests] {
+        ++poolRequests;
+        return pool;
+    });
+
+    DirectiveHandlerConfiguration handler0Config;
+    handler0Config[NamespaceAndName{NAMESPACE_AND_NAME_0_0}] = BlockingPolicy(BlockingPolicy::MEDIUM_AUDIO, false);
+    auto handler0 = MockDirectiveHandler::create(handler0Config);
+
+    DirectiveHandlerConfiguration handler1Config;
+    handler1Config[NamespaceAndName{NAMESPACE_AND_NAME_0_1}] = BlockingPolicy(BlockingPolicy::MEDIUM_VISUAL, false);
+    auto handler1 = MockDirectiveHandler::create(handler1Config);
+    ON_CALL(*(handler1.get()), supportsConcurrentPreHandle()).WillByDefault(Return(true));
+
+    ASSERT_TRUE(m_router->addDirectiveHandler(handler0));
+    ASSERT_TRUE(m_router->addDirectiveHandler(handler1));
+    EXPECT_CALL(*(handler0.get()), preHandleDirective(m_directive_0_0, _)).Times(1);
+    EXPECT_CALL(*(handler1.get()), preHandleDirective(m_directive_0_1, _)).Times(1);
+
+    processor->setDialogRequestId(DIALOG_REQUEST_ID_0);
+    ASSERT_TRUE(processor->onDirective(m_directive_0_0));
+    EXPECT_TRUE(handler0->waitUntilCompleted());
+    EXPECT_EQ(poolRequests, 0);
+
+    ASSERT_TRUE(processor->onDirective(m_directive_0_1));
+    EXPECT_TRUE(handler1->waitUntilCompleted());
+    EXPECT_EQ(poolRequests, 1);
+    processor->shutdown();
+}
+
 }  // namespace test
 }  // namespace adsl
 }  // namespace alexaClientSDK
@@ -16,9 +16,12 @@
 // @file DirectiveSequencerTest.cpp
 
 #include <chrono>
+#include <condition_variable>
 #include <future>
 #include <string>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
@@ -959,6 +962,157 @@ TEST_F(DirectiveSequencerTest, test_addDirectiveAfterReEnabled) {
     ASSERT_TRUE(handler->waitUntilCompleted());
 }
 
+/// Name for Test::Visual directives used by the benchmark.
+static const std::string NAME_VISUAL("Visual");
+
+/// The number of blocking audio directives, and of non-blocking visual directives, the benchmark queues.
+static const int BENCHMARK_DIRECTIVES_PER_MEDIUM = 4000;
+
+/// How long to wait for the benchmark directives to be handled.
+static const std::chrono::seconds BENCHMARK_TIMEOUT(120);
+
+/**
+ * A @c DirectiveHandlerInterface for the benchmark which completes every directive as soon as it is handled, except
+ * for one gate directive whose completion is triggered by the test.
+ */
+class BenchmarkDirectiveHandler : public DirectiveHandlerInterface {
+public:
+    /**
+     * Constructor.
+     *
+     * @param gateMessageId The messageId of the directive which is only completed by @c completeGate().
+     * @param expectedCount The number of directives to handle before @c waitUntilAllHandled() returns.
+     */
+    BenchmarkDirectiveHandler(const std::string& gateMessageId, int expectedCount) :
+            m_gateMessageId{gateMessageId},
+            m_expectedCount{expectedCount},
+            m_handledCount{0} {
+    }
+
+    void handleDirectiveImmediately(std::shared_ptr<AVSDirective> directive) override {
+    }
+
+    void preHandleDirective(
+        std::shared_ptr<AVSDirective> directive,
+        std::unique_ptr<DirectiveHandlerResultInterface> result) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_results[directive->getMessageId()] = std::move(result);
+    }
+
+    bool handleDirective(const std::string& messageId) override {
+        std::unique_ptr<DirectiveHandlerResultInterface> result;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (messageId == m_gateMessageId) {
+                return true;
+            }
+            auto it = m_results.find(messageId);
+            if (it == m_results.end()) {
+                return false;
+            }
+            result = std::move(it->second);
+            m_results.erase(it);
+        }
+        result->setCompleted();
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (++m_handledCount == m_expectedCount) {
+            m_allHandled.notify_all();
+        }
+        return true;
+    }
+
+    void cancelDirective(const std::string& messageId) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_results.erase(messageId);
+    }
+
+    void onDeregistered() override {
+    }
+
+    DirectiveHandlerConfiguration getConfiguration() const override {
+        DirectiveHandlerConfiguration config;
+        config[NamespaceAndName{NAMESPACE_TEST, NAME_BLOCKING}] = BlockingPolicy(BlockingPolicy::MEDIUM_AUDIO, true);
+        config[NamespaceAndName{NAMESPACE_TEST, NAME_VISUAL}] = BlockingPolicy(BlockingPolicy::MEDIUM_VISUAL, false);
+        return config;
+    }
+
+    /**
+     * Complete the gate directive, unblocking the audio medium.
+     */
+    void completeGate() {
+        std::unique_ptr<DirectiveHandlerResultInterface> result;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            result = std::move(m_results[m_gateMessageId]);
+        }
+        if (result) {
+            result->setCompleted();
+        }
+    }
+
+    /**
+     * Wait until the expected number of directives other than the gate have been handled.
+     *
+     * @param timeout How long to wait.
+     * @return Whether the directives were handled before the timeout.
+     */
+    bool waitUntilAllHandled(std::chrono::milliseconds timeout) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_allHandled.wait_for(lock, timeout, [this] { return m_handledCount >= m_expectedCount; });
+    }
+
+private:
+    /// The messageId of the gate directive.
+    const std::string m_gateMessageId;
+
+    /// The number of directives to handle before @c waitUntilAllHandled() returns.
+    const int m_expectedCount;
+
+    /// Serializes access to the members below.
+    std::mutex m_mutex;
+
+    /// Notified when the expected number of directives have been handled.
+    std::condition_variable m_allHandled;
+
+    /// The number of directives handled, not counting the gate.
+    int m_handledCount;
+
+    /// The results of pre-handled directives, by messageId.
+    std::unordered_map<std::string, std::unique_ptr<DirectiveHandlerResultInterface>> m_results;
+};
+
+/**
+ * Benchmark pushing thousands of directives through the @c DirectiveSequencer.  A blocking audio directive holds up a
+ * large backlog of blocking audio directives while as many non-blocking visual directives pass it, then the backlog is
+ * released.  This used to take time quadratic in the size of the backlog.
+ */
+TEST_F(DirectiveSequencerTest, testSlow_benchmarkDirectiveBacklog) {
+    const std::string gateMessageId = "Message_Gate";
+    auto handler = std::make_shared<BenchmarkDirectiveHandler>(gateMessageId, 2 * BENCHMARK_DIRECTIVES_PER_MEDIUM);
+    ASSERT_TRUE(m_sequencer->addDirectiveHandler(handler));
+
+    auto createDirective = [this](const std::string& name, const std::string& messageId) {
+        auto header = std::make_shared<AVSMessageHeader>(NAMESPACE_TEST, name, messageId);
+        return AVSDirective::create(
+            UNPARSED_DIRECTIVE, header, PAYLOAD_TEST, m_attachmentManager, TEST_ATTACHMENT_CONTEXT_ID);
+    };
+    std::vector<std::shared_ptr<AVSDirective>> directives;
+    directives.push_back(createDirective(NAME_BLOCKING, gateMessageId));
+    for (int i = 0; i < BENCHMARK_DIRECTIVES_PER_MEDIUM; ++i) {
+        directives.push_back(createDirective(NAME_BLOCKING, "Message_Audio_" + std::to_string(i)));
+    }
+    for (int i = 0; i < BENCHMARK_DIRECTIVES_PER_MEDIUM; ++i) {
+        directives.push_back(createDirective(NAME_VISUAL, "Message_Visual_" + std::to_string(i)));
+    }
+
+    for (const auto& directive : directives) {
+        ASSERT_TRUE(m_sequencer->onDirective(directive));
+    }
+    handler->completeGate();
+    ASSERT_TRUE(handler->waitUntilAllHandled(BENCHMARK_TIMEOUT));
+    ASSERT_TRUE(m_sequencer->removeDirectiveHandler(handler));
+}
+
 }  // namespace test
 }  // namespace adsl
 }  // namespace alexaClientSDK
@@ -239,6 +239,7 @@ public:
         void(
             std::shared_ptr<avsCommon::avs::AVSDirective>,
             std::shared_ptr<avsCommon::sdkInterfaces::DirectiveHandlerResultInterface>));
+    MOCK_CONST_METHOD0(supportsConcurrentPreHandle, bool());
     MOCK_METHOD1(handleDirective, bool(const std::string&));
     MOCK_METHOD1(cancelDirective, void(const std::string&));
     MOCK_METHOD0(onDeregistered, void());
@@ -77,7 +77,7 @@ bool FocusManager::acquireChannel(
         return false;
     }
 
-    m_executor.submit(
+    m_executor.execute(
         [this, channelToAcquire, channelActivity]() { acquireChannelHelper(channelToAcquire, channelActivity); });
     return true;
 }
@@ -97,7 +97,7 @@ bool FocusManager::acquireChannel(
         return false;
     }
 
-    m_executor.submit(
+    m_executor.execute(
         [this, channelToAcquire, channelActivity]() { acquireChannelHelper(channelToAcquire, channelActivity); });
     return true;
 }
@@ -117,7 +117,7 @@ std::future<bool> FocusManager::releaseChannel(
         return returnValue;
     }
 
-    m_executor.submit([this, channelToRelease, channelObserver, releaseChannelSuccess, channelName]() {
+    m_executor.execute([this, channelToRelease, channelObserver, releaseChannelSuccess, channelName]() {
         releaseChannelHelper(channelToRelease, channelObserver, releaseChannelSuccess, channelName);
     });
 
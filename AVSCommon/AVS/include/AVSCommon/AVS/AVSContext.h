@@ -16,8 +16,10 @@
 #define ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_AVSCONTEXT_H_
 
 #include <map>
+#include <memory>
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include "AVSCommon/AVS/CapabilityTag.h"
 #include "AVSCommon/AVS/CapabilityState.h"
@@ -46,10 +48,39 @@ public:
     /**
      * Return a stringified json representation of @c AVSContext value.
      *
+     * If a serialization was set with @c setJson(), it is returned without regenerating it.
+     *
      * @return A stringified json following AVS format specification.
      */
     std::string toJson() const;
 
+    /**
+     * Set a serialization of this context, built with @c fragmentsToJson() from the same states, which @c toJson()
+     * will then return instead of generating its own.  The serialization is dropped by @c addState() and
+     * @c removeState().
+     *
+     * @param json The serialization, or @c nullptr to generate it on demand.
+     */
+    void setJson(std::shared_ptr<const std::string> json);
+
+    /**
+     * Serialize the state of one capability as an element of the context properties array.
+     *
+     * @param identifier The capability identifier.
+     * @param state The state of the capability.
+     * @return The serialized element, or an empty string if the state has no value and is left out of the context.
+     */
+    static std::string stateToJson(const CapabilityTag& identifier, const CapabilityState& state);
+
+    /**
+     * Join serialized states into a context.  Joining the fragments of the states of a context, in the order of
+     * @c getStates(), gives the same string as @c toJson().
+     *
+     * @param fragments The serialized states, as returned by @c stateToJson().  Empty fragments are skipped.
+     * @return A stringified json following AVS format specification.
+     */
+    static std::string fragmentsToJson(const std::vector<const std::string*>& fragments);
+
     /**
      * Get all states available in this context.
      *
@@ -86,6 +117,9 @@ public:
 private:
     /// A map of capabilities and their state.
     States m_states;
+
+    /// A serialization of @c m_states to return from @c toJson(), or @c nullptr if it must be generated.
+    std::shared_ptr<const std::string> m_json;
 };
 
 }  // namespace avs
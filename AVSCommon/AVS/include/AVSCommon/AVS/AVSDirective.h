@@ -21,6 +21,9 @@
 #include <string>
 #include <utility>
 
+#include <rapidjson/document.h>
+
+#include "AVSCommon/Utils/JSON/PooledJSONDocument.h"
 #include "Attachment/AttachmentManagerInterface.h"
 #include "AVSMessage.h"
 
@@ -30,6 +33,9 @@ namespace avs {
 
 /**
  * A class representation of the AVS directive.
+ *
+ * The parsed JSON of the directive is kept alive with the directive, so capability agents can read the payload with
+ * @c getPayloadValue() instead of parsing @c getPayload() again.
  */
 class AVSDirective : public AVSMessage {
 public:
@@ -106,6 +112,13 @@ public:
         const std::string& contentId,
         utils::sds::ReaderPolicy readerPolicy) const;
 
+    /**
+     * Returns the parsed payload of the directive.  The value remains valid for the lifetime of the directive.
+     *
+     * @return The payload, or a null value if the payload is not valid JSON.
+     */
+    const rapidjson::Value& getPayloadValue() const;
+
     /**
      * Returns the underlying unparsed directive.
      */
@@ -126,6 +139,8 @@ private:
      * @param attachmentManager The attachment manager object.
      * @param attachmentContextId The contextId required to get attachments from the AttachmentManager.
      * @param endpoint Optional parameter used to identify the target endpoint for the given directive.
+     * @param document The parsed JSON holding the payload, or @c nullptr if the payload is not valid JSON.
+     * @param payloadValue The parsed payload within @c document, or @c nullptr if @c document is @c nullptr.
      */
     AVSDirective(
         const std::string& unparsedDirective,
@@ -133,7 +148,9 @@ private:
         const std::string& payload,
         std::shared_ptr<avsCommon::avs::attachment::AttachmentManagerInterface> attachmentManager,
         const std::string& attachmentContextId,
-        const utils::Optional<AVSMessageEndpoint>& endpoint);
+        const utils::Optional<AVSMessageEndpoint>& endpoint,
+        std::shared_ptr<const utils::json::PooledJSONDocument> document,
+        const rapidjson::Value* payloadValue);
 
     /// The unparsed directive JSON string from AVS.
     const std::string m_unparsedDirective;
@@ -141,6 +158,10 @@ private:
     std::shared_ptr<avsCommon::avs::attachment::AttachmentManagerInterface> m_attachmentManager;
     /// The contextId needed to acquire the right attachment from the attachmentManager.
     std::string m_attachmentContextId;
+    /// The parsed JSON which @c m_payloadValue points into.
+    std::shared_ptr<const utils::json::PooledJSONDocument> m_document;
+    /// The parsed payload, or @c nullptr if the payload is not valid JSON.
+    const rapidjson::Value* m_payloadValue;
 };
 
 /**
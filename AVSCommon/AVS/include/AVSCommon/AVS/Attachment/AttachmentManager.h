@@ -16,10 +16,13 @@
 #ifndef ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_ATTACHMENTMANAGER_H_
 #define ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_ATTACHMENTMANAGER_H_
 
+#include <memory>
 #include <mutex>
 #include <unordered_map>
 
 #include "AVSCommon/AVS/Attachment/AttachmentManagerInterface.h"
+#include "AVSCommon/AVS/Attachment/AttachmentMemoryPool.h"
+#include "AVSCommon/AVS/Attachment/ChunkedAttachmentBuffer.h"
 
 namespace alexaClientSDK {
 namespace avsCommon {
@@ -40,12 +43,12 @@ namespace attachment {
  *  @li An AttachmentReader or AttachmentWriter has reference to a shared buffer resource for the actual data.  This
  *    buffer will remain in existence until both the Reader and Writer have been destroyed.
  *  @li Therefore, application code should ensure that Readers and Writers are destroyed when no longer needed.
- *  @li The AttachmentManager will always satisfy a request to create a Reader or Writer - it will not currently
- *    enforce a maximum resource limit.
- *  @li ACSDK-254 will address this by enforcing such limits.  It should also be noted however, that a well
- *    behaving application may not observe much difference - the future implementation will forcibly close
- *    the oldest Attachment to make space for the new one.  For a system reading and writing a small set of attachments
- *    at any given time, the AttachmentManager should not need to step in and take such action.
+ *  @li The AttachmentManager will always satisfy a request to create a Reader or Writer.  The data of the attachments
+ *    is held in chunks from an @c AttachmentMemoryPool shared by all of them, which grow as data is written and are
+ *    recycled as it is read.  When the memory held by the attachments reaches the pool's budget, the manager
+ *    releases the attachments it no longer needs to hold, and discards the data of expired attachments.  Data which
+ *    may still be read is never discarded: writers see a full buffer, or wait, until readers catch up or attachments
+ *    are released.
  */
 class AttachmentManager : public AttachmentManagerInterface {
 public:
@@ -86,6 +89,11 @@ public:
      */
     AttachmentManager(AttachmentType attachmentType);
 
+    /**
+     * Destructor.
+     */
+    ~AttachmentManager() override;
+
     std::string generateAttachmentId(const std::string& contextId, const std::string& contentId) const override;
 
     bool setAttachmentTimeoutMinutes(std::chrono::minutes timeoutMinutes) override;
@@ -97,6 +105,22 @@ public:
     std::unique_ptr<AttachmentReader> createReader(const std::string& attachmentId, utils::sds::ReaderPolicy policy)
         override;
 
+    /**
+     * Set the budget for the memory held by the data of all attachments of this manager.  The default is
+     * @c AttachmentMemoryPool::DEFAULT_BUDGET_IN_BYTES.
+     *
+     * @param budgetInBytes The budget.
+     */
+    void setMemoryBudget(size_t budgetInBytes);
+
+    /**
+     * Obtain statistics about the memory held by the data of the attachments of this manager, including the current
+     * and peak usage.
+     *
+     * @return The statistics.
+     */
+    AttachmentMemoryPool::Stats getMemoryStats() const;
+
 private:
     /**
      * A utility structure to encapsulate an @c Attachment, its creation time, and other appropriate data fields.
@@ -111,6 +135,8 @@ private:
         std::chrono::steady_clock::time_point creationTime;
         /// The Attachment this object is managing.
         std::unique_ptr<Attachment> attachment;
+        /// The buffer holding the data of @c attachment, used to reclaim its memory.
+        std::shared_ptr<ChunkedAttachmentBuffer> buffer;
     };
 
     /**
@@ -131,8 +157,16 @@ private:
      */
     void removeExpiredAttachmentsLocked();
 
+    /**
+     * Free memory held for data which will not be read, when the budget of @c m_memoryPool is exhausted.  Attachments
+     * which already have a reader and a writer are released, and the data of expired attachments is discarded.
+     */
+    void reclaimMemory();
+
     /// The type of attachments that this manager will create.
     AttachmentType m_attachmentType;
+    /// The pool holding the data of the attachments.
+    std::shared_ptr<AttachmentMemoryPool> m_memoryPool;
     /// The timeout in minutes.  Any attachment whose lifetime exceeds this value will be released.
     std::chrono::minutes m_attachmentExpirationMinutes;
     /// The mutex to ensure the non-static public APIs are thread safe.
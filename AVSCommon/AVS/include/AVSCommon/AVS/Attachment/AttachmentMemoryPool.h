@@ -0,0 +1,205 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_ATTACHMENTMEMORYPOOL_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_ATTACHMENTMEMORYPOOL_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace attachment {
+
+/**
+ * A pool of fixed-size chunks of memory for the data of attachments, with a budget for the memory which all of the
+ * attachments sharing the pool may hold at once.
+ *
+ * Chunks returned to the pool are kept for reuse, up to a limit, so that a burst of attachments does not cost a burst
+ * of allocations.  When the budget is exhausted, @c acquireChunk() fails.  The attachment then asks the owner of the
+ * pool to free memory held for data which will not be read (see @c setReclaimFunction()), and if that is not enough,
+ * applies backpressure to its writer until other attachments release memory.
+ *
+ * This class is thread safe.
+ */
+class AttachmentMemoryPool {
+public:
+    /// The default size of a chunk.
+    static constexpr size_t DEFAULT_CHUNK_SIZE = 16 * 1024;
+
+    /// The default budget for the memory held by attachments.
+    static constexpr size_t DEFAULT_BUDGET_IN_BYTES = 32 * 1024 * 1024;
+
+    /// The default limit on the memory kept in the pool for reuse.
+    static constexpr size_t DEFAULT_MAX_POOLED_BYTES = 1024 * 1024;
+
+    /// A chunk of memory.
+    using Chunk = std::unique_ptr<uint8_t[]>;
+
+    /// A function which frees memory held by the attachments using the pool, called when the budget is exhausted.
+    using ReclaimFunction = std::function<void()>;
+
+    /// Statistics about the memory held by attachments.
+    struct Stats {
+        /// The memory currently held by attachments.
+        size_t currentBytes;
+
+        /// The most memory held by attachments at once.
+        size_t peakBytes;
+
+        /// The memory kept in the pool for reuse, which is not counted in @c currentBytes.
+        size_t pooledBytes;
+
+        /// The budget for @c currentBytes.
+        size_t budgetBytes;
+
+        /// The number of times a chunk was refused because the budget was exhausted.
+        uint64_t exhaustedCount;
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param budgetInBytes The budget for the memory held by attachments using this pool.
+     * @param chunkSize The size of each chunk.
+     * @param maxPooledBytes The limit on the memory kept in the pool for reuse.
+     */
+    AttachmentMemoryPool(
+        size_t budgetInBytes = DEFAULT_BUDGET_IN_BYTES,
+        size_t chunkSize = DEFAULT_CHUNK_SIZE,
+        size_t maxPooledBytes = DEFAULT_MAX_POOLED_BYTES);
+
+    /**
+     * Obtain the size of the chunks in this pool.
+     *
+     * @return The size of a chunk.
+     */
+    size_t getChunkSize() const;
+
+    /**
+     * Obtain a chunk, reusing a pooled one if possible.
+     *
+     * @return A chunk of @c getChunkSize() bytes, or @c nullptr if the budget is exhausted.
+     */
+    Chunk acquireChunk();
+
+    /**
+     * Return a chunk obtained from @c acquireChunk().
+     *
+     * @param chunk The chunk.
+     */
+    void releaseChunk(Chunk chunk);
+
+    /**
+     * Change the budget.  Memory already held beyond a reduced budget is not reclaimed, but no more is handed out
+     * until enough has been released.
+     *
+     * @param budgetInBytes The budget for the memory held by attachments using this pool.
+     */
+    void setBudget(size_t budgetInBytes);
+
+    /**
+     * Check whether a chunk can be acquired without exceeding the budget.
+     *
+     * @return Whether the budget has room for another chunk.
+     */
+    bool hasRoomForChunk() const;
+
+    /**
+     * Set the function which frees memory held by the attachments using the pool when the budget is exhausted.  Once
+     * this returns, a previous function is no longer being called.
+     *
+     * @param reclaimFunction The function, or @c nullptr to remove it.  It may lock any attachment using the pool.
+     */
+    void setReclaimFunction(ReclaimFunction reclaimFunction);
+
+    /**
+     * Call the reclaim function, if one is set.  Must not be called with the lock of an attachment held.
+     */
+    void reclaim();
+
+    /**
+     * Obtain a count which changes whenever memory is released to the pool, or the budget changes.
+     *
+     * @return The count.
+     */
+    uint64_t getReleaseCount() const;
+
+    /**
+     * Wait until memory is released to the pool, the budget changes or @c wakeWaiters() is called.
+     *
+     * @param releaseCount The value of @c getReleaseCount() before the attempt to acquire a chunk which failed.
+     * @param timeout The maximum time to wait.  Zero means wait forever.
+     */
+    void waitForRelease(uint64_t releaseCount, std::chrono::milliseconds timeout);
+
+    /**
+     * Wake the threads waiting in @c waitForRelease(), so that they check their attachment again.
+     */
+    void wakeWaiters();
+
+    /**
+     * Obtain statistics about the memory held by attachments.
+     *
+     * @return The statistics.
+     */
+    Stats getStats() const;
+
+private:
+    /// The size of each chunk.
+    const size_t m_chunkSize;
+
+    /// The limit on the number of chunks kept in @c m_pooledChunks.
+    const size_t m_maxPooledChunks;
+
+    /// Serializes access to the members below.
+    mutable std::mutex m_mutex;
+
+    /// The chunks kept for reuse.
+    std::vector<Chunk> m_pooledChunks;
+
+    /// The statistics, with @c pooledBytes computed when they are read.
+    Stats m_stats;
+
+    /// Whether the last request for a chunk was refused, so that the exhaustion is only logged once.
+    bool m_exhausted;
+
+    /// Incremented whenever memory is released or the budget changes.
+    uint64_t m_releaseCount;
+
+    /// Notified when @c m_releaseCount changes.
+    std::condition_variable m_releaseTrigger;
+
+    /// Serializes calls to @c m_reclaimFunction with changes to it.
+    std::mutex m_reclaimMutex;
+
+    /// The function which frees memory held by the attachments using the pool.
+    ReclaimFunction m_reclaimFunction;
+};
+
+}  // namespace attachment
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_ATTACHMENTMEMORYPOOL_H_
@@ -18,6 +18,7 @@
 
 #include <chrono>
 #include <cstddef>
+#include <functional>
 #include <ostream>
 
 #include "AVSCommon/Utils/SDS/ReaderPolicy.h"
@@ -107,8 +108,23 @@ public:
      * @param closePoint The point at which the reader should stop reading from the attachment.
      */
     virtual void close(ClosePoint closePoint = ClosePoint::AFTER_DRAINING_CURRENT_BUFFER) = 0;
+
+    /**
+     * Set a function to call when the writer of the attachment makes new data available to this reader, or closes.
+     * This lets a non-blocking reader wait for data without polling.  The default implementation does not support
+     * this.
+     *
+     * @param callback The function to call, or an empty function to stop calling one.  It may be called from the
+     * writer's thread while the writer holds a lock, so it must return quickly and must not use this reader.
+     * @return Whether the reader calls @c callback.  If @c false, the reader must be polled for data.
+     */
+    virtual bool setDataAvailableCallback(std::function<void()> callback);
 };
 
+inline bool AttachmentReader::setDataAvailableCallback(std::function<void()> callback) {
+    return false;
+}
+
 /**
  * Write an @c Attachment::ReadStatus value to the given stream.
  *
@@ -18,6 +18,7 @@
 
 #include <chrono>
 #include <cstddef>
+#include <functional>
 #include <ostream>
 
 namespace alexaClientSDK {
@@ -76,8 +77,23 @@ public:
      * needs to use an attachment.
      */
     virtual void close() = 0;
+
+    /**
+     * Set a function to call when a reader of the attachment consumes data, or goes away, so that there may be more
+     * space to write into.  This lets a writer whose write timed out or found the buffer full wait for space without
+     * polling.  The default implementation does not support this.
+     *
+     * @param callback The function to call, or an empty function to stop calling one.  It may be called from a
+     * reader's thread while the reader holds a lock, so it must return quickly and must not use this writer.
+     * @return Whether the writer calls @c callback.  If @c false, the writer must be polled for space.
+     */
+    virtual bool setSpaceAvailableCallback(std::function<void()> callback);
 };
 
+inline bool AttachmentWriter::setSpaceAvailableCallback(std::function<void()> callback) {
+    return false;
+}
+
 /**
  * Write an @c Attachment::WriteStatus value to the given stream.
  *
@@ -0,0 +1,305 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_CHUNKEDATTACHMENTBUFFER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_CHUNKEDATTACHMENTBUFFER_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "AVSCommon/AVS/Attachment/AttachmentMemoryPool.h"
+#include "AVSCommon/AVS/Attachment/AttachmentReader.h"
+#include "AVSCommon/AVS/Attachment/AttachmentWriter.h"
+#include "AVSCommon/Utils/SDS/ReaderPolicy.h"
+#include "AVSCommon/Utils/SDS/WriterPolicy.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace attachment {
+
+/**
+ * The storage of an attachment which grows in chunks taken from an @c AttachmentMemoryPool, rather than being
+ * allocated at its maximum size up front.
+ *
+ * The buffer follows the semantics of the @c SharedDataStream used by other attachments: there is one writer and up
+ * to a fixed number of readers, readers start at the beginning of the data, and the writer may not get further than
+ * @c maxSize bytes ahead of the oldest reader (or of the beginning of the data, until a reader is created).  Chunks
+ * which every open reader has passed are returned to the pool as soon as they are consumed, and once the writer and
+ * every reader are done, the last chunk is returned too.
+ *
+ * When the pool's budget is exhausted, the writer first asks the pool to reclaim memory held by other attachments
+ * (see @c AttachmentMemoryPool::reclaim()).  If that is not enough, the writer is treated as if the buffer were full:
+ * @c ALL_OR_NOTHING writes return @c OK_BUFFER_FULL, @c BLOCKING writes wait until memory is released to the pool, and
+ * @c NONBLOCKABLE writes reuse the oldest chunk of the buffer.
+ *
+ * This class is thread safe.  It is used through @c ChunkedAttachmentWriter and @c ChunkedAttachmentReader.
+ */
+class ChunkedAttachmentBuffer {
+public:
+    /**
+     * Constructor.
+     *
+     * @param pool The pool to take chunks from.  Must not be @c nullptr.
+     * @param maxSize The most data the writer may be ahead of the oldest reader.
+     * @param maxReaders The maximum number of readers which may exist at once.
+     */
+    ChunkedAttachmentBuffer(std::shared_ptr<AttachmentMemoryPool> pool, size_t maxSize, size_t maxReaders);
+
+    /**
+     * Destructor.  Returns all chunks to the pool.
+     */
+    ~ChunkedAttachmentBuffer();
+
+    /**
+     * Write data to the end of the buffer.
+     *
+     * @param buf The data to write.
+     * @param numBytes The number of bytes to write.
+     * @param policy The policy of the writer.
+     * @param[out] writeStatus The status of the write.
+     * @param timeout The maximum time a @c BLOCKING write waits for space.  Zero means wait forever.
+     * @return The number of bytes written.
+     */
+    size_t write(
+        const void* buf,
+        size_t numBytes,
+        utils::sds::WriterPolicy policy,
+        AttachmentWriter::WriteStatus* writeStatus,
+        std::chrono::milliseconds timeout);
+
+    /**
+     * Close the writer.  Readers can still read the data which was written.
+     */
+    void closeWriter();
+
+    /**
+     * Add a reader, positioned at the beginning of the data.
+     *
+     * @param[out] id The id of the new reader.
+     * @return Whether a reader was added, which fails when @c maxReaders readers exist.
+     */
+    bool addReader(size_t* id);
+
+    /**
+     * Remove a reader, so that it no longer holds on to data.
+     *
+     * @param id The id of the reader.
+     */
+    void removeReader(size_t id);
+
+    /**
+     * Read data from the position of a reader.
+     *
+     * @param id The id of the reader.
+     * @param buf The buffer to read into.
+     * @param numBytes The size of @c buf.
+     * @param policy The policy of the reader.
+     * @param resetOnOverrun Whether a reader whose data was discarded moves to the end of the data, rather than
+     * failing.
+     * @param[out] readStatus The status of the read.
+     * @param timeout The maximum time a @c BLOCKING read waits for data.  Zero means wait forever.
+     * @return The number of bytes read.
+     */
+    size_t read(
+        size_t id,
+        void* buf,
+        size_t numBytes,
+        utils::sds::ReaderPolicy policy,
+        bool resetOnOverrun,
+        AttachmentReader::ReadStatus* readStatus,
+        std::chrono::milliseconds timeout);
+
+    /**
+     * Set a function to call whenever data is written or the writer is closed, so that a non-blocking reader need not
+     * poll.  The function is called while the buffer is locked, so it must not use the buffer.
+     *
+     * @param id The id of the reader.
+     * @param callback The function to call, or an empty function to stop calling one.
+     */
+    void setDataAvailableCallback(size_t id, std::function<void()> callback);
+
+    /**
+     * Stop a reader from reading further.
+     *
+     * @param id The id of the reader.
+     * @param closePoint Whether the reader stops now, or after reading the data already written.
+     */
+    void closeReader(size_t id, AttachmentReader::ClosePoint closePoint);
+
+    /**
+     * Move a reader to an absolute position in the data.
+     *
+     * @param id The id of the reader.
+     * @param offset The position.
+     * @return Whether the reader moved, which fails if the data at @c offset has already been discarded, or the
+     * reader has been closed before @c offset.
+     */
+    bool seek(size_t id, uint64_t offset);
+
+    /**
+     * Obtain the number of bytes written which a reader has not read yet.
+     *
+     * @param id The id of the reader.
+     * @return The number of unread bytes.
+     */
+    uint64_t getNumUnreadBytes(size_t id);
+
+    /**
+     * Return all chunks to the pool and close the writer, for data which will not be read.  Readers see an overrun,
+     * and no more readers can be added.
+     */
+    void discard();
+
+private:
+    /// The outcome of @c reserveLocked().
+    enum class ReserveResult {
+        /// The chunks for the write are in the buffer.
+        RESERVED,
+        /// The writer is too far ahead of the readers.
+        NO_SPACE,
+        /// The pool's budget is exhausted.
+        POOL_EXHAUSTED
+    };
+
+    /// The state of a reader.
+    struct ReaderState {
+        /// Whether the reader exists.
+        bool enabled;
+
+        /// The position of the next byte the reader will read.
+        uint64_t position;
+
+        /// The position at which the reader stops reading.
+        uint64_t closePosition;
+
+        /// Called whenever data is written or the writer is closed, if set.
+        std::function<void()> onDataAvailable;
+    };
+
+    /**
+     * Obtain the position before which no reader needs data.
+     *
+     * @return The position.
+     */
+    uint64_t getOldestUnconsumedLocked() const;
+
+    /**
+     * Obtain the number of bytes the writer may write before getting @c maxSize bytes ahead of the readers.
+     *
+     * @return The number of bytes.
+     */
+    size_t getSpaceLocked() const;
+
+    /**
+     * Make sure the buffer has the chunks for a write, following the writer policy.
+     *
+     * @param[in,out] numBytes The number of bytes to write, reduced to the number which can be written.
+     * @param policy The policy of the writer.
+     * @param canRecycle Whether a @c NONBLOCKABLE writer may reuse the oldest chunks of the buffer if the pool's budget
+     * is exhausted.
+     * @return Whether the chunks were reserved, and if not, why.
+     */
+    ReserveResult reserveLocked(size_t* numBytes, utils::sds::WriterPolicy policy, bool canRecycle);
+
+    /**
+     * Make sure the buffer has the chunks to store the data up to a position.
+     *
+     * @param end The position.
+     * @return The position up to which the buffer can store data, which is less than @c end if the pool's budget
+     * is exhausted.
+     */
+    uint64_t growLocked(uint64_t end);
+
+    /**
+     * Return chunks before a position to the pool.
+     *
+     * @param position The position.
+     */
+    void releaseChunksLocked(uint64_t position);
+
+    /// Return the chunks which no reader needs to the pool, including the last one once the writer is closed.
+    void releaseConsumedChunksLocked();
+
+    /// Wake the readers waiting for data, and call their data available callbacks.
+    void notifyDataAvailableLocked();
+
+    /**
+     * Copy data into the buffer at the write position.
+     *
+     * @param buf The data.
+     * @param numBytes The number of bytes, which must already fit in the buffer's chunks.
+     */
+    void copyInLocked(const uint8_t* buf, size_t numBytes);
+
+    /**
+     * Copy data out of the buffer.
+     *
+     * @param position The position of the data.
+     * @param buf The buffer to copy to.
+     * @param numBytes The number of bytes, all of which must be in the buffer.
+     */
+    void copyOutLocked(uint64_t position, uint8_t* buf, size_t numBytes) const;
+
+    /// The pool to take chunks from.
+    const std::shared_ptr<AttachmentMemoryPool> m_pool;
+
+    /// The size of each chunk.
+    const size_t m_chunkSize;
+
+    /// The most data the writer may be ahead of the oldest reader.
+    const size_t m_maxSize;
+
+    /// Serializes access to the members below.
+    std::mutex m_mutex;
+
+    /// Notified when data is written, or the writer is closed.
+    std::condition_variable m_dataAvailable;
+
+    /// Notified when readers move, or the writer is closed.
+    std::condition_variable m_spaceAvailable;
+
+    /// The chunks holding the data, in order.
+    std::deque<AttachmentMemoryPool::Chunk> m_chunks;
+
+    /// The position of the first byte of the first chunk.  Always a multiple of @c m_chunkSize.
+    uint64_t m_startPosition;
+
+    /// The position the next byte will be written at.
+    uint64_t m_writePosition;
+
+    /// Whether the writer has been closed.
+    bool m_writerClosed;
+
+    /// The readers.
+    std::vector<ReaderState> m_readers;
+
+    /// Whether any reader has been added.
+    bool m_hasAddedReader;
+};
+
+}  // namespace attachment
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_CHUNKEDATTACHMENTBUFFER_H_
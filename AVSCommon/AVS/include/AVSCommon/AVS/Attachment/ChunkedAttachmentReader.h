@@ -0,0 +1,105 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_CHUNKEDATTACHMENTREADER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_CHUNKEDATTACHMENTREADER_H_
+
+#include <memory>
+
+#include "AVSCommon/AVS/Attachment/AttachmentReader.h"
+#include "AVSCommon/AVS/Attachment/ChunkedAttachmentBuffer.h"
+#include "AVSCommon/Utils/SDS/ReaderPolicy.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace attachment {
+
+/**
+ * A class that provides functionality to read data from an @c Attachment stored in a @c ChunkedAttachmentBuffer.
+ */
+class ChunkedAttachmentReader : public AttachmentReader {
+public:
+    /**
+     * Create a ChunkedAttachmentReader, positioned at the beginning of the data.
+     *
+     * @param policy The policy of the new Reader.
+     * @param buffer The buffer to read from.
+     * @param resetOnOverrun If true, a read which finds that the writer has discarded unread data moves the reader to
+     * the end of the data rather than failing.
+     * @return Returns a new ChunkedAttachmentReader, or nullptr if the operation failed.
+     */
+    static std::unique_ptr<ChunkedAttachmentReader> create(
+        utils::sds::ReaderPolicy policy,
+        std::shared_ptr<ChunkedAttachmentBuffer> buffer,
+        bool resetOnOverrun = false);
+
+    /**
+     * Destructor.
+     */
+    ~ChunkedAttachmentReader();
+
+    /// @name AttachmentReader methods.
+    /// @{
+    std::size_t read(
+        void* buf,
+        std::size_t numBytes,
+        ReadStatus* readStatus,
+        std::chrono::milliseconds timeoutMs = std::chrono::milliseconds(0)) override;
+
+    void close(ClosePoint closePoint = ClosePoint::AFTER_DRAINING_CURRENT_BUFFER) override;
+
+    bool seek(uint64_t offset) override;
+
+    uint64_t getNumUnreadBytes() override;
+
+    bool setDataAvailableCallback(std::function<void()> callback) override;
+    /// @}
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param policy The policy of the new Reader.
+     * @param buffer The buffer to read from.
+     * @param id The id of the reader in @c buffer.
+     * @param resetOnOverrun Whether to move to the end of the data rather than failing on an overrun.
+     */
+    ChunkedAttachmentReader(
+        utils::sds::ReaderPolicy policy,
+        std::shared_ptr<ChunkedAttachmentBuffer> buffer,
+        size_t id,
+        bool resetOnOverrun);
+
+    /// The policy of this reader.
+    const utils::sds::ReaderPolicy m_policy;
+
+    /// The buffer to read from.
+    std::shared_ptr<ChunkedAttachmentBuffer> m_buffer;
+
+    /// The id of this reader in @c m_buffer.
+    const size_t m_id;
+
+    /// Whether to move to the end of the data rather than failing on an overrun.
+    const bool m_resetOnOverrun;
+};
+
+}  // namespace attachment
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_CHUNKEDATTACHMENTREADER_H_
@@ -72,6 +72,8 @@ public:
 
     uint64_t getNumUnreadBytes() override;
 
+    bool setDataAvailableCallback(std::function<void()> callback) override;
+
     /// @}
 private:
     /**
@@ -248,6 +250,16 @@ bool DefaultAttachmentReader<SDSType>::seek(uint64_t offset) {
     return false;
 }
 
+template <typename SDSType>
+bool DefaultAttachmentReader<SDSType>::setDataAvailableCallback(std::function<void()> callback) {
+    if (!m_reader) {
+        ACSDK_ERROR(utils::logger::LogEntry(TAG, "setDataAvailableCallbackFailed").d("reason", "noReader"));
+        return false;
+    }
+    m_reader->setDataAvailableCallback(std::move(callback));
+    return true;
+}
+
 template <typename SDSType>
 uint64_t DefaultAttachmentReader<SDSType>::getNumUnreadBytes() {
     if (m_reader) {
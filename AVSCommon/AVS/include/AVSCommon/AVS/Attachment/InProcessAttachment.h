@@ -17,6 +17,8 @@
 #define ALEXA_CLIENT_SDK_AVSCOMMON_AVS_INCLUDE_AVSCOMMON_AVS_ATTACHMENT_INPROCESSATTACHMENT_H_
 
 #include "AVSCommon/AVS/Attachment/Attachment.h"
+#include "AVSCommon/AVS/Attachment/AttachmentMemoryPool.h"
+#include "AVSCommon/AVS/Attachment/ChunkedAttachmentBuffer.h"
 #include "AVSCommon/AVS/Attachment/InProcessAttachmentReader.h"
 #include "AVSCommon/AVS/Attachment/InProcessAttachmentWriter.h"
 
@@ -29,6 +31,10 @@ namespace attachment {
 
 /**
  * A class that represents an AVS attachment following an in-process memory management model.
+ *
+ * By default the data is held in a @c SharedDataStream of @c SDS_BUFFER_DEFAULT_SIZE_IN_BYTES, allocated up front.
+ * An attachment created with @c createWithMemoryPool() instead holds its data in chunks taken from an
+ * @c AttachmentMemoryPool as it is written, and returns them as it is read, with the same limit on unread data.
  */
 class InProcessAttachment : public Attachment {
 public:
@@ -48,6 +54,27 @@ public:
      */
     InProcessAttachment(const std::string& id, std::unique_ptr<SDSType> sds = nullptr, size_t maxNumReaders = 1);
 
+    /**
+     * Create an attachment whose data is stored in chunks taken from a memory pool.
+     *
+     * @param id The attachment id.
+     * @param memoryPool The pool to take chunks from, whose budget applies backpressure to the writer.
+     * @param maxNumReaders The maximum number of readers allowed.
+     * @return The attachment, or @c nullptr if @c memoryPool is @c nullptr.
+     */
+    static std::unique_ptr<InProcessAttachment> createWithMemoryPool(
+        const std::string& id,
+        std::shared_ptr<AttachmentMemoryPool> memoryPool,
+        size_t maxNumReaders = 1);
+
+    /**
+     * Obtain the buffer of an attachment created with @c createWithMemoryPool(), so that the owner of the pool can
+     * reclaim the memory it holds.
+     *
+     * @return The buffer, or @c nullptr if the data is stored in a @c SharedDataStream.
+     */
+    std::shared_ptr<ChunkedAttachmentBuffer> getChunkedBuffer() const;
+
     std::unique_ptr<AttachmentWriter> createWriter(
         InProcessAttachmentWriter::SDSTypeWriter::Policy policy =
             InProcessAttachmentWriter::SDSTypeWriter::Policy::ALL_OR_NOTHING) override;
@@ -55,8 +82,19 @@ public:
     std::unique_ptr<AttachmentReader> createReader(InProcessAttachmentReader::SDSTypeReader::Policy policy) override;
 
 private:
-    /// The sds from which we will create the reader and writer.
+    /**
+     * Constructor for an attachment stored in a @c ChunkedAttachmentBuffer.
+     *
+     * @param buffer The buffer holding the data.
+     * @param id The attachment id.
+     * @param maxNumReaders The maximum number of readers allowed.
+     */
+    InProcessAttachment(std::shared_ptr<ChunkedAttachmentBuffer> buffer, const std::string& id, size_t maxNumReaders);
+
+    /// The sds from which we will create the reader and writer, unless @c m_chunkedBuffer is used.
     std::shared_ptr<SDSType> m_sds;
+    /// The buffer from which we will create the reader and writer, for attachments using a memory pool.
+    std::shared_ptr<ChunkedAttachmentBuffer> m_chunkedBuffer;
     /// The maximum number of readers allowed
     const size_t m_maxNumReaders;
 };
@@ -76,6 +76,8 @@ public:
 
     uint64_t getNumUnreadBytes() override;
 
+    bool setDataAvailableCallback(std::function<void()> callback) override;
+
 private:
     /**
      * Constructor
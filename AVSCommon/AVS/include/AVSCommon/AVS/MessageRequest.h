@@ -236,6 +236,24 @@ public:
      */
     std::shared_ptr<MessageRequest> resolveRequest(const std::string& resolveKey) const;
 
+    /**
+     * Set the key used to coalesce this request with other pending requests.  When the sender coalesces events, a
+     * request which has not been sent yet is superseded by a later request with the same key, and completes with the
+     * status of the request which replaced it.  Only events whose later instances fully describe the state reported
+     * by earlier ones (for example, a full-state @c *Changed event) should be given a key.
+     *
+     * @param coalescingKey The key, typically the namespace and name of the event.  An empty key, the default, means
+     * that the request is never coalesced.
+     */
+    void setCoalescingKey(const std::string& coalescingKey);
+
+    /**
+     * Get the key used to coalesce this request with other pending requests.
+     *
+     * @return The key, or an empty string if the request must not be coalesced.
+     */
+    std::string getCoalescingKey() const;
+
     /**
      * Get the stream bytes threshold, to determine when we should record the stream metric.
      * @return m_threshold
@@ -278,6 +296,9 @@ protected:
 
     /// The threshold for the number of bytes for when we should record the stream metric.
     unsigned int m_streamBytesThreshold;
+
+    /// The key used to coalesce this request with other pending requests.  Empty if it must not be coalesced.
+    std::string m_coalescingKey;
 };
 
 }  // namespace avs
@@ -59,38 +59,86 @@ std::map<CapabilityTag, CapabilityState> AVSContext::getStates() const {
 
 void AVSContext::addState(const CapabilityTag& identifier, const CapabilityState& state) {
     m_states.insert(std::make_pair(identifier, state));
+    m_json.reset();
 }
 
 void AVSContext::removeState(const CapabilityTag& identifier) {
     m_states.erase(identifier);
+    m_json.reset();
+}
+
+void AVSContext::setJson(std::shared_ptr<const std::string> json) {
+    m_json = std::move(json);
 }
 
 std::string AVSContext::toJson() const {
-    utils::json::JsonGenerator jsonGenerator;
-    jsonGenerator.startArray(PROPERTIES_KEY_STRING);
+    if (m_json) {
+        ACSDK_DEBUG5(LX("toJson").d("cached", true).sensitive("context", *m_json));
+        return *m_json;
+    }
+
+    std::vector<std::string> serializedStates;
+    serializedStates.reserve(m_states.size());
     for (const auto& element : m_states) {
-        auto& identifier = element.first;
-        auto& state = element.second;
-        if (!state.valuePayload.empty()) {
-            jsonGenerator.startArrayElement();
-            jsonGenerator.addMember(constants::NAMESPACE_KEY_STRING, identifier.nameSpace);
-            jsonGenerator.addMember(constants::NAME_KEY_STRING, identifier.name);
-            if (identifier.instance.hasValue()) {
-                jsonGenerator.addMember(INSTANCE_KEY_STRING, identifier.instance.value());
-            }
-
-            jsonGenerator.addRawJsonMember(VALUE_KEY_STRING, state.valuePayload);
-            jsonGenerator.addMember(TIME_OF_SAMPLE_KEY_STRING, state.timeOfSample.getTime_ISO_8601());
-            jsonGenerator.addMember(UNCERTAINTY_KEY_STRING, state.uncertaintyInMilliseconds);
-            jsonGenerator.finishArrayElement();
-        } else {
-            ACSDK_DEBUG0(LX("toJson").d("stateIgnored", identifier.nameSpace + "::" + identifier.name));
-        }
+        serializedStates.push_back(stateToJson(element.first, element.second));
     }
-    jsonGenerator.finishArray();
-    ACSDK_DEBUG5(LX("toJson").sensitive("context", jsonGenerator.toString()));
+    std::vector<const std::string*> fragments;
+    fragments.reserve(serializedStates.size());
+    for (const auto& serializedState : serializedStates) {
+        fragments.push_back(&serializedState);
+    }
+    auto json = fragmentsToJson(fragments);
+    ACSDK_DEBUG5(LX("toJson").sensitive("context", json));
+    return json;
+}
+
+std::string AVSContext::stateToJson(const CapabilityTag& identifier, const CapabilityState& state) {
+    if (state.valuePayload.empty()) {
+        ACSDK_DEBUG0(LX("toJson").d("stateIgnored", identifier.nameSpace + "::" + identifier.name));
+        return "";
+    }
+
+    // A JsonGenerator always writes an object, which is exactly one element of the properties array.
+    utils::json::JsonGenerator jsonGenerator;
+    jsonGenerator.addMember(constants::NAMESPACE_KEY_STRING, identifier.nameSpace);
+    jsonGenerator.addMember(constants::NAME_KEY_STRING, identifier.name);
+    if (identifier.instance.hasValue()) {
+        jsonGenerator.addMember(INSTANCE_KEY_STRING, identifier.instance.value());
+    }
+
+    jsonGenerator.addRawJsonMember(VALUE_KEY_STRING, state.valuePayload);
+    jsonGenerator.addMember(TIME_OF_SAMPLE_KEY_STRING, state.timeOfSample.getTime_ISO_8601());
+    jsonGenerator.addMember(UNCERTAINTY_KEY_STRING, state.uncertaintyInMilliseconds);
     return jsonGenerator.toString();
 }
+
+std::string AVSContext::fragmentsToJson(const std::vector<const std::string*>& fragments) {
+    static const std::string prefix = "{\"" + PROPERTIES_KEY_STRING + "\":[";
+    static const std::string suffix = "]}";
+
+    size_t size = prefix.size() + suffix.size();
+    for (auto fragment : fragments) {
+        size += fragment->size() + 1;
+    }
+
+    std::string json;
+    json.reserve(size);
+    json += prefix;
+    bool first = true;
+    for (auto fragment : fragments) {
+        if (fragment->empty()) {
+            continue;
+        }
+        if (!first) {
+            json += ',';
+        }
+        json += *fragment;
+        first = false;
+    }
+    json += suffix;
+    return json;
+}
+
 }  // namespace avs
 }  // namespace avsCommon
 }  // namespace alexaClientSDK
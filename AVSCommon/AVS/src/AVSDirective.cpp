@@ -15,6 +15,7 @@
 
 #include "AVSCommon/AVS/AVSDirective.h"
 #include <AVSCommon/Utils/JSON/JSONUtils.h>
+#include <AVSCommon/Utils/JSON/PooledJSONDocument.h>
 #include "AVSCommon/Utils/Logger/Logger.h"
 
 #include <rapidjson/document.h>
@@ -25,6 +26,7 @@ namespace avs {
 
 using namespace avsCommon::avs::attachment;
 using namespace avsCommon::utils;
+using namespace avsCommon::utils::json;
 using namespace avsCommon::utils::json::jsonUtils;
 
 using namespace rapidjson;
@@ -72,21 +74,14 @@ static const std::string TAG("AvsDirective");
  * Utility function to attempt a JSON parse of the passed in string, and inform the caller if this succeeded or failed.
  *
  * @param unparsedDirective The unparsed JSON string which should represent an AVS Directive.
- * @param[out] document The rapidjson Document which will be set to the parsed structure if the parse succeeds.
- * @return Whether the parse was successful.
+ * @return The parsed document, or @c nullptr if the parse failed.
  */
-static bool parseDocument(const std::string& unparsedDirective, Document* document) {
+static std::shared_ptr<PooledJSONDocument> parseDocument(const std::string& unparsedDirective) {
+    auto document = PooledJSONDocument::parse(unparsedDirective);
     if (!document) {
-        ACSDK_ERROR(LX("parseDocumentFailed").m("nullptr document"));
-        return false;
-    }
-
-    if (!parseJSON(unparsedDirective, document)) {
         ACSDK_ERROR(LX("parseDocumentFailed").d("uparsedDirective", unparsedDirective));
-        return false;
     }
-
-    return true;
+    return document;
 }
 
 /**
@@ -180,11 +175,15 @@ static std::shared_ptr<AVSMessageHeader> parseHeader(const Document& document, A
  *
  * @param document The constructed document tree
  * @param [out] parseStatus An out parameter to express if the parse was successful
+ * @param [out] payloadValue An out parameter which is set to the payload node if the parse was successful.
  * @return The payload content if it is available.
  */
-static std::string parsePayload(const Document& document, AVSDirective::ParseStatus* parseStatus) {
-    if (!parseStatus) {
-        ACSDK_ERROR(LX("parsePayloadFailed").m("nullptr parseStatus"));
+static std::string parsePayload(
+    const Document& document,
+    AVSDirective::ParseStatus* parseStatus,
+    const Value** payloadValue) {
+    if (!parseStatus || !payloadValue) {
+        ACSDK_ERROR(LX("parsePayloadFailed").m("nullptr parseStatus or payloadValue"));
         return "";
     }
 
@@ -194,13 +193,16 @@ static std::string parsePayload(const Document& document, AVSDirective::ParseSta
         return "";
     }
 
+    Value::ConstMemberIterator payloadIt;
     std::string payload;
-    if (!retrieveValue(directiveIt->value, JSON_MESSAGE_PAYLOAD_KEY, &payload)) {
+    if (!findNode(directiveIt->value, JSON_MESSAGE_PAYLOAD_KEY, &payloadIt) ||
+        !convertToValue(payloadIt->value, &payload)) {
         *parseStatus = AVSDirective::ParseStatus::ERROR_MISSING_PAYLOAD_KEY;
         return "";
     }
 
     *parseStatus = AVSDirective::ParseStatus::SUCCESS;
+    *payloadValue = &payloadIt->value;
     return payload;
 }
 
@@ -243,20 +245,22 @@ std::pair<std::unique_ptr<AVSDirective>, AVSDirective::ParseStatus> AVSDirective
     std::pair<std::unique_ptr<AVSDirective>, ParseStatus> result;
     result.second = ParseStatus::SUCCESS;
 
-    Document document;
-    if (!parseDocument(unparsedDirective, &document)) {
+    auto parsed = parseDocument(unparsedDirective);
+    if (!parsed) {
         ACSDK_ERROR(LX("createFailed").m("failed to parse JSON"));
         result.second = ParseStatus::ERROR_INVALID_JSON;
         return result;
     }
 
+    const auto& document = parsed->getDocument();
     auto header = parseHeader(document, &(result.second));
     if (ParseStatus::SUCCESS != result.second) {
         ACSDK_ERROR(LX("createFailed").m("failed to parse header"));
         return result;
     }
 
-    auto payload = parsePayload(document, &(result.second));
+    const Value* payloadValue = nullptr;
+    auto payload = parsePayload(document, &(result.second), &payloadValue);
     if (ParseStatus::SUCCESS != result.second) {
         ACSDK_ERROR(LX("createFailed").m("failed to parse payload"));
         return result;
@@ -264,8 +268,8 @@ std::pair<std::unique_ptr<AVSDirective>, AVSDirective::ParseStatus> AVSDirective
 
     auto endpoint = parseEndpoint(document);
 
-    result.first = std::unique_ptr<AVSDirective>(
-        new AVSDirective(unparsedDirective, header, payload, attachmentManager, attachmentContextId, endpoint));
+    result.first = std::unique_ptr<AVSDirective>(new AVSDirective(
+        unparsedDirective, header, payload, attachmentManager, attachmentContextId, endpoint, parsed, payloadValue));
 
     return result;
 }
@@ -285,8 +289,19 @@ std::unique_ptr<AVSDirective> AVSDirective::create(
         ACSDK_ERROR(LX("createFailed").d("reason", "nullAttachmentManager"));
         return nullptr;
     }
+    // Parse the payload once here, so that handlers can use getPayloadValue().  A payload which is not valid JSON is
+    // still accepted, as before; getPayloadValue() then returns a null value.
+    auto document = PooledJSONDocument::parse(payload);
+    const Value* payloadValue = document ? &document->getDocument() : nullptr;
     return std::unique_ptr<AVSDirective>(new AVSDirective(
-        unparsedDirective, avsMessageHeader, payload, attachmentManager, attachmentContextId, endpoint));
+        unparsedDirective,
+        avsMessageHeader,
+        payload,
+        attachmentManager,
+        attachmentContextId,
+        endpoint,
+        document,
+        payloadValue));
 }
 
 std::unique_ptr<AttachmentReader> AVSDirective::getAttachmentReader(
@@ -306,11 +321,20 @@ AVSDirective::AVSDirective(
     const std::string& payload,
     std::shared_ptr<AttachmentManagerInterface> attachmentManager,
     const std::string& attachmentContextId,
-    const utils::Optional<AVSMessageEndpoint>& endpoint) :
+    const utils::Optional<AVSMessageEndpoint>& endpoint,
+    std::shared_ptr<const PooledJSONDocument> document,
+    const Value* payloadValue) :
         AVSMessage{avsMessageHeader, payload, endpoint},
         m_unparsedDirective{unparsedDirective},
         m_attachmentManager{attachmentManager},
-        m_attachmentContextId{attachmentContextId} {
+        m_attachmentContextId{attachmentContextId},
+        m_document{document},
+        m_payloadValue{payloadValue} {
+}
+
+const Value& AVSDirective::getPayloadValue() const {
+    static const Value nullValue;
+    return m_payloadValue ? *m_payloadValue : nullValue;
 }
 
 std::string AVSDirective::getUnparsedDirective() const {
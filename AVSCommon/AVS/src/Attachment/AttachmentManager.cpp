@@ -56,7 +56,14 @@ std::shared_ptr<AttachmentManagerInterface> AttachmentManager::createInProcessAt
 
 AttachmentManager::AttachmentManager(AttachmentType attachmentType) :
         m_attachmentType{attachmentType},
+        m_memoryPool{std::make_shared<AttachmentMemoryPool>()},
         m_attachmentExpirationMinutes{ATTACHMENT_MANAGER_TIMOUT_MINUTES_DEFAULT} {
+    m_memoryPool->setReclaimFunction([this] { reclaimMemory(); });
+}
+
+AttachmentManager::~AttachmentManager() {
+    // Attachments may outlive the manager, and keep using the pool.
+    m_memoryPool->setReclaimFunction(nullptr);
 }
 
 std::string AttachmentManager::generateAttachmentId(const std::string& contextId, const std::string& contentId) const {
@@ -103,10 +110,14 @@ AttachmentManager::AttachmentManagementDetails& AttachmentManager::getDetailsLoc
         // Lack of default case will allow compiler to generate warnings if a case is unhandled.
         switch (m_attachmentType) {
             // The in-process attachment type.
-            case AttachmentType::IN_PROCESS:
-                details.attachment =
-                    alexaClientSDK::avsCommon::utils::memory::make_unique<InProcessAttachment>(attachmentId);
+            case AttachmentType::IN_PROCESS: {
+                auto attachment = InProcessAttachment::createWithMemoryPool(attachmentId, m_memoryPool);
+                if (attachment) {
+                    details.buffer = attachment->getChunkedBuffer();
+                }
+                details.attachment = std::move(attachment);
                 break;
+            }
         }
 
         // In code compiled with no warnings, the following test should never pass.
@@ -152,6 +163,14 @@ std::unique_ptr<AttachmentReader> AttachmentManager::createReader(
     return reader;
 }
 
+void AttachmentManager::setMemoryBudget(size_t budgetInBytes) {
+    m_memoryPool->setBudget(budgetInBytes);
+}
+
+AttachmentMemoryPool::Stats AttachmentManager::getMemoryStats() const {
+    return m_memoryPool->getStats();
+}
+
 void AttachmentManager::removeExpiredAttachmentsLocked() {
     std::vector<std::string> idsToErase;
     auto now = std::chrono::steady_clock::now();
@@ -167,8 +186,13 @@ void AttachmentManager::removeExpiredAttachmentsLocked() {
 
         auto attachmentLifetime = std::chrono::duration_cast<std::chrono::minutes>(now - details.creationTime);
 
-        if ((details.attachment->hasCreatedReader() && details.attachment->hasCreatedWriter()) ||
-            attachmentLifetime > m_attachmentExpirationMinutes) {
+        if (details.attachment->hasCreatedReader() && details.attachment->hasCreatedWriter()) {
+            idsToErase.push_back(iter.first);
+        } else if (attachmentLifetime > m_attachmentExpirationMinutes) {
+            // The writer may still exist, so drop the data as well as the attachment.
+            if (details.buffer) {
+                details.buffer->discard();
+            }
             idsToErase.push_back(iter.first);
         }
     }
@@ -178,6 +202,13 @@ void AttachmentManager::removeExpiredAttachmentsLocked() {
     }
 }
 
+void AttachmentManager::reclaimMemory() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // Attachments which have been fully read or released already returned their memory to the pool, except for those
+    // this manager still holds, or which have expired.  Data which may still be read is never discarded.
+    removeExpiredAttachmentsLocked();
+}
+
 }  // namespace attachment
 }  // namespace avs
 }  // namespace avsCommon
@@ -0,0 +1,155 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+
+#include <algorithm>
+
+#include "AVSCommon/AVS/Attachment/AttachmentMemoryPool.h"
+#include "AVSCommon/Utils/Logger/Logger.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace attachment {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("AttachmentMemoryPool");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param event The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+constexpr size_t AttachmentMemoryPool::DEFAULT_CHUNK_SIZE;
+constexpr size_t AttachmentMemoryPool::DEFAULT_BUDGET_IN_BYTES;
+constexpr size_t AttachmentMemoryPool::DEFAULT_MAX_POOLED_BYTES;
+
+AttachmentMemoryPool::AttachmentMemoryPool(size_t budgetInBytes, size_t chunkSize, size_t maxPooledBytes) :
+        m_chunkSize{std::max(chunkSize, static_cast<size_t>(1))},
+        m_maxPooledChunks{maxPooledBytes / m_chunkSize},
+        m_stats{0, 0, 0, budgetInBytes, 0},
+        m_exhausted{false},
+        m_releaseCount{0} {
+    m_pooledChunks.reserve(m_maxPooledChunks);
+}
+
+size_t AttachmentMemoryPool::getChunkSize() const {
+    return m_chunkSize;
+}
+
+AttachmentMemoryPool::Chunk AttachmentMemoryPool::acquireChunk() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_stats.currentBytes + m_chunkSize > m_stats.budgetBytes) {
+        m_stats.exhaustedCount++;
+        if (!m_exhausted) {
+            m_exhausted = true;
+            ACSDK_WARN(LX("acquireChunkFailed")
+                           .d("reason", "budgetExhausted")
+                           .d("currentBytes", m_stats.currentBytes)
+                           .d("budgetBytes", m_stats.budgetBytes));
+        }
+        return nullptr;
+    }
+    m_exhausted = false;
+
+    Chunk chunk;
+    if (!m_pooledChunks.empty()) {
+        chunk = std::move(m_pooledChunks.back());
+        m_pooledChunks.pop_back();
+    } else {
+        chunk.reset(new uint8_t[m_chunkSize]);
+    }
+    m_stats.currentBytes += m_chunkSize;
+    m_stats.peakBytes = std::max(m_stats.peakBytes, m_stats.currentBytes);
+    return chunk;
+}
+
+void AttachmentMemoryPool::releaseChunk(Chunk chunk) {
+    if (!chunk) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stats.currentBytes -= m_chunkSize;
+        if (m_pooledChunks.size() < m_maxPooledChunks) {
+            m_pooledChunks.push_back(std::move(chunk));
+        }
+        m_releaseCount++;
+    }
+    m_releaseTrigger.notify_all();
+}
+
+void AttachmentMemoryPool::setBudget(size_t budgetInBytes) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stats.budgetBytes = budgetInBytes;
+        m_releaseCount++;
+    }
+    m_releaseTrigger.notify_all();
+}
+
+bool AttachmentMemoryPool::hasRoomForChunk() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats.currentBytes + m_chunkSize <= m_stats.budgetBytes;
+}
+
+void AttachmentMemoryPool::setReclaimFunction(ReclaimFunction reclaimFunction) {
+    std::lock_guard<std::mutex> lock(m_reclaimMutex);
+    m_reclaimFunction = std::move(reclaimFunction);
+}
+
+void AttachmentMemoryPool::reclaim() {
+    std::lock_guard<std::mutex> lock(m_reclaimMutex);
+    if (m_reclaimFunction) {
+        m_reclaimFunction();
+    }
+}
+
+uint64_t AttachmentMemoryPool::getReleaseCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_releaseCount;
+}
+
+void AttachmentMemoryPool::waitForRelease(uint64_t releaseCount, std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    auto predicate = [this, releaseCount] { return m_releaseCount != releaseCount; };
+    if (std::chrono::milliseconds::zero() == timeout) {
+        m_releaseTrigger.wait(lock, predicate);
+    } else {
+        m_releaseTrigger.wait_for(lock, timeout, predicate);
+    }
+}
+
+void AttachmentMemoryPool::wakeWaiters() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_releaseCount++;
+    }
+    m_releaseTrigger.notify_all();
+}
+
+AttachmentMemoryPool::Stats AttachmentMemoryPool::getStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto stats = m_stats;
+    stats.pooledBytes = m_pooledChunks.size() * m_chunkSize;
+    return stats;
+}
+
+}  // namespace attachment
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,481 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "AVSCommon/AVS/Attachment/ChunkedAttachmentBuffer.h"
+#include "AVSCommon/Utils/Logger/Logger.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace attachment {
+
+using namespace avsCommon::utils::sds;
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("ChunkedAttachmentBuffer");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param event The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The close position of a reader which has not been closed.
+static const uint64_t NOT_CLOSED = std::numeric_limits<uint64_t>::max();
+
+ChunkedAttachmentBuffer::ChunkedAttachmentBuffer(
+    std::shared_ptr<AttachmentMemoryPool> pool,
+    size_t maxSize,
+    size_t maxReaders) :
+        m_pool{std::move(pool)},
+        m_chunkSize{m_pool->getChunkSize()},
+        m_maxSize{maxSize},
+        m_startPosition{0},
+        m_writePosition{0},
+        m_writerClosed{false},
+        m_readers(maxReaders, ReaderState{false, 0, NOT_CLOSED, nullptr}),
+        m_hasAddedReader{false} {
+}
+
+ChunkedAttachmentBuffer::~ChunkedAttachmentBuffer() {
+    for (auto& chunk : m_chunks) {
+        m_pool->releaseChunk(std::move(chunk));
+    }
+}
+
+size_t ChunkedAttachmentBuffer::write(
+    const void* buf,
+    size_t numBytes,
+    WriterPolicy policy,
+    AttachmentWriter::WriteStatus* writeStatus,
+    std::chrono::milliseconds timeout) {
+    if (!writeStatus) {
+        ACSDK_ERROR(LX("writeFailed").d("reason", "nullWriteStatus"));
+        return 0;
+    }
+    if (!buf) {
+        ACSDK_ERROR(LX("writeFailed").d("reason", "nullBuffer"));
+        *writeStatus = AttachmentWriter::WriteStatus::ERROR_INTERNAL;
+        return 0;
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    bool hasReclaimed = false;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        if (m_writerClosed) {
+            *writeStatus = AttachmentWriter::WriteStatus::CLOSED;
+            return 0;
+        }
+        *writeStatus = AttachmentWriter::WriteStatus::OK;
+        if (0 == numBytes) {
+            return 0;
+        }
+
+        // Taken before trying to grow, so that memory released after the attempt fails is not missed.
+        auto releaseCount = m_pool->getReleaseCount();
+        auto count = numBytes;
+        auto result = reserveLocked(&count, policy, hasReclaimed);
+        if (ReserveResult::RESERVED == result) {
+            copyInLocked(static_cast<const uint8_t*>(buf), count);
+            releaseConsumedChunksLocked();
+            notifyDataAvailableLocked();
+            return count;
+        }
+
+        if (ReserveResult::POOL_EXHAUSTED == result && !hasReclaimed) {
+            // Reclaiming may lock other attachments, and this one, so it is done without holding the lock.
+            hasReclaimed = true;
+            lock.unlock();
+            m_pool->reclaim();
+            lock.lock();
+            continue;
+        }
+
+        if (WriterPolicy::BLOCKING != policy) {
+            *writeStatus = AttachmentWriter::WriteStatus::OK_BUFFER_FULL;
+            return 0;
+        }
+
+        auto wait = std::chrono::milliseconds::zero();
+        if (std::chrono::milliseconds::zero() != timeout) {
+            auto now = std::chrono::steady_clock::now();
+            if (now >= deadline) {
+                *writeStatus = AttachmentWriter::WriteStatus::TIMEDOUT;
+                return 0;
+            }
+            // Rounded up, so that a wait of less than a millisecond does not become a wait forever.
+            wait = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - now) + std::chrono::milliseconds(1);
+        }
+        if (ReserveResult::NO_SPACE == result) {
+            if (std::chrono::milliseconds::zero() == wait) {
+                m_spaceAvailable.wait(lock);
+            } else {
+                m_spaceAvailable.wait_for(lock, wait);
+            }
+        } else {
+            // Memory released by any attachment using the pool may let this write proceed.
+            lock.unlock();
+            m_pool->waitForRelease(releaseCount, wait);
+            lock.lock();
+        }
+    }
+}
+
+void ChunkedAttachmentBuffer::closeWriter() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_writerClosed) {
+            return;
+        }
+        m_writerClosed = true;
+        releaseConsumedChunksLocked();
+        notifyDataAvailableLocked();
+        m_spaceAvailable.notify_all();
+    }
+    // A writer waiting for memory from the pool is not waiting on this buffer.
+    m_pool->wakeWaiters();
+}
+
+bool ChunkedAttachmentBuffer::addReader(size_t* id) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_startPosition > 0) {
+        ACSDK_ERROR(LX("addReaderFailed").d("reason", "dataDiscarded"));
+        return false;
+    }
+    for (size_t i = 0; i < m_readers.size(); ++i) {
+        if (!m_readers[i].enabled) {
+            m_readers[i] = ReaderState{true, 0, NOT_CLOSED, nullptr};
+            m_hasAddedReader = true;
+            *id = i;
+            return true;
+        }
+    }
+    ACSDK_ERROR(LX("addReaderFailed").d("reason", "tooManyReaders").d("maxReaders", m_readers.size()));
+    return false;
+}
+
+void ChunkedAttachmentBuffer::removeReader(size_t id) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (id >= m_readers.size()) {
+        return;
+    }
+    m_readers[id].enabled = false;
+    m_readers[id].onDataAvailable = nullptr;
+    releaseConsumedChunksLocked();
+    m_spaceAvailable.notify_all();
+}
+
+size_t ChunkedAttachmentBuffer::read(
+    size_t id,
+    void* buf,
+    size_t numBytes,
+    ReaderPolicy policy,
+    bool resetOnOverrun,
+    AttachmentReader::ReadStatus* readStatus,
+    std::chrono::milliseconds timeout) {
+    if (!readStatus) {
+        ACSDK_ERROR(LX("readFailed").d("reason", "nullReadStatus"));
+        return 0;
+    }
+    if (!buf || timeout.count() < 0) {
+        ACSDK_ERROR(LX("readFailed").d("reason", "invalidParameter"));
+        *readStatus = AttachmentReader::ReadStatus::ERROR_INTERNAL;
+        return 0;
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (id >= m_readers.size() || !m_readers[id].enabled) {
+        *readStatus = AttachmentReader::ReadStatus::CLOSED;
+        return 0;
+    }
+    *readStatus = AttachmentReader::ReadStatus::OK;
+    if (0 == numBytes) {
+        return 0;
+    }
+
+    auto& reader = m_readers[id];
+    while (true) {
+        if (reader.position >= reader.closePosition || (m_writerClosed && reader.position >= m_writePosition)) {
+            *readStatus = AttachmentReader::ReadStatus::CLOSED;
+            return 0;
+        }
+        if (reader.position < m_startPosition) {
+            if (resetOnOverrun) {
+                reader.position = m_writePosition;
+                *readStatus = AttachmentReader::ReadStatus::OK_OVERRUN_RESET;
+            } else {
+                ACSDK_ERROR(LX("readFailed").d("reason", "overrunByWriter"));
+                reader.closePosition = reader.position;
+                *readStatus = AttachmentReader::ReadStatus::ERROR_OVERRUN;
+            }
+            return 0;
+        }
+        if (m_writePosition > reader.position) {
+            break;
+        }
+        if (m_writerClosed) {
+            *readStatus = AttachmentReader::ReadStatus::CLOSED;
+            return 0;
+        }
+        if (ReaderPolicy::NONBLOCKING == policy) {
+            *readStatus = AttachmentReader::ReadStatus::OK_WOULDBLOCK;
+            return 0;
+        }
+
+        auto predicate = [this, &reader] {
+            return m_writerClosed || m_writePosition > reader.position || reader.position >= reader.closePosition;
+        };
+        if (std::chrono::milliseconds::zero() == timeout) {
+            m_dataAvailable.wait(lock, predicate);
+        } else if (!m_dataAvailable.wait_for(lock, timeout, predicate)) {
+            *readStatus = AttachmentReader::ReadStatus::OK_TIMEDOUT;
+            return 0;
+        }
+    }
+
+    auto available = std::min(m_writePosition, reader.closePosition) - reader.position;
+    numBytes = static_cast<size_t>(std::min(static_cast<uint64_t>(numBytes), available));
+    copyOutLocked(reader.position, static_cast<uint8_t*>(buf), numBytes);
+    reader.position += numBytes;
+    releaseConsumedChunksLocked();
+    m_spaceAvailable.notify_all();
+    return numBytes;
+}
+
+void ChunkedAttachmentBuffer::setDataAvailableCallback(size_t id, std::function<void()> callback) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (id >= m_readers.size() || !m_readers[id].enabled) {
+        return;
+    }
+    m_readers[id].onDataAvailable = std::move(callback);
+}
+
+void ChunkedAttachmentBuffer::closeReader(size_t id, AttachmentReader::ClosePoint closePoint) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (id >= m_readers.size() || !m_readers[id].enabled) {
+        return;
+    }
+    auto& reader = m_readers[id];
+    switch (closePoint) {
+        case AttachmentReader::ClosePoint::IMMEDIATELY:
+            reader.closePosition = reader.position;
+            break;
+        case AttachmentReader::ClosePoint::AFTER_DRAINING_CURRENT_BUFFER:
+            reader.closePosition = m_writePosition;
+            break;
+    }
+    releaseConsumedChunksLocked();
+    m_dataAvailable.notify_all();
+    m_spaceAvailable.notify_all();
+}
+
+bool ChunkedAttachmentBuffer::seek(size_t id, uint64_t offset) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (id >= m_readers.size() || !m_readers[id].enabled) {
+        return false;
+    }
+    auto& reader = m_readers[id];
+    if (offset > reader.closePosition) {
+        ACSDK_ERROR(LX("seekFailed").d("reason", "seekBeyondClosePosition").d("offset", offset));
+        return false;
+    }
+    if (offset < m_startPosition) {
+        ACSDK_ERROR(LX("seekFailed").d("reason", "dataDiscarded").d("offset", offset));
+        return false;
+    }
+    reader.position = offset;
+    releaseConsumedChunksLocked();
+    m_spaceAvailable.notify_all();
+    return true;
+}
+
+uint64_t ChunkedAttachmentBuffer::getNumUnreadBytes(size_t id) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (id >= m_readers.size() || !m_readers[id].enabled || m_readers[id].position >= m_writePosition) {
+        return 0;
+    }
+    return m_writePosition - m_readers[id].position;
+}
+
+void ChunkedAttachmentBuffer::discard() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        releaseChunksLocked(m_startPosition + m_chunks.size() * m_chunkSize);
+        m_writePosition = m_startPosition;
+        m_writerClosed = true;
+        notifyDataAvailableLocked();
+        m_spaceAvailable.notify_all();
+    }
+    m_pool->wakeWaiters();
+}
+
+void ChunkedAttachmentBuffer::notifyDataAvailableLocked() {
+    m_dataAvailable.notify_all();
+    for (auto& reader : m_readers) {
+        if (reader.enabled && reader.onDataAvailable) {
+            reader.onDataAvailable();
+        }
+    }
+}
+
+uint64_t ChunkedAttachmentBuffer::getOldestUnconsumedLocked() const {
+    auto oldest = NOT_CLOSED;
+    for (auto& reader : m_readers) {
+        // A reader which has reached its close position will not read any more.
+        if (reader.enabled && reader.position < reader.closePosition) {
+            oldest = std::min(oldest, reader.position);
+        }
+    }
+    if (NOT_CLOSED != oldest) {
+        return oldest;
+    }
+    // Keep the data for the first reader, but once every reader has gone, nobody will read it.
+    return m_hasAddedReader ? m_writePosition : m_startPosition;
+}
+
+size_t ChunkedAttachmentBuffer::getSpaceLocked() const {
+    auto limit = getOldestUnconsumedLocked() + m_maxSize;
+    if (limit <= m_writePosition) {
+        return 0;
+    }
+    return static_cast<size_t>(std::min(limit - m_writePosition, static_cast<uint64_t>(m_maxSize)));
+}
+
+ChunkedAttachmentBuffer::ReserveResult ChunkedAttachmentBuffer::reserveLocked(
+    size_t* numBytes,
+    WriterPolicy policy,
+    bool canRecycle) {
+    switch (policy) {
+        case WriterPolicy::NONBLOCKABLE: {
+            // Like an SDS, a NONBLOCKABLE write discards the oldest data rather than waiting for the readers.
+            *numBytes = std::min(*numBytes, m_maxSize);
+            auto end = m_writePosition + *numBytes;
+            if (end > m_maxSize) {
+                releaseChunksLocked(std::min(end - m_maxSize, m_writePosition));
+            }
+            auto available = growLocked(end);
+            if (available < end && !canRecycle) {
+                return ReserveResult::POOL_EXHAUSTED;
+            }
+            // If the budget is still exhausted, recycle the oldest chunks which are not being written to.
+            while (available < end && m_startPosition + m_chunkSize <= m_writePosition) {
+                auto chunk = std::move(m_chunks.front());
+                m_chunks.pop_front();
+                m_startPosition += m_chunkSize;
+                m_chunks.push_back(std::move(chunk));
+                available += m_chunkSize;
+            }
+            *numBytes = static_cast<size_t>(std::min(available, end) - m_writePosition);
+            return *numBytes > 0 ? ReserveResult::RESERVED : ReserveResult::POOL_EXHAUSTED;
+        }
+        case WriterPolicy::ALL_OR_NOTHING: {
+            if (*numBytes > getSpaceLocked()) {
+                return ReserveResult::NO_SPACE;
+            }
+            auto numChunks = m_chunks.size();
+            if (growLocked(m_writePosition + *numBytes) < m_writePosition + *numBytes) {
+                // Give back what was taken for this write, so that the budget goes to writes which can complete.
+                while (m_chunks.size() > numChunks) {
+                    m_pool->releaseChunk(std::move(m_chunks.back()));
+                    m_chunks.pop_back();
+                }
+                return ReserveResult::POOL_EXHAUSTED;
+            }
+            return ReserveResult::RESERVED;
+        }
+        case WriterPolicy::BLOCKING: {
+            auto space = getSpaceLocked();
+            if (0 == space) {
+                return ReserveResult::NO_SPACE;
+            }
+            auto available = growLocked(m_writePosition + std::min(*numBytes, space));
+            if (available <= m_writePosition) {
+                return ReserveResult::POOL_EXHAUSTED;
+            }
+            *numBytes = static_cast<size_t>(available - m_writePosition);
+            return ReserveResult::RESERVED;
+        }
+    }
+    return ReserveResult::NO_SPACE;
+}
+
+uint64_t ChunkedAttachmentBuffer::growLocked(uint64_t end) {
+    auto capacityEnd = m_startPosition + m_chunks.size() * m_chunkSize;
+    while (capacityEnd < end) {
+        auto chunk = m_pool->acquireChunk();
+        if (!chunk) {
+            return capacityEnd;
+        }
+        m_chunks.push_back(std::move(chunk));
+        capacityEnd += m_chunkSize;
+    }
+    return end;
+}
+
+void ChunkedAttachmentBuffer::releaseChunksLocked(uint64_t position) {
+    while (!m_chunks.empty() && m_startPosition + m_chunkSize <= position) {
+        m_pool->releaseChunk(std::move(m_chunks.front()));
+        m_chunks.pop_front();
+        m_startPosition += m_chunkSize;
+    }
+}
+
+void ChunkedAttachmentBuffer::releaseConsumedChunksLocked() {
+    auto oldest = getOldestUnconsumedLocked();
+    if (m_writerClosed && oldest >= m_writePosition) {
+        // Nobody will write or read the rest of the last chunk.
+        releaseChunksLocked(m_startPosition + m_chunks.size() * m_chunkSize);
+        return;
+    }
+    releaseChunksLocked(std::min(oldest, m_writePosition));
+}
+
+void ChunkedAttachmentBuffer::copyInLocked(const uint8_t* buf, size_t numBytes) {
+    while (numBytes > 0) {
+        auto offset = m_writePosition - m_startPosition;
+        auto& chunk = m_chunks[offset / m_chunkSize];
+        auto inChunk = static_cast<size_t>(offset % m_chunkSize);
+        auto count = std::min(numBytes, m_chunkSize - inChunk);
+        std::memcpy(chunk.get() + inChunk, buf, count);
+        buf += count;
+        numBytes -= count;
+        m_writePosition += count;
+    }
+}
+
+void ChunkedAttachmentBuffer::copyOutLocked(uint64_t position, uint8_t* buf, size_t numBytes) const {
+    while (numBytes > 0) {
+        auto offset = position - m_startPosition;
+        auto& chunk = m_chunks[offset / m_chunkSize];
+        auto inChunk = static_cast<size_t>(offset % m_chunkSize);
+        auto count = std::min(numBytes, m_chunkSize - inChunk);
+        std::memcpy(buf, chunk.get() + inChunk, count);
+        buf += count;
+        numBytes -= count;
+        position += count;
+    }
+}
+
+}  // namespace attachment
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,95 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+
+#include "AVSCommon/AVS/Attachment/ChunkedAttachmentReader.h"
+#include "AVSCommon/Utils/Logger/Logger.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace attachment {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("ChunkedAttachmentReader");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param event The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+std::unique_ptr<ChunkedAttachmentReader> ChunkedAttachmentReader::create(
+    utils::sds::ReaderPolicy policy,
+    std::shared_ptr<ChunkedAttachmentBuffer> buffer,
+    bool resetOnOverrun) {
+    if (!buffer) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "nullBuffer"));
+        return nullptr;
+    }
+    size_t id;
+    if (!buffer->addReader(&id)) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "addReaderFailed"));
+        return nullptr;
+    }
+    return std::unique_ptr<ChunkedAttachmentReader>(
+        new ChunkedAttachmentReader(policy, std::move(buffer), id, resetOnOverrun));
+}
+
+ChunkedAttachmentReader::ChunkedAttachmentReader(
+    utils::sds::ReaderPolicy policy,
+    std::shared_ptr<ChunkedAttachmentBuffer> buffer,
+    size_t id,
+    bool resetOnOverrun) :
+        m_policy{policy},
+        m_buffer{std::move(buffer)},
+        m_id{id},
+        m_resetOnOverrun{resetOnOverrun} {
+}
+
+ChunkedAttachmentReader::~ChunkedAttachmentReader() {
+    m_buffer->removeReader(m_id);
+}
+
+std::size_t ChunkedAttachmentReader::read(
+    void* buf,
+    std::size_t numBytes,
+    ReadStatus* readStatus,
+    std::chrono::milliseconds timeoutMs) {
+    return m_buffer->read(m_id, buf, numBytes, m_policy, m_resetOnOverrun, readStatus, timeoutMs);
+}
+
+void ChunkedAttachmentReader::close(ClosePoint closePoint) {
+    m_buffer->closeReader(m_id, closePoint);
+}
+
+bool ChunkedAttachmentReader::seek(uint64_t offset) {
+    return m_buffer->seek(m_id, offset);
+}
+
+uint64_t ChunkedAttachmentReader::getNumUnreadBytes() {
+    return m_buffer->getNumUnreadBytes(m_id);
+}
+
+bool ChunkedAttachmentReader::setDataAvailableCallback(std::function<void()> callback) {
+    m_buffer->setDataAvailableCallback(m_id, std::move(callback));
+    return true;
+}
+
+}  // namespace attachment
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -13,6 +13,8 @@
  * permissions and limitations under the License.
  */
 
+#include "AVSCommon/AVS/Attachment/ChunkedAttachmentReader.h"
+#include "AVSCommon/AVS/Attachment/ChunkedAttachmentWriter.h"
 #include "AVSCommon/AVS/Attachment/InProcessAttachment.h"
 #include "AVSCommon/Utils/Memory/Memory.h"
 
@@ -37,6 +39,31 @@ InProcessAttachment::InProcessAttachment(const std::string& id, std::unique_ptr<
     }
 }
 
+std::unique_ptr<InProcessAttachment> InProcessAttachment::createWithMemoryPool(
+    const std::string& id,
+    std::shared_ptr<AttachmentMemoryPool> memoryPool,
+    size_t maxNumReaders) {
+    if (!memoryPool) {
+        return nullptr;
+    }
+    auto buffer = std::make_shared<ChunkedAttachmentBuffer>(
+        memoryPool, static_cast<size_t>(SDS_BUFFER_DEFAULT_SIZE_IN_BYTES), maxNumReaders);
+    return std::unique_ptr<InProcessAttachment>(new InProcessAttachment(buffer, id, maxNumReaders));
+}
+
+InProcessAttachment::InProcessAttachment(
+    std::shared_ptr<ChunkedAttachmentBuffer> buffer,
+    const std::string& id,
+    size_t maxNumReaders) :
+        Attachment(id),
+        m_chunkedBuffer{std::move(buffer)},
+        m_maxNumReaders{maxNumReaders} {
+}
+
+std::shared_ptr<ChunkedAttachmentBuffer> InProcessAttachment::getChunkedBuffer() const {
+    return m_chunkedBuffer;
+}
+
 std::unique_ptr<AttachmentWriter> InProcessAttachment::createWriter(
     InProcessAttachmentWriter::SDSTypeWriter::Policy policy) {
     std::lock_guard<std::mutex> lock(m_mutex);
@@ -45,12 +72,17 @@ std::unique_ptr<AttachmentWriter> InProcessAttachment::createWriter(
         return nullptr;
     }
 
-    auto writer = InProcessAttachmentWriter::create(m_sds, policy);
+    std::unique_ptr<AttachmentWriter> writer;
+    if (m_chunkedBuffer) {
+        writer = ChunkedAttachmentWriter::create(m_chunkedBuffer, policy);
+    } else {
+        writer = InProcessAttachmentWriter::create(m_sds, policy);
+    }
     if (writer) {
         m_hasCreatedWriter = true;
     }
 
-    return std::move(writer);
+    return writer;
 }
 
 std::unique_ptr<AttachmentReader> InProcessAttachment::createReader(
@@ -61,12 +93,17 @@ std::unique_ptr<AttachmentReader> InProcessAttachment::createReader(
         return nullptr;
     }
 
-    auto reader = InProcessAttachmentReader::create(policy, m_sds);
+    std::unique_ptr<AttachmentReader> reader;
+    if (m_chunkedBuffer) {
+        reader = ChunkedAttachmentReader::create(policy, m_chunkedBuffer);
+    } else {
+        reader = InProcessAttachmentReader::create(policy, m_sds);
+    }
     if (reader) {
         ++m_numReaders;
     }
 
-    return std::move(reader);
+    return reader;
 }
 
 }  // namespace attachment
@@ -59,6 +59,10 @@ uint64_t InProcessAttachmentReader::getNumUnreadBytes() {
     return m_delegate->getNumUnreadBytes();
 }
 
+bool InProcessAttachmentReader::setDataAvailableCallback(std::function<void()> callback) {
+    return m_delegate->setDataAvailableCallback(std::move(callback));
+}
+
 }  // namespace attachment
 }  // namespace avs
 }  // namespace avsCommon
@@ -143,6 +143,14 @@ void InProcessAttachmentWriter::close() {
     }
 }
 
+bool InProcessAttachmentWriter::setSpaceAvailableCallback(std::function<void()> callback) {
+    if (!m_writer) {
+        return false;
+    }
+    m_writer->setSpaceAvailableCallback(std::move(callback));
+    return true;
+}
+
 }  // namespace attachment
 }  // namespace avs
 }  // namespace avsCommon
@@ -14,7 +14,7 @@
  */
 
 #include "AVSCommon/AVS/Initialization/InitializationParametersBuilder.h"
-#include "AVSCommon/Utils/Timing/TimerDelegateFactory.h"
+#include "AVSCommon/Utils/Timing/TimerWheelDelegateFactory.h"
 
 namespace alexaClientSDK {
 namespace avsCommon {
@@ -26,7 +26,7 @@ std::unique_ptr<InitializationParametersBuilder> InitializationParametersBuilder
 }
 
 InitializationParametersBuilder::InitializationParametersBuilder() {
-    m_initParams.timerDelegateFactory = std::make_shared<utils::timing::TimerDelegateFactory>();
+    m_initParams.timerDelegateFactory = std::make_shared<utils::timing::TimerWheelDelegateFactory>();
 }
 
 InitializationParametersBuilder& InitializationParametersBuilder::withJsonStreams(
@@ -13,7 +13,7 @@
  * permissions and limitations under the License.
  */
 #include <AVSCommon/Utils/Logger/Logger.h>
-#include <AVSCommon/Utils/Timing/TimerDelegateFactory.h>
+#include <AVSCommon/Utils/Timing/TimerWheelDelegateFactory.h>
 
 #include "AVSCommon/AVS/Initialization/SDKPrimitivesProvider.h"
 
@@ -48,7 +48,7 @@ std::shared_ptr<SDKPrimitivesProvider> SDKPrimitivesProvider::getInstance() {
 
 SDKPrimitivesProvider::SDKPrimitivesProvider() :
         m_initialized{false},
-        m_timerDelegateFactory{std::make_shared<utils::timing::TimerDelegateFactory>()} {
+        m_timerDelegateFactory{std::make_shared<utils::timing::TimerWheelDelegateFactory>()} {
 }
 
 bool SDKPrimitivesProvider::withTimerDelegateFactory(
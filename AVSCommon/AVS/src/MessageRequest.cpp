@@ -79,7 +79,8 @@ MessageRequest::MessageRequest(const MessageRequest& messageRequest) :
         m_headers{messageRequest.m_headers},
         m_resolver{messageRequest.m_resolver},
         m_streamMetricName{messageRequest.m_streamMetricName},
-        m_streamBytesThreshold{messageRequest.m_streamBytesThreshold} {
+        m_streamBytesThreshold{messageRequest.m_streamBytesThreshold},
+        m_coalescingKey{messageRequest.m_coalescingKey} {
 }
 
 MessageRequest::~MessageRequest() {
@@ -119,6 +120,14 @@ unsigned int MessageRequest::getStreamBytesThreshold() const {
     return m_streamBytesThreshold;
 }
 
+void MessageRequest::setCoalescingKey(const std::string& coalescingKey) {
+    m_coalescingKey = coalescingKey;
+}
+
+std::string MessageRequest::getCoalescingKey() const {
+    return m_coalescingKey;
+}
+
 std::shared_ptr<MessageRequest::NamedReader> MessageRequest::getAttachmentReader(size_t index) const {
     if (m_readers.size() <= index) {
         ACSDK_ERROR(LX("getAttachmentReaderFailed").d("reason", "index out of bound").d("index", index));
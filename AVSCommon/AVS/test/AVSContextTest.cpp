@@ -85,6 +85,47 @@ TEST(AVSContextTest, test_toJsonWithoutPropertyInstance) {
     EXPECT_EQ(json.find(R"("instance":)"), std::string::npos);
 }
 
+/// Test that joining the serialized states of a context gives the same string as toJson().
+TEST(AVSContextTest, test_fragmentsToJsonMatchesToJson) {
+    AVSContext context;
+    CapabilityTag otherTag{"Other", "Name", "EndpointId", Optional<std::string>("Instance")};
+    CapabilityTag emptyTag{"Empty", "Name", "EndpointId"};
+    context.addState(CAPABILITY_TAG, CAPABILITY_STATE);
+    context.addState(otherTag, CapabilityState{R"({"key":"value"})"});
+    context.addState(emptyTag, CapabilityState{""});
+
+    std::vector<std::string> serializedStates;
+    for (const auto& state : context.getStates()) {
+        serializedStates.push_back(AVSContext::stateToJson(state.first, state.second));
+    }
+    std::vector<const std::string*> fragments;
+    for (const auto& serializedState : serializedStates) {
+        fragments.push_back(&serializedState);
+    }
+
+    EXPECT_EQ(AVSContext::fragmentsToJson(fragments), context.toJson());
+    EXPECT_EQ(AVSContext::fragmentsToJson({}), R"({"properties":[]})");
+}
+
+/// Test that toJson() returns the serialization set with setJson(), until the states change.
+TEST(AVSContextTest, test_setJsonIsUsedUntilStatesChange) {
+    AVSContext context;
+    context.addState(CAPABILITY_TAG, CAPABILITY_STATE);
+    auto generated = context.toJson();
+
+    context.setJson(std::make_shared<const std::string>("cached"));
+    EXPECT_EQ(context.toJson(), "cached");
+
+    AVSContext copy = context;
+    EXPECT_EQ(copy.toJson(), "cached");
+
+    context.removeState(CAPABILITY_TAG);
+    EXPECT_EQ(context.toJson(), R"({"properties":[]})");
+
+    copy.addState(CapabilityTag{"Other", "Name", "EndpointId"}, CapabilityState{""});
+    EXPECT_EQ(copy.toJson(), generated);
+}
+
 }  // namespace test
 }  // namespace avs
 }  // namespace avsCommon
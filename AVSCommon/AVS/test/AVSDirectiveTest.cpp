@@ -17,6 +17,7 @@
 #include <gmock/gmock.h>
 
 #include "AVSCommon/AVS/AVSDirective.h"
+#include "AVSCommon/AVS/Attachment/AttachmentManager.h"
 #include "AVSCommon/Utils/Optional.h"
 
 namespace alexaClientSDK {
@@ -192,6 +193,57 @@ TEST(AVSDirectiveTest, test_getAttachementReaderCallIfAttachementManagerIsNullpt
     ASSERT_THAT(directive.getAttachmentReader("Token123", sds::ReaderPolicy::NONBLOCKING), IsNull());
 }
 
+/**
+ * Verify that the parsed payload of a directive is kept, and matches the payload string.
+ */
+TEST(AVSDirectiveTest, test_payloadValueOfParsedDirective) {
+    // clang-format off
+    std::string directiveJson = R"({
+    "directive": {
+        "header": {
+            "namespace": "Namespace",
+            "name": "Name",
+            "messageId": "Id"
+        },
+        "payload": {
+            "key":"value",
+            "number":42
+        }
+    }})";
+    // clang-format on
+    auto parseResult = AVSDirective::create(directiveJson, nullptr, "");
+    EXPECT_EQ(parseResult.second, AVSDirective::ParseStatus::SUCCESS);
+    ASSERT_THAT(parseResult.first, NotNull());
+
+    auto& payload = parseResult.first->getPayloadValue();
+    ASSERT_TRUE(payload.IsObject());
+    ASSERT_TRUE(payload.HasMember("key"));
+    EXPECT_STREQ(payload["key"].GetString(), "value");
+    ASSERT_TRUE(payload.HasMember("number"));
+    EXPECT_EQ(payload["number"].GetInt(), 42);
+    EXPECT_EQ(parseResult.first->getPayload(), R"({"key":"value","number":42})");
+}
+
+/**
+ * Verify that a directive created from a payload string parses the payload, and that a payload which is not valid JSON
+ * is still accepted but has a null payload value.
+ */
+TEST(AVSDirectiveTest, test_payloadValueOfDirectiveCreatedFromPayloadString) {
+    auto attachmentManager = std::make_shared<attachment::AttachmentManager>(
+        attachment::AttachmentManager::AttachmentType::IN_PROCESS);
+    auto header = std::make_shared<AVSMessageHeader>("Namespace", "Name", "Id");
+
+    auto directive = AVSDirective::create("", header, R"({"key":"value"})", attachmentManager, "");
+    ASSERT_THAT(directive, NotNull());
+    ASSERT_TRUE(directive->getPayloadValue().IsObject());
+    EXPECT_STREQ(directive->getPayloadValue()["key"].GetString(), "value");
+
+    auto invalid = AVSDirective::create("", header, "not json", attachmentManager, "");
+    ASSERT_THAT(invalid, NotNull());
+    EXPECT_EQ(invalid->getPayload(), "not json");
+    EXPECT_TRUE(invalid->getPayloadValue().IsNull());
+}
+
 }  // namespace test
 }  // namespace avs
 }  // namespace avsCommon
@@ -292,6 +292,81 @@ TEST_F(AttachmentManagerTest, test_attachmentWriterAndReaderInOnePass) {
     }
 }
 
+/**
+ * Verify that a small attachment only holds the memory it needs, and that the manager reports the current and peak
+ * memory held by its attachments.
+ */
+TEST_F(AttachmentManagerTest, test_attachmentMemoryStats) {
+    auto writer = m_manager.createWriter(TEST_ATTACHMENT_ID_STRING_ONE);
+    auto reader = m_manager.createReader(TEST_ATTACHMENT_ID_STRING_ONE, utils::sds::ReaderPolicy::NONBLOCKING);
+    ASSERT_NE(writer, nullptr);
+    ASSERT_NE(reader, nullptr);
+
+    auto testPattern = createTestPattern(TEST_SDS_BUFFER_SIZE_IN_BYTES);
+    auto writeStatus = InProcessAttachmentWriter::WriteStatus::OK;
+    ASSERT_EQ(writer->write(testPattern.data(), testPattern.size(), &writeStatus), testPattern.size());
+    auto stats = m_manager.getMemoryStats();
+    ASSERT_EQ(stats.currentBytes, AttachmentMemoryPool::DEFAULT_CHUNK_SIZE);
+    ASSERT_EQ(stats.budgetBytes, AttachmentMemoryPool::DEFAULT_BUDGET_IN_BYTES);
+
+    std::vector<uint8_t> result(testPattern.size());
+    auto readStatus = InProcessAttachmentReader::ReadStatus::OK;
+    ASSERT_EQ(reader->read(result.data(), result.size(), &readStatus), testPattern.size());
+    ASSERT_EQ(result, testPattern);
+    writer.reset();
+    reader.reset();
+    stats = m_manager.getMemoryStats();
+    ASSERT_EQ(stats.currentBytes, 0u);
+    ASSERT_EQ(stats.peakBytes, AttachmentMemoryPool::DEFAULT_CHUNK_SIZE);
+}
+
+/**
+ * Verify that writers see a full buffer when the manager's memory budget is exhausted.
+ */
+TEST_F(AttachmentManagerTest, test_attachmentMemoryBudget) {
+    m_manager.setMemoryBudget(AttachmentMemoryPool::DEFAULT_CHUNK_SIZE);
+    auto writer1 = m_manager.createWriter(TEST_ATTACHMENT_ID_STRING_ONE);
+    auto writer2 = m_manager.createWriter(TEST_ATTACHMENT_ID_STRING_TWO);
+    auto testPattern = createTestPattern(TEST_SDS_BUFFER_SIZE_IN_BYTES);
+
+    auto writeStatus = InProcessAttachmentWriter::WriteStatus::OK;
+    ASSERT_EQ(writer1->write(testPattern.data(), testPattern.size(), &writeStatus), testPattern.size());
+    ASSERT_EQ(writer2->write(testPattern.data(), testPattern.size(), &writeStatus), 0u);
+    ASSERT_EQ(writeStatus, InProcessAttachmentWriter::WriteStatus::OK_BUFFER_FULL);
+    ASSERT_EQ(m_manager.getMemoryStats().currentBytes, AttachmentMemoryPool::DEFAULT_CHUNK_SIZE);
+}
+
+/**
+ * Verify that when the memory budget is exhausted, the data of a complete attachment which nobody has started reading
+ * is kept, and a writer sees a full buffer until that attachment has been read.
+ */
+TEST_F(AttachmentManagerTest, test_unreadAttachmentKeptWhenBudgetExhausted) {
+    m_manager.setMemoryBudget(AttachmentMemoryPool::DEFAULT_CHUNK_SIZE);
+    auto testPattern = createTestPattern(TEST_SDS_BUFFER_SIZE_IN_BYTES);
+    auto writeStatus = InProcessAttachmentWriter::WriteStatus::OK;
+
+    auto writer1 = m_manager.createWriter(TEST_ATTACHMENT_ID_STRING_ONE);
+    ASSERT_EQ(writer1->write(testPattern.data(), testPattern.size(), &writeStatus), testPattern.size());
+    writer1.reset();
+
+    auto writer2 = m_manager.createWriter(TEST_ATTACHMENT_ID_STRING_TWO);
+    ASSERT_EQ(writer2->write(testPattern.data(), testPattern.size(), &writeStatus), 0u);
+    ASSERT_EQ(writeStatus, InProcessAttachmentWriter::WriteStatus::OK_BUFFER_FULL);
+
+    auto reader1 = m_manager.createReader(TEST_ATTACHMENT_ID_STRING_ONE, utils::sds::ReaderPolicy::NONBLOCKING);
+    ASSERT_NE(reader1, nullptr);
+    std::vector<uint8_t> result(testPattern.size());
+    auto readStatus = InProcessAttachmentReader::ReadStatus::OK;
+    ASSERT_EQ(reader1->read(result.data(), result.size(), &readStatus), testPattern.size());
+    ASSERT_EQ(result, testPattern);
+
+    // Reading the attachment to the end returned its memory to the pool.
+    ASSERT_EQ(reader1->read(result.data(), result.size(), &readStatus), 0u);
+    ASSERT_EQ(readStatus, InProcessAttachmentReader::ReadStatus::CLOSED);
+    ASSERT_EQ(writer2->write(testPattern.data(), testPattern.size(), &writeStatus), testPattern.size());
+    ASSERT_EQ(writeStatus, InProcessAttachmentWriter::WriteStatus::OK);
+}
+
 }  // namespace test
 }  // namespace avs
 }  // namespace avsCommon
@@ -0,0 +1,403 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+
+#include <chrono>
+#include <future>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/AVS/Attachment/ChunkedAttachmentBuffer.h"
+#include "AVSCommon/AVS/Attachment/ChunkedAttachmentReader.h"
+#include "AVSCommon/AVS/Attachment/ChunkedAttachmentWriter.h"
+#include "AVSCommon/AVS/Attachment/InProcessAttachment.h"
+
+#include "Common/Common.h"
+
+using namespace ::testing;
+using namespace alexaClientSDK::avsCommon::avs::attachment;
+using namespace alexaClientSDK::avsCommon::utils::sds;
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace avs {
+namespace test {
+
+/// The chunk size used by the tests, small enough for the test patterns to span several chunks.
+static const size_t TEST_CHUNK_SIZE = 64;
+
+/// The budget used by the tests, which holds the whole test pattern.
+static const size_t TEST_BUDGET = 8 * TEST_CHUNK_SIZE;
+
+/// The maximum amount of unread data in buffers created directly by the tests.
+static const size_t TEST_MAX_SIZE = 4 * TEST_CHUNK_SIZE;
+
+/// How long to wait for something which is expected to happen.
+static const std::chrono::seconds WAIT_TIMEOUT{5};
+
+/// How long to wait for something which is expected not to happen.
+static const std::chrono::milliseconds SHORT_TIMEOUT{50};
+
+/**
+ * A class which helps drive this unit test suite.
+ */
+class ChunkedAttachmentTest : public ::testing::Test {
+public:
+    /**
+     * Constructor.
+     */
+    ChunkedAttachmentTest() :
+            m_pool{std::make_shared<AttachmentMemoryPool>(TEST_BUDGET, TEST_CHUNK_SIZE, TEST_BUDGET)},
+            m_attachment{InProcessAttachment::createWithMemoryPool(TEST_ATTACHMENT_ID_STRING_ONE, m_pool)},
+            m_testPattern(createTestPattern(TEST_BUDGET)) {
+    }
+
+    /**
+     * Utility function to write data, expecting it all to be written.
+     *
+     * @param writer The writer.
+     * @param offset The offset in @c m_testPattern of the data.
+     * @param size The size of the data.
+     */
+    void writeAll(AttachmentWriter* writer, size_t offset, size_t size);
+
+    /**
+     * Utility function to read data, expecting it to match @c m_testPattern.
+     *
+     * @param reader The reader.
+     * @param offset The offset in @c m_testPattern of the data.
+     * @param size The size of the data.
+     */
+    void readAll(AttachmentReader* reader, size_t offset, size_t size);
+
+    /// The memory pool.
+    std::shared_ptr<AttachmentMemoryPool> m_pool;
+
+    /// An attachment using @c m_pool.
+    std::unique_ptr<InProcessAttachment> m_attachment;
+
+    /// The data written by the tests.
+    std::vector<uint8_t> m_testPattern;
+};
+
+void ChunkedAttachmentTest::writeAll(AttachmentWriter* writer, size_t offset, size_t size) {
+    auto writeStatus = AttachmentWriter::WriteStatus::OK;
+    ASSERT_EQ(writer->write(m_testPattern.data() + offset, size, &writeStatus), size);
+    ASSERT_EQ(writeStatus, AttachmentWriter::WriteStatus::OK);
+}
+
+void ChunkedAttachmentTest::readAll(AttachmentReader* reader, size_t offset, size_t size) {
+    std::vector<uint8_t> result(size);
+    auto readStatus = AttachmentReader::ReadStatus::OK;
+    ASSERT_EQ(reader->read(result.data(), result.size(), &readStatus), size);
+    ASSERT_EQ(readStatus, AttachmentReader::ReadStatus::OK);
+    ASSERT_TRUE(std::equal(result.begin(), result.end(), m_testPattern.begin() + offset));
+}
+
+/**
+ * Verify that data written in pieces which do not line up with the chunks is read back intact, and that the
+ * attachment only holds the chunks it needs.
+ */
+TEST_F(ChunkedAttachmentTest, test_writeAndReadAcrossChunks) {
+    auto writer = m_attachment->createWriter();
+    ASSERT_NE(writer, nullptr);
+    ASSERT_EQ(m_pool->getStats().currentBytes, 0u);
+
+    writeAll(writer.get(), 0, 10);
+    ASSERT_EQ(m_pool->getStats().currentBytes, TEST_CHUNK_SIZE);
+    writeAll(writer.get(), 10, TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES);
+    writeAll(
+        writer.get(),
+        10 + TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES,
+        m_testPattern.size() - 10 - TEST_SDS_PARTIAL_WRITE_AMOUNT_IN_BYTES);
+    writer->close();
+    auto chunks = (m_testPattern.size() + TEST_CHUNK_SIZE - 1) / TEST_CHUNK_SIZE;
+    ASSERT_EQ(m_pool->getStats().currentBytes, chunks * TEST_CHUNK_SIZE);
+
+    auto reader = m_attachment->createReader(ReaderPolicy::NONBLOCKING);
+    ASSERT_NE(reader, nullptr);
+    ASSERT_EQ(reader->getNumUnreadBytes(), m_testPattern.size());
+    readAll(reader.get(), 0, TEST_SDS_PARTIAL_READ_AMOUNT_IN_BYTES);
+    readAll(
+        reader.get(),
+        TEST_SDS_PARTIAL_READ_AMOUNT_IN_BYTES,
+        m_testPattern.size() - TEST_SDS_PARTIAL_READ_AMOUNT_IN_BYTES);
+
+    uint8_t byte;
+    auto readStatus = AttachmentReader::ReadStatus::OK;
+    ASSERT_EQ(reader->read(&byte, 1, &readStatus), 0u);
+    ASSERT_EQ(readStatus, AttachmentReader::ReadStatus::CLOSED);
+}
+
+/**
+ * Verify that chunks are returned to the pool as soon as they have been read, and reused for later writes, and that
+ * the statistics track the current and peak memory.
+ */
+TEST_F(ChunkedAttachmentTest, test_chunksRecycledAsRead) {
+    auto writer = m_attachment->createWriter();
+    auto reader = m_attachment->createReader(ReaderPolicy::NONBLOCKING);
+    ASSERT_NE(writer, nullptr);
+    ASSERT_NE(reader, nullptr);
+
+    writeAll(writer.get(), 0, 4 * TEST_CHUNK_SIZE);
+    readAll(reader.get(), 0, 2 * TEST_CHUNK_SIZE + 1);
+    auto stats = m_pool->getStats();
+    ASSERT_EQ(stats.currentBytes, 2 * TEST_CHUNK_SIZE);
+    ASSERT_EQ(stats.peakBytes, 4 * TEST_CHUNK_SIZE);
+    ASSERT_EQ(stats.pooledBytes, 2 * TEST_CHUNK_SIZE);
+
+    writeAll(writer.get(), 4 * TEST_CHUNK_SIZE, TEST_CHUNK_SIZE);
+    stats = m_pool->getStats();
+    ASSERT_EQ(stats.currentBytes, 3 * TEST_CHUNK_SIZE);
+    ASSERT_EQ(stats.pooledBytes, TEST_CHUNK_SIZE);
+
+    readAll(reader.get(), 2 * TEST_CHUNK_SIZE + 1, 3 * TEST_CHUNK_SIZE - 1);
+    ASSERT_EQ(m_pool->getStats().currentBytes, 0u);
+
+    // Seeking back to data which has been released fails.
+    ASSERT_FALSE(reader->seek(0));
+    ASSERT_TRUE(reader->seek(5 * TEST_CHUNK_SIZE));
+
+    reader.reset();
+    writer.reset();
+    m_attachment.reset();
+    stats = m_pool->getStats();
+    ASSERT_EQ(stats.currentBytes, 0u);
+    ASSERT_EQ(stats.peakBytes, 4 * TEST_CHUNK_SIZE);
+}
+
+/**
+ * Verify that an @c ALL_OR_NOTHING writer sees a full buffer while the budget is exhausted by another attachment, and
+ * that it can write once the other attachment releases its memory.
+ */
+TEST_F(ChunkedAttachmentTest, test_budgetExhaustedAppliesBackpressure) {
+    auto other = InProcessAttachment::createWithMemoryPool(TEST_ATTACHMENT_ID_STRING_TWO, m_pool);
+    auto otherWriter = other->createWriter();
+    writeAll(otherWriter.get(), 0, TEST_BUDGET - TEST_CHUNK_SIZE);
+
+    auto writer = m_attachment->createWriter();
+    writeAll(writer.get(), 0, TEST_CHUNK_SIZE);
+
+    auto writeStatus = AttachmentWriter::WriteStatus::OK;
+    ASSERT_EQ(writer->write(m_testPattern.data(), TEST_CHUNK_SIZE, &writeStatus), 0u);
+    ASSERT_EQ(writeStatus, AttachmentWriter::WriteStatus::OK_BUFFER_FULL);
+    auto stats = m_pool->getStats();
+    ASSERT_EQ(stats.currentBytes, TEST_BUDGET);
+    ASSERT_GT(stats.exhaustedCount, 0u);
+
+    auto otherReader = other->createReader(ReaderPolicy::NONBLOCKING);
+    readAll(otherReader.get(), 0, TEST_CHUNK_SIZE);
+    writeAll(writer.get(), TEST_CHUNK_SIZE, TEST_CHUNK_SIZE);
+}
+
+/**
+ * Verify that a @c BLOCKING writer waits while the budget is exhausted, and completes once memory is released.
+ */
+TEST_F(ChunkedAttachmentTest, test_blockingWriterWaitsForBudget) {
+    auto other = InProcessAttachment::createWithMemoryPool(TEST_ATTACHMENT_ID_STRING_TWO, m_pool);
+    auto otherWriter = other->createWriter();
+    writeAll(otherWriter.get(), 0, TEST_BUDGET);
+
+    auto writer = m_attachment->createWriter(WriterPolicy::BLOCKING);
+    auto writeStatus = AttachmentWriter::WriteStatus::OK;
+    ASSERT_EQ(writer->write(m_testPattern.data(), TEST_CHUNK_SIZE, &writeStatus, SHORT_TIMEOUT), 0u);
+    ASSERT_EQ(writeStatus, AttachmentWriter::WriteStatus::TIMEDOUT);
+
+    auto result = std::async(std::launch::async, [this, &writer] {
+        auto status = AttachmentWriter::WriteStatus::OK;
+        return writer->write(m_testPattern.data(), TEST_CHUNK_SIZE, &status);
+    });
+    ASSERT_EQ(result.wait_for(SHORT_TIMEOUT), std::future_status::timeout);
+    other.reset();
+    otherWriter.reset();
+    ASSERT_EQ(result.wait_for(WAIT_TIMEOUT), std::future_status::ready);
+    ASSERT_EQ(result.get(), TEST_CHUNK_SIZE);
+}
+
+/**
+ * Verify that the pool's reclaim function is called before an @c ALL_OR_NOTHING writer sees a full buffer, so that
+ * memory freed by it is used for the write.
+ */
+TEST_F(ChunkedAttachmentTest, test_budgetExhaustedReclaimsMemory) {
+    std::shared_ptr<InProcessAttachment> other =
+        InProcessAttachment::createWithMemoryPool(TEST_ATTACHMENT_ID_STRING_TWO, m_pool);
+    auto otherWriter = other->createWriter();
+    writeAll(otherWriter.get(), 0, TEST_BUDGET);
+    otherWriter.reset();
+
+    // Releasing the last reference to the other attachment returns its memory, as the manager does with attachments
+    // it no longer needs to hold.
+    int reclaimCount = 0;
+    m_pool->setReclaimFunction([&reclaimCount, &other] {
+        reclaimCount++;
+        other.reset();
+    });
+
+    auto writer = m_attachment->createWriter();
+    writeAll(writer.get(), 0, TEST_CHUNK_SIZE);
+    ASSERT_EQ(reclaimCount, 1);
+    ASSERT_EQ(m_pool->getStats().currentBytes, TEST_CHUNK_SIZE);
+    m_pool->setReclaimFunction(nullptr);
+}
+
+/**
+ * Verify that a @c BLOCKING writer waiting for the budget returns as soon as the writer is closed.
+ */
+TEST_F(ChunkedAttachmentTest, test_blockingWriterWaitingForBudgetWokenByClose) {
+    auto other = InProcessAttachment::createWithMemoryPool(TEST_ATTACHMENT_ID_STRING_TWO, m_pool);
+    auto otherWriter = other->createWriter();
+    writeAll(otherWriter.get(), 0, TEST_BUDGET);
+
+    auto writer = m_attachment->createWriter(WriterPolicy::BLOCKING);
+    auto result = std::async(std::launch::async, [this, &writer] {
+        auto status = AttachmentWriter::WriteStatus::OK;
+        writer->write(m_testPattern.data(), TEST_CHUNK_SIZE, &status);
+        return status;
+    });
+    ASSERT_EQ(result.wait_for(SHORT_TIMEOUT), std::future_status::timeout);
+    writer->close();
+    ASSERT_EQ(result.wait_for(WAIT_TIMEOUT), std::future_status::ready);
+    ASSERT_EQ(result.get(), AttachmentWriter::WriteStatus::CLOSED);
+}
+
+/**
+ * Verify that the writer cannot get further ahead of the reader than the maximum size of the buffer, and that a
+ * @c BLOCKING reader is woken by new data.
+ */
+TEST_F(ChunkedAttachmentTest, test_maxSizeLimitsUnreadData) {
+    auto buffer = std::make_shared<ChunkedAttachmentBuffer>(m_pool, TEST_MAX_SIZE, 1);
+    auto writer = ChunkedAttachmentWriter::create(buffer);
+    auto reader = ChunkedAttachmentReader::create(ReaderPolicy::BLOCKING, buffer);
+    ASSERT_NE(writer, nullptr);
+    ASSERT_NE(reader, nullptr);
+
+    writeAll(writer.get(), 0, TEST_MAX_SIZE);
+    auto writeStatus = AttachmentWriter::WriteStatus::OK;
+    ASSERT_EQ(writer->write(m_testPattern.data(), 1, &writeStatus), 0u);
+    ASSERT_EQ(writeStatus, AttachmentWriter::WriteStatus::OK_BUFFER_FULL);
+
+    readAll(reader.get(), 0, TEST_MAX_SIZE);
+    auto result = std::async(std::launch::async, [&reader] {
+        uint8_t byte;
+        auto readStatus = AttachmentReader::ReadStatus::OK;
+        return reader->read(&byte, 1, &readStatus);
+    });
+    ASSERT_EQ(result.wait_for(SHORT_TIMEOUT), std::future_status::timeout);
+    writeAll(writer.get(), TEST_MAX_SIZE, 1);
+    ASSERT_EQ(result.wait_for(WAIT_TIMEOUT), std::future_status::ready);
+    ASSERT_EQ(result.get(), 1u);
+}
+
+/**
+ * Verify that a @c NONBLOCKABLE writer discards unread data, and that the reader reports the overrun, or skips ahead
+ * if it was created to reset on overruns.
+ */
+TEST_F(ChunkedAttachmentTest, test_nonblockableWriterOverrunsReader) {
+    auto buffer = std::make_shared<ChunkedAttachmentBuffer>(m_pool, TEST_MAX_SIZE, 2);
+    auto writer = ChunkedAttachmentWriter::create(buffer, WriterPolicy::NONBLOCKABLE);
+    auto reader = ChunkedAttachmentReader::create(ReaderPolicy::NONBLOCKING, buffer);
+    auto resettingReader = ChunkedAttachmentReader::create(ReaderPolicy::NONBLOCKING, buffer, true);
+    ASSERT_NE(resettingReader, nullptr);
+
+    writeAll(writer.get(), 0, TEST_MAX_SIZE);
+    writeAll(writer.get(), TEST_MAX_SIZE, 2 * TEST_CHUNK_SIZE);
+    ASSERT_LE(m_pool->getStats().currentBytes, TEST_MAX_SIZE + TEST_CHUNK_SIZE);
+
+    uint8_t byte;
+    auto readStatus = AttachmentReader::ReadStatus::OK;
+    ASSERT_EQ(reader->read(&byte, 1, &readStatus), 0u);
+    ASSERT_EQ(readStatus, AttachmentReader::ReadStatus::ERROR_OVERRUN);
+
+    ASSERT_EQ(resettingReader->read(&byte, 1, &readStatus), 0u);
+    ASSERT_EQ(readStatus, AttachmentReader::ReadStatus::OK_OVERRUN_RESET);
+    writeAll(writer.get(), 0, 1);
+    ASSERT_EQ(resettingReader->read(&byte, 1, &readStatus), 1u);
+    ASSERT_EQ(readStatus, AttachmentReader::ReadStatus::OK);
+    ASSERT_EQ(byte, m_testPattern[0]);
+}
+
+/**
+ * Verify that once the only reader has gone, the data written is released rather than filling the budget.
+ */
+TEST_F(ChunkedAttachmentTest, test_dataReleasedAfterReaderGone) {
+    auto writer = m_attachment->createWriter();
+    auto reader = m_attachment->createReader(ReaderPolicy::NONBLOCKING);
+    writeAll(writer.get(), 0, 2 * TEST_CHUNK_SIZE);
+    reader->close(AttachmentReader::ClosePoint::IMMEDIATELY);
+    reader.reset();
+    ASSERT_EQ(m_pool->getStats().currentBytes, 0u);
+
+    for (size_t i = 0; i < 2 * TEST_BUDGET / TEST_CHUNK_SIZE; ++i) {
+        writeAll(writer.get(), 0, TEST_CHUNK_SIZE);
+    }
+    ASSERT_LE(m_pool->getStats().currentBytes, TEST_CHUNK_SIZE);
+}
+
+/**
+ * Verify that a reader which has been closed, but not destroyed, does not hold on to data.
+ */
+TEST_F(ChunkedAttachmentTest, test_dataReleasedAfterReaderClosed) {
+    auto writer = m_attachment->createWriter();
+    auto reader = m_attachment->createReader(ReaderPolicy::NONBLOCKING);
+    writeAll(writer.get(), 0, 2 * TEST_CHUNK_SIZE);
+    reader->close(AttachmentReader::ClosePoint::IMMEDIATELY);
+    ASSERT_EQ(m_pool->getStats().currentBytes, 0u);
+}
+
+/**
+ * Verify that once the writer is closed and the reader has read everything, the last, partly written, chunk is
+ * released too, and the reader sees the attachment as closed.
+ */
+TEST_F(ChunkedAttachmentTest, test_lastChunkReleasedWhenDrained) {
+    auto writer = m_attachment->createWriter();
+    auto reader = m_attachment->createReader(ReaderPolicy::NONBLOCKING);
+    writeAll(writer.get(), 0, TEST_CHUNK_SIZE + TEST_CHUNK_SIZE / 2);
+    writer->close();
+    readAll(reader.get(), 0, TEST_CHUNK_SIZE + TEST_CHUNK_SIZE / 2);
+    ASSERT_EQ(m_pool->getStats().currentBytes, 0u);
+
+    uint8_t byte;
+    auto readStatus = AttachmentReader::ReadStatus::OK;
+    ASSERT_EQ(reader->read(&byte, 1, &readStatus), 0u);
+    ASSERT_EQ(readStatus, AttachmentReader::ReadStatus::CLOSED);
+}
+
+/**
+ * Verify that a reader's data available callback is called when data is written and when the writer is closed, and
+ * not once it has been cleared.
+ */
+TEST_F(ChunkedAttachmentTest, test_dataAvailableCallback) {
+    auto writer = m_attachment->createWriter();
+    auto reader = m_attachment->createReader(ReaderPolicy::NONBLOCKING);
+    int calls = 0;
+    ASSERT_TRUE(reader->setDataAvailableCallback([&calls] { ++calls; }));
+
+    writeAll(writer.get(), 0, 10);
+    ASSERT_EQ(calls, 1);
+
+    ASSERT_TRUE(reader->setDataAvailableCallback(nullptr));
+    writeAll(writer.get(), 10, 10);
+    ASSERT_EQ(calls, 1);
+
+    ASSERT_TRUE(reader->setDataAvailableCallback([&calls] { ++calls; }));
+    writer->close();
+    ASSERT_EQ(calls, 2);
+}
+
+}  // namespace test
+}  // namespace avs
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
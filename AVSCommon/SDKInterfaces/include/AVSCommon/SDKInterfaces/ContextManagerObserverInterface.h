@@ -48,8 +48,20 @@ public:
         const avs::CapabilityTag& identifier,
         const avs::CapabilityState& state,
         AlexaStateChangeCauseType cause) = 0;
+
+    /**
+     * Notifies the observer that the value of a state which is not proactively reported has changed, e.g. because its
+     * provider set a new state or answered a state request with a different value.  Observers which keep a copy of the
+     * context should consider their copy of this state out of date.
+     *
+     * @param identifier Identifies the state which changed.
+     */
+    virtual void onStateInvalidated(const avs::CapabilityTag& identifier);
 };
 
+inline void ContextManagerObserverInterface::onStateInvalidated(const avs::CapabilityTag& identifier) {
+}
+
 }  // namespace sdkInterfaces
 }  // namespace avsCommon
 }  // namespace alexaClientSDK
@@ -77,6 +77,20 @@ public:
         std::shared_ptr<avsCommon::avs::AVSDirective> directive,
         std::unique_ptr<DirectiveHandlerResultInterface> result) = 0;
 
+    /**
+     * Returns whether @c preHandleDirective() may be called for several directives at the same time, from different
+     * threads, and not necessarily in the order the directives arrived.  Handlers which return @c true have their
+     * directives pre-handled on a shared thread pool, so that a slow @c preHandleDirective() does not delay the
+     * directives queued behind it.  Directives are still handled in the order they arrived.
+     *
+     * @note The returned value must not change while the handler is registered.
+     *
+     * @return Whether @c preHandleDirective() supports concurrent calls.
+     */
+    virtual bool supportsConcurrentPreHandle() const {
+        return false;
+    }
+
     /**
      * Handle the action specified by the directive identified by @c messageId. The handling of subsequent directives
      * with the same @c DialogRequestId may be blocked until the @c DirectiveHandler calls the @c setSucceeded()
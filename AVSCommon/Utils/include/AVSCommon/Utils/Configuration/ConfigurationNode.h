@@ -67,6 +67,10 @@ namespace configuration {
  *         }
  *     }
  * @endcode
+ *
+ * The global configuration is merged into a new document by @c initialize() and published only once it is complete.
+ * It is never modified after that, so it may be read from any thread without locking.  Each @c ConfigurationNode shares
+ * ownership of the document it was obtained from, so it stays valid after @c uninitialize().
  */
 class ConfigurationNode {
 public:
@@ -90,7 +94,8 @@ public:
     /**
      * Uninitialize the global configuration.
      *
-     * @note Once this method has been called, all existing ConfigurationNode instances will become invalid.
+     * @note Existing @c ConfigurationNode instances keep the configuration they were obtained from, which is freed
+     * once the last of them is destroyed.
      */
     static void uninitialize();
 
@@ -258,8 +263,9 @@ private:
      *
      * @param object @c rapidjson::Value of type @c rapidjson::Type::kObject within the global configuration that this
      * @c ConfigurationNode will represent.
+     * @param document The document containing @c object, which this @c ConfigurationNode keeps alive.
      */
-    ConfigurationNode(const rapidjson::Value* object);
+    ConfigurationNode(const rapidjson::Value* object, std::shared_ptr<const rapidjson::Document> document);
 
     /**
      * Adapt between the public version of @c getString() (which fetches @c std::string) and the @c getValue()
@@ -275,17 +281,20 @@ private:
     /// Object value within the global configuration that this @c ConfigurationNode represents.
     const rapidjson::Value* m_object;
 
+    /// The document containing @c m_object.
+    std::shared_ptr<const rapidjson::Document> m_document;
+
     /**
-     * Static mutex to serialize access to static values @c m_document and @c m_root.  This enables enforcing
-     * that @c initialize() is only performed once after startup or the latest call to @c uninitialize().
+     * Static mutex to serialize @c initialize() and @c uninitialize().  This enables enforcing that @c initialize()
+     * is only performed once after startup or the latest call to @c uninitialize().
      */
     static std::mutex m_mutex;
 
-    /// static Document containing the global configuration.
-    static rapidjson::Document m_document;
-
-    /// static instance of @c ConfigurationNode identifying the root object within the global configuration.
-    static ConfigurationNode m_root;
+    /**
+     * The published global configuration, or @c nullptr if it is not initialized.  Only changed while holding
+     * @c m_mutex, and read without locking with @c std::atomic_load().
+     */
+    static std::shared_ptr<const rapidjson::Document> m_root;
 };
 
 template <typename InputType, typename OutputType, typename DefaultType>
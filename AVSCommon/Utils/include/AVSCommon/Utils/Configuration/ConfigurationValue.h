@@ -0,0 +1,176 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_CONFIGURATION_CONFIGURATIONVALUE_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_CONFIGURATION_CONFIGURATIONVALUE_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "AVSCommon/Utils/Configuration/ConfigurationNode.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace configuration {
+
+/**
+ * A typed value of the global configuration, looked up once by its path.  Reading a @c ConfigurationValue does not
+ * walk the configuration tree, so components which read the same value repeatedly should resolve it when they are
+ * created and keep it.  For example:
+ * @code
+ *     auto caPath = ConfigurationValue<std::string>::resolve({"libcurlUtils", "CURLOPT_CAPATH"});
+ *     if (caPath.isSet()) {
+ *         useCaPath(caPath.get());
+ *     }
+ * @endcode
+ *
+ * @note Like a @c ConfigurationNode, a @c ConfigurationValue reflects the configuration at the time it was resolved.
+ * It is not updated by a later @c ConfigurationNode::initialize().
+ *
+ * @tparam Type The type of the value.  One of @c bool, @c int, @c uint32_t or @c std::string.
+ */
+template <typename Type>
+class ConfigurationValue {
+public:
+    /**
+     * Resolve a value of the global configuration.
+     *
+     * @param path The keys of the objects containing the value, starting from the root, followed by the key of the
+     * value itself.
+     * @param defaultValue The value to use if the configuration does not have a value of type @c Type at @c path.
+     * @return The resolved value.
+     */
+    static ConfigurationValue<Type> resolve(const std::vector<std::string>& path, Type defaultValue = Type());
+
+    /**
+     * Resolve a value of the configuration relative to a @c ConfigurationNode.
+     *
+     * @param node The @c ConfigurationNode to start from.
+     * @param path The keys of the objects containing the value, starting from @c node, followed by the key of the
+     * value itself.
+     * @param defaultValue The value to use if the configuration does not have a value of type @c Type at @c path.
+     * @return The resolved value.
+     */
+    static ConfigurationValue<Type> resolve(
+        const ConfigurationNode& node,
+        const std::vector<std::string>& path,
+        Type defaultValue = Type());
+
+    /**
+     * Get whether the configuration had a value of type @c Type at the resolved path.
+     *
+     * @return Whether the configuration had a value.
+     */
+    bool isSet() const;
+
+    /**
+     * Get the value, or the default value if the configuration did not have one.
+     *
+     * @return The value.
+     */
+    const Type& get() const;
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param isSet Whether the configuration had a value.
+     * @param value The value, or the default value.
+     */
+    ConfigurationValue(bool isSet, Type value);
+
+    /**
+     * Read a value from a @c ConfigurationNode, using the getter for @c Type.
+     *
+     * @param node The @c ConfigurationNode containing the value.
+     * @param key The key of the value.
+     * @param[out] out Pointer to receive the value.
+     * @param defaultValue Default value to use if @c node does not have a value for @c key.
+     * @return Whether @c node has a value for @c key.
+     */
+    static bool read(const ConfigurationNode& node, const std::string& key, bool* out, bool defaultValue) {
+        return node.getBool(key, out, defaultValue);
+    }
+
+    /// @copydoc read(const ConfigurationNode&,const std::string&,bool*,bool)
+    static bool read(const ConfigurationNode& node, const std::string& key, int* out, int defaultValue) {
+        return node.getInt(key, out, defaultValue);
+    }
+
+    /// @copydoc read(const ConfigurationNode&,const std::string&,bool*,bool)
+    static bool read(const ConfigurationNode& node, const std::string& key, uint32_t* out, uint32_t defaultValue) {
+        return node.getUint32(key, out, defaultValue);
+    }
+
+    /// @copydoc read(const ConfigurationNode&,const std::string&,bool*,bool)
+    static bool read(
+        const ConfigurationNode& node,
+        const std::string& key,
+        std::string* out,
+        const std::string& defaultValue) {
+        return node.getString(key, out, defaultValue);
+    }
+
+    /// Whether the configuration had a value.
+    bool m_isSet;
+
+    /// The value, or the default value.
+    Type m_value;
+};
+
+template <typename Type>
+ConfigurationValue<Type> ConfigurationValue<Type>::resolve(const std::vector<std::string>& path, Type defaultValue) {
+    return resolve(ConfigurationNode::getRoot(), path, defaultValue);
+}
+
+template <typename Type>
+ConfigurationValue<Type> ConfigurationValue<Type>::resolve(
+    const ConfigurationNode& node,
+    const std::vector<std::string>& path,
+    Type defaultValue) {
+    if (path.empty()) {
+        return ConfigurationValue<Type>(false, defaultValue);
+    }
+    auto parent = node;
+    for (size_t index = 0; index + 1 < path.size() && parent; ++index) {
+        parent = parent[path[index]];
+    }
+    Type value;
+    auto isSet = read(parent, path.back(), &value, defaultValue);
+    return ConfigurationValue<Type>(isSet, value);
+}
+
+template <typename Type>
+ConfigurationValue<Type>::ConfigurationValue(bool isSet, Type value) : m_isSet{isSet}, m_value(std::move(value)) {
+}
+
+template <typename Type>
+bool ConfigurationValue<Type>::isSet() const {
+    return m_isSet;
+}
+
+template <typename Type>
+const Type& ConfigurationValue<Type>::get() const {
+    return m_value;
+}
+
+}  // namespace configuration
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_CONFIGURATION_CONFIGURATIONVALUE_H_
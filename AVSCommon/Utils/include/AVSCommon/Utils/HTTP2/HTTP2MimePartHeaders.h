@@ -0,0 +1,210 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_HTTP2_HTTP2MIMEPARTHEADERS_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_HTTP2_HTTP2MIMEPARTHEADERS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace http2 {
+
+/**
+ * The headers of a MIME part, held in a small fixed-size table so that decoding them does not allocate.
+ *
+ * Names and values are copied into an embedded buffer as the decoder receives them, which may be in several pieces if
+ * a header spans two chunks of the response.  Headers which do not fit in the table are dropped, and
+ * @c hasOverflowed() reports that this happened.  The @c Text references returned by the accessors are valid until
+ * the headers are next modified.
+ */
+class HTTP2MimePartHeaders {
+public:
+    /// The maximum number of headers in the table.
+    static constexpr size_t MAX_HEADERS = 8;
+
+    /// The size of the buffer holding the names and values of the headers.
+    static constexpr size_t TEXT_SIZE = 512;
+
+    /// A reference to a name or value in the table.  It is not null terminated.
+    struct Text {
+        /// The first character.
+        const char* data;
+
+        /// The number of characters.
+        size_t size;
+
+        /**
+         * Checks whether the text contains a string.
+         *
+         * @param str The string to look for.
+         * @return Whether @c str occurs in the text.
+         */
+        bool contains(const std::string& str) const;
+
+        /**
+         * Copies the text into a @c std::string.
+         *
+         * @return The text.
+         */
+        std::string str() const;
+    };
+
+    /// Constructs an empty table.
+    HTTP2MimePartHeaders();
+
+    /// Removes all headers.
+    void clear();
+
+    /**
+     * Appends characters to the name of the header being received.
+     *
+     * @param data The characters.
+     * @param size The number of characters.
+     */
+    void appendName(const char* data, size_t size);
+
+    /**
+     * Appends characters to the value of the header being received.
+     *
+     * @param data The characters.
+     * @param size The number of characters.
+     */
+    void appendValue(const char* data, size_t size);
+
+    /// Adds the header being received to the table, or drops it if it did not fit.
+    void endHeader();
+
+    /**
+     * Obtain the number of headers in the table.
+     *
+     * @return The number of headers.
+     */
+    size_t getCount() const;
+
+    /**
+     * Obtain the name of a header.
+     *
+     * @param index The index of the header, less than @c getCount().
+     * @return The name.
+     */
+    Text getName(size_t index) const;
+
+    /**
+     * Obtain the value of a header.
+     *
+     * @param index The index of the header, less than @c getCount().
+     * @return The value.
+     */
+    Text getValue(size_t index) const;
+
+    /**
+     * Finds the first header with a name.  Names are compared without regard to case.
+     *
+     * @param name The name of the header.
+     * @param[out] value The value of the header, if found.
+     * @return Whether a header with the name was found.
+     */
+    bool find(const std::string& name, Text* value) const;
+
+    /**
+     * Counts the headers with a name.  Names are compared without regard to case.
+     *
+     * @param name The name of the header.
+     * @return The number of headers with the name.
+     */
+    size_t count(const std::string& name) const;
+
+    /**
+     * Checks whether any header was dropped because the table was full.
+     *
+     * @return Whether a header was dropped since the last @c clear().
+     */
+    bool hasOverflowed() const;
+
+    /**
+     * Copies the headers into a multimap from names to values.
+     *
+     * @return The headers.
+     */
+    std::multimap<std::string, std::string> toMultimap() const;
+
+private:
+    /// The location of a header in @c m_text.
+    struct Entry {
+        /// The offset of the name.
+        uint16_t nameOffset;
+
+        /// The size of the name.
+        uint16_t nameSize;
+
+        /// The offset of the value, which follows the name.
+        uint16_t valueOffset;
+
+        /// The size of the value.
+        uint16_t valueSize;
+    };
+
+    /**
+     * Appends characters to the header being received.
+     *
+     * @param data The characters.
+     * @param size The number of characters.
+     * @return Whether the characters fit.
+     */
+    bool append(const char* data, size_t size);
+
+    /**
+     * Checks whether the name of a header matches a string, without regard to case.
+     *
+     * @param index The index of the header.
+     * @param name The string to compare with.
+     * @return Whether the name matches.
+     */
+    bool nameEquals(size_t index, const std::string& name) const;
+
+    /// The headers.  The entry at @c m_count is the header being received.
+    Entry m_entries[MAX_HEADERS];
+
+    /// The number of complete headers.
+    size_t m_count;
+
+    /// The number of characters used in @c m_text.
+    size_t m_textSize;
+
+    /// Whether the value of the header being received has started.
+    bool m_inValue;
+
+    /// Whether the header being received does not fit, and will be dropped.
+    bool m_dropCurrent;
+
+    /// Whether a header has been dropped.
+    bool m_overflowed;
+
+    /// The names and values of the headers.
+    char m_text[TEXT_SIZE];
+};
+
+}  // namespace http2
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_HTTP2_HTTP2MIMEPARTHEADERS_H_
@@ -53,6 +53,7 @@ public:
     /// @{
     HTTP2SendDataResult onSendData(char* bytes, size_t size) override;
     std::vector<std::string> getRequestHeaderLines() override;
+    bool setDataAvailableCallback(std::function<void()> callback) override;
     /// @}
 
 private:
@@ -18,8 +18,9 @@
 
 #include <memory>
 
-#include <MultipartParser/MultipartReader.h>
+#include <MultipartParser/MultipartParser.h>
 
+#include "AVSCommon/Utils/HTTP2/HTTP2MimePartHeaders.h"
 #include "AVSCommon/Utils/HTTP2/HTTP2MimeResponseSinkInterface.h"
 #include "AVSCommon/Utils/HTTP2/HTTP2ResponseSinkInterface.h"
 
@@ -31,6 +32,9 @@ namespace http2 {
 /**
  * Class that adapts between HTTPResponseSinkInterface and HTTP2MimeResponseSinkInterface providing
  * mime decoding services.
+ *
+ * Once the first chunk has been received, decoding does not allocate: part data is passed to the sink as pointers
+ * into the received chunk, and part headers are collected in a fixed-size @c HTTP2MimePartHeaders table.
  */
 class HTTP2MimeResponseDecoder : public HTTP2ResponseSinkInterface {
 public:
@@ -55,17 +59,30 @@ public:
     /// @}
 
 private:
-    /** We will also need to implements the callbacks for @class MultipartReader **/
-    static void partBeginCallback(const MultipartHeaders& headers, void* userData);
-    static void partDataCallback(const char* buffer, size_t size, void* userData);
-    static void partEndCallback(void* userData);
+    /// @name Callbacks for @c MultipartParser
+    /// @{
+    static void partBeginCallback(const char* buffer, size_t start, size_t end, void* userData);
+    static void headerFieldCallback(const char* buffer, size_t start, size_t end, void* userData);
+    static void headerValueCallback(const char* buffer, size_t start, size_t end, void* userData);
+    static void headerEndCallback(const char* buffer, size_t start, size_t end, void* userData);
+    static void headersEndCallback(const char* buffer, size_t start, size_t end, void* userData);
+    static void partDataCallback(const char* buffer, size_t start, size_t end, void* userData);
+    static void partEndCallback(const char* buffer, size_t start, size_t end, void* userData);
+    /// @}
 
     /// MIMEResponseSinkInterface implementation to pass MIME data to
     std::shared_ptr<HTTP2MimeResponseSinkInterface> m_sink;
     /// Response code that has been received, or zero.
     long m_responseCode;
-    /// Instance of a multipart MIME reader.
-    MultipartReader m_multipartReader;
+    /// Instance of a multipart MIME parser.
+    MultipartParser m_multipartParser;
+    /// The state of @c m_multipartParser before the current chunk, restored if the sink pauses.  Assigned rather than
+    /// constructed for each chunk, so that it reuses its buffers.
+    MultipartParser m_multipartParserCheckpoint;
+    /// The headers of the part being received.
+    HTTP2MimePartHeaders m_partHeaders;
+    /// The state of @c m_partHeaders before the current chunk, restored if the sink pauses.
+    HTTP2MimePartHeaders m_partHeadersCheckpoint;
     /// Last parse status returned
     HTTP2ReceiveDataStatus m_lastStatus;
     /// MIME part callbacks on current(or last in case of PAUSE) chunk
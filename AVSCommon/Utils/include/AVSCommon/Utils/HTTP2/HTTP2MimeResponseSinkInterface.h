@@ -21,6 +21,7 @@
 #include <map>
 #include <string>
 
+#include "AVSCommon/Utils/HTTP2/HTTP2MimePartHeaders.h"
 #include "AVSCommon/Utils/HTTP2/HTTP2ResponseSinkInterface.h"
 #include "AVSCommon/Utils/HTTP2/HTTP2ReceiveDataStatus.h"
 #include "AVSCommon/Utils/HTTP2/HTTP2ResponseFinishedStatus.h"
@@ -73,6 +74,19 @@ public:
      */
     virtual bool onBeginMimePart(const std::multimap<std::string, std::string>& headers) = 0;
 
+    /**
+     * Notification of the start of a new mime part, with the headers of the part as decoded, without copying them.
+     * Sinks which override this method avoid allocating for the headers of every part.  The default implementation
+     * copies the headers into a multimap and calls @c onBeginMimePart().
+     *
+     * @note Calls to this method may block network operations for the associated instance of HTTP2ConnectionInterface,
+     * so they should return quickly.
+     *
+     * @param headers The headers of the part.  Only valid for the duration of the call.
+     * @return Whether receipt of the response should continue.
+     */
+    virtual bool onBeginMimePartHeaders(const HTTP2MimePartHeaders& headers);
+
     /**
      * Notification of new body data received from an HTTP2 response.
      *
@@ -118,6 +132,10 @@ public:
     virtual void onResponseFinished(HTTP2ResponseFinishedStatus status) = 0;
 };
 
+inline bool HTTP2MimeResponseSinkInterface::onBeginMimePartHeaders(const HTTP2MimePartHeaders& headers) {
+    return onBeginMimePart(headers.toMultimap());
+}
+
 }  // namespace http2
 }  // namespace utils
 }  // namespace avsCommon
@@ -18,6 +18,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -59,8 +60,22 @@ public:
      * @return Result indicating the disposition of the operation and number of bytes copied.  @see HTTPSendDataResult.
      */
     virtual HTTP2SendDataResult onSendData(char* bytes, size_t size) = 0;
+
+    /**
+     * Set a function to call when data becomes available after a call to send data returned @c PAUSE, so that the
+     * request can be resumed without polling this source.  The default implementation does not support this.
+     *
+     * @param callback The function to call, or an empty function to stop calling one.  It may be called from any
+     * thread, so it must be thread-safe and return quickly.
+     * @return Whether this source calls @c callback.  If @c false, a paused request must be polled.
+     */
+    virtual bool setDataAvailableCallback(std::function<void()> callback);
 };
 
+inline bool HTTP2RequestSourceInterface::setDataAvailableCallback(std::function<void()> callback) {
+    return false;
+}
+
 }  // namespace http2
 }  // namespace utils
 }  // namespace avsCommon
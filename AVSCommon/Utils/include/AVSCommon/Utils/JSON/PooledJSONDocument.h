@@ -0,0 +1,143 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_JSON_POOLEDJSONDOCUMENT_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_JSON_POOLEDJSONDOCUMENT_H_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include <rapidjson/document.h>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace json {
+
+/**
+ * A @c rapidjson::Document whose values are allocated from a reusable arena.
+ *
+ * When rapidjson is built with a @c MemoryPoolAllocator as its default allocator (@c RAPIDJSON_MEM_OPTIMIZATION=OFF),
+ * the first @c ARENA_SIZE bytes of the document are carved out of a buffer taken from a process-wide pool, and the
+ * buffer is handed back to the pool when the document is destroyed, so parsing a typical message does not allocate
+ * its nodes from the heap.  Larger documents spill over into heap chunks as usual.  Up to @c MAX_POOLED_ARENAS idle
+ * buffers are kept; any more are freed.  With any other default allocator, such as the @c CrtAllocator used by the
+ * memory optimized build, the document allocates as a plain @c rapidjson::Document does.
+ *
+ * A @c PooledJSONDocument is neither copyable nor movable, because its document refers to its own allocator.  Share
+ * it with a @c std::shared_ptr instead.
+ */
+class PooledJSONDocument {
+public:
+    /// The size in bytes of the arena buffer of each document.
+    static constexpr size_t ARENA_SIZE = 16 * 1024;
+
+    /// The maximum number of idle arena buffers kept in the pool.
+    static constexpr size_t MAX_POOLED_ARENAS = 8;
+
+    /**
+     * Creates an empty document.
+     *
+     * @return The new document.
+     */
+    static std::shared_ptr<PooledJSONDocument> create();
+
+    /**
+     * Creates a document and parses a JSON string into it.
+     *
+     * @param jsonContent The JSON string to parse.
+     * @return The parsed document, or @c nullptr if @c jsonContent is not valid JSON.
+     */
+    static std::shared_ptr<PooledJSONDocument> parse(const std::string& jsonContent);
+
+    /// Constructor.  Use @c create() or @c parse() instead.
+    PooledJSONDocument();
+
+    /// Deleted copy constructor.
+    PooledJSONDocument(const PooledJSONDocument&) = delete;
+
+    /// Deleted assignment operator.
+    PooledJSONDocument& operator=(const PooledJSONDocument&) = delete;
+
+    /**
+     * Obtain the document.
+     *
+     * @return The document.
+     */
+    rapidjson::Document& getDocument();
+
+    /**
+     * Obtain the document.
+     *
+     * @return The document.
+     */
+    const rapidjson::Document& getDocument() const;
+
+    /**
+     * Whether documents allocate from pooled arenas, which depends on the default allocator rapidjson is built with.
+     *
+     * @return Whether documents allocate from pooled arenas.
+     */
+    static bool usesArena();
+
+    /**
+     * Obtain the number of idle arena buffers in the pool.  Intended for tests.
+     *
+     * @return The number of idle arena buffers.
+     */
+    static size_t getPooledArenaCount();
+
+private:
+    /// Owns an arena buffer, and returns it to the pool on destruction.
+    class Arena {
+    public:
+        /**
+         * Constructor.  Takes a buffer from the pool, or allocates one if the pool is empty.
+         *
+         * @param enabled Whether a buffer is needed at all.  If not, @c buffer is left @c nullptr.
+         */
+        explicit Arena(bool enabled);
+
+        /// Destructor.  Returns the buffer to the pool, or frees it if the pool is full.
+        ~Arena();
+
+        /// Deleted copy constructor.
+        Arena(const Arena&) = delete;
+
+        /// Deleted assignment operator.
+        Arena& operator=(const Arena&) = delete;
+
+        /// The buffer, or @c nullptr if the arena is not enabled.
+        char* buffer;
+    };
+
+    /// The arena buffer.  Declared first so that it outlives the allocator, which writes to it as it is destroyed.
+    Arena m_arena;
+
+    /// The allocator of the values of @c m_document, which starts in @c m_arena if @c usesArena().
+    std::unique_ptr<rapidjson::Document::AllocatorType> m_allocator;
+
+    /// The document.
+    rapidjson::Document m_document;
+};
+
+}  // namespace json
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_JSON_POOLEDJSONDOCUMENT_H_
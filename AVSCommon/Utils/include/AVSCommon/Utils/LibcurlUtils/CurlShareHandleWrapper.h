@@ -0,0 +1,106 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LIBCURLUTILS_CURLSHAREHANDLEWRAPPER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LIBCURLUTILS_CURLSHAREHANDLEWRAPPER_H_
+
+#include <curl/curl.h>
+#include <memory>
+#include <mutex>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace libcurlUtils {
+
+/**
+ * This class wraps a @c libcurl @c share @c handle which shares the DNS cache and the TLS session cache between
+ * @c libcurl @c handles, even when they are used by different @c libcurl @c multi @c handles on different threads.
+ *
+ * A @c libcurl @c multi @c handle keeps these caches itself, so they are lost when it is destroyed.  Sharing them
+ * through an instance of this class that outlives the @c multi @c handles lets a new connection to a known host skip
+ * the DNS lookup and resume the previous TLS session instead of doing a full handshake.
+ */
+class CurlShareHandleWrapper {
+public:
+    /**
+     * Create a CurlShareHandleWrapper.
+     *
+     * @return The new CurlShareHandleWrapper instance, or nullptr if the operation fails.
+     */
+    static std::shared_ptr<CurlShareHandleWrapper> create();
+
+    /**
+     * Destructor.  Every @c libcurl @c handle must have been detached with @c detach() before this is called.
+     */
+    ~CurlShareHandleWrapper();
+
+    /**
+     * Make a @c libcurl @c handle use the caches of this instance.  This must be done before the handle is added
+     * to a @c libcurl @c multi @c handle.
+     *
+     * @param handle The @c libcurl @c handle.
+     * @return Whether the operation was successful.
+     */
+    bool attach(CURL* handle);
+
+    /**
+     * Stop a @c libcurl @c handle using the caches of this instance.  This must be done after the handle is removed
+     * from its @c libcurl @c multi @c handle.
+     *
+     * @param handle The @c libcurl @c handle.
+     */
+    void detach(CURL* handle);
+
+private:
+    /**
+     * Constructor.
+     *
+     * @param handle The @c libcurl @c share @c handle to wrap.
+     */
+    CurlShareHandleWrapper(CURLSH* handle);
+
+    /**
+     * The @c CURLSHOPT_LOCKFUNC of the wrapped @c libcurl @c share @c handle.
+     *
+     * @param handle The @c libcurl @c handle which needs the lock.
+     * @param data The data to lock.
+     * @param access The type of access needed.
+     * @param userPtr The @c CurlShareHandleWrapper instance.
+     */
+    static void lock(CURL* handle, curl_lock_data data, curl_lock_access access, void* userPtr);
+
+    /**
+     * The @c CURLSHOPT_UNLOCKFUNC of the wrapped @c libcurl @c share @c handle.
+     *
+     * @param handle The @c libcurl @c handle which held the lock.
+     * @param data The data to unlock.
+     * @param userPtr The @c CurlShareHandleWrapper instance.
+     */
+    static void unlock(CURL* handle, curl_lock_data data, void* userPtr);
+
+    /// The wrapped @c libcurl @c share @c handle.
+    CURLSH* m_handle;
+
+    /// One mutex for each kind of data @c libcurl may lock.
+    std::mutex m_mutexes[CURL_LOCK_DATA_LAST];
+};
+
+}  // namespace libcurlUtils
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LIBCURLUTILS_CURLSHAREHANDLEWRAPPER_H_
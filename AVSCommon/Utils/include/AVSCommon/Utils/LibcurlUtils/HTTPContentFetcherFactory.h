@@ -17,10 +17,12 @@
 #define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LIBCURLUTILS_HTTPCONTENTFETCHERFACTORY_H_
 
 #include <memory>
+#include <mutex>
 #include <string>
 
 #include <AVSCommon/SDKInterfaces/HTTPContentFetcherInterface.h>
 #include <AVSCommon/SDKInterfaces/HTTPContentFetcherInterfaceFactoryInterface.h>
+#include <AVSCommon/Utils/LibcurlUtils/LibcurlContentFetchEngine.h>
 #include <AVSCommon/Utils/LibcurlUtils/LibcurlSetCurlOptionsCallbackFactoryInterface.h>
 
 namespace alexaClientSDK {
@@ -30,6 +32,9 @@ namespace libcurlUtils {
 
 /**
  * A class that produces @c HTTPContentFetchers.
+ *
+ * All the fetchers produced by a factory perform their transfers on one @c LibcurlContentFetchEngine, so they share a
+ * single network thread, and reuse each other's connections, DNS lookups and TLS sessions.
  */
 class HTTPContentFetcherFactory : public avsCommon::sdkInterfaces::HTTPContentFetcherInterfaceFactoryInterface {
 public:
@@ -61,6 +66,12 @@ public:
 private:
     /// The optional @c LibcurlSetCurlOptionsCallbackFactoryInterface to set user defined curl options.
     std::shared_ptr<LibcurlSetCurlOptionsCallbackFactoryInterface> m_setCurlOptionsCallbackFactory;
+
+    /// Mutex to serialize the creation of @c m_engine.
+    std::mutex m_engineMutex;
+
+    /// The engine shared by the fetchers, created when the first fetcher is.
+    std::shared_ptr<LibcurlContentFetchEngine> m_engine;
 };
 
 }  // namespace libcurlUtils
@@ -18,11 +18,12 @@
 
 #include <atomic>
 #include <future>
+#include <chrono>
 #include <string>
-#include <thread>
 
 #include <AVSCommon/SDKInterfaces/HTTPContentFetcherInterface.h>
 #include <AVSCommon/Utils/LibcurlUtils/CurlEasyHandleWrapper.h>
+#include <AVSCommon/Utils/LibcurlUtils/LibcurlContentFetchEngine.h>
 #include <AVSCommon/Utils/LibcurlUtils/LibcurlSetCurlOptionsCallbackInterface.h>
 
 namespace alexaClientSDK {
@@ -42,10 +43,14 @@ public:
      * @param url The url to fetch the content from.
      * @param setCurlOptionsCallback The optional @c LibcurlSetCurlOptionsCallbackInterface allows setting user
      * defined curl options.
+     * @param engine The @c LibcurlContentFetchEngine to perform the transfer on.  Fetchers sharing an engine share its
+     * network thread and its cache of connections.  If @c nullptr, or if the URL is not an HTTP one, a private
+     * engine is created by @c getContent().
      */
     explicit LibCurlHttpContentFetcher(
         const std::string& url,
-        const std::shared_ptr<LibcurlSetCurlOptionsCallbackInterface>& setCurlOptionsCallback = nullptr);
+        const std::shared_ptr<LibcurlSetCurlOptionsCallbackInterface>& setCurlOptionsCallback = nullptr,
+        std::shared_ptr<LibcurlContentFetchEngine> engine = nullptr);
 
     /// @name HTTPContentFetcherInterface methods
     /// @{
@@ -91,6 +96,21 @@ private:
      */
     curl_slist* getCustomHeaderList(const std::vector<std::string>& customHeaders);
 
+    /**
+     * Called on the engine's network thread when a transfer started by an @c ENTIRE_BODY fetch ends.  Restarts the
+     * transfer with a range if bytes of the body are still missing, otherwise completes the fetch.
+     *
+     * @param result The result of the transfer.
+     * @param writerWasCreatedLocally Whether @c m_streamWriter was created by @c getContent().
+     */
+    void onBodyTransferCompleted(CURLcode result, bool writerWasCreatedLocally);
+
+    /// Frees @c m_headerList, if set, and removes it from the curl handle.
+    void releaseHeaderList();
+
+    /// Resumes the transfer if it is paused, so that it notices a change made by another thread.
+    void resumeTransfer();
+
     /// The URL to fetch from.
     const std::string m_url;
 
@@ -100,6 +120,12 @@ private:
     /// The last used url to fetch content from.
     std::string m_effectiveUrl;
 
+    /// The engine performing the transfer.
+    std::shared_ptr<LibcurlContentFetchEngine> m_engine;
+
+    /// The custom HTTP headers of the transfer.  Freed once the transfer has ended.
+    curl_slist* m_headerList;
+
     /// A libcurl wrapper.
     CurlEasyHandleWrapper m_curlWrapper;
 
@@ -123,6 +149,15 @@ private:
     /// Number of bytes that has been received since the first request.
     ssize_t m_totalContentReceivedLength;
 
+    /**
+     * Number of bytes of the buffer passed to the last call of @c bodyCallback which were written before the transfer
+     * was paused.  Since libcurl delivers the same buffer again on resume, these bytes are skipped.
+     */
+    size_t m_bytesWrittenBeforePause;
+
+    /// The time at which the body started waiting for @c getBody() to be called.
+    std::chrono::steady_clock::time_point m_getBodyWaitStartTime;
+
     /// Flag to indicate that the data-fetch operation has completed.
     std::atomic<bool> m_done;
 
@@ -130,10 +165,23 @@ private:
     std::atomic<bool> m_isShutdown;
 
     /**
-     * Internal thread that does the curl_easy_perform. The reason for using a thread is that curl_easy_perform may
-     * block forever if the URL specified is a live stream.
+     * Flag to indicate that the curl handle has been handed to @c m_engine.  The transfer is performed on the engine's
+     * network thread, rather than by a blocking @c curl_easy_perform, since it may never end if the URL specified is
+     * a live stream.
+     */
+    std::atomic<bool> m_isTransferStarted;
+
+    /**
+     * Whether libcurl can pause the transfer, which it only can for network protocols, and whether the writer can
+     * resume it when a reader frees space.  Set by @c getContent(), and cleared by @c bodyCallback if the writer cannot.
+     */
+    bool m_canPauseTransfer;
+
+    /**
+     * Set by @c bodyCallback while it writes the body, so that a reader freeing space resumes the transfer if the
+     * write paused it.  Shared with the function the writer calls when space is freed, which may outlive this object.
      */
-    std::thread m_thread;
+    std::shared_ptr<std::atomic<bool>> m_isWaitingForSpace;
 
     /// Flag to indicate that a call to @c getContent() has been made. Subsequent calls will not be accepted.
     std::atomic<bool> m_hasObjectBeenUsed;
@@ -0,0 +1,270 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LIBCURLUTILS_LIBCURLCONTENTFETCHENGINE_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LIBCURLUTILS_LIBCURLCONTENTFETCHENGINE_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <curl/curl.h>
+
+#include <AVSCommon/Utils/LibcurlUtils/CurlMultiHandleWrapper.h>
+#include <AVSCommon/Utils/LibcurlUtils/CurlShareHandleWrapper.h>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace libcurlUtils {
+
+/**
+ * Runs the transfers of many @c LibCurlHttpContentFetcher instances on a single network thread, with a single
+ * @c CurlMultiHandleWrapper.
+ *
+ * Because the transfers share one multi handle, they also share its connection cache, so a fetcher can reuse the
+ * connection of an earlier fetcher to the same host.  The transfers also share a DNS cache and a TLS session cache
+ * through a @c CurlShareHandleWrapper, so a new connection to a known host can skip the DNS lookup and resume the TLS
+ * session instead of doing a full handshake.
+ *
+ * Callbacks of a transfer run on the network thread and must not block, since that would stall every other transfer.
+ * A write callback which cannot make progress should call @c onTransferPaused() and return @c CURL_WRITEFUNC_PAUSE.
+ * The transfer stays paused until whatever it waits for calls @c resumeTransfer(), or until the time given to
+ * @c onTransferPaused() passes, at which point @c libcurl delivers the same data again.
+ *
+ * This class is thread-safe.
+ */
+class LibcurlContentFetchEngine {
+public:
+    /**
+     * The function called on the network thread when a transfer completes.  The transfer has already been removed from
+     * the engine, so the function may add it again.
+     *
+     * @param result The result of the transfer.  @c CURLE_FAILED_INIT means the engine itself failed.
+     */
+    using CompletionCallback = std::function<void(CURLcode result)>;
+
+    /**
+     * Create a @c LibcurlContentFetchEngine and start its network thread.
+     *
+     * @return The new engine, or @c nullptr if the operation fails.
+     */
+    static std::shared_ptr<LibcurlContentFetchEngine> create();
+
+    /**
+     * Destructor.  Stops the network thread.  Any remaining transfers are removed without calling their callbacks.
+     */
+    ~LibcurlContentFetchEngine();
+
+    /**
+     * Start a transfer.  If the transfer cannot be started, @c onCompleted is called with @c CURLE_FAILED_INIT.
+     *
+     * @param handle The @c libcurl easy handle of the transfer, which must stay valid until the transfer completes or
+     * is removed with @c removeTransfer().
+     * @param onCompleted The function to call when the transfer completes.
+     */
+    void addTransfer(CURL* handle, CompletionCallback onCompleted);
+
+    /**
+     * Stop a transfer.  When called off the network thread, this blocks until the engine no longer uses @c handle, so
+     * that it is safe to destroy the handle, and everything its callbacks use, afterwards.  The completion callback of
+     * the transfer will not be called after this returns.
+     *
+     * @param handle The @c libcurl easy handle of the transfer.
+     */
+    void removeTransfer(CURL* handle);
+
+    /**
+     * Mark a transfer as paused, so that it will be resumed by @c resumeTransfer().  Must be called on the network
+     * thread, from a callback of the transfer which returns @c CURL_WRITEFUNC_PAUSE.
+     *
+     * @param handle The @c libcurl easy handle of the transfer.
+     * @param resumeTime When to resume the transfer if @c resumeTransfer() has not been called by then, so that the
+     * callback can check for a timeout.
+     */
+    void onTransferPaused(
+        CURL* handle,
+        std::chrono::steady_clock::time_point resumeTime = std::chrono::steady_clock::time_point::max());
+
+    /**
+     * Resume a transfer paused with @c onTransferPaused(), because it may be able to make progress.  Does nothing if
+     * the transfer is not paused.  May be called on any thread, including from callbacks of other objects which hold
+     * locks, since it only queues a command for the network thread.
+     *
+     * @param handle The @c libcurl easy handle of the transfer.
+     */
+    void resumeTransfer(CURL* handle);
+
+private:
+    /// A request to change a transfer, made by another thread.
+    struct Command {
+        /// The kinds of commands.
+        enum class Type {
+            /// Start the transfer.
+            ADD,
+            /// Stop the transfer.
+            REMOVE,
+            /// Resume the transfer if it is paused.
+            RESUME
+        };
+
+        /// The kind of command.
+        Type type;
+
+        /// The easy handle of the transfer.
+        CURL* handle;
+
+        /// The function to call when the transfer completes, for @c ADD commands.
+        CompletionCallback onCompleted;
+    };
+
+    /// The state of a transfer which is running on the engine.
+    struct Transfer {
+        /// The function to call when the transfer completes.
+        CompletionCallback onCompleted;
+
+        /// Whether the transfer is paused.
+        bool isPaused;
+
+        /// When to resume the transfer if it is still paused.
+        std::chrono::steady_clock::time_point resumeTime;
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param multiHandle The multi handle to run the transfers on.
+     * @param shareHandle The share handle the transfers use for their DNS and TLS session caches, or @c nullptr.
+     */
+    LibcurlContentFetchEngine(
+        std::unique_ptr<CurlMultiHandleWrapper> multiHandle,
+        std::shared_ptr<CurlShareHandleWrapper> shareHandle);
+
+    /**
+     * Queue a command for the network thread, and wake it.  Must be called with @c m_mutex held.
+     *
+     * @param command The command.
+     * @return The number of the command.
+     */
+    uint64_t queueCommandLocked(Command command);
+
+    /// The main loop of the network thread.
+    void networkLoop();
+
+    /**
+     * Apply commands from other threads.  Only called on the network thread.
+     *
+     * @param commands The commands, in the order they were made.
+     */
+    void applyCommands(const std::vector<Command>& commands);
+
+    /**
+     * Start a transfer on the multi handle.  Only called on the network thread.
+     *
+     * @param handle The easy handle of the transfer.
+     * @param onCompleted The function to call when the transfer completes.
+     */
+    void startTransfer(CURL* handle, CompletionCallback onCompleted);
+
+    /**
+     * Remove a transfer from the multi handle.  Only called on the network thread.
+     *
+     * @param handle The easy handle of the transfer.
+     * @return The completion callback of the transfer, or @c nullptr if it was not running.
+     */
+    CompletionCallback stopTransfer(CURL* handle);
+
+    /**
+     * Call the completion callbacks of all transfers which have completed.  Only called on the network thread.
+     */
+    void completeTransfers();
+
+    /**
+     * Fail all running transfers, after an error of the multi handle.  Only called on the network thread.
+     */
+    void failAllTransfers();
+
+    /**
+     * Resume a paused transfer.  Only called on the network thread.
+     *
+     * @param handle The easy handle of the transfer.
+     */
+    void continueTransfer(CURL* handle);
+
+    /**
+     * Resume the paused transfers whose resume time has passed.  Only called on the network thread.
+     */
+    void resumeDueTransfers();
+
+    /**
+     * Wait for network activity, a command, or the resume time of a paused transfer.  Only called on the network
+     * thread.
+     *
+     * @return Whether the wait succeeded.
+     */
+    bool waitForActivity();
+
+    /// Wake the network thread if it is waiting for network activity.
+    void wakeNetworkThread();
+
+    /// The multi handle the transfers run on.  Only used on the network thread after construction.
+    std::unique_ptr<CurlMultiHandleWrapper> m_multiHandle;
+
+    /// The share handle the transfers use for their DNS and TLS session caches, or @c nullptr if they do not share them.
+    std::shared_ptr<CurlShareHandleWrapper> m_shareHandle;
+
+    /// The running transfers.  Only used on the network thread.
+    std::unordered_map<CURL*, Transfer> m_transfers;
+
+    /// The earliest resume time of the paused transfers.  Only used on the network thread.
+    std::chrono::steady_clock::time_point m_nextResumeTime;
+
+    /// Serializes access to the members below.
+    std::mutex m_mutex;
+
+    /// Notified when there are commands to apply, or the engine is shutting down.
+    std::condition_variable m_wakeTrigger;
+
+    /// Notified when commands have been applied.
+    std::condition_variable m_commandsAppliedTrigger;
+
+    /// The commands not yet applied by the network thread.
+    std::vector<Command> m_commands;
+
+    /// The number of commands made so far.
+    uint64_t m_commandCount;
+
+    /// The number of commands applied so far.
+    uint64_t m_appliedCommandCount;
+
+    /// Whether the engine is shutting down.
+    bool m_isShutdown;
+
+    /// The network thread.  Declared last so that it starts after everything else is initialized.
+    std::thread m_networkThread;
+};
+
+}  // namespace libcurlUtils
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LIBCURLUTILS_LIBCURLCONTENTFETCHENGINE_H_
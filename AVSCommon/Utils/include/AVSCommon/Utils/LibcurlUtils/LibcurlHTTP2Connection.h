@@ -24,6 +24,7 @@
 
 #include "AVSCommon/Utils/HTTP2/HTTP2ConnectionInterface.h"
 #include "CurlMultiHandleWrapper.h"
+#include "CurlShareHandleWrapper.h"
 #include "LibcurlSetCurlOptionsCallbackInterface.h"
 
 namespace alexaClientSDK {
@@ -40,10 +41,13 @@ public:
      *
      * @param setCurlOptionsCallback The optional @c LibcurlSetCurlOptionsCallbackInterface to set curl
      * options when a new http2 connection is being created.
+     * @param shareHandle The optional @c CurlShareHandleWrapper whose DNS and TLS session caches the streams of this
+     * connection should use, so that they survive the connection.
      * @return The new @c LibcurlHTTP2Connection or nullptr if the operation fails.
      */
     static std::shared_ptr<LibcurlHTTP2Connection> create(
-        const std::shared_ptr<LibcurlSetCurlOptionsCallbackInterface>& setCurlOptionsCallback = nullptr);
+        const std::shared_ptr<LibcurlSetCurlOptionsCallbackInterface>& setCurlOptionsCallback = nullptr,
+        const std::shared_ptr<CurlShareHandleWrapper>& shareHandle = nullptr);
 
     /**
      * Destructor.
@@ -65,9 +69,11 @@ protected:
      *
      * @param setCurlOptionsCallback The optional @c LibcurlSetCurlOptionsCallbackInterface to set curl
      * options when a new http2 connection is being created.
+     * @param shareHandle The optional @c CurlShareHandleWrapper whose caches the streams of this connection use.
      */
     LibcurlHTTP2Connection(
-        const std::shared_ptr<LibcurlSetCurlOptionsCallbackInterface>& setCurlOptionsCallback = nullptr);
+        const std::shared_ptr<LibcurlSetCurlOptionsCallbackInterface>& setCurlOptionsCallback = nullptr,
+        const std::shared_ptr<CurlShareHandleWrapper>& shareHandle = nullptr);
 
 private:
     /**
@@ -162,9 +168,18 @@ private:
     std::shared_ptr<LibcurlHTTP2Request> dequeueRequest();
 
     /**
-     * Dequeue next request and add it to the multi-handle
+     * Dequeue all queued requests and add them to the multi-handle.
+     *
+     * @return The number of requests added to the multi-handle.
      */
-    void processNextRequest();
+    int processQueuedRequests();
+
+    /**
+     * Wait for activity on the active streams, for a request to be queued, or for the network loop to be stopped.
+     *
+     * @return Whether the operation was successful.
+     */
+    bool waitForActivity();
 
     /**
      * Notify observers that a GOAWAY frame has been received.
@@ -177,6 +192,13 @@ private:
     /// Represents a CURL multi handle.  Intended to only be accessed by the network loop thread.
     std::unique_ptr<avsCommon::utils::libcurlUtils::CurlMultiHandleWrapper> m_multi;
 
+    /// Wakes the network loop while it waits for activity on @c m_multi.  Defined in the implementation file.
+    class NetworkLoopWaker;
+
+    /// The @c NetworkLoopWaker of this connection.  Shared with the requests of this connection, so that cancelling
+    /// a request wakes the network loop even if the request outlives the connection.
+    std::shared_ptr<NetworkLoopWaker> m_waker;
+
     /// Serializes concurrent access to the m_requestQueue and m_isStopping members.
     std::mutex m_mutex;
 
@@ -202,6 +224,9 @@ private:
 
     /// The @c LibcurlSetCurlOptionsCallbackInterface used for this connection.
     std::shared_ptr<LibcurlSetCurlOptionsCallbackInterface> m_setCurlOptionsCallback;
+
+    /// The optional @c CurlShareHandleWrapper whose DNS and TLS session caches the streams of this connection use.
+    std::shared_ptr<CurlShareHandleWrapper> m_shareHandle;
 };
 
 }  // namespace libcurlUtils
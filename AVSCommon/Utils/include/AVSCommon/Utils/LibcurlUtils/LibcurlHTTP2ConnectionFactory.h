@@ -18,6 +18,7 @@
 
 #include <AVSCommon/Utils/HTTP2/HTTP2ConnectionFactoryInterface.h>
 
+#include "CurlShareHandleWrapper.h"
 #include "LibcurlSetCurlOptionsCallbackFactoryInterface.h"
 
 namespace alexaClientSDK {
@@ -28,6 +29,12 @@ namespace libcurlUtils {
 /**
  * A class that produces @c LibcurlHTTP2Connection instances.
  */
+/**
+ * Creates @c LibcurlHTTP2Connection instances.
+ *
+ * The connections created by a factory share a DNS cache and a TLS session cache, so reconnecting to the same host
+ * skips the DNS lookup and resumes the TLS session of the previous connection instead of doing a full handshake.
+ */
 class LibcurlHTTP2ConnectionFactory : public avsCommon::utils::http2::HTTP2ConnectionFactoryInterface {
 public:
     /**
@@ -59,6 +66,9 @@ private:
     /// The optional @c LibcurlSetCurlOptionsCallbackFactoryInterface to set curl options when creating a new http2
     /// connection.
     std::shared_ptr<LibcurlSetCurlOptionsCallbackFactoryInterface> m_setCurlOptionsCallbackFactory;
+
+    /// The DNS and TLS session caches shared by the connections created by this factory.  May be @c nullptr.
+    std::shared_ptr<CurlShareHandleWrapper> m_shareHandle;
 };
 
 }  // namespace libcurlUtils
@@ -18,6 +18,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <functional>
 #include <memory>
 
 #include <AVSCommon/Utils/HTTP2/HTTP2RequestConfig.h>
@@ -46,12 +47,34 @@ public:
         const std::shared_ptr<LibcurlSetCurlOptionsCallbackInterface>& setCurlOptionsCallback,
         std::string id = "");
 
+    /**
+     * Destructor.
+     */
+    ~LibcurlHTTP2Request() override;
+
     /// @name HTTP2RequestInterface methods.
     /// @{
     bool cancel() override;
     std::string getId() const override;
     /// @}
 
+    /**
+     * Set a function to call when this request is cancelled, so that its connection can remove it promptly.  Must be
+     * called before the request is shared with other threads.
+     *
+     * @param onCancelled The function to call when this request is cancelled.
+     */
+    void setOnCancelled(std::function<void()> onCancelled);
+
+    /**
+     * Set a function for the source of this request to call when it has more data to send after pausing, so that its
+     * connection can resume the request promptly.  Must be called before the request is shared with other threads.
+     *
+     * @param onDataAvailable The function to call when the source has more data to send.
+     * @return Whether the source of this request calls @c onDataAvailable.
+     */
+    bool setOnDataAvailable(std::function<void()> onDataAvailable);
+
     /**
      * Gets the CURL easy handle associated with this stream
      *
@@ -104,6 +127,14 @@ public:
      */
     bool isPaused() const;
 
+    /**
+     * Return whether this stream is paused only because its source has no data to send, and the source will call the
+     * function set with @c setOnDataAvailable() when it has.  Such a stream need not be polled to be resumed.
+     *
+     * @return whether this stream is paused until its source has more data to send.
+     */
+    bool isPausedUntilDataAvailable() const;
+
     /**
      * Return whether this request has been cancelled.
      *
@@ -187,9 +218,18 @@ private:
     /// Whether this stream has any paused transfers.
     bool m_isPaused;
 
+    /// Whether this stream has a paused transfer which must be polled to be resumed.
+    bool m_isPausedUntilPolled;
+
+    /// Whether @c m_source calls the function set with @c setOnDataAvailable().
+    bool m_sourceNotifiesDataAvailable;
+
     /// Whether this request has been cancelled.
     std::atomic_bool m_isCancelled;
 
+    /// The function to call when this request is cancelled.  May be empty.
+    std::function<void()> m_onCancelled;
+
     /// Connect timeout.
     std::chrono::milliseconds m_connectTimeout;
 };
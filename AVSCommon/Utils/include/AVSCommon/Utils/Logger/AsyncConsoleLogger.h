@@ -0,0 +1,254 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_ASYNCCONSOLELOGGER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_ASYNCCONSOLELOGGER_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+#include "AVSCommon/Utils/Logger/Logger.h"
+#include "AVSCommon/Utils/Logger/LogStringFormatter.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/// Default number of entries the @c AsyncConsoleLogger ring can hold.
+static const size_t DEFAULT_ASYNC_LOGGER_ENTRIES = 1024;
+
+/// Default maximum size in bytes of the text of a single @c AsyncConsoleLogger entry, including the null terminator.
+static const size_t DEFAULT_ASYNC_LOGGER_MAX_ENTRY_SIZE = 512;
+
+/// Default maximum time an entry waits in the @c AsyncConsoleLogger ring before it is written.
+static const std::chrono::milliseconds DEFAULT_ASYNC_LOGGER_FLUSH_INTERVAL{50};
+
+/**
+ * A @c Logger which does not write to its output stream on the logging thread.
+ *
+ * @c emit() copies the entry into a preallocated, fixed-size ring and returns.  Producers claim slots with a
+ * compare-and-swap, so any number of threads can log concurrently without taking a lock, and no memory is allocated.
+ * A background thread formats the entries with @c LogStringFormatter and writes them to the output stream in batches,
+ * waking when the ring is half full or after a flush interval, whichever comes first.
+ *
+ * Entries whose values were captured in a @c LogRecord are copied into the ring as they are, and their text is
+ * rendered on the background thread too.
+ *
+ * When the ring is full, new entries are dropped rather than blocking the caller.  Dropped entries are counted, and
+ * the count is reported in the output.  Entries longer than the maximum entry size are truncated.
+ *
+ * @c ConsoleLogger uses an @c AsyncConsoleLogger when the @c consoleLogger configuration node enables it:
+ *
+ * @code{.json}
+ *     "consoleLogger": {
+ *         "logLevel": "DEBUG9",
+ *         "asynchronous": true,
+ *         "asyncBufferEntries": 1024,
+ *         "asyncMaxEntrySize": 512
+ *     }
+ * @endcode
+ */
+class AsyncConsoleLogger : public Logger {
+public:
+    /**
+     * Constructor.
+     *
+     * @param level The lowest severity level of logs to be emitted by this Logger.
+     * @param stream The stream to write formatted entries to.  Must outlive this logger.
+     * @param streamMutex The mutex to hold while writing to @c stream, or @c nullptr to use a private mutex.
+     * @param numEntries The number of entries the ring can hold.  Rounded up to a power of two.
+     * @param maxEntrySize The maximum size in bytes of the text of one entry, including the null terminator.
+     * @param flushInterval The maximum time an entry waits in the ring before it is written.
+     */
+    AsyncConsoleLogger(
+        Level level,
+        std::ostream& stream,
+        std::shared_ptr<std::mutex> streamMutex = nullptr,
+        size_t numEntries = DEFAULT_ASYNC_LOGGER_ENTRIES,
+        size_t maxEntrySize = DEFAULT_ASYNC_LOGGER_MAX_ENTRY_SIZE,
+        std::chrono::milliseconds flushInterval = DEFAULT_ASYNC_LOGGER_FLUSH_INTERVAL);
+
+    /**
+     * Destructor.  Writes any queued entries, then stops the background thread.
+     */
+    ~AsyncConsoleLogger() override;
+
+    void emit(Level level, std::chrono::system_clock::time_point time, const char* threadMoniker, const char* text)
+        override;
+
+    void emitRecord(
+        Level level,
+        std::chrono::system_clock::time_point time,
+        const char* threadMoniker,
+        const LogRecord& record) override;
+
+    /**
+     * Blocks until every entry emitted before this call has been written to the output stream.
+     */
+    void flush();
+
+    /**
+     * Obtain the number of entries dropped because the ring was full.
+     *
+     * @return The number of dropped entries.
+     */
+    uint64_t getDroppedCount() const;
+
+    /**
+     * Obtain the number of entries the ring can hold.
+     *
+     * @return The number of entries the ring can hold.
+     */
+    size_t getCapacity() const;
+
+private:
+    /// The maximum number of bytes of a thread moniker kept with an entry, including the null terminator.
+    static const size_t MAX_MONIKER_SIZE = 16;
+
+    /// A slot in the ring.
+    struct Slot {
+        /**
+         * The sequence number of the slot.  A slot at position @c p is free for a producer when the sequence is @c p,
+         * and ready for the consumer when the sequence is @c p+1.
+         */
+        std::atomic<size_t> sequence;
+
+        /// The severity level of the entry.
+        Level level;
+
+        /// The time of the entry.
+        std::chrono::system_clock::time_point time;
+
+        /// The moniker of the thread which emitted the entry.
+        char threadMoniker[MAX_MONIKER_SIZE];
+
+        /// Whether the text was truncated to fit.
+        bool truncated;
+
+        /// Whether the text area of the slot holds a @c LogRecord rather than text.
+        bool isRecord;
+    };
+
+    /**
+     * Claims a slot in the ring for a producer, and fills in everything but the text.
+     *
+     * @param level The severity level of the entry.
+     * @param time The time of the entry.
+     * @param threadMoniker The moniker of the thread which emitted the entry.
+     * @param[out] position The position of the claimed slot.
+     * @return The claimed slot, or @c nullptr if the ring is full and the entry was dropped.
+     */
+    Slot* claimSlot(
+        Level level,
+        std::chrono::system_clock::time_point time,
+        const char* threadMoniker,
+        size_t* position);
+
+    /**
+     * Hands a filled slot to the background thread, waking it if the ring is filling up.
+     *
+     * @param slot The slot.
+     * @param position The position of the slot.
+     */
+    void publishSlot(Slot* slot, size_t position);
+
+    /// The main loop of the background thread.
+    void runConsumer();
+
+    /**
+     * Formats and writes all entries which are ready, in a single batch.
+     *
+     * @return The number of entries written.
+     */
+    size_t writeBatch();
+
+    /**
+     * Checks whether the entry at @c m_consumePosition is ready to be written.  Only called by the background thread.
+     *
+     * @return Whether an entry is ready.
+     */
+    bool hasReadyEntry() const;
+
+    /// The stream to write to.
+    std::ostream& m_stream;
+
+    /// The mutex to hold while writing to @c m_stream.
+    std::shared_ptr<std::mutex> m_streamMutex;
+
+    /// The number of slots, a power of two.
+    const size_t m_capacity;
+
+    /// The maximum size of the text of an entry, including the null terminator.
+    const size_t m_maxEntrySize;
+
+    /// The maximum time an entry waits in the ring.
+    const std::chrono::milliseconds m_flushInterval;
+
+    /// The slots in the ring.
+    std::unique_ptr<Slot[]> m_slots;
+
+    /// The text of the entries, @c m_maxEntrySize bytes per slot.
+    std::vector<char> m_text;
+
+    /// The position the next producer will claim.
+    std::atomic<size_t> m_producePosition;
+
+    /// The position of the next entry to be written.  Only modified by the background thread.
+    std::atomic<size_t> m_consumePosition;
+
+    /// The number of dropped entries.
+    std::atomic<uint64_t> m_dropped;
+
+    /// The number of dropped entries already reported in the output.  Only used by the background thread.
+    uint64_t m_droppedReported;
+
+    /// Whether the background thread is sleeping, or about to sleep.
+    std::atomic<bool> m_consumerSleeping;
+
+    /// Whether the logger is shutting down.
+    bool m_stop;
+
+    /// Mutex used to wake the background thread and to wait for flushes.
+    std::mutex m_wakeMutex;
+
+    /// Condition variable the background thread sleeps on.
+    std::condition_variable m_wakeCondition;
+
+    /// Condition variable notified after each batch is written.
+    std::condition_variable m_flushedCondition;
+
+    /// The number of @c flush() calls waiting, which makes the background thread write without delay.
+    size_t m_flushRequests;
+
+    /// Object to format log strings correctly.
+    LogStringFormatter m_logFormatter;
+
+    /// The background thread.  Declared last so that it starts after everything else is initialized.
+    std::thread m_consumerThread;
+};
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_ASYNCCONSOLELOGGER_H_
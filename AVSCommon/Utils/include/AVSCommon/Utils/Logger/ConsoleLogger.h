@@ -16,6 +16,9 @@
 #ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_CONSOLELOGGER_H_
 #define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_CONSOLELOGGER_H_
 
+#include <memory>
+
+#include "AVSCommon/Utils/Logger/AsyncConsoleLogger.h"
 #include "AVSCommon/Utils/Logger/Logger.h"
 #include "AVSCommon/Utils/Logger/LoggerUtils.h"
 #include "AVSCommon/Utils/Logger/LogStringFormatter.h"
@@ -26,7 +29,11 @@ namespace utils {
 namespace logger {
 
 /**
- * A very simple (e.g. not asynchronous) @c Logger that logs to console.
+ * A very simple @c Logger that logs to console.
+ *
+ * By default, entries are written to @c std::cout on the logging thread.  If @c asynchronous is set in the
+ * @c consoleLogger configuration node, entries are instead handed to an @c AsyncConsoleLogger, which writes them from a
+ * background thread.  @c asyncBufferEntries and @c asyncMaxEntrySize configure the size of its ring.
  *
  * Inheriting @c std::ios_base::Init ensures that the standard iostreams objects are properly initialized before @c
  * ConsoleLogger uses them.
@@ -45,6 +52,12 @@ public:
     void emit(Level level, std::chrono::system_clock::time_point time, const char* threadMoniker, const char* text)
         override;
 
+    void emitRecord(
+        Level level,
+        std::chrono::system_clock::time_point time,
+        const char* threadMoniker,
+        const LogRecord& record) override;
+
 private:
     /**
      * Constructor.
@@ -56,6 +69,9 @@ private:
 
     /// Object to format log strings correctly.
     LogStringFormatter m_logFormatter;
+
+    /// The logger entries are handed to when asynchronous logging is configured, else @c nullptr.
+    std::unique_ptr<AsyncConsoleLogger> m_asyncLogger;
 };
 
 /**
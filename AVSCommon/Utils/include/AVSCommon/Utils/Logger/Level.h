@@ -19,6 +19,22 @@
 #include <iostream>
 #include <string>
 
+/*
+ * Values of each @c Level for use in preprocessor conditionals, such as the compile-time minimum level selected with
+ * @c ACSDK_LOG_MIN_LEVEL or @c ACSDK_LOG_MODULE_MIN_LEVEL.  These must match the order of the @c Level enum.
+ */
+#define ACSDK_LOG_LEVEL_DEBUG9 0
+#define ACSDK_LOG_LEVEL_DEBUG8 1
+#define ACSDK_LOG_LEVEL_DEBUG7 2
+#define ACSDK_LOG_LEVEL_DEBUG6 3
+#define ACSDK_LOG_LEVEL_DEBUG5 4
+#define ACSDK_LOG_LEVEL_DEBUG4 5
+#define ACSDK_LOG_LEVEL_DEBUG3 6
+#define ACSDK_LOG_LEVEL_DEBUG2 7
+#define ACSDK_LOG_LEVEL_DEBUG1 8
+#define ACSDK_LOG_LEVEL_DEBUG0 9
+#define ACSDK_LOG_LEVEL_INFO 10
+
 namespace alexaClientSDK {
 namespace avsCommon {
 namespace utils {
@@ -77,6 +93,12 @@ enum class Level {
     UNKNOWN
 };
 
+static_assert(
+    static_cast<int>(Level::DEBUG9) == ACSDK_LOG_LEVEL_DEBUG9 &&
+        static_cast<int>(Level::DEBUG0) == ACSDK_LOG_LEVEL_DEBUG0 &&
+        static_cast<int>(Level::INFO) == ACSDK_LOG_LEVEL_INFO,
+    "ACSDK_LOG_LEVEL_* values do not match the Level enum");
+
 /**
  * Get the name of a Level value.
  * @param level The Level to get the name of.
@@ -20,15 +20,24 @@
 #include <functional>
 #include <sstream>
 #include <string>
+#include <type_traits>
 
 #include "AVSCommon/Utils/Logger/LogEntryStream.h"
+#include "AVSCommon/Utils/Logger/LogRecord.h"
 
 namespace alexaClientSDK {
 namespace avsCommon {
 namespace utils {
 namespace logger {
 
-/// LogEntry is used to compile the log entry text to log via Logger.
+/**
+ * LogEntry is used to compile the log entry text to log via Logger.
+ *
+ * Formatting is deferred where possible.  Strings, numbers and pointers passed to @c d() are only captured in a
+ * fixed-size @c LogRecord, and the text is rendered the first time it is needed, typically when a sink consumes the
+ * entry.  A value of any other type, or a value which does not fit in the record, renders the entry at that point,
+ * and the rest of the entry is built as text.  The rendered text is the same either way.
+ */
 class LogEntry {
 public:
     /**
@@ -47,6 +56,19 @@ public:
      */
     LogEntry(const std::string& source, const std::string& event);
 
+    /**
+     * Constructor.  Creates an entry from values captured earlier, to render its text.
+     *
+     * @param record The captured values of the entry.
+     */
+    explicit LogEntry(const LogRecord& record);
+
+    /// Destructor.
+    ~LogEntry();
+
+    LogEntry(const LogEntry&) = delete;
+    LogEntry& operator=(const LogEntry&) = delete;
+
     /**
      * Add a @c key, @c value pair to the metadata of this log entry.
      *
@@ -163,7 +185,92 @@ public:
      */
     const char* c_str() const;
 
+    /**
+     * Get the captured values of this LogEntry, if its text has not been rendered yet.
+     *
+     * @return The captured values, or @c nullptr if the text of this LogEntry has already been rendered.  The returned
+     * record is only valid for the lifetime of this LogEntry, and only as long as no further modifications are made
+     * to it.
+     */
+    const LogRecord* getRecord() const;
+
 private:
+    /// How a value passed to @c d() is captured in @c m_record.
+    enum class CaptureAs { TEXT, SIGNED, UNSIGNED, FLOATING, POINTER };
+
+    /// Whether @c Type is a character type, which @c std::ostream prints as a character rather than a number.
+    template <typename Type>
+    struct IsCharacter
+            : std::integral_constant<
+                  bool,
+                  std::is_same<typename std::remove_cv<Type>::type, char>::value ||
+                      std::is_same<typename std::remove_cv<Type>::type, signed char>::value ||
+                      std::is_same<typename std::remove_cv<Type>::type, unsigned char>::value ||
+                      std::is_same<typename std::remove_cv<Type>::type, wchar_t>::value ||
+                      std::is_same<typename std::remove_cv<Type>::type, char16_t>::value ||
+                      std::is_same<typename std::remove_cv<Type>::type, char32_t>::value> {};
+
+    /// Whether @c Type is a pointer which @c std::ostream prints as an address.
+    template <typename Type, typename Pointee = typename std::remove_pointer<Type>::type>
+    struct IsAddress
+            : std::integral_constant<
+                  bool,
+                  std::is_pointer<Type>::value && (std::is_object<Pointee>::value || std::is_void<Pointee>::value) &&
+                      !std::is_volatile<Pointee>::value && !IsCharacter<Pointee>::value> {};
+
+    /// Selects how a value of type @c ValueType is captured.
+    template <typename ValueType>
+    struct CaptureFor
+            : std::integral_constant<
+                  CaptureAs,
+                  IsCharacter<ValueType>::value
+                      ? CaptureAs::TEXT
+                      : std::is_integral<ValueType>::value
+                            ? (std::is_signed<ValueType>::value ? CaptureAs::SIGNED : CaptureAs::UNSIGNED)
+                            : (std::is_same<ValueType, float>::value || std::is_same<ValueType, double>::value)
+                                  ? CaptureAs::FLOATING
+                                  : IsAddress<ValueType>::value ? CaptureAs::POINTER : CaptureAs::TEXT> {};
+
+    /**
+     * Capture a value in @c m_record.
+     *
+     * @param key The key identifying the value.
+     * @param value The value to capture.
+     * @return Whether the value was captured.  If not, the caller must format it as text.
+     */
+    template <typename ValueType>
+    bool capture(const char* key, const ValueType& value, std::integral_constant<CaptureAs, CaptureAs::TEXT>);
+
+    /// @copydoc capture()
+    template <typename ValueType>
+    bool capture(const char* key, const ValueType& value, std::integral_constant<CaptureAs, CaptureAs::SIGNED>);
+
+    /// @copydoc capture()
+    template <typename ValueType>
+    bool capture(const char* key, const ValueType& value, std::integral_constant<CaptureAs, CaptureAs::UNSIGNED>);
+
+    /// @copydoc capture()
+    template <typename ValueType>
+    bool capture(const char* key, const ValueType& value, std::integral_constant<CaptureAs, CaptureAs::FLOATING>);
+
+    /// @copydoc capture()
+    template <typename ValueType>
+    bool capture(const char* key, const ValueType& value, std::integral_constant<CaptureAs, CaptureAs::POINTER>);
+
+    /**
+     * Get the stream holding the text of this LogEntry, first rendering any values captured in @c m_record.
+     *
+     * @return The stream holding the text of this LogEntry.
+     */
+    LogEntryStream& stream() const;
+
+    /**
+     * Render the values captured in @c m_record.
+     *
+     * @param out The stream to render the values to.
+     */
+    void renderRecord(LogEntryStream& out) const;
+
     /// Add the appropriate prefix for a key,value pair that is about to be appended to the text of this LogEntry.
     void prefixKeyValuePair();
 
@@ -182,18 +289,32 @@ private:
      *     <key>=<value>[,<key>=<value>]:[<message>]
      * ...so we need to reserve ',', '=' and ':'.  We escape those vales with '\' so we escape '\' as well.
      *
+     * @param out The stream to append to.
      * @param in The string to escape and append.
      */
-    void appendEscapedString(const char* in);
+    static void appendEscapedString(std::ostream& out, const char* in);
 
     /// Character used to separate @c key from @c value text in metadata.
     static const char KEY_VALUE_SEPARATOR = '=';
 
-    /// Flag indicating (if true) that some metadata has already been appended to this LogEntry.
-    bool m_hasMetadata;
+    /// Values captured for deferred formatting.  Only used while @c m_deferred is true.
+    LogRecord m_record;
 
-    /// A stream with which to accumulate the text for this LogEntry.
-    LogEntryStream m_stream;
+    /*
+     * The members below are mutable so that c_str() can render the captured values.
+     */
+
+    /// Flag indicating (if true) that some metadata has already been appended to the text of this LogEntry.
+    mutable bool m_hasMetadata;
+
+    /// Flag indicating (if true) that the values of this LogEntry are held in @c m_record, not rendered yet.
+    mutable bool m_deferred;
+
+    /// Flag indicating (if true) that the stream in @c m_streamStorage has been constructed.
+    mutable bool m_hasStream;
+
+    /// Storage for the stream with which to accumulate the text of this LogEntry, constructed when first needed.
+    mutable typename std::aligned_storage<sizeof(LogEntryStream), alignof(LogEntryStream)>::type m_streamStorage;
 };
 
 template <typename ValueType>
@@ -203,11 +324,51 @@ inline LogEntry& LogEntry::d(const std::string& key, const ValueType& value) {
 
 template <typename ValueType>
 LogEntry& LogEntry::d(const char* key, const ValueType& value) {
+    if (m_deferred && key && capture(key, value, CaptureFor<ValueType>())) {
+        return *this;
+    }
     prefixKeyValuePair();
-    m_stream << key << KEY_VALUE_SEPARATOR << value;
+    stream() << key << KEY_VALUE_SEPARATOR << value;
     return *this;
 }
 
+template <typename ValueType>
+bool LogEntry::capture(const char*, const ValueType&, std::integral_constant<CaptureAs, CaptureAs::TEXT>) {
+    return false;
+}
+
+template <typename ValueType>
+bool LogEntry::capture(
+    const char* key,
+    const ValueType& value,
+    std::integral_constant<CaptureAs, CaptureAs::SIGNED>) {
+    return m_record.addSigned(key, static_cast<long long>(value));
+}
+
+template <typename ValueType>
+bool LogEntry::capture(
+    const char* key,
+    const ValueType& value,
+    std::integral_constant<CaptureAs, CaptureAs::UNSIGNED>) {
+    return m_record.addUnsigned(key, static_cast<unsigned long long>(value));
+}
+
+template <typename ValueType>
+bool LogEntry::capture(
+    const char* key,
+    const ValueType& value,
+    std::integral_constant<CaptureAs, CaptureAs::FLOATING>) {
+    return m_record.addFloating(key, static_cast<double>(value));
+}
+
+template <typename ValueType>
+bool LogEntry::capture(
+    const char* key,
+    const ValueType& value,
+    std::integral_constant<CaptureAs, CaptureAs::POINTER>) {
+    return m_record.addPointer(key, static_cast<const void*>(value));
+}
+
 template <typename PtrType>
 LogEntry& LogEntry::p(const char* key, const std::shared_ptr<PtrType>& ptr) {
     return d(key, ptr.get());
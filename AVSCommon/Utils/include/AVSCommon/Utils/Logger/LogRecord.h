@@ -0,0 +1,225 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_LOGRECORD_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_LOGRECORD_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/**
+ * A fixed-size record of the values passed to a @c LogEntry, captured so that the text of the entry can be rendered
+ * later, when (and where) a sink consumes it.
+ *
+ * Strings, including the source, event and keys, are copied into a small embedded buffer, and numbers and pointers are
+ * stored by value, so a @c LogRecord does not allocate and can be copied with @c memcpy.  The add methods return
+ * @c false when the record is full, in which case the caller should render the entry immediately instead.
+ */
+class LogRecord {
+public:
+    /// The maximum number of fields (key/value pairs and messages) in a record.
+    static constexpr size_t MAX_FIELDS = 8;
+
+    /// The size of the buffer holding the strings of a record, including their null terminators.
+    static constexpr size_t TEXT_SIZE = 240;
+
+    /// The types of field in a record.
+    enum class FieldType : uint8_t {
+        /// A key with a string value.
+        STRING,
+        /// A key with a signed integer value.
+        SIGNED,
+        /// A key with an unsigned integer value.
+        UNSIGNED,
+        /// A key with a floating point value.
+        FLOATING,
+        /// A key with a pointer value.
+        POINTER,
+        /// A free-form message, with no key.
+        MESSAGE
+    };
+
+    /// A field of a record.
+    struct Field {
+        /// The type of the field.
+        FieldType type;
+
+        /// The offset of the key in the text buffer.  Unused for @c MESSAGE fields.
+        uint16_t key;
+
+        /// The value of the field.
+        union {
+            /// The offset of the value in the text buffer, for @c STRING and @c MESSAGE fields.
+            uint16_t text;
+            /// The value of a @c SIGNED field.
+            long long signedValue;
+            /// The value of an @c UNSIGNED field.
+            unsigned long long unsignedValue;
+            /// The value of a @c FLOATING field.
+            double floatingValue;
+            /// The value of a @c POINTER field.
+            const void* pointerValue;
+        };
+    };
+
+    /// Constructs an empty record.
+    LogRecord();
+
+    /**
+     * Sets the source and event of the record, and removes any fields.
+     *
+     * @param source The name of the source of the entry.
+     * @param event The name of the event the entry describes.  May be @c nullptr.
+     * @return Whether the source and event fit in the record.
+     */
+    bool reset(const std::string& source, const char* event);
+
+    /**
+     * Adds a key with a string value.
+     *
+     * @param key The key.  Must not be @c nullptr.
+     * @param value The value.  @c nullptr is rendered as an empty value.
+     * @return Whether the field fit in the record.
+     */
+    bool addString(const char* key, const char* value);
+
+    /**
+     * Adds a key with a signed integer value.
+     *
+     * @param key The key.  Must not be @c nullptr.
+     * @param value The value.
+     * @return Whether the field fit in the record.
+     */
+    bool addSigned(const char* key, long long value);
+
+    /**
+     * Adds a key with an unsigned integer value.
+     *
+     * @param key The key.  Must not be @c nullptr.
+     * @param value The value.
+     * @return Whether the field fit in the record.
+     */
+    bool addUnsigned(const char* key, unsigned long long value);
+
+    /**
+     * Adds a key with a floating point value.
+     *
+     * @param key The key.  Must not be @c nullptr.
+     * @param value The value.
+     * @return Whether the field fit in the record.
+     */
+    bool addFloating(const char* key, double value);
+
+    /**
+     * Adds a key with a pointer value.
+     *
+     * @param key The key.  Must not be @c nullptr.
+     * @param value The value.
+     * @return Whether the field fit in the record.
+     */
+    bool addPointer(const char* key, const void* value);
+
+    /**
+     * Adds a free-form message.
+     *
+     * @param message The message.  @c nullptr is rendered as an empty message.
+     * @return Whether the message fit in the record.
+     */
+    bool addMessage(const char* message);
+
+    /**
+     * Obtain the source of the entry.
+     *
+     * @return The source of the entry.
+     */
+    const char* getSource() const;
+
+    /**
+     * Obtain the event of the entry.
+     *
+     * @return The event of the entry.
+     */
+    const char* getEvent() const;
+
+    /**
+     * Obtain the number of fields in the record.
+     *
+     * @return The number of fields.
+     */
+    size_t getNumFields() const;
+
+    /**
+     * Obtain a field of the record.
+     *
+     * @param index The index of the field, less than @c getNumFields().
+     * @return The field.
+     */
+    const Field& getField(size_t index) const;
+
+    /**
+     * Obtain a string stored in the record.
+     *
+     * @param offset The offset of the string, from the @c key or @c text of a @c Field.
+     * @return The string.
+     */
+    const char* getText(uint16_t offset) const;
+
+private:
+    /**
+     * Copies a string into the text buffer.
+     *
+     * @param in The string to copy.  @c nullptr is stored as an empty string.
+     * @param[out] offset The offset of the copy in the text buffer.
+     * @return Whether the string fit.
+     */
+    bool storeText(const char* in, uint16_t* offset);
+
+    /**
+     * Adds a field with a key, and no value set.
+     *
+     * @param type The type of the field.
+     * @param key The key of the field.
+     * @return The new field, or @c nullptr if it did not fit.
+     */
+    Field* addField(FieldType type, const char* key);
+
+    /// The number of fields in @c m_fields.
+    uint16_t m_numFields;
+
+    /// The number of bytes used in @c m_text.
+    uint16_t m_textSize;
+
+    /// The offset of the event in @c m_text.  The source is always at offset 0.
+    uint16_t m_event;
+
+    /// The fields of the record.
+    Field m_fields[MAX_FIELDS];
+
+    /// The strings of the record, each followed by a null terminator.
+    char m_text[TEXT_SIZE];
+};
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_LOGGER_LOGRECORD_H_
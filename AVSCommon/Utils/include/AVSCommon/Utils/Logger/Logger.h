@@ -114,6 +114,12 @@ namespace logger {
  * @c INFO and above are in included in non @c DEBUG builds.  These macros also perform an in-line @c logLevel
  * check before evaluating the @c LX() expression.  That allows much of the CPU overhead of compiled-in log
  * lines to be selectively bypassed at run-time if the @c Logger's log level is set to not emit them.
+ * Debug logs on hot paths can also be compiled out below a chosen level, for the whole build with the
+ * @c ACSDK_LOG_MIN_LEVEL CMake option, or for a single module with @c acsdk_log_min_level(<target> <LEVEL>).
+ *
+ * When every value passed to @c LogEntry::d() is a string, number or pointer, the @c LogEntry only captures the
+ * values in a fixed-size @c LogRecord, and the text is rendered when a sink consumes it.  Sinks which override
+ * @c emitRecord() (such as the asynchronous console logger) can render it on another thread.
  *
  * Logging may also be configured on a per-module basis.  Modules are defined by defining
  * @c ACSDK_LOG_MODULE to a common name for all source files in a module.  This name specifies the name
@@ -211,6 +217,23 @@ public:
         const char* threadMoniker,
         const char* text);
 
+    /**
+     * Emit a log entry whose values were captured in a @c LogRecord and have not been rendered yet.  The default
+     * implementation renders the text and calls @c emit().  Sinks can override this to defer rendering further,
+     * for example to a background thread.
+     * NOTE: This method must be thread-safe.
+     *
+     * @param level The severity Level of this log line.
+     * @param time The time that the event to log occurred.
+     * @param threadMoniker Moniker of the thread that generated the event.
+     * @param record The captured values of the entry to log.  Only valid for the duration of this call.
+     */
+    virtual void emitRecord(
+        Level level,
+        std::chrono::system_clock::time_point time,
+        const char* threadMoniker,
+        const LogRecord& record);
+
     /**
      * Add an observer to this object.
      *
@@ -373,8 +396,28 @@ inline std::shared_ptr<Logger> ACSDK_GET_LOGGER_FUNCTION() {
     } while (false)
 #endif
 
-#ifdef ACSDK_DEBUG_LOG_ENABLED
+/*
+ * Select the lowest severity level compiled in to this translation unit.  @c ACSDK_<LEVEL> debug log lines below it
+ * expand to nothing, so neither the @c LogEntry nor the run-time level check is generated for them.  The level is
+ * given as one of the @c ACSDK_LOG_LEVEL_<LEVEL> values from Level.h, from @c ACSDK_LOG_LEVEL_DEBUG9 (the default,
+ * everything compiled in) up to @c ACSDK_LOG_LEVEL_INFO (all debug logs compiled out).
+ *
+ * @c ACSDK_LOG_MODULE_MIN_LEVEL is typically set for a single module with the @c acsdk_log_min_level() CMake function,
+ * and takes precedence over @c ACSDK_LOG_MIN_LEVEL, which applies to the whole build.
+ */
+#if defined(ACSDK_LOG_MODULE_MIN_LEVEL)
+#define ACSDK_LOG_COMPILED_MIN_LEVEL ACSDK_LOG_MODULE_MIN_LEVEL
+#elif defined(ACSDK_LOG_MIN_LEVEL)
+#define ACSDK_LOG_COMPILED_MIN_LEVEL ACSDK_LOG_MIN_LEVEL
+#else
+#define ACSDK_LOG_COMPILED_MIN_LEVEL ACSDK_LOG_LEVEL_DEBUG9
+#endif
+
+#if ACSDK_LOG_COMPILED_MIN_LEVEL < ACSDK_LOG_LEVEL_DEBUG9 || ACSDK_LOG_COMPILED_MIN_LEVEL > ACSDK_LOG_LEVEL_INFO
+#error "The compile-time minimum log level must be between ACSDK_LOG_LEVEL_DEBUG9 and ACSDK_LOG_LEVEL_INFO."
+#endif
 
+#if defined(ACSDK_DEBUG_LOG_ENABLED) && ACSDK_LOG_COMPILED_MIN_LEVEL <= ACSDK_LOG_LEVEL_DEBUG9
 /**
  * Send a DEBUG9 severity log line.
  *
@@ -382,161 +425,169 @@ inline std::shared_ptr<Logger> ACSDK_GET_LOGGER_FUNCTION() {
  * @param entry The text (or builder of the text) for the log entry.
  */
 #define ACSDK_DEBUG9(entry) ACSDK_LOG(alexaClientSDK::avsCommon::utils::logger::Level::DEBUG9, entry)
-
-/**
- * Send a DEBUG8 severity log line.
- *
- * @param loggerArg The Logger to send the line to.
- * @param entry The text (or builder of the text) for the log entry.
- */
-#define ACSDK_DEBUG8(entry) ACSDK_LOG(alexaClientSDK::avsCommon::utils::logger::Level::DEBUG8, entry)
-
+#else
 /**
- * Send a DEBUG7 severity log line.
+ * Compile out a DEBUG9 severity log line.
  *
  * @param loggerArg The Logger to send the line to.
  * @param entry The text (or builder of the text) for the log entry.
  */
-#define ACSDK_DEBUG7(entry) ACSDK_LOG(alexaClientSDK::avsCommon::utils::logger::Level::DEBUG7, entry)
+#define ACSDK_DEBUG9(entry)
+#endif
 
+#if defined(ACSDK_DEBUG_LOG_ENABLED) && ACSDK_LOG_COMPILED_MIN_LEVEL <= ACSDK_LOG_LEVEL_DEBUG8
 /**
- * Send a DEBUG6 severity log line.
+ * Send a DEBUG8 severity log line.
  *
  * @param loggerArg The Logger to send the line to.
  * @param entry The text (or builder of the text) for the log entry.
  */
-#define ACSDK_DEBUG6(entry) ACSDK_LOG(alexaClientSDK::avsCommon::utils::logger::Level::DEBUG6, entry)
-
+#define ACSDK_DEBUG8(entry) ACSDK_LOG(alexaClientSDK::avsCommon::utils::logger::Level::DEBUG8, entry)
+#else
 /**
- * Send a DEBUG5 severity log line.
+ * Compile out a DEBUG8 severity log line.
  *
  * @param loggerArg The Logger to send the line to.
  * @param entry The text (or builder of the text) for the log entry.
  */
-#define ACSDK_DEBUG5(entry) ACSDK_LOG(alexaClientSDK::avsCommon::utils::logger::Level::DEBUG5, entry)
+#define ACSDK_DEBUG8(entry)
+#endif
 
+#if defined(ACSDK_DEBUG_LOG_ENABLED) && ACSDK_LOG_COMPILED_MIN_LEVEL <= ACSDK_LOG_LEVEL_DEBUG7
 /**
- * Send a DEBUG4 severity log line.
+ * Send a DEBUG7 severity log line.
  *
  * @param loggerArg The Logger to send the line to.
  * @param entry The text (or builder of the text) for the log entry.
  */
-#define ACSDK_DEBUG4(entry) ACSDK_LOG(alexaClientSDK::avsCommon::utils::logger::Level::DEBUG4, entry)
-
+#define ACSDK_DEBUG7(entry) ACSDK_LOG(alexaClientSDK::avsCommon::utils::logger::Level::DEBUG7, entry)
+#else
 /**
- * Send a DEBUG3 severity log line.
+ * Compile out a DEBUG7 severity log line.
  *
  * @param loggerArg The Logger to send the line to.
  * @param entry The text (or builder of the text) for the log entry.
  */
-#define ACSDK_DEBUG3(entry) ACSDK_LOG(alexaClientSDK::avsCommon::utils::logger::Level::DEBUG3, entry)
+#define ACSDK_DEBUG7(entry)
+#endif
 
+#if defined(ACSDK_DEBUG_LOG_ENABLED) && ACSDK_LOG_COMPILED_MIN_LEVEL <= ACSDK_LOG_LEVEL_DEBUG6
 /**
- * Send a DEBUG2 severity log line.
+ * Send a DEBUG6 severity log line.
  *
  * @param loggerArg The Logger to send the line to.
  * @param entry The text (or builder of the text) for the log entry.
  */
-#define ACSDK_DEBUG2(entry) ACSDK_LOG(alexaClientSDK::avsCommon::utils::logger::Level::DEBUG2, entry)
-
+#define ACSDK_DEBUG6(entry) ACSDK_LOG(alexaClientSDK::avsCommon::utils::logger::Level::DEBUG6, entry)
+#else
 /**
- * Send a DEBUG1 severity log line.
+ * Compile out a DEBUG6 severity log line.
  *
  * @param loggerArg The Logger to send the line to.
  * @param entry The text (or builder of the text) for the log entry.
  */
-#define ACSDK_DEBUG1(entry) ACSDK_LOG(alexaClientSDK::avsCommon::utils::logger::Level::DEBUG1, entry)
+#define ACSDK_DEBUG6(entry)
+#endif
 
+#if defined(ACSDK_DEBUG_LOG_ENABLED) && ACSDK_LOG_COMPILED_MIN_LEVEL <= ACSDK_LOG_LEVEL_DEBUG5
 /**
- * Send a DEBUG0 severity log line.
+ * Send a DEBUG5 severity log line.
  *
  * @param loggerArg The Logger to send the line to.
  * @param entry The text (or builder of the text) for the log entry.
  */
-#define ACSDK_DEBUG0(entry) ACSDK_LOG(alexaClientSDK::avsCommon::utils::logger::Level::DEBUG0, entry)
-
+#define ACSDK_DEBUG5(entry) ACSDK_LOG(alexaClientSDK::avsCommon::utils::logger::Level::DEBUG5, entry)
+#else
 /**
- * Send a log line at the default debug level (DEBUG0).
+ * Compile out a DEBUG5 severity log line.
  *
  * @param loggerArg The Logger to send the line to.
  * @param entry The text (or builder of the text) for the log entry.
  */
-#define ACSDK_DEBUG(entry) ACSDK_LOG(alexaClientSDK::avsCommon::utils::logger::Level::DEBUG0, entry)
-
-#else  // ACSDK_DEBUG_LOG_ENABLED
+#define ACSDK_DEBUG5(entry)
+#endif
 
+#if defined(ACSDK_DEBUG_LOG_ENABLED) && ACSDK_LOG_COMPILED_MIN_LEVEL <= ACSDK_LOG_LEVEL_DEBUG4
 /**
- * Compile out a DEBUG9 severity log line.
+ * Send a DEBUG4 severity log line.
  *
  * @param loggerArg The Logger to send the line to.
  * @param entry The text (or builder of the text) for the log entry.
  */
-#define ACSDK_DEBUG9(entry)
-
+#define ACSDK_DEBUG4(entry) ACSDK_LOG(alexaClientSDK::avsCommon::utils::logger::Level::DEBUG4, entry)
+#else
 /**
- * Compile out a DEBUG8 severity log line.
+ * Compile out a DEBUG4 severity log line.
  *
  * @param loggerArg The Logger to send the line to.
  * @param entry The text (or builder of the text) for the log entry.
  */
-#define ACSDK_DEBUG8(entry)
+#define ACSDK_DEBUG4(entry)
+#endif
 
+#if defined(ACSDK_DEBUG_LOG_ENABLED) && ACSDK_LOG_COMPILED_MIN_LEVEL <= ACSDK_LOG_LEVEL_DEBUG3
 /**
- * Compile out a DEBUG7 severity log line.
+ * Send a DEBUG3 severity log line.
  *
  * @param loggerArg The Logger to send the line to.
  * @param entry The text (or builder of the text) for the log entry.
  */
-#define ACSDK_DEBUG7(entry)
-
+#define ACSDK_DEBUG3(entry) ACSDK_LOG(alexaClientSDK::avsCommon::utils::logger::Level::DEBUG3, entry)
+#else
 /**
- * Compile out a DEBUG6 severity log line.
+ * Compile out a DEBUG3 severity log line.
  *
  * @param loggerArg The Logger to send the line to.
  * @param entry The text (or builder of the text) for the log entry.
  */
-#define ACSDK_DEBUG6(entry)
+#define ACSDK_DEBUG3(entry)
+#endif
 
+#if defined(ACSDK_DEBUG_LOG_ENABLED) && ACSDK_LOG_COMPILED_MIN_LEVEL <= ACSDK_LOG_LEVEL_DEBUG2
 /**
- * Compile out a DEBUG5 severity log line.
+ * Send a DEBUG2 severity log line.
  *
  * @param loggerArg The Logger to send the line to.
  * @param entry The text (or builder of the text) for the log entry.
  */
-#define ACSDK_DEBUG5(entry)
-
+#define ACSDK_DEBUG2(entry) ACSDK_LOG(alexaClientSDK::avsCommon::utils::logger::Level::DEBUG2, entry)
+#else
 /**
- * Compile out a DEBUG4 severity log line.
+ * Compile out a DEBUG2 severity log line.
  *
  * @param loggerArg The Logger to send the line to.
  * @param entry The text (or builder of the text) for the log entry.
  */
-#define ACSDK_DEBUG4(entry)
+#define ACSDK_DEBUG2(entry)
+#endif
 
+#if defined(ACSDK_DEBUG_LOG_ENABLED) && ACSDK_LOG_COMPILED_MIN_LEVEL <= ACSDK_LOG_LEVEL_DEBUG1
 /**
- * Compile out a DEBUG3 severity log line.
+ * Send a DEBUG1 severity log line.
  *
  * @param loggerArg The Logger to send the line to.
  * @param entry The text (or builder of the text) for the log entry.
  */
-#define ACSDK_DEBUG3(entry)
-
+#define ACSDK_DEBUG1(entry) ACSDK_LOG(alexaClientSDK::avsCommon::utils::logger::Level::DEBUG1, entry)
+#else
 /**
- * Compile out a DEBUG2 severity log line.
+ * Compile out a DEBUG1 severity log line.
  *
  * @param loggerArg The Logger to send the line to.
  * @param entry The text (or builder of the text) for the log entry.
  */
-#define ACSDK_DEBUG2(entry)
+#define ACSDK_DEBUG1(entry)
+#endif
 
+#if defined(ACSDK_DEBUG_LOG_ENABLED) && ACSDK_LOG_COMPILED_MIN_LEVEL <= ACSDK_LOG_LEVEL_DEBUG0
 /**
- * Compile out a DEBUG1 severity log line.
+ * Send a DEBUG0 severity log line.
  *
  * @param loggerArg The Logger to send the line to.
  * @param entry The text (or builder of the text) for the log entry.
  */
-#define ACSDK_DEBUG1(entry)
-
+#define ACSDK_DEBUG0(entry) ACSDK_LOG(alexaClientSDK::avsCommon::utils::logger::Level::DEBUG0, entry)
+#else
 /**
  * Compile out a DEBUG0 severity log line.
  *
@@ -544,16 +595,15 @@ inline std::shared_ptr<Logger> ACSDK_GET_LOGGER_FUNCTION() {
  * @param entry The text (or builder of the text) for the log entry.
  */
 #define ACSDK_DEBUG0(entry)
+#endif
 
 /**
- * Compile out a DEBUG severity log line.
+ * Send a log line at the default debug level (DEBUG0), or compile it out along with DEBUG0.
  *
  * @param loggerArg The Logger to send the line to.
  * @param entry The text (or builder of the text) for the log entry.
  */
-#define ACSDK_DEBUG(entry)
-
-#endif  // ACSDK_DEBUG_LOG_ENABLED
+#define ACSDK_DEBUG(entry) ACSDK_DEBUG0(entry)
 
 /**
  * Send a INFO severity log line.
@@ -43,6 +43,12 @@ public:
 
     void emit(Level level, std::chrono::system_clock::time_point time, const char* threadId, const char* text) override;
 
+    void emitRecord(
+        Level level,
+        std::chrono::system_clock::time_point time,
+        const char* threadId,
+        const LogRecord& record) override;
+
 private:
     void onLogLevelChanged(Level level) override;
 
@@ -0,0 +1,246 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_METRICS_AGGREGATINGMETRICRECORDER_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_METRICS_AGGREGATINGMETRICRECORDER_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "AVSCommon/Utils/Metrics/MetricRecorderInterface.h"
+#include "AVSCommon/Utils/Timing/Timer.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace metrics {
+
+/**
+ * A @c MetricRecorderInterface which pre-aggregates high-rate counters and histograms before they reach the sinks.
+ *
+ * Callers register each metric once, by activity name and data point name, and get back a small integer id.  The name
+ * is interned at that point, so recording a value only indexes an array with the id: no @c MetricEvent is built, no
+ * string is hashed or copied, and no memory is allocated.  Each recording thread gets its own slots, which only that
+ * thread writes, so recording does not take a lock or contend with other threads.
+ *
+ * Every flush interval the slots of all threads are summed, and the change since the previous flush is sent to the
+ * downstream recorder as one @c MetricEvent per activity name:
+ *  - A counter becomes a @c COUNTER data point with its name, holding the increments since the last flush.
+ *  - A histogram holds durations in milliseconds.  It becomes @c COUNTER data points named @c <name>.count and
+ *    @c <name>.sum, and @c DURATION data points named @c <name>.p50, @c <name>.p90 and @c <name>.p99.  Values are
+ *    bucketed by powers of two, so percentiles are the upper bound of their bucket.
+ * Metrics which did not change since the last flush are not sent.  The slots of threads which have exited are
+ * released by the next flush.
+ *
+ * Events passed to @c recordMetric() are forwarded to the downstream recorder as they are, so an
+ * @c AggregatingMetricRecorder can stand in for the recorder it wraps.
+ */
+class AggregatingMetricRecorder : public MetricRecorderInterface {
+public:
+    /// The type of the id of a registered metric.
+    using MetricId = uint32_t;
+
+    /// The id returned when a metric could not be registered.  Recording to it does nothing.
+    static const MetricId INVALID_METRIC_ID = UINT32_MAX;
+
+    /// The default interval between flushes.
+    static constexpr std::chrono::milliseconds DEFAULT_FLUSH_INTERVAL{std::chrono::seconds(60)};
+
+    /// The default maximum number of metrics which can be registered.
+    static const size_t DEFAULT_MAX_METRICS = 64;
+
+    /**
+     * Creates an @c AggregatingMetricRecorder.
+     *
+     * @param recorder The recorder to send flushed metrics and forwarded events to.
+     * @param flushInterval The interval between flushes, or zero to only flush when @c flush() is called.
+     * @param maxMetrics The maximum number of metrics which can be registered.
+     * @return The new @c AggregatingMetricRecorder, or @c nullptr if the parameters are invalid.
+     */
+    static std::shared_ptr<AggregatingMetricRecorder> create(
+        std::shared_ptr<MetricRecorderInterface> recorder,
+        std::chrono::milliseconds flushInterval = DEFAULT_FLUSH_INTERVAL,
+        size_t maxMetrics = DEFAULT_MAX_METRICS);
+
+    /**
+     * Destructor.  Flushes any values recorded since the last flush.
+     */
+    ~AggregatingMetricRecorder() override;
+
+    /**
+     * Registers a counter, or looks up one already registered.
+     *
+     * @param activityName The activity name of the events the counter is sent in.
+     * @param name The name of the data point of the counter.
+     * @return The id of the counter, or @c INVALID_METRIC_ID if the name is empty or too many metrics are registered.
+     */
+    MetricId getCounter(const std::string& activityName, const std::string& name);
+
+    /**
+     * Registers a histogram, or looks up one already registered.
+     *
+     * @param activityName The activity name of the events the histogram is sent in.
+     * @param name The prefix of the names of the data points of the histogram.
+     * @return The id of the histogram, or @c INVALID_METRIC_ID if the name is empty or too many metrics are registered.
+     */
+    MetricId getHistogram(const std::string& activityName, const std::string& name);
+
+    /**
+     * Adds to a counter.  This does not lock or allocate.
+     *
+     * @param id The id of the counter, returned by @c getCounter().
+     * @param count The amount to add.
+     */
+    void increment(MetricId id, uint64_t count = 1);
+
+    /**
+     * Records a value in a histogram.  This does not lock or allocate.
+     *
+     * @param id The id of the histogram, returned by @c getHistogram().
+     * @param value The value to record, in milliseconds.
+     */
+    void recordValue(MetricId id, uint64_t value);
+
+    /**
+     * Sends the changes to all metrics since the last flush to the downstream recorder.
+     */
+    void flush();
+
+    /// @name MetricRecorderInterface method.
+    /// @{
+    void recordMetric(std::shared_ptr<MetricEvent> metricEvent) override;
+    /// @}
+
+private:
+    /// The number of histogram buckets.  Bucket 0 holds zero, and bucket @c i holds values in [2^(i-1), 2^i).
+    static const size_t NUM_BUCKETS = 32;
+
+    /// The number of slots used by each metric: a count, a sum, and the histogram buckets.
+    static const size_t SLOTS_PER_METRIC = 2 + NUM_BUCKETS;
+
+    /// The slot holding the count of a metric.  Counters only use this slot.
+    static const size_t COUNT_SLOT = 0;
+
+    /// The slot holding the sum of the values of a histogram.
+    static const size_t SUM_SLOT = 1;
+
+    /// The first bucket slot of a histogram.
+    static const size_t FIRST_BUCKET_SLOT = 2;
+
+    /// A registered metric.
+    struct Metric {
+        /// The activity name of the events the metric is sent in.
+        std::string activityName;
+
+        /// The name of the metric.
+        std::string name;
+
+        /// Whether the metric is a histogram rather than a counter.
+        bool isHistogram;
+    };
+
+    /// The slots of one recording thread.
+    struct ThreadSlots {
+        /**
+         * Constructor.
+         *
+         * @param numSlots The number of slots.
+         */
+        explicit ThreadSlots(size_t numSlots);
+
+        /// The values recorded by the thread.  Only written by that thread.
+        std::unique_ptr<std::atomic<uint64_t>[]> values;
+
+        /// The values as of the last flush.  Only used while flushing.
+        std::unique_ptr<uint64_t[]> flushed;
+
+        /// Expires when the recording thread exits, after which no more values are recorded to these slots.
+        std::weak_ptr<void> owner;
+    };
+
+    /**
+     * Constructor.
+     *
+     * @param recorder The recorder to send flushed metrics and forwarded events to.
+     * @param maxMetrics The maximum number of metrics which can be registered.
+     */
+    AggregatingMetricRecorder(std::shared_ptr<MetricRecorderInterface> recorder, size_t maxMetrics);
+
+    /**
+     * Registers a metric, or looks up one already registered.
+     *
+     * @param activityName The activity name of the events the metric is sent in.
+     * @param name The name of the metric.
+     * @param isHistogram Whether the metric is a histogram.
+     * @return The id of the metric, or @c INVALID_METRIC_ID if it could not be registered.
+     */
+    MetricId registerMetric(const std::string& activityName, const std::string& name, bool isHistogram);
+
+    /**
+     * Obtain the slots of the calling thread, creating them if needed.
+     *
+     * @return The slots of the calling thread.
+     */
+    ThreadSlots* getThreadSlots();
+
+    /**
+     * Looks up the slots of the calling thread in @c m_threadSlots, creating them if needed.  This is the slow path of
+     * @c getThreadSlots(), taken the first time a thread records to this recorder.
+     *
+     * @return The slots of the calling thread.
+     */
+    ThreadSlots* lookupThreadSlots();
+
+    /// The recorder to send flushed metrics and forwarded events to.
+    const std::shared_ptr<MetricRecorderInterface> m_recorder;
+
+    /// The maximum number of metrics which can be registered.
+    const size_t m_maxMetrics;
+
+    /// An id for this instance which is never reused, to tell apart the entries of the per-thread slot caches.
+    const uint64_t m_instanceId;
+
+    /// Serializes registration, creation of thread slots and flushes.
+    std::mutex m_mutex;
+
+    /// The registered metrics, indexed by id.
+    std::vector<Metric> m_metrics;
+
+    /// The ids of the registered metrics, keyed by type, activity name and name.
+    std::unordered_map<std::string, MetricId> m_metricIds;
+
+    /// The slots of every thread which has recorded a value since the last flush, or is still running.  A thread which
+    /// reuses the id of an exited thread also reuses its slots if they have not been released yet.
+    std::unordered_map<std::thread::id, std::unique_ptr<ThreadSlots>> m_threadSlots;
+
+    /// The timer which flushes periodically.  Declared last so that it is stopped before anything else is destroyed.
+    timing::Timer m_flushTimer;
+};
+
+}  // namespace metrics
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_METRICS_AGGREGATINGMETRICRECORDER_H_
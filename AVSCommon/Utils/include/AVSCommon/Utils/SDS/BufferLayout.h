@@ -16,8 +16,10 @@
 #ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_BUFFERLAYOUT_H_
 #define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_BUFFERLAYOUT_H_
 
+#include <atomic>
 #include <cstdint>
 #include <cstddef>
+#include <functional>
 #include <mutex>
 #include <string>
 #include <vector>
@@ -288,6 +290,37 @@ public:
      */
     void disableReaderLocked(size_t id);
 
+    /**
+     * This function sets the function to call when a @c Writer using this @c BufferLayout makes new data available,
+     * or closes, on behalf of the specified reader.  Only @c Writers in this process which share this @c BufferLayout
+     * call it.
+     *
+     * @param id The id of the reader the callback is for.
+     * @param callback The function to call, or an empty function to stop calling one.  It is called from the
+     *     @c Writer's thread while an internal lock is held, so it must return quickly and must not use this stream.
+     */
+    void setDataAvailableCallback(size_t id, std::function<void()> callback);
+
+    /**
+     * This function calls the functions set with @c setDataAvailableCallback().  It does not lock if none are set.
+     */
+    void notifyDataAvailable();
+
+    /**
+     * This function sets the function to call when a @c Reader using this @c BufferLayout consumes data, or goes away,
+     * so that a @c Writer has more space to write into.  Only @c Readers in this process which share this
+     * @c BufferLayout call it.
+     *
+     * @param callback The function to call, or an empty function to stop calling one.  It is called from the
+     *     @c Reader's thread while an internal lock is held, so it must return quickly and must not use this stream.
+     */
+    void setSpaceAvailableCallback(std::function<void()> callback);
+
+    /**
+     * This function calls the function set with @c setSpaceAvailableCallback().  It does not lock if none is set.
+     */
+    void notifySpaceAvailable();
+
     /**
      * This function returns a count of the number of words after the specified @c Index before the circular data
      * will wrap.
@@ -417,6 +450,24 @@ private:
 
     /// Precalculated pointer to the circular data.
     uint8_t* m_data;
+
+    /// Serializes access to @c m_dataAvailableCallbacks.
+    std::mutex m_dataAvailableCallbacksMutex;
+
+    /// The functions set with @c setDataAvailableCallback(), indexed by reader id.
+    std::vector<std::function<void()>> m_dataAvailableCallbacks;
+
+    /// The number of non-empty functions in @c m_dataAvailableCallbacks.
+    std::atomic<size_t> m_numDataAvailableCallbacks;
+
+    /// Serializes access to @c m_spaceAvailableCallback.
+    std::mutex m_spaceAvailableCallbackMutex;
+
+    /// The function set with @c setSpaceAvailableCallback().
+    std::function<void()> m_spaceAvailableCallback;
+
+    /// Whether @c m_spaceAvailableCallback is set.
+    std::atomic<bool> m_hasSpaceAvailableCallback;
 };
 
 template <typename T>
@@ -429,7 +480,9 @@ SharedDataStream<T>::BufferLayout::BufferLayout(std::shared_ptr<Buffer> buffer)
         m_readerCursorArray{nullptr},
         m_readerCloseIndexArray{nullptr},
         m_dataSize{0},
-        m_data{nullptr} {
+        m_data{nullptr},
+        m_numDataAvailableCallbacks{0},
+        m_hasSpaceAvailableCallback{false} {
 }
 
 template <typename T>
@@ -616,6 +669,57 @@ void SharedDataStream<T>::BufferLayout::disableReaderLocked(size_t id) {
     m_readerEnabledArray[id] = false;
 }
 
+template <typename T>
+void SharedDataStream<T>::BufferLayout::setDataAvailableCallback(size_t id, std::function<void()> callback) {
+    std::lock_guard<std::mutex> lock(m_dataAvailableCallbacksMutex);
+    if (id >= m_dataAvailableCallbacks.size()) {
+        if (!callback) {
+            return;
+        }
+        m_dataAvailableCallbacks.resize(id + 1);
+    }
+    auto& entry = m_dataAvailableCallbacks[id];
+    if (static_cast<bool>(entry) != static_cast<bool>(callback)) {
+        if (callback) {
+            ++m_numDataAvailableCallbacks;
+        } else {
+            --m_numDataAvailableCallbacks;
+        }
+    }
+    entry = std::move(callback);
+}
+
+template <typename T>
+void SharedDataStream<T>::BufferLayout::notifyDataAvailable() {
+    if (0 == m_numDataAvailableCallbacks) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_dataAvailableCallbacksMutex);
+    for (const auto& callback : m_dataAvailableCallbacks) {
+        if (callback) {
+            callback();
+        }
+    }
+}
+
+template <typename T>
+void SharedDataStream<T>::BufferLayout::setSpaceAvailableCallback(std::function<void()> callback) {
+    std::lock_guard<std::mutex> lock(m_spaceAvailableCallbackMutex);
+    m_hasSpaceAvailableCallback = static_cast<bool>(callback);
+    m_spaceAvailableCallback = std::move(callback);
+}
+
+template <typename T>
+void SharedDataStream<T>::BufferLayout::notifySpaceAvailable() {
+    if (!m_hasSpaceAvailableCallback) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_spaceAvailableCallbackMutex);
+    if (m_spaceAvailableCallback) {
+        m_spaceAvailableCallback();
+    }
+}
+
 template <typename T>
 typename SharedDataStream<T>::Index SharedDataStream<T>::BufferLayout::wordsUntilWrap(Index after) const {
     // The type of Index is uint64_t, size_t is 32 bits in a 32bits system.
@@ -680,6 +784,7 @@ void SharedDataStream<T>::BufferLayout::updateOldestUnconsumedCursorLocked() {
         // Notify the writer(s).
         // Note: as an optimization, we could skip this if there are no blocking writers (ACSDK-251).
         header->spaceAvailableConditionVariable.notify_all();
+        notifySpaceAvailable();
     }
 }
 
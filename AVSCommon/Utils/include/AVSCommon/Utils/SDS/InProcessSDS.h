@@ -22,6 +22,7 @@
 #include <condition_variable>
 #include <string>
 
+#include "SequenceConditionVariable.h"
 #include "SharedDataStream.h"
 
 namespace alexaClientSDK {
@@ -53,6 +54,41 @@ struct InProcessSDSTraits {
 /// Type alias for a SharedDataStream which works between threads in a single process.
 using InProcessSDS = SharedDataStream<InProcessSDSTraits>;
 
+/**
+ * Structure for specifying the traits of a low-latency SharedDataStream which works between threads in a single
+ * process.
+ *
+ * These traits are compatible with @c InProcessSDSTraits, except that readers are woken through a
+ * @c SequenceConditionVariable.  This allows the @c Writer to publish its cursor with an atomic store and wake
+ * blocked @c Readers without taking @c dataAvailableMutex, and makes the wake-up free when no @c Reader is blocked.
+ * @c NONBLOCKING @c Readers which poll the stream never touch a mutex.
+ */
+struct LowLatencyInProcessSDSTraits {
+    /// C++11 std::atomic is sufficient for in-process atomic variables.
+    using AtomicIndex = std::atomic<uint64_t>;
+
+    /// C++11 std::atomic is sufficient for in-process atomic variables.
+    using AtomicBool = std::atomic<bool>;
+
+    /// A std::vector provides a simple container to hold a buffer for in-process usage.
+    using Buffer = std::vector<uint8_t>;
+
+    /// A std::mutex provides a lock which will work for in-process usage.
+    using Mutex = std::mutex;
+
+    /// A @c SequenceConditionVariable does not require notifiers to hold @c Mutex.
+    using ConditionVariable = SequenceConditionVariable;
+
+    /// @c ConditionVariable cannot miss a notification, so the @c Writer may notify without locking.
+    static constexpr bool lockFreeNotify = true;
+
+    /// A unique identifier representing this combination of traits.
+    static constexpr const char* traitsName = "alexaClientSDK::avsCommon::utils::sds::LowLatencyInProcessSDSTraits";
+};
+
+/// Type alias for a low-latency SharedDataStream which works between threads in a single process.
+using LowLatencyInProcessSDS = SharedDataStream<LowLatencyInProcessSDSTraits>;
+
 }  // namespace sds
 }  // namespace utils
 }  // namespace avsCommon
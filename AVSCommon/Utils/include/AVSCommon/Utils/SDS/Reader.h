@@ -18,6 +18,7 @@
 
 #include <cstdint>
 #include <cstddef>
+#include <functional>
 #include <vector>
 #include <mutex>
 #include <limits>
@@ -162,6 +163,38 @@ public:
      */
     ssize_t read(void* buf, size_t nWords, std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
 
+    /**
+     * This function provides direct access to data in the stream without consuming it or copying it.  The available
+     * data is described by up to two @c Spans which point straight into the circular buffer; the second @c Span is
+     * only used when the data wraps around the end of the buffer.  Once the caller has finished with the data, it
+     * must call @c consume() to advance the @c Reader.  Calling @c peek() again without consuming returns the same
+     * data (plus any data written in the meantime).
+     *
+     * @param spans Receives the regions of the buffer which hold the available data.  On error, both @c Spans are
+     *     empty.
+     * @param maxWords The maximum number of @c wordSize words to expose.
+     * @param timeout The maximum time to wait (if @c policy is @c BLOCKING) for data.  If this parameter is zero,
+     *     there is no timeout and blocking peeks will wait forever.  If @c policy is @c NONBLOCKING, this parameter
+     *     is ignored.
+     * @return The total number of @c wordSize words described by @c spans, or zero if the stream has closed, or a
+     *     negative @c Error code if the stream is still open, but no data is available.
+     *
+     * @warning The @c Writer is not held off while the caller accesses @c spans.  If the @c Writer can overwrite
+     *     unconsumed data (e.g. @c WriterPolicy::NONBLOCKABLE), the data may change underneath the caller; in that
+     *     case @c consume() will report @c Error::OVERRUN and the caller should discard its results.
+     */
+    ssize_t peek(Spans* spans, size_t maxWords, std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
+
+    /**
+     * This function consumes data previously exposed by @c peek().
+     *
+     * @param nWords The number of @c wordSize words to consume.  This must not exceed the value returned by the
+     *     preceding @c peek().
+     * @return @c nWords if the data was consumed, @c Error::OVERRUN if the data was overwritten while it was being
+     *     accessed, or @c Error::INVALID if @c nWords is larger than the available data.
+     */
+    ssize_t consume(size_t nWords);
+
     /**
      * This function moves the @c Reader to the specified location in the stream.  If successful, subsequent calls to
      * @c read() will start from the new location.  For this function to succeed, the specified location *must* point
@@ -214,6 +247,17 @@ public:
      */
     size_t getId() const;
 
+    /**
+     * This function sets a function to call when a @c Writer makes new data available to this @c Reader, or closes.
+     * This lets a @c NONBLOCKING @c Reader wait for data without polling.  Only @c Writers in this process which were
+     * created by the same @c SharedDataStream instance call it.  The function is cleared when this @c Reader is
+     * destroyed.
+     *
+     * @param callback The function to call, or an empty function to stop calling one.  It is called from the
+     *     @c Writer's thread while an internal lock is held, so it must return quickly and must not use this stream.
+     */
+    void setDataAvailableCallback(std::function<void()> callback);
+
     /**
      * This function returns the word size (in bytes).  All @c SharedDataStream operations that work with data or
      * position in the stream are quantified in words.
@@ -283,6 +327,8 @@ SharedDataStream<T>::Reader::~Reader() {
     // updateOldestUnconsumedCursor().  See updateOldestUnconsumedCursor() comments for further explanation.
     seek(0, Reference::BEFORE_WRITER);
 
+    m_bufferLayout->setDataAvailableCallback(m_id, nullptr);
+
     std::lock_guard<Mutex> lock(m_bufferLayout->getHeader()->readerEnableMutex);
     m_bufferLayout->disableReaderLocked(m_id);
     m_bufferLayout->updateOldestUnconsumedCursor();
@@ -313,12 +359,45 @@ ssize_t SharedDataStream<T>::Reader::read(OutputFunction function, size_t nWords
         logger::acsdkError(logger::LogEntry(TAG, "readFailed").d("reason", "nullFunction"));
         return Error::INVALID;
     }
-
     if (0 == nWords) {
         logger::acsdkError(logger::LogEntry(TAG, "readFailed").d("reason", "invalidNumWords").d("numWords", nWords));
         return Error::INVALID;
     }
 
+    Spans spans;
+    auto wordsAvailable = peek(&spans, nWords, timeout);
+    if (wordsAvailable <= 0) {
+        return wordsAvailable;
+    }
+
+    // Pass the two segments.
+    if (!function(spans[0].data, spans[0].nWords)) {
+        // We haven't changed the read pointer yet, just error out.
+        return Error::INVALID;
+    }
+
+    if (spans[1].nWords > 0 && !function(spans[1].data, spans[1].nWords)) {
+        // By API if either of these calls fail the entire read fails and no data is consumed.
+        return Error::INVALID;
+    }
+
+    return consume(wordsAvailable);
+}
+
+template <typename T>
+ssize_t SharedDataStream<T>::Reader::peek(Spans* spans, size_t nWords, std::chrono::milliseconds timeout) {
+    if (nullptr == spans) {
+        logger::acsdkError(logger::LogEntry(TAG, "peekFailed").d("reason", "nullSpans"));
+        return Error::INVALID;
+    }
+    (*spans)[0] = {nullptr, 0};
+    (*spans)[1] = {nullptr, 0};
+
+    if (0 == nWords) {
+        logger::acsdkError(logger::LogEntry(TAG, "peekFailed").d("reason", "invalidNumWords").d("numWords", nWords));
+        return Error::INVALID;
+    }
+
     // Check if closed.
     auto readerCloseIndex = m_readerCloseIndex->load();
     if (*m_readerCursor >= readerCloseIndex) {
@@ -332,12 +411,8 @@ ssize_t SharedDataStream<T>::Reader::read(OutputFunction function, size_t nWords
         return Error::OVERRUN;
     }
 
-    std::unique_lock<Mutex> lock(header->dataAvailableMutex, std::defer_lock);
-    if (Policy::BLOCKING == m_policy) {
-        lock.lock();
-    }
-
-    // Figure out how much we can actually copy.
+    // Figure out how much we can actually copy.  The data-available mutex is only needed if we have to wait; the
+    // predicate below re-checks under the lock, so data published after this check is not missed.
     size_t wordsAvailable = tell(Reference::BEFORE_WRITER);
     if (0 == wordsAvailable) {
         if (header->writeEndCursor > 0 && !header->isWriterEnabled) {
@@ -345,6 +420,8 @@ ssize_t SharedDataStream<T>::Reader::read(OutputFunction function, size_t nWords
         } else if (Policy::NONBLOCKING == m_policy) {
             return Error::WOULDBLOCK;
         } else if (Policy::BLOCKING == m_policy) {
+            std::unique_lock<Mutex> lock(header->dataAvailableMutex);
+
             // Condition for returning from read: the Writer has been closed or there is data to read
             auto predicate = [this, header] {
                 return header->hasWriterBeenClosed || tell(Reference::BEFORE_WRITER) > 0;
@@ -364,9 +441,6 @@ ssize_t SharedDataStream<T>::Reader::read(OutputFunction function, size_t nWords
         }
     }
 
-    if (Policy::BLOCKING == m_policy) {
-        lock.unlock();
-    }
     if (nWords > wordsAvailable) {
         nWords = wordsAvailable;
     }
@@ -383,14 +457,18 @@ ssize_t SharedDataStream<T>::Reader::read(OutputFunction function, size_t nWords
     }
     size_t afterWrap = nWords - beforeWrap;
 
-    // Copy the two segments.
-    if (!function(m_bufferLayout->getData(*m_readerCursor), beforeWrap)) {
-        // We haven't changed the read pointer yet, just error out.
-        return Error::INVALID;
+    (*spans)[0] = {m_bufferLayout->getData(*m_readerCursor), beforeWrap};
+    if (afterWrap > 0) {
+        (*spans)[1] = {m_bufferLayout->getData(*m_readerCursor + beforeWrap), afterWrap};
     }
 
-    if (afterWrap > 0 && !function(m_bufferLayout->getData(*m_readerCursor + beforeWrap), afterWrap)) {
-        // By API if either of these calls fail the entire read fails and no data is consumed.
+    return nWords;
+}
+
+template <typename T>
+ssize_t SharedDataStream<T>::Reader::consume(size_t nWords) {
+    if (nWords > tell(Reference::BEFORE_WRITER) || (*m_readerCursor + nWords) > m_readerCloseIndex->load()) {
+        logger::acsdkError(logger::LogEntry(TAG, "consumeFailed").d("reason", "invalidNumWords").d("numWords", nWords));
         return Error::INVALID;
     }
 
@@ -398,6 +476,7 @@ ssize_t SharedDataStream<T>::Reader::read(OutputFunction function, size_t nWords
     *m_readerCursor += nWords;
 
     // Final check for overrun (do this before the updateOldestUnconsumedCursor() call below for improved accuracy).
+    auto header = m_bufferLayout->getHeader();
     bool overrun = ((header->writeEndCursor - *m_readerCursor) > m_bufferLayout->getDataSize());
 
     // Move the unconsumed cursor before returning.
@@ -547,6 +626,11 @@ size_t SharedDataStream<T>::Reader::getId() const {
     return m_id;
 }
 
+template <typename T>
+void SharedDataStream<T>::Reader::setDataAvailableCallback(std::function<void()> callback) {
+    m_bufferLayout->setDataAvailableCallback(m_id, std::move(callback));
+}
+
 template <typename T>
 size_t SharedDataStream<T>::Reader::getWordSize() const {
     return m_bufferLayout->getHeader()->wordSize;
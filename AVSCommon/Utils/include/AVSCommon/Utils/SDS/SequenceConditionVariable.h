@@ -0,0 +1,150 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_SEQUENCECONDITIONVARIABLE_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_SEQUENCECONDITIONVARIABLE_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+#ifndef __linux__
+#include <condition_variable>
+#endif
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+
+/**
+ * A condition variable for in-process @c SharedDataStream instances which does not require the notifier to hold the
+ * mutex associated with the waiters.
+ *
+ * Every @c notify_all() bumps an atomic sequence number.  Waiters sample the sequence number @b before evaluating
+ * their predicate, and then sleep only until the sequence number moves away from the sampled value.  A notification
+ * which lands between the predicate check and the sleep therefore cannot be lost, so a producer can publish its state
+ * with plain atomic stores and call @c notify_all() without taking a lock.  When there are no sleeping waiters,
+ * @c notify_all() is a single atomic increment and load; no mutex is taken and no system call is made.
+ *
+ * On Linux, sleeping is implemented with a private futex on the sequence number.  On other platforms, sleeping falls
+ * back to an internal @c std::condition_variable which is only touched when there is at least one sleeping waiter.
+ *
+ * The interface mirrors the subset of @c std::condition_variable required by @c SharedDataStream.
+ */
+class SequenceConditionVariable {
+public:
+    /// Constructor.
+    SequenceConditionVariable();
+
+    /// Unblocks all threads currently waiting on this condition variable.
+    void notify_all();
+
+    /**
+     * Waits until the next call to @c notify_all().  As with @c std::condition_variable, spurious wake-ups are
+     * possible.
+     *
+     * @param lock The locked mutex, which is unlocked while waiting and re-locked before returning.
+     */
+    void wait(std::unique_lock<std::mutex>& lock);
+
+    /**
+     * Waits until @c pred is satisfied.
+     *
+     * @param lock The locked mutex, which is unlocked while waiting and re-locked before evaluating @c pred.
+     * @param pred The predicate to evaluate.
+     */
+    template <class Predicate>
+    void wait(std::unique_lock<std::mutex>& lock, Predicate pred);
+
+    /**
+     * Waits up to @c relTime for @c pred to be satisfied.
+     *
+     * @param lock The locked mutex, which is unlocked while waiting and re-locked before evaluating @c pred.
+     * @param relTime The maximum time to wait.
+     * @param pred The predicate to evaluate.
+     * @return The final evaluation of @c pred.
+     */
+    template <class Rep, class Period, class Predicate>
+    bool wait_for(
+        std::unique_lock<std::mutex>& lock,
+        const std::chrono::duration<Rep, Period>& relTime,
+        Predicate pred);
+
+private:
+    /**
+     * Sleeps until the sequence number differs from @c sequence, or @c timeout elapses.  Spurious returns are allowed.
+     *
+     * @param sequence The sequence number sampled before the caller's predicate was evaluated.
+     * @param timeout The maximum time to sleep.  A negative value means there is no timeout.
+     */
+    void waitForChange(uint32_t sequence, std::chrono::nanoseconds timeout);
+
+    /// The sequence number, incremented on every notification.
+    std::atomic<uint32_t> m_sequence;
+
+    /// The number of threads currently sleeping in @c waitForChange().
+    std::atomic<uint32_t> m_sleepers;
+
+#ifndef __linux__
+    /// Mutex used with @c m_sleepCondition on platforms without futex support.
+    std::mutex m_sleepMutex;
+
+    /// Condition variable used to sleep on platforms without futex support.
+    std::condition_variable m_sleepCondition;
+#endif
+};
+
+template <class Predicate>
+void SequenceConditionVariable::wait(std::unique_lock<std::mutex>& lock, Predicate pred) {
+    while (true) {
+        auto sequence = m_sequence.load();
+        if (pred()) {
+            return;
+        }
+        lock.unlock();
+        waitForChange(sequence, std::chrono::nanoseconds(-1));
+        lock.lock();
+    }
+}
+
+template <class Rep, class Period, class Predicate>
+bool SequenceConditionVariable::wait_for(
+    std::unique_lock<std::mutex>& lock,
+    const std::chrono::duration<Rep, Period>& relTime,
+    Predicate pred) {
+    auto deadline = std::chrono::steady_clock::now() + relTime;
+    while (true) {
+        auto sequence = m_sequence.load();
+        if (pred()) {
+            return true;
+        }
+        auto now = std::chrono::steady_clock::now();
+        if (now >= deadline) {
+            return false;
+        }
+        lock.unlock();
+        waitForChange(sequence, std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - now));
+        lock.lock();
+    }
+}
+
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_SEQUENCECONDITIONVARIABLE_H_
@@ -16,9 +16,11 @@
 #ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_SHAREDDATASTREAM_H_
 #define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_SDS_SHAREDDATASTREAM_H_
 
+#include <array>
 #include <cstdint>
 #include <cstddef>
 #include <memory>
+#include <type_traits>
 
 #include "AVSCommon/Utils/Logger/LoggerUtils.h"
 
@@ -27,6 +29,18 @@ namespace avsCommon {
 namespace utils {
 namespace sds {
 
+/**
+ * Helper which reports the value of the optional @c T::lockFreeNotify trait, or @c false if @c T does not declare it.
+ *
+ * @tparam T The traits type to inspect.
+ */
+template <typename T, typename = void>
+struct SdsLockFreeNotify : std::false_type {};
+
+/// Specialization of @c SdsLockFreeNotify for traits which declare @c lockFreeNotify.
+template <typename T>
+struct SdsLockFreeNotify<T, typename std::enable_if<T::lockFreeNotify>::type> : std::true_type {};
+
 /**
  * Class for streaming data from a single producer (@c Writer) to multiple consumers (@c Reader).  This class
  * implements streaming in a generic manner, and utilizes template traits to decouple from platform specifics related
@@ -89,6 +103,11 @@ namespace sds {
  * @tparam T::traitsName A unique string value which describes the collection of traits specified by T.  This string
  *     is used to ensure that a SharedDataStream attempting to open() a buffer is using the same set of traits that
  *     were originally used to create() the buffer.
+ *
+ * @tparam T::lockFreeNotify (optional) A `static constexpr bool` which, when @c true, indicates that
+ *     @c ConditionVariable never loses a @c notify_all() issued without holding @c Mutex, as long as the state tested
+ *     by the waiter's predicate was updated before the call.  In this case the @c Writer publishes new data and wakes
+ *     @c Readers without locking the data-available @c Mutex.  If this member is absent it defaults to @c false.
  */
 template <typename T>
 class SharedDataStream {
@@ -119,6 +138,24 @@ public:
     /// A condition variable type which works with @c Mutex.
     using ConditionVariable = typename T::ConditionVariable;
 
+    /**
+     * A contiguous region of words inside the stream's circular buffer, as returned by @c Reader::peek() and
+     * @c Writer::reserve().
+     */
+    struct Span {
+        /// Pointer to the first byte of the region.
+        uint8_t* data;
+
+        /// The number of @c wordSize words in the region.
+        size_t nWords;
+    };
+
+    /**
+     * A region of the circular buffer described as up to two contiguous @c Spans.  The second @c Span is only used
+     * when the region wraps around the end of the buffer; otherwise its @c nWords is zero.
+     */
+    using Spans = std::array<Span, 2>;
+
     // Forward declare the nested @c Reader class (full declaration is in @c Reader.h).
     class Reader;
 
@@ -19,6 +19,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <functional>
 #include <limits>
 #include <mutex>
 #include <vector>
@@ -86,7 +87,8 @@ public:
      *     is zero, there is no timeout and blocking writes will wait forever.  If @c policy is not @C BLOCKING, this
      *     parameter is ignored.
      * @return The number of @c wordSize words copied, or zero if the stream has closed, or a
-     *     negative @c Error code if the stream is still open, but no data could be written.
+     *     negative @c Error code if the stream is still open, but no data could be written.  @c Error::INVALID is
+     *     returned if a @c reserve() has not been followed by its @c commit().
      *
      * @note A stream is closed for the @c Writer if @c Writer::close() has been called.
      *
@@ -96,6 +98,37 @@ public:
      */
     ssize_t write(const void* buf, size_t nWords, std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
 
+    /**
+     * This function reserves space in the stream so that the caller can produce data directly into the circular
+     * buffer instead of copying it in with @c write().  The reserved space is described by up to two @c Spans; the
+     * second @c Span is only used when the space wraps around the end of the buffer.  The data becomes visible to
+     * @c Readers when @c commit() is called.  @c Readers which try to read the reserved region before it is committed
+     * will see it as overrun, exactly as they would during a @c write().
+     *
+     * The @c policy is applied as for @c write(), except that a reservation never exceeds the size of the buffer.
+     *
+     * @param spans Receives the regions of the buffer which have been reserved.  On error, both @c Spans are empty.
+     * @param nWords The maximum number of @c wordSize words to reserve.
+     * @param timeout The maximum time to wait (if @c policy is @c BLOCKING) for space.  If this parameter is zero,
+     *     there is no timeout and blocking reservations will wait forever.  If @c policy is not @C BLOCKING, this
+     *     parameter is ignored.
+     * @return The number of @c wordSize words reserved, or zero if the stream has closed, or a negative @c Error code
+     *     if the stream is still open, but no space could be reserved.
+     *
+     * @note Each successful @c reserve() must be followed by a @c commit() before the next @c write() or
+     *     @c reserve().  A reservation can be abandoned with `commit(0)`.
+     */
+    ssize_t reserve(Spans* spans, size_t nWords, std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
+
+    /**
+     * This function publishes data produced into the space returned by the preceding @c reserve().
+     *
+     * @param nWords The number of @c wordSize words to publish, starting at the beginning of the reservation.  This
+     *     must not exceed the value returned by @c reserve().  Any remaining reserved space is released.
+     * @return @c nWords if the data was published, or @c Error::INVALID if @c nWords exceeds the reservation.
+     */
+    ssize_t commit(size_t nWords);
+
     /**
      * This function reports the current position of the @c Writer in the stream.
      *
@@ -117,6 +150,17 @@ public:
      */
     size_t getWordSize() const;
 
+    /**
+     * This function sets a function to call when a @c Reader consumes data, or goes away, so that there may be more
+     * space to write into.  This lets a @c NONBLOCKABLE or @c ALL_OR_NOTHING @c Writer, or a @c BLOCKING one which
+     * timed out, wait for space without polling.  Only @c Readers in this process which were created by the same
+     * @c SharedDataStream instance call it.  The function is cleared when this @c Writer is closed.
+     *
+     * @param callback The function to call, or an empty function to stop calling one.  It is called from the
+     *     @c Reader's thread while an internal lock is held, so it must return quickly and must not use this stream.
+     */
+    void setSpaceAvailableCallback(std::function<void()> callback);
+
     /**
      * Returns the text of an error code.
      *
@@ -125,6 +169,24 @@ public:
     static std::string errorToString(Error error);
 
 private:
+    /**
+     * This function applies @c m_policy to a request for @c nWords words of space, and marks the region which will be
+     * written by moving @c writeEndCursor past it.
+     *
+     * @param nWords The number of @c wordSize words the caller would like to write.
+     * @param timeout The maximum time to wait (if @c policy is @c BLOCKING) for space.
+     * @return The number of @c wordSize words which the caller may write, or a negative @c Error code.  For
+     *     @c ALL_OR_NOTHING, the returned value may exceed the buffer size, in which case only the trailing words of
+     *     the write are retained.
+     */
+    ssize_t claim(size_t nWords, std::chrono::milliseconds timeout);
+
+    /**
+     * This function publishes the region between @c writeStartCursor and @c writeEndCursor to the @c Readers, and
+     * wakes any which are blocked waiting for data.
+     */
+    void publish();
+
     /**
      * The tag associated with log entries from this class.
      */
@@ -142,6 +204,9 @@ private:
      * @c Header::WriterEnabledMutex.
      */
     bool m_closed;
+
+    /// The number of words reserved by the last call to @c reserve() which have not yet been committed.
+    size_t m_reservedWords;
 };
 
 template <typename T>
@@ -151,7 +216,8 @@ template <typename T>
 SharedDataStream<T>::Writer::Writer(Policy policy, std::shared_ptr<BufferLayout> bufferLayout) :
         m_policy{policy},
         m_bufferLayout{bufferLayout},
-        m_closed{false} {
+        m_closed{false},
+        m_reservedWords{0} {
     // Note - SharedDataStream::createWriter() holds writerEnableMutex while calling this function.
     auto header = m_bufferLayout->getHeader();
     header->isWriterEnabled = true;
@@ -180,8 +246,123 @@ ssize_t SharedDataStream<T>::Writer::write(const void* buf, size_t nWords, std::
         return Error::CLOSED;
     }
 
+    if (m_reservedWords > 0) {
+        logger::acsdkError(logger::LogEntry(TAG, "writeFailed").d("reason", "uncommittedReservation"));
+        return Error::INVALID;
+    }
+
+    auto claimed = claim(nWords, timeout);
+    if (claimed <= 0) {
+        return claimed;
+    }
+    nWords = claimed;
+
     auto wordsToCopy = nWords;
     auto buf8 = static_cast<const uint8_t*>(buf);
+    if (Policy::ALL_OR_NOTHING == m_policy) {
+        // If we have more data than the SDS can hold and we're not going to be overwriting oldestUnconsumedCursor, we
+        // can safely discard the initial data and just leave the trailing data in the buffer.
+        if (wordsToCopy > m_bufferLayout->getDataSize()) {
+            wordsToCopy = m_bufferLayout->getDataSize();
+            buf8 += (nWords - wordsToCopy) * getWordSize();
+        }
+    }
+
+    // Split it across the wrap.
+    size_t beforeWrap = m_bufferLayout->wordsUntilWrap(header->writeStartCursor);
+    if (beforeWrap > wordsToCopy) {
+        beforeWrap = wordsToCopy;
+    }
+    size_t afterWrap = wordsToCopy - beforeWrap;
+
+    // Copy the two segments.
+    memcpy(m_bufferLayout->getData(header->writeStartCursor), buf8, beforeWrap * getWordSize());
+    if (afterWrap > 0) {
+        memcpy(
+            m_bufferLayout->getData(header->writeStartCursor + beforeWrap),
+            buf8 + beforeWrap * getWordSize(),
+            afterWrap * getWordSize());
+    }
+
+    publish();
+
+    return nWords;
+}
+
+template <typename T>
+ssize_t SharedDataStream<T>::Writer::reserve(Spans* spans, size_t nWords, std::chrono::milliseconds timeout) {
+    if (nullptr == spans) {
+        logger::acsdkError(logger::LogEntry(TAG, "reserveFailed").d("reason", "nullSpans"));
+        return Error::INVALID;
+    }
+    (*spans)[0] = {nullptr, 0};
+    (*spans)[1] = {nullptr, 0};
+
+    if (0 == nWords) {
+        logger::acsdkError(logger::LogEntry(TAG, "reserveFailed").d("reason", "zeroNumWords"));
+        return Error::INVALID;
+    }
+
+    auto header = m_bufferLayout->getHeader();
+    if (!header->isWriterEnabled) {
+        logger::acsdkError(logger::LogEntry(TAG, "reserveFailed").d("reason", "writerDisabled"));
+        return Error::CLOSED;
+    }
+
+    if (m_reservedWords > 0) {
+        logger::acsdkError(logger::LogEntry(TAG, "reserveFailed").d("reason", "uncommittedReservation"));
+        return Error::INVALID;
+    }
+
+    // A reservation must map onto the buffer, so it can never be larger than the buffer.
+    if (nWords > m_bufferLayout->getDataSize()) {
+        nWords = m_bufferLayout->getDataSize();
+    }
+
+    auto claimed = claim(nWords, timeout);
+    if (claimed <= 0) {
+        return claimed;
+    }
+    nWords = claimed;
+
+    size_t beforeWrap = m_bufferLayout->wordsUntilWrap(header->writeStartCursor);
+    if (beforeWrap > nWords) {
+        beforeWrap = nWords;
+    }
+    size_t afterWrap = nWords - beforeWrap;
+
+    (*spans)[0] = {m_bufferLayout->getData(header->writeStartCursor), beforeWrap};
+    if (afterWrap > 0) {
+        (*spans)[1] = {m_bufferLayout->getData(header->writeStartCursor + beforeWrap), afterWrap};
+    }
+    m_reservedWords = nWords;
+
+    return nWords;
+}
+
+template <typename T>
+ssize_t SharedDataStream<T>::Writer::commit(size_t nWords) {
+    if (nWords > m_reservedWords) {
+        logger::acsdkError(logger::LogEntry(TAG, "commitFailed")
+                               .d("reason", "exceedsReservation")
+                               .d("numWords", nWords)
+                               .d("reservedWords", m_reservedWords));
+        return Error::INVALID;
+    }
+    m_reservedWords = 0;
+
+    // Release any part of the reservation which was not used.
+    auto header = m_bufferLayout->getHeader();
+    header->writeEndCursor = header->writeStartCursor + nWords;
+
+    publish();
+
+    return nWords;
+}
+
+template <typename T>
+ssize_t SharedDataStream<T>::Writer::claim(size_t nWords, std::chrono::milliseconds timeout) {
+    auto header = m_bufferLayout->getHeader();
     std::unique_lock<Mutex> backwardSeekLock(header->backwardSeekMutex, std::defer_lock);
     Index writeEnd = header->writeStartCursor + nWords;
 
@@ -189,7 +370,7 @@ ssize_t SharedDataStream<T>::Writer::write(const void* buf, size_t nWords, std::
         case Policy::NONBLOCKABLE:
             // For NONBLOCKABLE, we can truncate the write if it won't fit in the buffer.
             if (nWords > m_bufferLayout->getDataSize()) {
-                wordsToCopy = nWords = m_bufferLayout->getDataSize();
+                nWords = m_bufferLayout->getDataSize();
                 writeEnd = header->writeStartCursor + nWords;
             }
             break;
@@ -238,7 +419,7 @@ ssize_t SharedDataStream<T>::Writer::write(const void* buf, size_t nWords, std::
 
             // For BLOCKING, we can truncate the write if it won't fit in the buffer.
             if (spaceAvailable < nWords) {
-                wordsToCopy = nWords = spaceAvailable;
+                nWords = spaceAvailable;
                 writeEnd = header->writeStartCursor + nWords;
             }
 
@@ -252,30 +433,12 @@ ssize_t SharedDataStream<T>::Writer::write(const void* buf, size_t nWords, std::
         backwardSeekLock.unlock();
     }
 
-    if (Policy::ALL_OR_NOTHING == m_policy) {
-        // If we have more data than the SDS can hold and we're not going to be overwriting oldestUnconsumedCursor, we
-        // can safely discard the initial data and just leave the trailing data in the buffer.
-        if (wordsToCopy > m_bufferLayout->getDataSize()) {
-            wordsToCopy = m_bufferLayout->getDataSize();
-            buf8 += (nWords - wordsToCopy) * getWordSize();
-        }
-    }
-
-    // Split it across the wrap.
-    size_t beforeWrap = m_bufferLayout->wordsUntilWrap(header->writeStartCursor);
-    if (beforeWrap > wordsToCopy) {
-        beforeWrap = wordsToCopy;
-    }
-    size_t afterWrap = wordsToCopy - beforeWrap;
+    return nWords;
+}
 
-    // Copy the two segments.
-    memcpy(m_bufferLayout->getData(header->writeStartCursor), buf8, beforeWrap * getWordSize());
-    if (afterWrap > 0) {
-        memcpy(
-            m_bufferLayout->getData(header->writeStartCursor + beforeWrap),
-            buf8 + beforeWrap * getWordSize(),
-            afterWrap * getWordSize());
-    }
+template <typename T>
+void SharedDataStream<T>::Writer::publish() {
+    auto header = m_bufferLayout->getHeader();
 
     // Advance the write cursor.
     // Note: To prevent a race condition and ensure that readers which block on dataAvailableConditionVariable don't
@@ -283,20 +446,22 @@ ssize_t SharedDataStream<T>::Writer::write(const void* buf, size_t nWords, std::
     // an optimization, we skip that lock for NONBLOCKABLE writers under the assumption that they will be writing
     // continuously, so a missed notification is not significant.
     // Note: As a further optimization, the lock could be omitted if no blocking readers are in use (ACSDK-251).
+    // Note: Traits which declare lockFreeNotify use a condition variable which cannot miss a notify, so the lock is
+    // always skipped for them.
+    bool lockForNotify = (Policy::NONBLOCKABLE != m_policy) && !SdsLockFreeNotify<T>::value;
     std::unique_lock<Mutex> dataAvailableLock(header->dataAvailableMutex, std::defer_lock);
-    if (Policy::NONBLOCKABLE != m_policy) {
+    if (lockForNotify) {
         dataAvailableLock.lock();
     }
     header->writeStartCursor = header->writeEndCursor.load();
-    if (Policy::NONBLOCKABLE != m_policy) {
+    if (lockForNotify) {
         dataAvailableLock.unlock();
     }
 
     // Notify the reader(s).
     // Note: as an optimization, we could skip this if there are no blocking readers (ACSDK-251).
     header->dataAvailableConditionVariable.notify_all();
-
-    return nWords;
+    m_bufferLayout->notifyDataAvailable();
 }
 
 template <typename T>
@@ -319,7 +484,10 @@ void SharedDataStream<T>::Writer::close() {
         header->hasWriterBeenClosed = true;
 
         header->dataAvailableConditionVariable.notify_all();
+        dataAvailableLock.unlock();
+        m_bufferLayout->notifyDataAvailable();
     }
+    m_bufferLayout->setSpaceAvailableCallback(nullptr);
     m_closed = true;
 }
 
@@ -328,6 +496,14 @@ size_t SharedDataStream<T>::Writer::getWordSize() const {
     return m_bufferLayout->getHeader()->wordSize;
 }
 
+template <typename T>
+void SharedDataStream<T>::Writer::setSpaceAvailableCallback(std::function<void()> callback) {
+    if (m_closed) {
+        return;
+    }
+    m_bufferLayout->setSpaceAvailableCallback(std::move(callback));
+}
+
 template <typename T>
 std::string SharedDataStream<T>::Writer::errorToString(Error error) {
     switch (error) {
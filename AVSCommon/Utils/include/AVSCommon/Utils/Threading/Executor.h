@@ -19,14 +19,17 @@
 #include <atomic>
 #include <condition_variable>
 #include <chrono>
-#include <deque>
 #include <functional>
 #include <future>
 #include <memory>
 #include <mutex>
+#include <type_traits>
 #include <utility>
 
+#include "AVSCommon/Utils/Threading/PooledTaskQueue.h"
+#include "AVSCommon/Utils/Threading/SmallTask.h"
 #include "AVSCommon/Utils/Threading/TaskThread.h"
+#include "AVSCommon/Utils/Threading/WorkStealingThreadPool.h"
 #include "AVSCommon/Utils/Power/PowerResource.h"
 
 namespace alexaClientSDK {
@@ -36,6 +39,12 @@ namespace threading {
 
 /**
  * An Executor is used to run callable types asynchronously.
+ *
+ * Tasks are always run one at a time, in the order they are queued.  By default each Executor runs its tasks on a
+ * @c TaskThread leased from the @c ThreadPool.  An Executor may instead be constructed with a
+ * @c WorkStealingThreadPool, in which case it acts as a strand on that pool: it borrows a pool thread only while it has
+ * queued tasks, so many Executors can share a small, fixed number of threads.  When the SDK is built with
+ * @c WORK_STEALING_EXECUTOR, the default constructor uses the default @c WorkStealingThreadPool.
  */
 class Executor {
 public:
@@ -47,6 +56,13 @@ public:
      */
     Executor(const std::chrono::milliseconds& delayExit = std::chrono::milliseconds(1000));
 
+    /**
+     * Constructs an Executor which runs its tasks as a strand on a @c WorkStealingThreadPool.
+     *
+     * @param threadPool The pool to run tasks on.  If @c nullptr, the Executor uses its own @c TaskThread.
+     */
+    explicit Executor(std::shared_ptr<WorkStealingThreadPool> threadPool);
+
     /**
      * Destructs an Executor.
      */
@@ -75,6 +91,19 @@ public:
     template <typename Task, typename... Args>
     auto submitToFront(Task task, Args&&... args) -> std::future<decltype(task(args...))>;
 
+    /**
+     * Queues a callable type to be executed on an Executor thread, without providing a way to wait for its result.
+     *
+     * Unlike @c submit(), this does not allocate a @c std::future or @c std::packaged_task.  Once the Executor has
+     * warmed up, queuing a callable of up to @c SmallTask::INLINE_SIZE bytes does not allocate at all.  Exceptions
+     * thrown by @c task are logged and discarded, as they would be if @c task was submitted and its future ignored.
+     *
+     * @param task A callable type representing a task.
+     * @return @c true if the task was queued, @c false if the Executor is shutdown.
+     */
+    template <typename Task>
+    bool execute(Task&& task);
+
     /**
      * Waits for any previously submitted tasks to complete.
      */
@@ -88,7 +117,42 @@ public:
 
 private:
     /// The queue type to use for holding tasks.
-    using Queue = std::deque<std::function<void()>>;
+    using Queue = PooledTaskQueue;
+
+    /// Where to queue a task.
+    enum class QueuePosition {
+        /// Queue the task ahead of all queued tasks.
+        FRONT,
+        /// Queue the task behind all queued tasks.
+        BACK
+    };
+
+    /**
+     * Wraps a task queued by @c execute(), catching the exceptions which @c submit() would have stored in the future.
+     *
+     * @tparam Task The type of the wrapped callable.
+     */
+    template <typename Task>
+    struct ExecutedTask {
+        /// Runs the wrapped task, logging any exception it throws.
+        void operator()();
+
+        /// The wrapped callable.
+        Task task;
+    };
+
+    /**
+     * Logs an exception thrown by a task queued by @c execute().
+     *
+     * @param what The description of the exception, or @c nullptr if it is not a @c std::exception.
+     */
+    static void logExecutedTaskException(const char* what);
+
+    /// State shared between an Executor and the strand tasks it submits to its @c WorkStealingThreadPool.
+    struct StrandState {
+        /// Set if the Executor was destroyed by one of its own tasks, after which the strand must not touch it.
+        std::atomic_bool executorDestroyed{false};
+    };
 
     /**
      * Executes the next job in the queue.
@@ -110,20 +174,45 @@ private:
      *
      * @returns A function that represents a new task. The function will be empty if the queue has no job.
      */
-    std::function<void()> pop();
+    SmallTask pop();
+
+    /**
+     * Pushes a task on the queue, and starts a thread to run it if needed.
+     *
+     * @param position Whether to push to the front or the back of the queue.
+     * @param task The task to push.
+     * @return @c false if the queue is shutdown and the task was dropped, else @c true.
+     */
+    bool pushTask(QueuePosition position, SmallTask task);
+
+    /**
+     * Starts running queued tasks, either on @c m_taskThread or as a strand on @c m_threadPool.  Must be called with
+     * @c m_queueMutex held.
+     *
+     * @return Whether tasks will be run.
+     */
+    bool startRunning();
+
+    /**
+     * Runs a batch of queued tasks on a @c m_threadPool thread, then either resubmits itself if more tasks are queued
+     * or marks the strand as stopped.  If a task destroys this Executor, returns as soon as that task completes.
+     *
+     * @param strandState The @c StrandState of this Executor, which remains valid if the Executor is destroyed.
+     */
+    void runStrand(std::shared_ptr<StrandState> strandState);
 
     /**
      * Pushes a task on the the queue. If the queue is shutdown, the task will be dropped, and an invalid
      * future will be returned.
      *
-     * @param front If @c true, push to the front of the queue, else push to the back.
+     * @param position Whether to push to the front or the back of the queue.
      * @param task A task to push to the front or back of the queue.
      * @param args The arguments to call the task with.
      * @returns A @c std::future to access the return value of the task. If the queue is shutdown, the task will be
      *     dropped, and an invalid future will be returned.
      */
     template <typename Task, typename... Args>
-    auto pushTo(bool front, Task task, Args&&... args) -> std::future<decltype(task(args...))>;
+    auto pushTo(QueuePosition position, Task task, Args&&... args) -> std::future<decltype(task(args...))>;
 
     /// The queue of tasks
     Queue m_queue;
@@ -149,20 +238,24 @@ private:
     /// The id of this instance.
     const uint64_t m_id;
 
+    /// The pool this executor runs on as a strand, or @c nullptr if tasks run on @c m_taskThread.
+    std::shared_ptr<WorkStealingThreadPool> m_threadPool;
+
+    /// State shared with the strand tasks submitted to @c m_threadPool, or @c nullptr if there is no pool.
+    std::shared_ptr<StrandState> m_strandState;
+
     /// The thread to execute tasks on. The thread must be declared last to be destructed first.
     TaskThread m_taskThread;
 };
 
 template <typename Task, typename... Args>
 auto Executor::submit(Task task, Args&&... args) -> std::future<decltype(task(args...))> {
-    bool front = false;
-    return pushTo(front, std::forward<Task>(task), std::forward<Args>(args)...);
+    return pushTo(QueuePosition::BACK, std::forward<Task>(task), std::forward<Args>(args)...);
 }
 
 template <typename Task, typename... Args>
 auto Executor::submitToFront(Task task, Args&&... args) -> std::future<decltype(task(args...))> {
-    bool front = true;
-    return pushTo(front, std::forward<Task>(task), std::forward<Args>(args)...);
+    return pushTo(QueuePosition::FRONT, std::forward<Task>(task), std::forward<Args>(args)...);
 }
 
 /**
@@ -205,7 +298,7 @@ inline void forwardPromise<void>(std::shared_ptr<std::promise<void>> promise, st
 }
 
 template <typename Task, typename... Args>
-auto Executor::pushTo(bool front, Task task, Args&&... args) -> std::future<decltype(task(args...))> {
+auto Executor::pushTo(QueuePosition position, Task task, Args&&... args) -> std::future<decltype(task(args...))> {
     // Remove arguments from the tasks type by binding the arguments to the task.
     auto boundTask = std::bind(std::forward<Task>(task), std::forward<Args>(args)...);
 
@@ -245,31 +338,34 @@ auto Executor::pushTo(bool front, Task task, Args&&... args) -> std::future<decl
     // Release our local reference to packaged task so that the only remaining reference is inside the lambda.
     packaged_task.reset();
 
-    {
-        bool restart = false;
-        std::lock_guard<std::mutex> queueLock{m_queueMutex};
-        if (!m_shutdown) {
-            restart = !m_threadRunning;
-            if (m_powerResource) {
-                m_powerResource->acquire();
-            }
-            m_queue.emplace(front ? m_queue.begin() : m_queue.end(), std::move(translated_task));
-        } else {
-            using FutureType = decltype(task(args...));
-            return std::future<FutureType>();
-        }
-
-        if (restart) {
-            // Restart task thread.
-            m_taskThread.start(std::bind(&Executor::runNext, this));
-            m_threadRunning = true;
-        }
+    if (!pushTask(position, std::move(translated_task))) {
+        using FutureType = decltype(task(args...));
+        return std::future<FutureType>();
     }
-
-    m_delayedCondition.notify_one();
     return cleanupFuture;
 }
 
+template <typename Task>
+bool Executor::execute(Task&& task) {
+    using TaskType = typename std::decay<Task>::type;
+    return pushTask(QueuePosition::BACK, SmallTask(ExecutedTask<TaskType>{std::forward<Task>(task)}));
+}
+
+template <typename Task>
+void Executor::ExecutedTask<Task>::operator()() {
+#if __cpp_exceptions || defined(__EXCEPTIONS)
+    try {
+#endif
+        task();
+#if __cpp_exceptions || defined(__EXCEPTIONS)
+    } catch (const std::exception& e) {
+        logExecutedTaskException(e.what());
+    } catch (...) {
+        logExecutedTaskException(nullptr);
+    }
+#endif
+}
+
 }  // namespace threading
 }  // namespace utils
 }  // namespace avsCommon
@@ -0,0 +1,126 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_POOLEDTASKQUEUE_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_POOLEDTASKQUEUE_H_
+
+#include <cstddef>
+
+#include "AVSCommon/Utils/Threading/SmallTask.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+
+/// The default number of free nodes kept by a @c PooledTaskQueue.
+static const size_t DEFAULT_POOLED_TASK_QUEUE_FREE_NODES = 64;
+
+/**
+ * A queue of @c SmallTask which recycles its nodes.  Nodes released by @c popFront() and @c clear() are kept on a free
+ * list, up to a configurable limit, and reused by later pushes, so a queue whose depth stays within that limit does not
+ * allocate once it has warmed up.
+ *
+ * This class is not thread-safe.
+ */
+class PooledTaskQueue {
+public:
+    /**
+     * Constructor.
+     *
+     * @param maxFreeNodes The maximum number of unused nodes to keep for reuse.
+     */
+    explicit PooledTaskQueue(size_t maxFreeNodes = DEFAULT_POOLED_TASK_QUEUE_FREE_NODES);
+
+    /// Destructor.
+    ~PooledTaskQueue();
+
+    /**
+     * Adds a task to the back of the queue.
+     *
+     * @param task The task to add.
+     */
+    void pushBack(SmallTask task);
+
+    /**
+     * Adds a task to the front of the queue.
+     *
+     * @param task The task to add.
+     */
+    void pushFront(SmallTask task);
+
+    /**
+     * Removes and returns the task at the front of the queue.
+     *
+     * @return The task at the front of the queue, or an empty task if the queue is empty.
+     */
+    SmallTask popFront();
+
+    /// Returns whether the queue is empty.
+    bool empty() const;
+
+    /// Removes all tasks from the queue.
+    void clear();
+
+    PooledTaskQueue(const PooledTaskQueue&) = delete;
+    PooledTaskQueue& operator=(const PooledTaskQueue&) = delete;
+
+private:
+    /// A node in the queue or in the free list.
+    struct Node {
+        /// The queued task.
+        SmallTask task;
+
+        /// The next node.
+        Node* next;
+    };
+
+    /**
+     * Takes a node from the free list, or allocates a new one.
+     *
+     * @param task The task to store in the node.
+     * @return The node.
+     */
+    Node* obtainNode(SmallTask task);
+
+    /**
+     * Destroys the task in @c node, then returns the node to the free list or deletes it.
+     *
+     * @param node The node to release.
+     */
+    void releaseNode(Node* node);
+
+    /// The front of the queue.
+    Node* m_head;
+
+    /// The back of the queue.
+    Node* m_tail;
+
+    /// The free list.
+    Node* m_freeNodes;
+
+    /// The number of nodes in the free list.
+    size_t m_freeCount;
+
+    /// The maximum number of nodes in the free list.
+    const size_t m_maxFreeNodes;
+};
+
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_POOLEDTASKQUEUE_H_
@@ -0,0 +1,241 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_SMALLTASK_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_SMALLTASK_H_
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+
+/**
+ * A move-only callable wrapper for tasks with the signature @c void(), similar to @c std::function<void()>.
+ *
+ * Callables of up to @c INLINE_SIZE bytes which can be moved without throwing are stored inside the @c SmallTask
+ * itself, so wrapping a typical lambda which captures a few pointers does not allocate.  Larger callables are stored on
+ * the heap.  Unlike @c std::function, the wrapped callable does not need to be copyable.
+ */
+class SmallTask {
+public:
+    /// The number of bytes available to store a callable without allocating.
+    static constexpr size_t INLINE_SIZE = 6 * sizeof(void*);
+
+    /// Constructs an empty task.
+    SmallTask() noexcept;
+
+    /// Constructs an empty task.
+    SmallTask(std::nullptr_t) noexcept;
+
+    /**
+     * Constructs a task which wraps @c callable.
+     *
+     * @param callable The callable to wrap.
+     */
+    template <
+        typename Callable,
+        typename = typename std::enable_if<
+            !std::is_same<typename std::decay<Callable>::type, SmallTask>::value &&
+            !std::is_same<typename std::decay<Callable>::type, std::nullptr_t>::value>::type>
+    SmallTask(Callable&& callable);
+
+    /**
+     * Move constructor.  @c other is left empty.
+     *
+     * @param other The task to move from.
+     */
+    SmallTask(SmallTask&& other) noexcept;
+
+    /**
+     * Move assignment.  @c other is left empty.
+     *
+     * @param other The task to move from.
+     * @return This task.
+     */
+    SmallTask& operator=(SmallTask&& other) noexcept;
+
+    /// Destructor.
+    ~SmallTask();
+
+    /// Invokes the wrapped callable.  Must not be called on an empty task.
+    void operator()();
+
+    /// Returns whether this task holds a callable.
+    explicit operator bool() const noexcept;
+
+    /// Returns whether the wrapped callable is stored inline, i.e. without a heap allocation.
+    bool isInline() const noexcept;
+
+    SmallTask(const SmallTask&) = delete;
+    SmallTask& operator=(const SmallTask&) = delete;
+
+private:
+    /// The type-specific operations on the stored callable.
+    struct Operations {
+        /// Invokes the callable in @c storage.
+        void (*invoke)(void* storage);
+
+        /// Move constructs the callable in @c from into @c to, and destroys the callable in @c from.
+        void (*relocate)(void* from, void* to);
+
+        /// Destroys the callable in @c storage.
+        void (*destroy)(void* storage);
+
+        /// Whether the callable is stored inline.
+        bool isInline;
+    };
+
+    /// Operations for a callable of type @c Callable stored inline.
+    template <typename Callable>
+    struct InlineOperations {
+        static void invoke(void* storage) {
+            (*static_cast<Callable*>(storage))();
+        }
+        static void relocate(void* from, void* to) {
+            new (to) Callable(std::move(*static_cast<Callable*>(from)));
+            static_cast<Callable*>(from)->~Callable();
+        }
+        static void destroy(void* storage) {
+            static_cast<Callable*>(storage)->~Callable();
+        }
+        static const Operations operations;
+    };
+
+    /// Operations for a callable of type @c Callable stored on the heap, with a pointer to it stored inline.
+    template <typename Callable>
+    struct HeapOperations {
+        static void invoke(void* storage) {
+            (**static_cast<Callable**>(storage))();
+        }
+        static void relocate(void* from, void* to) {
+            *static_cast<Callable**>(to) = *static_cast<Callable**>(from);
+        }
+        static void destroy(void* storage) {
+            delete *static_cast<Callable**>(storage);
+        }
+        static const Operations operations;
+    };
+
+    /// Whether a callable of type @c Callable can be stored inline.
+    template <typename Callable>
+    struct FitsInline
+            : std::integral_constant<
+                  bool,
+                  sizeof(Callable) <= INLINE_SIZE && alignof(Callable) <= alignof(std::max_align_t) &&
+                      std::is_nothrow_move_constructible<Callable>::value> {};
+
+    /// Stores @c callable inline.
+    template <typename Callable, typename Argument>
+    void store(Argument&& callable, std::true_type);
+
+    /// Stores @c callable on the heap.
+    template <typename Callable, typename Argument>
+    void store(Argument&& callable, std::false_type);
+
+    /// Storage for the callable, or for a pointer to it.
+    typename std::aligned_storage<INLINE_SIZE, alignof(std::max_align_t)>::type m_storage;
+
+    /// The operations for the stored callable, or @c nullptr if this task is empty.
+    const Operations* m_operations;
+};
+
+template <typename Callable>
+const SmallTask::Operations SmallTask::InlineOperations<Callable>::operations = {
+    &SmallTask::InlineOperations<Callable>::invoke,
+    &SmallTask::InlineOperations<Callable>::relocate,
+    &SmallTask::InlineOperations<Callable>::destroy,
+    true};
+
+template <typename Callable>
+const SmallTask::Operations SmallTask::HeapOperations<Callable>::operations = {
+    &SmallTask::HeapOperations<Callable>::invoke,
+    &SmallTask::HeapOperations<Callable>::relocate,
+    &SmallTask::HeapOperations<Callable>::destroy,
+    false};
+
+inline SmallTask::SmallTask() noexcept : m_operations{nullptr} {
+}
+
+inline SmallTask::SmallTask(std::nullptr_t) noexcept : m_operations{nullptr} {
+}
+
+template <typename Callable, typename>
+SmallTask::SmallTask(Callable&& callable) : m_operations{nullptr} {
+    using CallableType = typename std::decay<Callable>::type;
+    store<CallableType>(std::forward<Callable>(callable), FitsInline<CallableType>());
+}
+
+template <typename Callable, typename Argument>
+void SmallTask::store(Argument&& callable, std::true_type) {
+    new (&m_storage) Callable(std::forward<Argument>(callable));
+    m_operations = &InlineOperations<Callable>::operations;
+}
+
+template <typename Callable, typename Argument>
+void SmallTask::store(Argument&& callable, std::false_type) {
+    *reinterpret_cast<Callable**>(&m_storage) = new Callable(std::forward<Argument>(callable));
+    m_operations = &HeapOperations<Callable>::operations;
+}
+
+inline SmallTask::SmallTask(SmallTask&& other) noexcept : m_operations{other.m_operations} {
+    if (m_operations) {
+        m_operations->relocate(&other.m_storage, &m_storage);
+        other.m_operations = nullptr;
+    }
+}
+
+inline SmallTask& SmallTask::operator=(SmallTask&& other) noexcept {
+    if (this != &other) {
+        if (m_operations) {
+            m_operations->destroy(&m_storage);
+        }
+        m_operations = other.m_operations;
+        if (m_operations) {
+            m_operations->relocate(&other.m_storage, &m_storage);
+            other.m_operations = nullptr;
+        }
+    }
+    return *this;
+}
+
+inline SmallTask::~SmallTask() {
+    if (m_operations) {
+        m_operations->destroy(&m_storage);
+    }
+}
+
+inline void SmallTask::operator()() {
+    m_operations->invoke(&m_storage);
+}
+
+inline SmallTask::operator bool() const noexcept {
+    return m_operations != nullptr;
+}
+
+inline bool SmallTask::isInline() const noexcept {
+    return m_operations && m_operations->isInline;
+}
+
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_SMALLTASK_H_
@@ -0,0 +1,171 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_WORKSTEALINGTHREADPOOL_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_WORKSTEALINGTHREADPOOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "AVSCommon/Utils/Threading/SmallTask.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+
+/// The minimum number of threads used by the default @c WorkStealingThreadPool.
+static const size_t MIN_WORK_STEALING_THREADS = 2;
+
+/**
+ * The @c WorkStealingThreadPool runs tasks on a fixed set of worker threads which are created up front and live as long
+ * as the pool.  Each worker owns a task queue.  Tasks submitted from a worker thread go to that worker's queue, and
+ * tasks submitted from any other thread go to a shared injection queue.  A worker runs tasks from its own queue first,
+ * then from the injection queue, and finally steals from the back of another worker's queue.  Workers with nothing to
+ * do sleep until new work is submitted.
+ *
+ * The pool gives no ordering guarantees between tasks.  Components which need ordered execution should use an
+ * @c Executor constructed with a @c WorkStealingThreadPool, which runs its tasks in order as a strand on the pool.
+ *
+ * Because the number of threads is fixed, tasks should not block for long periods.  In particular, a task which waits
+ * for another task on the same pool may wait forever if every worker is blocked in the same way.
+ */
+class WorkStealingThreadPool {
+public:
+    /// The type of task run by the pool.
+    using Task = SmallTask;
+
+    /**
+     * Constructs a pool and starts its worker threads.
+     *
+     * @param numThreads The number of worker threads.  If 0, the number of hardware threads is used, with a minimum
+     *     of @c MIN_WORK_STEALING_THREADS.
+     */
+    explicit WorkStealingThreadPool(size_t numThreads = 0);
+
+    /**
+     * Destructs the pool.  Tasks which have already been submitted are run, then the worker threads are joined.
+     */
+    ~WorkStealingThreadPool();
+
+    /**
+     * Submits a task to be run on one of the worker threads.
+     *
+     * @param task The task to run.
+     * @return @c true if the task was accepted, @c false if @c task is empty or the pool is shutting down.
+     */
+    bool submit(Task task);
+
+    /**
+     * Obtain the number of worker threads in the pool.
+     *
+     * @return The number of worker threads.
+     */
+    size_t getNumThreads() const;
+
+    /**
+     * Obtain statistics for the pool.
+     *
+     * @param tasksExecuted The total number of tasks run by the pool.
+     * @param tasksStolen The number of tasks that were run by a worker other than the one they were submitted to.
+     */
+    void getStats(uint64_t& tasksExecuted, uint64_t& tasksStolen);
+
+    /**
+     * Obtain a shared pointer to the default singleton pool.
+     *
+     * @return A shared pointer to the pool.
+     */
+    static std::shared_ptr<WorkStealingThreadPool> getDefaultThreadPool();
+
+private:
+    /// A queue of tasks and the mutex protecting it.
+    struct TaskQueue {
+        /// The mutex protecting @c tasks.
+        std::mutex mutex;
+
+        /// The queued tasks.
+        std::deque<Task> tasks;
+    };
+
+    /**
+     * The main loop of a worker thread.
+     *
+     * @param index The index of the worker.
+     */
+    void runWorker(size_t index);
+
+    /**
+     * Takes the next task for a worker, from its own queue, the injection queue, or another worker's queue.
+     *
+     * @param index The index of the worker looking for a task.
+     * @param[out] task The task, if one was found.
+     * @return @c true if a task was found.
+     */
+    bool takeTask(size_t index, Task* task);
+
+    /**
+     * Removes a task from a queue.
+     *
+     * @param queue The queue to take the task from.
+     * @param fromFront Whether to take the oldest task, or the newest.
+     * @param[out] task The task, if the queue was not empty.
+     * @return @c true if a task was taken.
+     */
+    bool popFrom(TaskQueue& queue, bool fromFront, Task* task);
+
+    /// One queue per worker thread.
+    std::vector<std::unique_ptr<TaskQueue>> m_workerQueues;
+
+    /// The queue for tasks submitted from threads which are not part of this pool.
+    TaskQueue m_injectionQueue;
+
+    /// The number of tasks which have been submitted and not yet taken by a worker.
+    std::atomic<size_t> m_pending;
+
+    /// The number of workers sleeping, or about to sleep, on @c m_workAvailable.
+    std::atomic<size_t> m_idle;
+
+    /// Whether the pool is shutting down.
+    std::atomic<bool> m_stop;
+
+    /// Metrics for executed tasks.
+    std::atomic<uint64_t> m_executed;
+
+    /// Metrics for stolen tasks.
+    std::atomic<uint64_t> m_stolen;
+
+    /// A mutex used with @c m_workAvailable to put idle workers to sleep.
+    std::mutex m_idleMutex;
+
+    /// The condition variable idle workers sleep on.
+    std::condition_variable m_workAvailable;
+
+    /// The worker threads.
+    std::vector<std::thread> m_threads;
+};
+
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_THREADING_WORKSTEALINGTHREADPOOL_H_
@@ -0,0 +1,265 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMERWHEEL_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMERWHEEL_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+/**
+ * A hierarchical timing wheel which expires any number of timers from a single thread.
+ *
+ * Time is divided into ticks of @c TICK_DURATION.  Level 0 of the wheel has a slot for each of the next
+ * @c SLOTS_PER_LEVEL ticks, and each higher level has a slot for @c SLOTS_PER_LEVEL times as many ticks as a slot of
+ * the level below.  An entry is linked into the slot which covers its expiry, and whenever the wheel reaches the start
+ * of a higher level slot, the entries in it are redistributed to the lower levels.  Entries further out than the top
+ * level covers are parked in the top level, and redistributed until they are in range.
+ *
+ * Slots are intrusive doubly linked lists, so scheduling and cancelling an entry take constant time and do not
+ * allocate.  The wheel thread sleeps until the next non-empty slot is due, rather than waking up on every tick.
+ *
+ * Expired entries are queued in expiry order, and their callbacks are called by a worker thread, one at a time.  If
+ * a callback holds up the queue for longer than @c CALLBACK_GRACE_PERIOD (for example because it waits for another
+ * timer), another worker is started, so that a blocked callback does not stop other entries from expiring.  Workers
+ * beyond the first exit when they run out of work, so with short callbacks the wheel uses two threads in all.
+ *
+ * Entries never expire early, and normally expire at most one tick late.
+ */
+class TimerWheel {
+public:
+    /// The duration of a tick of the wheel.
+    static constexpr std::chrono::milliseconds TICK_DURATION{1};
+
+    /// The number of bits of a tick number used to index the slots of one level.
+    static constexpr int BITS_PER_LEVEL = 6;
+
+    /// The number of slots in each level.
+    static constexpr size_t SLOTS_PER_LEVEL = 1 << BITS_PER_LEVEL;
+
+    /// The number of levels.  Entries due within 2^(6*6) ticks (about 795 days) are placed directly.
+    static constexpr size_t NUM_LEVELS = 6;
+
+    /// How long the callback queue may be held up before another worker is started.
+    static constexpr std::chrono::milliseconds CALLBACK_GRACE_PERIOD{5};
+
+    /**
+     * A timer scheduled on a @c TimerWheel.  The owner keeps the @c Entry alive until it has been cancelled, or has
+     * expired and its callback has returned.
+     */
+    class Entry {
+    public:
+        /**
+         * Constructor.
+         *
+         * @param callback The function to call on the wheel thread when the entry expires.
+         */
+        explicit Entry(std::function<void()> callback);
+
+    private:
+        friend class TimerWheel;
+
+        /// The function to call when the entry expires.
+        std::function<void()> m_callback;
+
+        /// The tick at which the entry expires.
+        uint64_t m_expiry;
+
+        /// The previous entry in the list the entry is linked into.
+        Entry* m_prev;
+
+        /// The next entry in the list the entry is linked into, or @c nullptr if it is the last entry.
+        Entry* m_next;
+
+        /// The head of the list the entry is linked into, or @c nullptr if it is not scheduled.
+        Entry** m_list;
+
+        /// The level of the slot the entry is linked into, or @c NUM_LEVELS for the list of expired entries.
+        size_t m_level;
+
+        /// Whether the callback of the entry is running.
+        bool m_isRunning;
+
+        /// The thread running the callback of the entry, if @c m_isRunning.
+        std::thread::id m_runningThread;
+    };
+
+    /**
+     * Obtain the @c TimerWheel shared by the process.  The wheel is created when first needed, and its thread stops
+     * once the last reference is released.
+     *
+     * @return The shared @c TimerWheel.
+     */
+    static std::shared_ptr<TimerWheel> getDefault();
+
+    /// Constructor.  Starts the wheel thread.
+    TimerWheel();
+
+    /**
+     * Destructor.  Stops the wheel thread and the workers.  Entries which have not expired, or whose callbacks have not
+     * been called yet, are dropped.  Must not be called from a callback.
+     */
+    ~TimerWheel();
+
+    /**
+     * Schedules an entry to expire at the given time.  An entry which is already scheduled is rescheduled.
+     *
+     * @param entry The entry to schedule.
+     * @param deadline The time at which @c entry should expire.  Entries with a deadline in the past expire on the
+     *     next tick.
+     */
+    void schedule(Entry* entry, std::chrono::steady_clock::time_point deadline);
+
+    /**
+     * Cancels an entry.  If the callback of @c entry is running, this blocks until it returns, unless called from the
+     * callback itself.  On return, @c entry is not scheduled.
+     *
+     * @param entry The entry to cancel.
+     */
+    void cancel(Entry* entry);
+
+    /**
+     * Obtain the number of entries which are scheduled and have not expired yet.
+     *
+     * @return The number of scheduled entries.
+     */
+    size_t getNumScheduled() const;
+
+private:
+    /// The main loop of the wheel thread.
+    void run();
+
+    /// The main loop of a worker thread.
+    void runWorker();
+
+    /// Joins the worker threads which have exited.  @c m_mutex must be held.
+    void joinExitedWorkersLocked();
+
+    /**
+     * Links an entry into the slot for its expiry.  @c m_mutex must be held.
+     *
+     * @param entry The entry, which is not linked into any list.
+     */
+    void insertLocked(Entry* entry);
+
+    /**
+     * Appends an entry to the queue of expired entries.  @c m_mutex must be held.
+     *
+     * @param entry The entry, which is not linked into any list.
+     */
+    void enqueueExpiredLocked(Entry* entry);
+
+    /**
+     * Unlinks an entry from the list it is in.  @c m_mutex must be held.
+     *
+     * @param entry The entry, which is linked into a list.
+     */
+    void unlinkLocked(Entry* entry);
+
+    /**
+     * Advances the wheel up to the given tick, redistributing entries and queueing the expired ones.
+     * Stretches where nothing is scheduled are skipped.  @c m_mutex must be held.
+     *
+     * @param tick The tick to advance to.
+     */
+    void advanceLocked(uint64_t tick);
+
+    /**
+     * Finds the next tick at which the wheel has work to do.  @c m_mutex must be held.
+     *
+     * @return The next tick with work, or @c UINT64_MAX if nothing is scheduled.
+     */
+    uint64_t nextEventTickLocked() const;
+
+    /**
+     * Converts a time to the first tick which does not start before it.
+     *
+     * @param time The time to convert.
+     * @return The tick.
+     */
+    uint64_t toTick(std::chrono::steady_clock::time_point time) const;
+
+    /// The time at which tick 0 starts.
+    const std::chrono::steady_clock::time_point m_epoch;
+
+    /// Serializes access to the members below.
+    mutable std::mutex m_mutex;
+
+    /// Notified to wake the wheel thread.
+    std::condition_variable m_wakeCondition;
+
+    /// Notified to wake an idle worker.
+    std::condition_variable m_workerCondition;
+
+    /// Notified when a callback returns.
+    std::condition_variable m_callbackDone;
+
+    /// The last tick the wheel has processed.
+    uint64_t m_currentTick;
+
+    /// The tick the wheel thread is sleeping until, or 0 if it is not sleeping.
+    uint64_t m_wakeTick;
+
+    /// The heads of the slot lists, by level.
+    Entry* m_slots[NUM_LEVELS][SLOTS_PER_LEVEL];
+
+    /// The number of entries in each level.
+    size_t m_levelCounts[NUM_LEVELS];
+
+    /// The entries which have expired, but whose callbacks have not been called yet, in order of expiry.
+    Entry* m_expired;
+
+    /// The last entry in @c m_expired.
+    Entry* m_expiredTail;
+
+    /// The last time a worker took an entry from @c m_expired, or @c m_expired became non-empty.
+    std::chrono::steady_clock::time_point m_lastProgress;
+
+    /// The worker threads, including those which have exited but have not been joined yet.
+    std::vector<std::thread> m_workers;
+
+    /// The ids of the worker threads which have exited, for the wheel thread to join.
+    std::vector<std::thread::id> m_exitedWorkers;
+
+    /// The number of worker threads which have not exited.
+    size_t m_numWorkers;
+
+    /// The number of worker threads waiting for work.
+    size_t m_numIdleWorkers;
+
+    /// Whether the wheel is shutting down.
+    bool m_stop;
+
+    /// The wheel thread.  Declared last so that it starts after everything else is initialized.
+    std::thread m_thread;
+};
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMERWHEEL_H_
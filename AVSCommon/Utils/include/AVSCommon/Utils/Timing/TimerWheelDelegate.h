@@ -0,0 +1,113 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMERWHEELDELEGATE_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMERWHEELDELEGATE_H_
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+#include <AVSCommon/SDKInterfaces/Timing/TimerDelegateInterface.h>
+
+#include "AVSCommon/Utils/Timing/TimerWheel.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+/**
+ * A @c TimerDelegateInterface which schedules its task on a shared @c TimerWheel instead of running a thread of its
+ * own.  The task is called on the wheel thread.
+ */
+class TimerWheelDelegate : public sdkInterfaces::timing::TimerDelegateInterface {
+public:
+    /// @name TimerDelegateInterface Functions
+    /// @{
+    void start(
+        std::chrono::nanoseconds delay,
+        std::chrono::nanoseconds period,
+        PeriodType periodType,
+        size_t maxCount,
+        std::function<void()> task) override;
+    void stop() override;
+    bool activate() override;
+    bool isActive() const override;
+    /// @}
+
+    /**
+     * Constructor.
+     *
+     * @param wheel The @c TimerWheel to schedule the task on.
+     */
+    explicit TimerWheelDelegate(std::shared_ptr<TimerWheel> wheel);
+
+    /// Destructor.
+    ~TimerWheelDelegate() override;
+
+private:
+    /// The parameters and progress of a call to @c start().
+    struct Schedule {
+        /// The time between task calls.
+        std::chrono::nanoseconds period;
+
+        /// The type of period.
+        PeriodType periodType;
+
+        /// The desired number of task calls.
+        size_t maxCount;
+
+        /// The task.
+        std::function<void()> task;
+
+        /// The number of times the timer has expired.
+        size_t count;
+
+        /// The time the timer is due to expire next.
+        std::chrono::steady_clock::time_point deadline;
+
+        /// Whether the task overran the period, so the next call should be skipped.
+        bool offSchedule;
+    };
+
+    /// Called on the wheel thread when @c m_entry expires.
+    void onExpired();
+
+    /// The wheel the task is scheduled on.
+    std::shared_ptr<TimerWheel> m_wheel;
+
+    /// The entry scheduled on @c m_wheel.
+    TimerWheel::Entry m_entry;
+
+    /// The mutex for synchronizing calls into the @c TimerWheelDelegate.
+    std::mutex m_callMutex;
+
+    /// The mutex protecting @c m_schedule, which is also used by the wheel thread.
+    std::mutex m_scheduleMutex;
+
+    /// The schedule being run, or @c nullptr if the timer is not running.
+    std::shared_ptr<Schedule> m_schedule;
+
+    /// Flag which indicates that the timer is active.
+    std::atomic<bool> m_running;
+};
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMERWHEELDELEGATE_H_
@@ -0,0 +1,58 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMERWHEELDELEGATEFACTORY_H_
+#define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMERWHEELDELEGATEFACTORY_H_
+
+#include <memory>
+#include <AVSCommon/SDKInterfaces/Timing/TimerDelegateFactoryInterface.h>
+
+#include "AVSCommon/Utils/Timing/TimerWheel.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+/**
+ * A factory for @c TimerWheelDelegate, which drives every @c Timer it creates delegates for from the thread of a single
+ * @c TimerWheel, instead of a thread per @c Timer like @c TimerDelegateFactory.
+ */
+class TimerWheelDelegateFactory : public avsCommon::sdkInterfaces::timing::TimerDelegateFactoryInterface {
+public:
+    /**
+     * Constructor.
+     *
+     * @param wheel The @c TimerWheel to schedule timers on, or @c nullptr to use @c TimerWheel::getDefault().
+     */
+    explicit TimerWheelDelegateFactory(std::shared_ptr<TimerWheel> wheel = nullptr);
+
+    /// @name TimerDelegateFactoryInterface Functions
+    /// @{
+    bool supportsLowPowerMode() override;
+    std::unique_ptr<sdkInterfaces::timing::TimerDelegateInterface> getTimerDelegate() override;
+    /// @}
+
+private:
+    /// The wheel shared by the delegates.
+    std::shared_ptr<TimerWheel> m_wheel;
+};
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
+
+#endif  // ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_TIMING_TIMERWHEELDELEGATEFACTORY_H_
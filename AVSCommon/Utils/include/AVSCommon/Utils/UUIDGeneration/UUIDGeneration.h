@@ -16,6 +16,8 @@
 #ifndef ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_UUIDGENERATION_UUIDGENERATION_H_
 #define ALEXA_CLIENT_SDK_AVSCOMMON_UTILS_INCLUDE_AVSCOMMON_UTILS_UUIDGENERATION_UUIDGENERATION_H_
 
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <string>
 #include <vector>
@@ -25,6 +27,9 @@ namespace avsCommon {
 namespace utils {
 namespace uuidGeneration {
 
+/// The length of a UUID string: 32 hexadecimal digits and 4 hyphens.
+static const size_t UUID_STRING_LENGTH = 36;
+
 /**
  * Set the customized function to read entropy value instead of the default.
  * @param func Customized function used to read entropy value.
@@ -42,6 +47,27 @@ void setEntropyReader(std::function<double(void)> func);
  */
 const std::string generateUUID();
 
+/**
+ * Generates a UUID as @c generateUUID() does, and writes its text to a caller supplied buffer instead of allocating a
+ * string.
+ *
+ * Each thread draws UUIDs from its own ChaCha20 keystream, keyed from @c std::random_device and the seeds passed to
+ * @c addSeeds() and @c setSalt(), so concurrent callers do not contend on a lock.
+ *
+ * @param[out] buffer The buffer to write the @c UUID_STRING_LENGTH characters of the UUID to.  No null terminator is
+ *     written.
+ */
+void generateUUID(char* buffer);
+
+/**
+ * Generates a batch of UUIDs, for callers which need many identifiers at once or want to take them from a
+ * pre-generated supply.
+ *
+ * @param count The number of UUIDs to generate.
+ * @return The UUIDs, as @c generateUUID() would return them.
+ */
+std::vector<std::string> generateUUIDs(size_t count);
+
 /**
  * Allows caller to set a specific salt to be used in any seeding operation.
  * Salt wil be a prefix to the seed and should be as specific to the unique device as possible.
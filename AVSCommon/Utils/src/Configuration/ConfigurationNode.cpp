@@ -40,8 +40,7 @@ static const std::string TAG("ConfigurationNode");
 using namespace rapidjson;
 
 std::mutex ConfigurationNode::m_mutex;
-Document ConfigurationNode::m_document;
-ConfigurationNode ConfigurationNode::m_root;
+std::shared_ptr<const Document> ConfigurationNode::m_root;
 
 #ifdef ACSDK_DEBUG_LOG_ENABLED
 /**
@@ -98,38 +97,35 @@ bool ConfigurationNode::initialize(const std::vector<std::shared_ptr<std::istrea
         ACSDK_ERROR(LX("initializeFailed").d("reason", "alreadyInitialized"));
         return false;
     }
-    m_document.SetObject();
+    std::shared_ptr<Document> document = std::make_shared<Document>();
+    document->SetObject();
 
     for (auto jsonStream : jsonStreams) {
         if (!jsonStream) {
-            m_document.SetObject();
             return false;
         }
         IStreamWrapper wrapper(*jsonStream);
-        Document overlay(&m_document.GetAllocator());
+        Document overlay(&document->GetAllocator());
         overlay.ParseStream<kParseCommentsFlag>(wrapper);
         if (overlay.HasParseError()) {
             ACSDK_ERROR(LX("initializeFailed")
                             .d("reason", "parseFailure")
                             .d("offset", overlay.GetErrorOffset())
                             .d("message", GetParseError_En(overlay.GetParseError())));
-            m_document.SetObject();
-
             return false;
         }
 
-        mergeDocument("root", m_document, overlay, m_document.GetAllocator());
+        mergeDocument("root", *document, overlay, document->GetAllocator());
     }
 
-    m_root = ConfigurationNode(&m_document);
-    ACSDK_DEBUG0(LX("initializeSuccess").sensitive("configuration", valueToString(m_document)));
+    ACSDK_DEBUG0(LX("initializeSuccess").sensitive("configuration", valueToString(*document)));
+    std::atomic_store(&m_root, std::shared_ptr<const Document>(std::move(document)));
     return true;
 }
 
 void ConfigurationNode::uninitialize() {
     std::lock_guard<std::mutex> lock(m_mutex);
-    m_document.SetObject();
-    m_root = ConfigurationNode();
+    std::atomic_store(&m_root, std::shared_ptr<const Document>());
 }
 
 std::shared_ptr<ConfigurationNode> ConfigurationNode::createRoot() {
@@ -137,7 +133,12 @@ std::shared_ptr<ConfigurationNode> ConfigurationNode::createRoot() {
 }
 
 ConfigurationNode ConfigurationNode::getRoot() {
-    return m_root;
+    auto root = std::atomic_load(&m_root);
+    if (!root) {
+        return ConfigurationNode();
+    }
+    auto object = root.get();
+    return ConfigurationNode(object, std::move(root));
 }
 
 ConfigurationNode::ConfigurationNode() : m_object{nullptr} {
@@ -176,14 +177,16 @@ ConfigurationNode ConfigurationNode::operator[](const std::string& key) const {
     if (m_object->MemberEnd() == it || !it->value.IsObject()) {
         return ConfigurationNode();
     }
-    return ConfigurationNode(&it->value);
+    return ConfigurationNode(&it->value, m_document);
 }
 
 ConfigurationNode::operator bool() const {
     return m_object;
 }
 
-ConfigurationNode::ConfigurationNode(const rapidjson::Value* object) : m_object{object} {
+ConfigurationNode::ConfigurationNode(const rapidjson::Value* object, std::shared_ptr<const Document> document) :
+        m_object{object},
+        m_document{std::move(document)} {
 }
 
 std::string ConfigurationNode::serialize() const {
@@ -234,7 +237,7 @@ ConfigurationNode ConfigurationNode::getArray(const std::string& key) const {
         ACSDK_ERROR(LX("getArrayFailed").d("reason", "notAnArray"));
         return ConfigurationNode();
     }
-    return ConfigurationNode(&it->value);
+    return ConfigurationNode(&it->value, m_document);
 }
 
 std::size_t ConfigurationNode::getArraySize() const {
@@ -256,7 +259,7 @@ ConfigurationNode ConfigurationNode::operator[](const std::size_t index) const {
         return ConfigurationNode();
     }
     const rapidjson::Value& objectRef = *m_object;
-    return ConfigurationNode(&objectRef[index]);
+    return ConfigurationNode(&objectRef[index], m_document);
 }
 
 }  // namespace configuration
@@ -13,10 +13,21 @@
  * permissions and limitations under the License.
  */
 
+#include "AVSCommon/Utils/Logger/Logger.h"
 #include "AVSCommon/Utils/Memory/Memory.h"
 #include "AVSCommon/Utils/Power/PowerMonitor.h"
 #include "AVSCommon/Utils/Threading/Executor.h"
 
+/// String to identify log entries originating from this file.
+static const std::string TAG("Executor");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
 namespace alexaClientSDK {
 namespace avsCommon {
 namespace utils {
@@ -25,8 +36,28 @@ namespace threading {
 /// An id for identifying instances.
 static std::atomic<uint64_t> g_id{0};
 
+/// The maximum number of tasks a strand runs before yielding its pool thread to other work.
+static const size_t STRAND_BATCH_SIZE = 16;
+
+/// The executor whose strand is running on the current thread, if any.
+static thread_local Executor* g_currentStrand = nullptr;
+
 Executor::~Executor() {
+    if (m_threadPool && this == g_currentStrand) {
+        // One of our own tasks released the last reference to us.  The strand can't stop while we wait for it, so
+        // drop the queued tasks and tell the strand not to touch this executor again once the task returns.
+        std::lock_guard<std::mutex> lock{m_queueMutex};
+        m_queue.clear();
+        m_shutdown = true;
+        m_strandState->executorDestroyed = true;
+        return;
+    }
     shutdown();
+    if (m_threadPool) {
+        // The strand may still be running after fulfilling the last task; wait for it to stop using this executor.
+        std::unique_lock<std::mutex> lock{m_queueMutex};
+        m_delayedCondition.wait(lock, [this] { return !m_threadRunning; });
+    }
 }
 
 Executor::Executor(const std::chrono::milliseconds& delayExit) :
@@ -34,6 +65,20 @@ Executor::Executor(const std::chrono::milliseconds& delayExit) :
         m_timeout{delayExit},
         m_shutdown{false},
         m_id{g_id++} {
+#ifdef ENABLE_WORK_STEALING_EXECUTOR
+    m_threadPool = WorkStealingThreadPool::getDefaultThreadPool();
+    m_strandState = std::make_shared<StrandState>();
+#endif
+    m_powerResource = power::PowerMonitor::getInstance()->createLocalPowerResource("Executor:" + std::to_string(m_id));
+}
+
+Executor::Executor(std::shared_ptr<WorkStealingThreadPool> threadPool) :
+        m_threadRunning{false},
+        m_timeout{std::chrono::milliseconds::zero()},
+        m_shutdown{false},
+        m_id{g_id++},
+        m_threadPool{std::move(threadPool)},
+        m_strandState{std::make_shared<StrandState>()} {
     m_powerResource = power::PowerMonitor::getInstance()->createLocalPowerResource("Executor:" + std::to_string(m_id));
 }
 
@@ -43,7 +88,7 @@ void Executor::waitForSubmittedTasks() {
         // wait for thread to exit.
         std::promise<void> flushedPromise;
         auto flushedFuture = flushedPromise.get_future();
-        m_queue.emplace_back([&flushedPromise]() { flushedPromise.set_value(); });
+        m_queue.pushBack([&flushedPromise]() { flushedPromise.set_value(); });
 
         lock.unlock();
         m_delayedCondition.notify_one();
@@ -51,14 +96,42 @@ void Executor::waitForSubmittedTasks() {
     }
 }
 
-std::function<void()> Executor::pop() {
+SmallTask Executor::pop() {
     std::lock_guard<std::mutex> lock{m_queueMutex};
-    if (!m_queue.empty()) {
-        auto task = std::move(m_queue.front());
-        m_queue.pop_front();
-        return task;
+    return m_queue.popFront();
+}
+
+void Executor::logExecutedTaskException(const char* what) {
+    if (what) {
+        ACSDK_ERROR(LX("executedTaskFailed").d("reason", "exception").d("what", what));
+    } else {
+        ACSDK_ERROR(LX("executedTaskFailed").d("reason", "unknownException"));
     }
-    return std::function<void()>();
+}
+
+bool Executor::pushTask(QueuePosition position, SmallTask task) {
+    {
+        std::lock_guard<std::mutex> queueLock{m_queueMutex};
+        if (m_shutdown) {
+            return false;
+        }
+        if (m_powerResource) {
+            m_powerResource->acquire();
+        }
+        if (QueuePosition::FRONT == position) {
+            m_queue.pushFront(std::move(task));
+        } else {
+            m_queue.pushBack(std::move(task));
+        }
+
+        if (!m_threadRunning) {
+            // Restart task thread.
+            m_threadRunning = startRunning();
+        }
+    }
+
+    m_delayedCondition.notify_one();
+    return true;
 }
 
 bool Executor::hasNext() {
@@ -86,6 +159,54 @@ bool Executor::runNext() {
     return hasNext();
 }
 
+bool Executor::startRunning() {
+    if (!m_threadPool) {
+        m_taskThread.start(std::bind(&Executor::runNext, this));
+        return true;
+    }
+    auto strandState = m_strandState;
+    if (!m_threadPool->submit([this, strandState] { runStrand(strandState); })) {
+        ACSDK_ERROR(LX("startRunningFailed").d("reason", "submitToThreadPoolFailed").d("id", m_id));
+        return false;
+    }
+    return true;
+}
+
+void Executor::runStrand(std::shared_ptr<StrandState> strandState) {
+    // Keep our own reference, as a task may destroy this executor and its members.
+    auto powerResource = m_powerResource;
+    g_currentStrand = this;
+    for (size_t i = 0; i < STRAND_BATCH_SIZE; ++i) {
+        auto task = pop();
+        if (!task) {
+            break;
+        }
+        task();
+        // Destroy the task before checking on the executor, as the task may hold the last reference to it.
+        task = nullptr;
+        if (powerResource) {
+            powerResource->release();
+        }
+        if (strandState->executorDestroyed) {
+            g_currentStrand = nullptr;
+            return;
+        }
+    }
+    g_currentStrand = nullptr;
+
+    std::lock_guard<std::mutex> lock{m_queueMutex};
+    if (!m_queue.empty()) {
+        // Go to the back of the pool's queue so that other strands get a turn.
+        m_threadRunning = startRunning();
+    } else {
+        m_threadRunning = false;
+    }
+    if (!m_threadRunning) {
+        // Notify while holding the lock, as the destructor may complete as soon as the lock is released.
+        m_delayedCondition.notify_all();
+    }
+}
+
 void Executor::shutdown() {
     std::unique_lock<std::mutex> lock{m_queueMutex};
     m_queue.clear();
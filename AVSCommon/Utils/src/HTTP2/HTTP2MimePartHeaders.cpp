@@ -0,0 +1,164 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+#include "AVSCommon/Utils/HTTP2/HTTP2MimePartHeaders.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace http2 {
+
+constexpr size_t HTTP2MimePartHeaders::MAX_HEADERS;
+constexpr size_t HTTP2MimePartHeaders::TEXT_SIZE;
+
+bool HTTP2MimePartHeaders::Text::contains(const std::string& str) const {
+    if (str.empty()) {
+        return true;
+    }
+    return std::search(data, data + size, str.begin(), str.end()) != data + size;
+}
+
+std::string HTTP2MimePartHeaders::Text::str() const {
+    return std::string(data, size);
+}
+
+HTTP2MimePartHeaders::HTTP2MimePartHeaders() {
+    clear();
+}
+
+void HTTP2MimePartHeaders::clear() {
+    m_count = 0;
+    m_textSize = 0;
+    m_inValue = false;
+    m_dropCurrent = false;
+    m_overflowed = false;
+    m_entries[0] = Entry{0, 0, 0, 0};
+}
+
+bool HTTP2MimePartHeaders::append(const char* data, size_t size) {
+    if (m_dropCurrent || m_count >= MAX_HEADERS || size > TEXT_SIZE - m_textSize) {
+        m_dropCurrent = true;
+        return false;
+    }
+    std::memcpy(m_text + m_textSize, data, size);
+    m_textSize += size;
+    return true;
+}
+
+void HTTP2MimePartHeaders::appendName(const char* data, size_t size) {
+    if (append(data, size)) {
+        m_entries[m_count].nameSize += static_cast<uint16_t>(size);
+    }
+}
+
+void HTTP2MimePartHeaders::appendValue(const char* data, size_t size) {
+    if (!m_inValue && !m_dropCurrent && m_count < MAX_HEADERS) {
+        m_entries[m_count].valueOffset = static_cast<uint16_t>(m_textSize);
+        m_inValue = true;
+    }
+    if (append(data, size)) {
+        m_entries[m_count].valueSize += static_cast<uint16_t>(size);
+    }
+}
+
+void HTTP2MimePartHeaders::endHeader() {
+    if (m_dropCurrent || m_count >= MAX_HEADERS) {
+        m_overflowed = true;
+        if (m_count < MAX_HEADERS) {
+            // Discard what was stored of the dropped header.
+            m_textSize = m_entries[m_count].nameOffset;
+        }
+    } else {
+        if (!m_inValue) {
+            m_entries[m_count].valueOffset = static_cast<uint16_t>(m_textSize);
+        }
+        m_count++;
+    }
+    if (m_count < MAX_HEADERS) {
+        m_entries[m_count] = Entry{static_cast<uint16_t>(m_textSize), 0, static_cast<uint16_t>(m_textSize), 0};
+    }
+    m_inValue = false;
+    m_dropCurrent = false;
+}
+
+size_t HTTP2MimePartHeaders::getCount() const {
+    return m_count;
+}
+
+HTTP2MimePartHeaders::Text HTTP2MimePartHeaders::getName(size_t index) const {
+    return Text{m_text + m_entries[index].nameOffset, m_entries[index].nameSize};
+}
+
+HTTP2MimePartHeaders::Text HTTP2MimePartHeaders::getValue(size_t index) const {
+    return Text{m_text + m_entries[index].valueOffset, m_entries[index].valueSize};
+}
+
+bool HTTP2MimePartHeaders::nameEquals(size_t index, const std::string& name) const {
+    auto& entry = m_entries[index];
+    if (entry.nameSize != name.size()) {
+        return false;
+    }
+    const char* text = m_text + entry.nameOffset;
+    for (size_t i = 0; i < name.size(); ++i) {
+        if (std::tolower(static_cast<unsigned char>(text[i])) != std::tolower(static_cast<unsigned char>(name[i]))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool HTTP2MimePartHeaders::find(const std::string& name, Text* value) const {
+    for (size_t i = 0; i < m_count; ++i) {
+        if (nameEquals(i, name)) {
+            if (value) {
+                *value = getValue(i);
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t HTTP2MimePartHeaders::count(const std::string& name) const {
+    size_t result = 0;
+    for (size_t i = 0; i < m_count; ++i) {
+        if (nameEquals(i, name)) {
+            result++;
+        }
+    }
+    return result;
+}
+
+bool HTTP2MimePartHeaders::hasOverflowed() const {
+    return m_overflowed;
+}
+
+std::multimap<std::string, std::string> HTTP2MimePartHeaders::toMultimap() const {
+    std::multimap<std::string, std::string> headers;
+    for (size_t i = 0; i < m_count; ++i) {
+        headers.insert(std::make_pair(getName(i).str(), getValue(i).str()));
+    }
+    return headers;
+}
+
+}  // namespace http2
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
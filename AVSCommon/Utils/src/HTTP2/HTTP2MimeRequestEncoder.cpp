@@ -249,6 +249,10 @@ std::vector<std::string> HTTP2MimeRequestEncoder::getRequestHeaderLines() {
     return {};
 }
 
+bool HTTP2MimeRequestEncoder::setDataAvailableCallback(std::function<void()> callback) {
+    return m_source && m_source->setDataAvailableCallback(std::move(callback));
+}
+
 void HTTP2MimeRequestEncoder::setState(State newState) {
     if (newState == m_state) {
         ACSDK_DEBUG9(LX("nonStateChangeInSetState").d("state", m_state).d("newState", newState));
@@ -62,10 +62,14 @@ HTTP2MimeResponseDecoder::HTTP2MimeResponseDecoder(std::shared_ptr<HTTP2MimeResp
         m_leadingCRLFCharsLeftToRemove{LEADING_CRLF_CHAR_SIZE},
         m_boundaryFound{false},
         m_lastSuccessIndex{0} {
-    m_multipartReader.onPartBegin = HTTP2MimeResponseDecoder::partBeginCallback;
-    m_multipartReader.onPartData = HTTP2MimeResponseDecoder::partDataCallback;
-    m_multipartReader.onPartEnd = HTTP2MimeResponseDecoder::partEndCallback;
-    m_multipartReader.userData = this;
+    m_multipartParser.onPartBegin = HTTP2MimeResponseDecoder::partBeginCallback;
+    m_multipartParser.onHeaderField = HTTP2MimeResponseDecoder::headerFieldCallback;
+    m_multipartParser.onHeaderValue = HTTP2MimeResponseDecoder::headerValueCallback;
+    m_multipartParser.onHeaderEnd = HTTP2MimeResponseDecoder::headerEndCallback;
+    m_multipartParser.onHeadersEnd = HTTP2MimeResponseDecoder::headersEndCallback;
+    m_multipartParser.onPartData = HTTP2MimeResponseDecoder::partDataCallback;
+    m_multipartParser.onPartEnd = HTTP2MimeResponseDecoder::partEndCallback;
+    m_multipartParser.userData = this;
     ACSDK_DEBUG9(LX(__func__));
 }
 
@@ -109,7 +113,7 @@ bool HTTP2MimeResponseDecoder::onReceiveHeaderLine(const std::string& line) {
             std::string boundary = line.substr(boundaryIndexStart, boundaryIndex - boundaryIndexStart);
             // as per NFC2046 the boundary should range from 1 to 70 chars
             if (boundary.size() > 0 && boundary.size() <= BOUNDARY_MAX_LENGTH) {
-                m_multipartReader.setBoundary(boundary);
+                m_multipartParser.setBoundary(boundary);
                 m_boundaryFound = true;
                 ACSDK_DEBUG9(LX(__func__).d("boundary", boundary));
             } else {
@@ -123,16 +127,55 @@ bool HTTP2MimeResponseDecoder::onReceiveHeaderLine(const std::string& line) {
     return m_sink->onReceiveHeaderLine(line);
 }
 
-void HTTP2MimeResponseDecoder::partBeginCallback(const MultipartHeaders& headers, void* userData) {
+void HTTP2MimeResponseDecoder::partBeginCallback(const char* buffer, size_t start, size_t end, void* userData) {
     HTTP2MimeResponseDecoder* decoder = static_cast<HTTP2MimeResponseDecoder*>(userData);
     if (!decoder) {
         ACSDK_ERROR(LX("partBeginCallbackFailed").d("reason", "nullDecoder"));
         return;
     }
+    decoder->m_partHeaders.clear();
+}
+
+void HTTP2MimeResponseDecoder::headerFieldCallback(const char* buffer, size_t start, size_t end, void* userData) {
+    HTTP2MimeResponseDecoder* decoder = static_cast<HTTP2MimeResponseDecoder*>(userData);
+    if (!decoder) {
+        ACSDK_ERROR(LX("headerFieldCallbackFailed").d("reason", "nullDecoder"));
+        return;
+    }
+    decoder->m_partHeaders.appendName(buffer + start, end - start);
+}
+
+void HTTP2MimeResponseDecoder::headerValueCallback(const char* buffer, size_t start, size_t end, void* userData) {
+    HTTP2MimeResponseDecoder* decoder = static_cast<HTTP2MimeResponseDecoder*>(userData);
+    if (!decoder) {
+        ACSDK_ERROR(LX("headerValueCallbackFailed").d("reason", "nullDecoder"));
+        return;
+    }
+    decoder->m_partHeaders.appendValue(buffer + start, end - start);
+}
+
+void HTTP2MimeResponseDecoder::headerEndCallback(const char* buffer, size_t start, size_t end, void* userData) {
+    HTTP2MimeResponseDecoder* decoder = static_cast<HTTP2MimeResponseDecoder*>(userData);
+    if (!decoder) {
+        ACSDK_ERROR(LX("headerEndCallbackFailed").d("reason", "nullDecoder"));
+        return;
+    }
+    decoder->m_partHeaders.endHeader();
+}
+
+void HTTP2MimeResponseDecoder::headersEndCallback(const char* buffer, size_t start, size_t end, void* userData) {
+    HTTP2MimeResponseDecoder* decoder = static_cast<HTTP2MimeResponseDecoder*>(userData);
+    if (!decoder) {
+        ACSDK_ERROR(LX("headersEndCallbackFailed").d("reason", "nullDecoder"));
+        return;
+    }
+    if (decoder->m_partHeaders.hasOverflowed()) {
+        ACSDK_WARN(LX("headersEndCallback").d("reason", "partHeadersDropped"));
+    }
     switch (decoder->m_lastStatus) {
         case HTTP2ReceiveDataStatus::SUCCESS:
             // Pass notification and headers through to our sink.
-            if (!decoder->m_sink->onBeginMimePart(headers)) {
+            if (!decoder->m_sink->onBeginMimePartHeaders(decoder->m_partHeaders)) {
                 // Sink doesn't want the next part? ABORT!
                 decoder->m_lastStatus = HTTP2ReceiveDataStatus::ABORT;
             }
@@ -147,7 +190,7 @@ void HTTP2MimeResponseDecoder::partBeginCallback(const MultipartHeaders& headers
     }
 }
 
-void HTTP2MimeResponseDecoder::partDataCallback(const char* buffer, size_t size, void* userData) {
+void HTTP2MimeResponseDecoder::partDataCallback(const char* buffer, size_t start, size_t end, void* userData) {
     HTTP2MimeResponseDecoder* decoder = static_cast<HTTP2MimeResponseDecoder*>(userData);
     if (!decoder) {
         ACSDK_ERROR(LX("partDataCallbackFailed").d("reason", "nullDecoder"));
@@ -157,6 +200,8 @@ void HTTP2MimeResponseDecoder::partDataCallback(const char* buffer, size_t size,
         ACSDK_ERROR(LX("partDataCallbackFailed").d("reason", "nullBuffer"));
         return;
     }
+    buffer += start;
+    size_t size = end - start;
     // Increment the counter for partDataCallbacks.
     decoder->m_index++;
     // Check if we can resume callbacks to sink again.
@@ -174,7 +219,7 @@ void HTTP2MimeResponseDecoder::partDataCallback(const char* buffer, size_t size,
     }
 }
 
-void HTTP2MimeResponseDecoder::partEndCallback(void* userData) {
+void HTTP2MimeResponseDecoder::partEndCallback(const char* buffer, size_t start, size_t end, void* userData) {
     HTTP2MimeResponseDecoder* decoder = static_cast<HTTP2MimeResponseDecoder*>(userData);
     if (!decoder) {
         ACSDK_ERROR(LX("partEndCallbackFailed").d("reason", "nullDecoder"));
@@ -201,7 +246,8 @@ HTTP2ReceiveDataStatus HTTP2MimeResponseDecoder::onReceiveData(const char* bytes
             }
         }
 
-        auto readerCheckpoint = m_multipartReader;
+        m_multipartParserCheckpoint = m_multipartParser;
+        m_partHeadersCheckpoint = m_partHeaders;
         auto oldLeadingCRLFCharsLeftToRemove = m_leadingCRLFCharsLeftToRemove;
         /**
          * If no boundary found...
@@ -239,12 +285,12 @@ HTTP2ReceiveDataStatus HTTP2MimeResponseDecoder::onReceiveData(const char* bytes
         }
 
         m_index = 0;
-        m_multipartReader.feed(bytes, size);
+        m_multipartParser.feed(bytes, size);
 
-        if (m_multipartReader.hasError()) {
+        if (m_multipartParser.hasError()) {
             ACSDK_ERROR(LX("onReceiveDataFailed")
                             .d("reason", "mimeParseError")
-                            .d("error", m_multipartReader.getErrorMessage()));
+                            .d("error", m_multipartParser.getErrorMessage()));
             m_lastStatus = HTTP2ReceiveDataStatus::ABORT;
         }
 
@@ -253,7 +299,8 @@ HTTP2ReceiveDataStatus HTTP2MimeResponseDecoder::onReceiveData(const char* bytes
                 m_lastSuccessIndex = 0;
                 break;
             case HTTP2ReceiveDataStatus::PAUSE:
-                m_multipartReader = readerCheckpoint;
+                m_multipartParser = m_multipartParserCheckpoint;
+                m_partHeaders = m_partHeadersCheckpoint;
                 m_leadingCRLFCharsLeftToRemove = oldLeadingCRLFCharsLeftToRemove;
                 break;
             case HTTP2ReceiveDataStatus::ABORT:
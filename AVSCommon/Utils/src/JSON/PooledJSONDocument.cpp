@@ -0,0 +1,160 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+#include "AVSCommon/Utils/JSON/JSONUtils.h"
+#include "AVSCommon/Utils/JSON/PooledJSONDocument.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace json {
+
+constexpr size_t PooledJSONDocument::ARENA_SIZE;
+constexpr size_t PooledJSONDocument::MAX_POOLED_ARENAS;
+
+/**
+ * Tells whether a rapidjson allocator can be constructed over a caller-supplied buffer.
+ *
+ * @tparam Allocator The allocator type.
+ */
+template <typename Allocator>
+struct IsArenaAllocator : std::false_type {};
+
+/// Only @c MemoryPoolAllocator can start in a caller-supplied buffer.
+template <typename BaseAllocator>
+struct IsArenaAllocator<rapidjson::MemoryPoolAllocator<BaseAllocator>> : std::true_type {};
+
+/// Whether the default allocator of @c rapidjson::Document can use a pooled arena.
+using DocumentUsesArena = IsArenaAllocator<rapidjson::Document::AllocatorType>;
+
+/**
+ * Creates an allocator which starts in an arena buffer.
+ *
+ * @param buffer The arena buffer, of @c PooledJSONDocument::ARENA_SIZE bytes.
+ * @return The new allocator.
+ */
+template <typename Allocator>
+static std::unique_ptr<Allocator> createAllocator(char* buffer, std::true_type) {
+    return std::unique_ptr<Allocator>(
+        new Allocator(buffer, PooledJSONDocument::ARENA_SIZE, PooledJSONDocument::ARENA_SIZE));
+}
+
+/**
+ * Creates an allocator which cannot use an arena buffer.
+ *
+ * @return The new allocator.
+ */
+template <typename Allocator>
+static std::unique_ptr<Allocator> createAllocator(char*, std::false_type) {
+    return std::unique_ptr<Allocator>(new Allocator());
+}
+
+/// The idle arena buffers shared by all @c PooledJSONDocument instances.
+struct ArenaPool {
+    /// Serializes access to @c buffers.
+    std::mutex mutex;
+
+    /// The idle buffers, each @c ARENA_SIZE bytes.
+    std::vector<char*> buffers;
+};
+
+/**
+ * Obtain the arena pool.  The pool is never destroyed, so documents which outlive static destruction can still hand
+ * their buffers back to it.
+ *
+ * @return The arena pool.
+ */
+static ArenaPool& getArenaPool() {
+    static ArenaPool* pool = new ArenaPool;
+    return *pool;
+}
+
+PooledJSONDocument::Arena::Arena(bool enabled) : buffer{nullptr} {
+    if (!enabled) {
+        return;
+    }
+    auto& pool = getArenaPool();
+    {
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        if (!pool.buffers.empty()) {
+            buffer = pool.buffers.back();
+            pool.buffers.pop_back();
+        }
+    }
+    if (!buffer) {
+        buffer = new char[ARENA_SIZE];
+    }
+}
+
+PooledJSONDocument::Arena::~Arena() {
+    if (!buffer) {
+        return;
+    }
+    auto& pool = getArenaPool();
+    {
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        if (pool.buffers.size() < MAX_POOLED_ARENAS) {
+            pool.buffers.push_back(buffer);
+            return;
+        }
+    }
+    delete[] buffer;
+}
+
+std::shared_ptr<PooledJSONDocument> PooledJSONDocument::create() {
+    return std::make_shared<PooledJSONDocument>();
+}
+
+std::shared_ptr<PooledJSONDocument> PooledJSONDocument::parse(const std::string& jsonContent) {
+    auto document = create();
+    if (!jsonUtils::parseJSON(jsonContent, &document->m_document)) {
+        return nullptr;
+    }
+    return document;
+}
+
+PooledJSONDocument::PooledJSONDocument() :
+        m_arena{DocumentUsesArena::value},
+        m_allocator{createAllocator<rapidjson::Document::AllocatorType>(m_arena.buffer, DocumentUsesArena())},
+        m_document{m_allocator.get()} {
+}
+
+rapidjson::Document& PooledJSONDocument::getDocument() {
+    return m_document;
+}
+
+const rapidjson::Document& PooledJSONDocument::getDocument() const {
+    return m_document;
+}
+
+bool PooledJSONDocument::usesArena() {
+    return DocumentUsesArena::value;
+}
+
+size_t PooledJSONDocument::getPooledArenaCount() {
+    auto& pool = getArenaPool();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    return pool.buffers.size();
+}
+
+}  // namespace json
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,102 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <AVSCommon/Utils/LibcurlUtils/CurlShareHandleWrapper.h>
+#include <AVSCommon/Utils/Logger/Logger.h>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace libcurlUtils {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("CurlShareHandleWrapper");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+std::shared_ptr<CurlShareHandleWrapper> CurlShareHandleWrapper::create() {
+    auto handle = curl_share_init();
+    if (!handle) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "curlShareInitFailed"));
+        return nullptr;
+    }
+    std::shared_ptr<CurlShareHandleWrapper> wrapper(new CurlShareHandleWrapper(handle));
+
+    if (curl_share_setopt(handle, CURLSHOPT_LOCKFUNC, &CurlShareHandleWrapper::lock) != CURLSHE_OK ||
+        curl_share_setopt(handle, CURLSHOPT_UNLOCKFUNC, &CurlShareHandleWrapper::unlock) != CURLSHE_OK ||
+        curl_share_setopt(handle, CURLSHOPT_USERDATA, wrapper.get()) != CURLSHE_OK) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "setLockFunctionsFailed"));
+        return nullptr;
+    }
+    for (auto data : {CURL_LOCK_DATA_DNS, CURL_LOCK_DATA_SSL_SESSION}) {
+        auto result = curl_share_setopt(handle, CURLSHOPT_SHARE, data);
+        if (result != CURLSHE_OK) {
+            ACSDK_ERROR(LX("createFailed").d("data", data).d("error", curl_share_strerror(result)));
+            return nullptr;
+        }
+    }
+    return wrapper;
+}
+
+CurlShareHandleWrapper::CurlShareHandleWrapper(CURLSH* handle) : m_handle{handle} {
+}
+
+CurlShareHandleWrapper::~CurlShareHandleWrapper() {
+    auto result = curl_share_cleanup(m_handle);
+    if (result != CURLSHE_OK) {
+        ACSDK_ERROR(LX("shareHandleLeaked").d("error", curl_share_strerror(result)));
+    }
+    m_handle = nullptr;
+}
+
+bool CurlShareHandleWrapper::attach(CURL* handle) {
+    auto result = curl_easy_setopt(handle, CURLOPT_SHARE, m_handle);
+    if (result != CURLE_OK) {
+        ACSDK_ERROR(LX("attachFailed").d("error", curl_easy_strerror(result)));
+        return false;
+    }
+    return true;
+}
+
+void CurlShareHandleWrapper::detach(CURL* handle) {
+    auto result = curl_easy_setopt(handle, CURLOPT_SHARE, nullptr);
+    if (result != CURLE_OK) {
+        ACSDK_ERROR(LX("detachFailed").d("error", curl_easy_strerror(result)));
+    }
+}
+
+void CurlShareHandleWrapper::lock(CURL* handle, curl_lock_data data, curl_lock_access access, void* userPtr) {
+    auto wrapper = static_cast<CurlShareHandleWrapper*>(userPtr);
+    if (data >= 0 && data < CURL_LOCK_DATA_LAST) {
+        wrapper->m_mutexes[data].lock();
+    }
+}
+
+void CurlShareHandleWrapper::unlock(CURL* handle, curl_lock_data data, void* userPtr) {
+    auto wrapper = static_cast<CurlShareHandleWrapper*>(userPtr);
+    if (data >= 0 && data < CURL_LOCK_DATA_LAST) {
+        wrapper->m_mutexes[data].unlock();
+    }
+}
+
+}  // namespace libcurlUtils
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
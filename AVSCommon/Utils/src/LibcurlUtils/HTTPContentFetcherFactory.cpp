@@ -51,8 +51,21 @@ std::unique_ptr<avsCommon::sdkInterfaces::HTTPContentFetcherInterface> HTTPConte
         setCurlOptionsCallback = m_setCurlOptionsCallbackFactory->createSetCurlOptionsCallback();
     }
 
+    std::shared_ptr<LibcurlContentFetchEngine> engine;
+    {
+        std::lock_guard<std::mutex> lock(m_engineMutex);
+        if (!m_engine) {
+            m_engine = LibcurlContentFetchEngine::create();
+            if (!m_engine) {
+                // The fetcher will try to create a private engine instead.
+                ACSDK_WARN(LX("create").d("reason", "createEngineFailed"));
+            }
+        }
+        engine = m_engine;
+    }
+
     ACSDK_DEBUG9(LX("create").sensitive("URL", url).m("Creating a new http content fetcher"));
-    return avsCommon::utils::memory::make_unique<LibCurlHttpContentFetcher>(url, setCurlOptionsCallback);
+    return avsCommon::utils::memory::make_unique<LibCurlHttpContentFetcher>(url, setCurlOptionsCallback, engine);
 }
 
 }  // namespace libcurlUtils
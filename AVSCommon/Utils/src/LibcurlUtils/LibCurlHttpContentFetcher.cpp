@@ -15,11 +15,11 @@
 
 #include <algorithm>
 #include <chrono>
+#include <thread>
 
 #include <AVSCommon/SDKInterfaces/HTTPContentFetcherInterface.h>
 #include <AVSCommon/Utils/HTTP/HttpResponseCode.h>
 #include <AVSCommon/Utils/LibcurlUtils/CurlEasyHandleWrapper.h>
-#include "AVSCommon/Utils/LibcurlUtils/CurlMultiHandleWrapper.h"
 #include <AVSCommon/Utils/LibcurlUtils/LibCurlHttpContentFetcher.h>
 #include <AVSCommon/Utils/Memory/Memory.h>
 #include <AVSCommon/Utils/SDS/InProcessSDS.h>
@@ -41,6 +41,12 @@ static const std::string TAG("LibCurlHttpContentFetcher");
  * may also increase latency.
  */
 static const std::chrono::milliseconds TIMEOUT_FOR_BLOCKING_WRITE = std::chrono::milliseconds(100);
+/**
+ * The timeout for a write call to an @c AttachmentWriter by a transfer which can be paused. Writes run on the network
+ * thread shared by all fetchers, so when the writer has no space the transfer is paused rather than blocking for long,
+ * and resumed when a reader frees space.
+ */
+static const std::chrono::milliseconds TIMEOUT_FOR_WRITE_BEFORE_PAUSE = std::chrono::milliseconds(1);
 /// Timeout for polling loops that check activities running on separate threads.
 static const std::chrono::milliseconds WAIT_FOR_ACTIVITY_TIMEOUT{100};
 /// Timeout for curl connection.
@@ -123,19 +129,24 @@ size_t LibCurlHttpContentFetcher::bodyCallback(char* data, size_t size, size_t n
     if (State::FETCHING_HEADER == fetcher->getState()) {
         ACSDK_DEBUG9(LX("bodyCallback").sensitive("url", fetcher->m_url).m("End of header found."));
         fetcher->stateTransition(State::HEADER_DONE, true);
+        fetcher->m_getBodyWaitStartTime = std::chrono::steady_clock::now();
     }
 
-    // Waits until the content fetcher is shutting down or the @c getBody method gets called.
-    auto startTime = std::chrono::steady_clock::now();
-    auto elapsedTime = std::chrono::steady_clock::now() - startTime;
-    while ((MAX_GET_BODY_WAIT > elapsedTime) && !fetcher->m_isShutdown && fetcher->waitingForBodyRequest()) {
+    // Keeps the transfer paused (or, if it cannot be paused, waits) until the content fetcher is shutting down or the
+    // @c getBody method gets called.
+    while (!fetcher->m_isShutdown && fetcher->waitingForBodyRequest()) {
+        if (MAX_GET_BODY_WAIT <= std::chrono::steady_clock::now() - fetcher->m_getBodyWaitStartTime) {
+            ACSDK_ERROR(LX("bodyCallback").d("reason", "getBodyCallWaitTimeout"));
+            fetcher->stateTransition(State::ERROR, false);
+            return 0;
+        }
+        if (fetcher->m_canPauseTransfer) {
+            // Resumed by getBody() or shutdown(), or when the wait times out.
+            fetcher->m_engine->onTransferPaused(
+                fetcher->m_curlWrapper.getCurlHandle(), fetcher->m_getBodyWaitStartTime + MAX_GET_BODY_WAIT);
+            return CURL_WRITEFUNC_PAUSE;
+        }
         std::this_thread::sleep_for(WAIT_FOR_ACTIVITY_TIMEOUT);
-        elapsedTime = std::chrono::steady_clock::now() - startTime;
-    }
-    if (MAX_GET_BODY_WAIT <= elapsedTime) {
-        ACSDK_ERROR(LX("bodyCallback").d("reason", "getBodyCallWaitTimeout"));
-        fetcher->stateTransition(State::ERROR, false);
-        return 0;
     }
     if (fetcher->m_isShutdown) {
         return 0;
@@ -151,21 +162,47 @@ size_t LibCurlHttpContentFetcher::bodyCallback(char* data, size_t size, size_t n
     }
 
     auto streamWriter = fetcher->m_streamWriter;
-    size_t totalBytesWritten = 0;
+    size_t targetNumBytes = size * nmemb;
+
+    if (streamWriter && fetcher->m_canPauseTransfer && !fetcher->m_isWaitingForSpace) {
+        // A transfer can only wait for space without blocking the network thread if a reader wakes it.
+        auto isWaitingForSpace = std::make_shared<std::atomic<bool>>(false);
+        auto engine = fetcher->m_engine;
+        auto handle = fetcher->m_curlWrapper.getCurlHandle();
+        if (streamWriter->setSpaceAvailableCallback([isWaitingForSpace, engine, handle] {
+                if (isWaitingForSpace->exchange(false)) {
+                    engine->resumeTransfer(handle);
+                }
+            })) {
+            fetcher->m_isWaitingForSpace = isWaitingForSpace;
+        } else {
+            ACSDK_DEBUG9(LX("bodyCallback").m("Writer does not notify of space, so writes block."));
+            fetcher->m_canPauseTransfer = false;
+        }
+    }
 
-    if (streamWriter) {
-        size_t targetNumBytes = size * nmemb;
+    // A resumed transfer delivers the data passed when it was paused again, so skip the part already written.
+    size_t totalBytesWritten = std::min(fetcher->m_bytesWrittenBeforePause, targetNumBytes);
+    fetcher->m_bytesWrittenBeforePause -= totalBytesWritten;
+    data += totalBytesWritten;
 
+    if (streamWriter) {
         while ((totalBytesWritten < targetNumBytes) && !fetcher->m_done) {
             auto writeStatus = avsCommon::avs::attachment::AttachmentWriter::WriteStatus::OK;
 
+            // Set before writing, so that a reader which frees space after the write finds none resumes the transfer.
+            if (fetcher->m_canPauseTransfer) {
+                *fetcher->m_isWaitingForSpace = true;
+            }
             size_t numBytesWritten = streamWriter->write(
                 data,
                 targetNumBytes - totalBytesWritten,
                 &writeStatus,
-                std::chrono::milliseconds(TIMEOUT_FOR_BLOCKING_WRITE));
+                fetcher->m_canPauseTransfer ? TIMEOUT_FOR_WRITE_BEFORE_PAUSE : TIMEOUT_FOR_BLOCKING_WRITE);
             totalBytesWritten += numBytesWritten;
             data += numBytesWritten;
+            fetcher->m_totalContentReceivedLength += numBytesWritten;
+            fetcher->m_currentContentReceivedLength += numBytesWritten;
 
             switch (writeStatus) {
                 case avsCommon::avs::attachment::AttachmentWriter::WriteStatus::CLOSED:
@@ -173,6 +210,14 @@ size_t LibCurlHttpContentFetcher::bodyCallback(char* data, size_t size, size_t n
                 case avsCommon::avs::attachment::AttachmentWriter::WriteStatus::ERROR_INTERNAL:
                     return totalBytesWritten;
                 case avsCommon::avs::attachment::AttachmentWriter::WriteStatus::TIMEDOUT:
+                    if (fetcher->m_canPauseTransfer && totalBytesWritten < targetNumBytes) {
+                        // The writer is full. Pause instead of blocking the transfers of other fetchers, until a
+                        // reader frees space.
+                        fetcher->m_bytesWrittenBeforePause = totalBytesWritten;
+                        fetcher->m_engine->onTransferPaused(fetcher->m_curlWrapper.getCurlHandle());
+                        return CURL_WRITEFUNC_PAUSE;
+                    }
+                    continue;
                 case avsCommon::avs::attachment::AttachmentWriter::WriteStatus::OK:
                     // might still have bytes to write
                     continue;
@@ -183,11 +228,11 @@ size_t LibCurlHttpContentFetcher::bodyCallback(char* data, size_t size, size_t n
             ACSDK_ERROR(LX("UnexpectedWriteStatus").d("writeStatus", static_cast<int>(writeStatus)));
             return 0;
         }
+        if (fetcher->m_canPauseTransfer) {
+            *fetcher->m_isWaitingForSpace = false;
+        }
     }
 
-    fetcher->m_totalContentReceivedLength += totalBytesWritten;
-    fetcher->m_currentContentReceivedLength += totalBytesWritten;
-
     ACSDK_DEBUG9(LX("bodyCallback")
                      .d("totalContentReceived", fetcher->m_totalContentReceivedLength)
                      .d("contentLength", fetcher->m_header.contentLength)
@@ -204,14 +249,20 @@ size_t LibCurlHttpContentFetcher::noopCallback(char* data, size_t size, size_t n
 
 LibCurlHttpContentFetcher::LibCurlHttpContentFetcher(
     const std::string& url,
-    const std::shared_ptr<LibcurlSetCurlOptionsCallbackInterface>& setCurlOptionsCallback) :
+    const std::shared_ptr<LibcurlSetCurlOptionsCallbackInterface>& setCurlOptionsCallback,
+    std::shared_ptr<LibcurlContentFetchEngine> engine) :
         m_state{HTTPContentFetcherInterface::State::INITIALIZED},
         m_url{url},
         m_effectiveUrl{url},
+        m_engine{std::move(engine)},
+        m_headerList{nullptr},
         m_currentContentReceivedLength{0},
         m_totalContentReceivedLength{0},
+        m_bytesWrittenBeforePause{0},
         m_done{false},
         m_isShutdown{false},
+        m_isTransferStarted{false},
+        m_canPauseTransfer{false},
         m_hasObjectBeenUsed{false} {
     m_headerFuture = m_headerPromise.get_future();
     if (setCurlOptionsCallback) {
@@ -264,6 +315,7 @@ bool LibCurlHttpContentFetcher::getBody(std::shared_ptr<avsCommon::avs::attachme
     }
     m_streamWriter = writer;
     stateTransition(State::FETCHING_BODY, true);
+    resumeTransfer();
     return true;
 }
 
@@ -271,6 +323,13 @@ void LibCurlHttpContentFetcher::shutdown() {
     ACSDK_DEBUG9(LX("shutdown"));
     m_isShutdown = true;
     stateTransition(State::BODY_DONE, true);
+    resumeTransfer();
+}
+
+void LibCurlHttpContentFetcher::resumeTransfer() {
+    if (m_isTransferStarted) {
+        m_engine->resumeTransfer(m_curlWrapper.getCurlHandle());
+    }
 }
 
 std::unique_ptr<avsCommon::utils::HTTPContent> LibCurlHttpContentFetcher::getContent(
@@ -345,7 +404,21 @@ std::unique_ptr<avsCommon::utils::HTTPContent> LibCurlHttpContentFetcher::getCon
         return nullptr;
     }
 
-    std::shared_ptr<avsCommon::avs::attachment::InProcessAttachment> stream = nullptr;
+    // libcurl can only pause transfers which use the network, so transfers of any other scheme (such as file://) keep
+    // blocking in the callbacks, and are performed on a private engine so that they don't hold up other fetchers.
+    std::string scheme = m_url.substr(0, m_url.find(':'));
+    std::transform(scheme.begin(), scheme.end(), scheme.begin(), ::tolower);
+    m_canPauseTransfer = "http" == scheme || "https" == scheme;
+    if (!m_engine || !m_canPauseTransfer) {
+        m_engine = LibcurlContentFetchEngine::create();
+        if (!m_engine) {
+            ACSDK_ERROR(LX("getContentFailed").d("reason", "createEngineFailed"));
+            curl_slist_free_all(headerList);
+            stateTransition(State::ERROR, false);
+            return nullptr;
+        }
+    }
+    m_headerList = headerList;
 
     // This flag will remain false if the caller of getContent() passed in their own writer.
     bool writerWasCreatedLocally = false;
@@ -363,41 +436,24 @@ std::unique_ptr<avsCommon::utils::HTTPContent> LibCurlHttpContentFetcher::getCon
                 return nullptr;
             }
             stateTransition(State::FETCHING_HEADER, true);
-            m_thread = std::thread([this, headerList]() {
-                auto curlMultiHandle = CurlMultiHandleWrapper::create();
-                if (!curlMultiHandle) {
-                    ACSDK_ERROR(LX("getContentFailed").d("reason", "curlMultiHandleWrapperCreateFailed"));
+            m_isTransferStarted = true;
+            m_engine->addTransfer(m_curlWrapper.getCurlHandle(), [this](CURLcode result) {
+                // The noop body callback ends the transfer as soon as the header has been received.
+                HTTPResponseCode finalResponseCode = HTTPResponseCode::HTTP_RESPONSE_CODE_UNDEFINED;
+                char* contentType = nullptr;
+                if (CURLE_FAILED_INIT == result) {
+                    ACSDK_ERROR(LX("getContentFailed").d("reason", "transferFailed"));
                     // Set the promises because of errors.
-                    m_header.responseCode = HTTPResponseCode::HTTP_RESPONSE_CODE_UNDEFINED;
+                    m_header.responseCode = finalResponseCode;
                     m_header.contentType = "";
-                    return;
-                }
-                curlMultiHandle->addHandle(m_curlWrapper.getCurlHandle());
-
-                int numTransfersLeft = 1;
-                HTTPResponseCode finalResponseCode;
-                char* contentType = nullptr;
-
-                while (numTransfersLeft && !m_isShutdown) {
-                    auto result = curlMultiHandle->perform(&numTransfersLeft);
-                    if (CURLM_CALL_MULTI_PERFORM == result) {
-                        continue;
-                    } else if (CURLM_OK != result) {
-                        ACSDK_ERROR(LX("getContentFailed").d("reason", "performFailed"));
-                        break;
-                    }
-
+                } else {
                     int finalResponseCodeId = 0;
                     auto curlReturnValue =
                         curl_easy_getinfo(m_curlWrapper.getCurlHandle(), CURLINFO_RESPONSE_CODE, &finalResponseCodeId);
                     finalResponseCode = intToHTTPResponseCode(finalResponseCodeId);
                     if (curlReturnValue != CURLE_OK) {
                         ACSDK_ERROR(LX("curlEasyGetInfoFailed").d("error", curl_easy_strerror(curlReturnValue)));
-                        break;
-                    }
-
-                    if (HTTPResponseCode::HTTP_RESPONSE_CODE_UNDEFINED != finalResponseCode &&
-                        !isRedirect(finalResponseCode)) {
+                    } else if (HTTPResponseCode::HTTP_RESPONSE_CODE_UNDEFINED != finalResponseCode) {
                         ACSDK_DEBUG9(LX("getContent").d("responseCode", finalResponseCode).sensitive("url", m_url));
                         curlReturnValue =
                             curl_easy_getinfo(m_curlWrapper.getCurlHandle(), CURLINFO_CONTENT_TYPE, &contentType);
@@ -408,26 +464,13 @@ std::unique_ptr<avsCommon::utils::HTTPContent> LibCurlHttpContentFetcher::getCon
                             ACSDK_ERROR(
                                 LX("getContent").d("contentType", "failedToGetContentType").sensitive("url", m_url));
                         }
-                        break;
-                    }
-
-                    int numTransfersUpdated = 0;
-                    result = curlMultiHandle->wait(WAIT_FOR_ACTIVITY_TIMEOUT, &numTransfersUpdated);
-                    if (result != CURLM_OK) {
-                        ACSDK_ERROR(LX("getContentFailed")
-                                        .d("reason", "multiWaitFailed")
-                                        .d("error", curl_multi_strerror(result)));
-                        break;
                     }
                 }
 
                 updateEffectiveURL();
 
                 // Free custom headers.
-                curl_slist_free_all(headerList);
-
-                // Abort any curl operation by removing the curl handle.
-                curlMultiHandle->removeHandle(m_curlWrapper.getCurlHandle());
+                releaseHeaderList();
             });
             break;
         case FetchOptions::ENTIRE_BODY:
@@ -444,117 +487,101 @@ std::unique_ptr<avsCommon::utils::HTTPContent> LibCurlHttpContentFetcher::getCon
                 return nullptr;
             }
 
-            m_thread = std::thread([this, writerWasCreatedLocally, headerList]() {
-                ACSDK_DEBUG9(LX("transferThread").sensitive("URL", m_url).m("start"));
-                auto curlMultiHandle = avsCommon::utils::libcurlUtils::CurlMultiHandleWrapper::create();
-                if (!curlMultiHandle) {
-                    ACSDK_ERROR(LX("getContentFailed").d("reason", "curlMultiHandleWrapperCreateFailed"));
-                    // Set the promises because of errors.
-                    m_header.responseCode = HTTPResponseCode::HTTP_RESPONSE_CODE_UNDEFINED;
-                    m_header.contentType = "";
-                    stateTransition(State::ERROR, false);
-                    return;
-                }
-                curlMultiHandle->addHandle(m_curlWrapper.getCurlHandle());
-
-                int numTransfersLeft = 1;
-                while (numTransfersLeft && !m_isShutdown) {
-                    ACSDK_DEBUG9(LX("transferThread").sensitive("URL", m_url).d("numTransfersLeft", numTransfersLeft));
-                    auto result = curlMultiHandle->perform(&numTransfersLeft);
-                    if (CURLM_CALL_MULTI_PERFORM == result) {
-                        continue;
-                    } else if (CURLM_OK != result) {
-                        ACSDK_ERROR(LX("getContentFailed").sensitive("URL", m_url).d("reason", "performFailed"));
-                        stateTransition(State::ERROR, false);
-                        return;
-                    }
-
-                    int numTransfersUpdated = 0;
-                    result = curlMultiHandle->wait(WAIT_FOR_ACTIVITY_TIMEOUT, &numTransfersUpdated);
-                    if (result != CURLM_OK) {
-                        ACSDK_ERROR(LX("getContentFailed")
-                                        .d("reason", "multiWaitFailed")
-                                        .d("error", curl_multi_strerror(result)));
-                        stateTransition(State::ERROR, false);
-                        return;
-                    }
-
-                    auto bytesRemaining = m_header.contentLength - m_currentContentReceivedLength;
-                    if (bytesRemaining < 0) {
-                        bytesRemaining = 0;
-                    }
-
-                    // There's still byte remaining to download, let's try to get the rest of the data by using range.
-                    if ((numTransfersLeft == 0) && bytesRemaining > 0) {
-                        // Remove the current curlHandle from the multiHandle first.
-                        curlMultiHandle->removeHandle(m_curlWrapper.getCurlHandle());
-
-                        // Reset the current content counters.
-                        m_header.contentLength = 0;
-                        m_currentContentReceivedLength = 0;
-
-                        // Set the range to start with total content that's been received so far to the end.
-                        std::ostringstream ss;
-                        ss << (m_totalContentReceivedLength) << "-";
-                        auto curlReturnValue =
-                            curl_easy_setopt(m_curlWrapper.getCurlHandle(), CURLOPT_RANGE, ss.str().c_str());
-                        if (curlReturnValue != CURLE_OK) {
-                            ACSDK_ERROR(
-                                LX("getContentFailed").d("reason", "setUserAgentFailed").d("error", curlReturnValue));
-                            stateTransition(State::ERROR, false);
-                            return;
-                        }
+            ACSDK_DEBUG9(LX("transfer").sensitive("URL", m_url).m("start"));
+            m_isTransferStarted = true;
+            m_engine->addTransfer(m_curlWrapper.getCurlHandle(), [this, writerWasCreatedLocally](CURLcode result) {
+                onBodyTransferCompleted(result, writerWasCreatedLocally);
+            });
+            break;
+        default:
+            stateTransition(State::ERROR, false);
+            return nullptr;
+    }
+    return nullptr;
+}
 
-                        // Add the curlHandle back to the mutliHandle.
-                        curlMultiHandle->addHandle(m_curlWrapper.getCurlHandle());
+void LibCurlHttpContentFetcher::onBodyTransferCompleted(CURLcode result, bool writerWasCreatedLocally) {
+    ACSDK_DEBUG9(LX("onBodyTransferCompleted").sensitive("URL", m_url).d("result", curl_easy_strerror(result)));
+    if (CURLE_FAILED_INIT == result) {
+        ACSDK_ERROR(LX("getContentFailed").sensitive("URL", m_url).d("reason", "transferFailed"));
+        releaseHeaderList();
+        stateTransition(State::ERROR, false);
+        return;
+    }
 
-                        // Set this to 1 so that we will try to perform() again.
-                        numTransfersLeft = 1;
+    auto bytesRemaining = m_header.contentLength - m_currentContentReceivedLength;
+    if (bytesRemaining < 0) {
+        bytesRemaining = 0;
+    }
 
-                        ACSDK_DEBUG9(LX("getContent")
-                                         .d("bytesRemaining", bytesRemaining)
-                                         .d("totalContentReceived", m_totalContentReceivedLength)
-                                         .d("restartingWithRange", ss.str()));
-                    }
-                }
+    // There's still byte remaining to download, let's try to get the rest of the data by using range.
+    if (!m_isShutdown && State::ERROR != getState() && bytesRemaining > 0) {
+        // Reset the current content counters.
+        m_header.contentLength = 0;
+        m_currentContentReceivedLength = 0;
+        m_bytesWrittenBeforePause = 0;
+
+        // Set the range to start with total content that's been received so far to the end.
+        std::ostringstream ss;
+        ss << (m_totalContentReceivedLength) << "-";
+        auto curlReturnValue = curl_easy_setopt(m_curlWrapper.getCurlHandle(), CURLOPT_RANGE, ss.str().c_str());
+        if (curlReturnValue != CURLE_OK) {
+            ACSDK_ERROR(LX("getContentFailed").d("reason", "setUserAgentFailed").d("error", curlReturnValue));
+            releaseHeaderList();
+            stateTransition(State::ERROR, false);
+            return;
+        }
 
-                updateEffectiveURL();
+        ACSDK_DEBUG9(LX("getContent")
+                         .d("bytesRemaining", bytesRemaining)
+                         .d("totalContentReceived", m_totalContentReceivedLength)
+                         .d("restartingWithRange", ss.str()));
 
-                /*
-                 * If the writer was created locally, its job is done and can be safely closed.
-                 */
-                if (writerWasCreatedLocally) {
-                    ACSDK_DEBUG9(LX("getContent").m("Closing the writer"));
-                    m_streamWriter->close();
-                }
+        // Add the curlHandle back to the engine, to perform the transfer again.
+        m_engine->addTransfer(m_curlWrapper.getCurlHandle(), [this, writerWasCreatedLocally](CURLcode result) {
+            onBodyTransferCompleted(result, writerWasCreatedLocally);
+        });
+        return;
+    }
 
-                /*
-                 * Note: If the writer was not created locally, its owner must ensure that it closes when
-                 * necessary. In the case of a livestream, if the writer is not closed the
-                 * LibCurlHttpContentFetcher will continue to download data indefinitely.
-                 */
-                m_done = true;
+    updateEffectiveURL();
 
-                // Free custom headers.
-                curl_slist_free_all(headerList);
+    /*
+     * If the writer was created locally, its job is done and can be safely closed.
+     */
+    if (writerWasCreatedLocally) {
+        ACSDK_DEBUG9(LX("getContent").m("Closing the writer"));
+        m_streamWriter->close();
+    }
 
-                // Abort any curl operation by removing the curl handle.
-                curlMultiHandle->removeHandle(m_curlWrapper.getCurlHandle());
+    /*
+     * Note: If the writer was not created locally, its owner must ensure that it closes when
+     * necessary. In the case of a livestream, if the writer is not closed the
+     * LibCurlHttpContentFetcher will continue to download data indefinitely.
+     */
+    m_done = true;
+
+    // Free custom headers.
+    releaseHeaderList();
+
+    auto state = getState();
+    // A transfer which failed before any of the body was received never completed its header.
+    auto failedBeforeBody = CURLE_OK != result && State::FETCHING_HEADER == state;
+    if (State::INITIALIZED == state || State::ERROR == state || failedBeforeBody) {
+        ACSDK_DEBUG9(LX("transfer").sensitive("URL", m_url).m("end with error"));
+        stateTransition(State::ERROR, false);
+    } else {
+        ACSDK_DEBUG9(LX("transfer").sensitive("URL", m_url).m("end"));
+        stateTransition(State::BODY_DONE, true);
+    }
+}
 
-                if (State::INITIALIZED == getState() || State::ERROR == getState()) {
-                    ACSDK_DEBUG9(LX("transferThread").sensitive("URL", m_url).m("end with error"));
-                    stateTransition(State::ERROR, false);
-                } else {
-                    ACSDK_DEBUG9(LX("transferThread").sensitive("URL", m_url).m("end"));
-                    stateTransition(State::BODY_DONE, true);
-                }
-            });
-            break;
-        default:
-            stateTransition(State::ERROR, false);
-            return nullptr;
+void LibCurlHttpContentFetcher::releaseHeaderList() {
+    if (m_headerList) {
+        curl_easy_setopt(m_curlWrapper.getCurlHandle(), CURLOPT_HTTPHEADER, nullptr);
+        curl_slist_free_all(m_headerList);
+        m_headerList = nullptr;
     }
-    return nullptr;
 }
 
 curl_slist* LibCurlHttpContentFetcher::getCustomHeaderList(const std::vector<std::string>& customHeaders) {
@@ -568,12 +595,18 @@ curl_slist* LibCurlHttpContentFetcher::getCustomHeaderList(const std::vector<std
 
 LibCurlHttpContentFetcher::~LibCurlHttpContentFetcher() {
     ACSDK_DEBUG9(LX("~LibCurlHttpContentFetcher").sensitive("URL", m_url));
-    if (m_thread.joinable()) {
+    if (m_isTransferStarted) {
         m_done = true;
         m_isShutdown = true;
         stateTransition(State::BODY_DONE, true);
-        m_thread.join();
+        // Abort any curl operation by removing the curl handle.
+        m_engine->removeTransfer(m_curlWrapper.getCurlHandle());
+        if (m_isWaitingForSpace) {
+            // The writer may outlive this fetcher, and must not resume a transfer which no longer exists.
+            m_streamWriter->setSpaceAvailableCallback(nullptr);
+        }
     }
+    releaseHeaderList();
 }
 
 void LibCurlHttpContentFetcher::reportInvalidStateTransitionAttempt(State currentState, State newState) {
@@ -0,0 +1,368 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <unordered_set>
+
+#include <AVSCommon/Utils/LibcurlUtils/LibcurlContentFetchEngine.h>
+#include <AVSCommon/Utils/Logger/Logger.h>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace libcurlUtils {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("LibcurlContentFetchEngine");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param event The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// The longest time to wait for network activity.
+static const std::chrono::milliseconds MAX_WAIT_FOR_ACTIVITY{1000};
+
+#if LIBCURL_VERSION_NUM >= 0x074400
+/// Whether @c curl_multi_poll() and @c curl_multi_wakeup() are available (libcurl 7.68.0 or later).
+#define ACSDK_CURL_MULTI_WAKEUP_SUPPORTED
+#else
+/**
+ * Without @c curl_multi_wakeup(), the network thread cannot be woken while it waits for network activity, so it
+ * waits at most this long before applying commands from other threads.
+ */
+static const std::chrono::milliseconds MAX_WAIT_WITHOUT_WAKEUP{10};
+#endif
+
+std::shared_ptr<LibcurlContentFetchEngine> LibcurlContentFetchEngine::create() {
+    auto multiHandle = CurlMultiHandleWrapper::create();
+    if (!multiHandle) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "createMultiHandleFailed"));
+        return nullptr;
+    }
+
+    auto shareHandle = CurlShareHandleWrapper::create();
+    if (!shareHandle) {
+        // Sharing is an optimization, so carry on without it.
+        ACSDK_WARN(LX("createShareHandleFailed"));
+    }
+
+    return std::shared_ptr<LibcurlContentFetchEngine>(
+        new LibcurlContentFetchEngine(std::move(multiHandle), shareHandle));
+}
+
+LibcurlContentFetchEngine::LibcurlContentFetchEngine(
+    std::unique_ptr<CurlMultiHandleWrapper> multiHandle,
+    std::shared_ptr<CurlShareHandleWrapper> shareHandle) :
+        m_multiHandle{std::move(multiHandle)},
+        m_shareHandle{std::move(shareHandle)},
+        m_nextResumeTime{std::chrono::steady_clock::time_point::max()},
+        m_commandCount{0},
+        m_appliedCommandCount{0},
+        m_isShutdown{false} {
+    m_networkThread = std::thread(&LibcurlContentFetchEngine::networkLoop, this);
+}
+
+LibcurlContentFetchEngine::~LibcurlContentFetchEngine() {
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_isShutdown = true;
+    }
+    m_wakeTrigger.notify_one();
+    wakeNetworkThread();
+    if (m_networkThread.joinable()) {
+        m_networkThread.join();
+    }
+
+    if (!m_transfers.empty()) {
+        ACSDK_WARN(LX("~LibcurlContentFetchEngine").d("reason", "transfersRemaining").d("count", m_transfers.size()));
+        std::vector<CURL*> handles;
+        for (const auto& transfer : m_transfers) {
+            handles.push_back(transfer.first);
+        }
+        for (auto handle : handles) {
+            stopTransfer(handle);
+        }
+    }
+    m_multiHandle.reset();
+}
+
+void LibcurlContentFetchEngine::addTransfer(CURL* handle, CompletionCallback onCompleted) {
+    if (!handle || !onCompleted) {
+        ACSDK_ERROR(LX("addTransferFailed").d("reason", !handle ? "nullHandle" : "nullCallback"));
+        if (onCompleted) {
+            onCompleted(CURLE_FAILED_INIT);
+        }
+        return;
+    }
+    std::unique_lock<std::mutex> lock{m_mutex};
+    if (m_isShutdown) {
+        lock.unlock();
+        ACSDK_ERROR(LX("addTransferFailed").d("reason", "engineShutdown"));
+        onCompleted(CURLE_FAILED_INIT);
+        return;
+    }
+    queueCommandLocked({Command::Type::ADD, handle, std::move(onCompleted)});
+}
+
+void LibcurlContentFetchEngine::removeTransfer(CURL* handle) {
+    if (!handle) {
+        return;
+    }
+    if (std::this_thread::get_id() == m_networkThread.get_id()) {
+        stopTransfer(handle);
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock{m_mutex};
+    if (m_isShutdown) {
+        // The network thread is stopping or stopped, and no longer runs any callbacks.
+        return;
+    }
+    auto commandNumber = queueCommandLocked({Command::Type::REMOVE, handle, nullptr});
+    m_commandsAppliedTrigger.wait(
+        lock, [this, commandNumber] { return m_appliedCommandCount >= commandNumber || m_isShutdown; });
+}
+
+void LibcurlContentFetchEngine::onTransferPaused(CURL* handle, std::chrono::steady_clock::time_point resumeTime) {
+    auto it = m_transfers.find(handle);
+    if (it == m_transfers.end()) {
+        ACSDK_ERROR(LX("onTransferPausedFailed").d("reason", "transferNotFound"));
+        return;
+    }
+    it->second.isPaused = true;
+    it->second.resumeTime = resumeTime;
+    m_nextResumeTime = std::min(m_nextResumeTime, resumeTime);
+}
+
+void LibcurlContentFetchEngine::resumeTransfer(CURL* handle) {
+    if (!handle) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock{m_mutex};
+    if (m_isShutdown) {
+        return;
+    }
+    queueCommandLocked({Command::Type::RESUME, handle, nullptr});
+}
+
+uint64_t LibcurlContentFetchEngine::queueCommandLocked(Command command) {
+    m_commands.push_back(std::move(command));
+    auto commandNumber = ++m_commandCount;
+    m_wakeTrigger.notify_one();
+    wakeNetworkThread();
+    return commandNumber;
+}
+
+void LibcurlContentFetchEngine::networkLoop() {
+    while (true) {
+        std::vector<Command> commands;
+        uint64_t commandCount;
+        {
+            std::unique_lock<std::mutex> lock{m_mutex};
+            if (m_transfers.empty()) {
+                m_wakeTrigger.wait(lock, [this] { return m_isShutdown || !m_commands.empty(); });
+            }
+            if (m_isShutdown) {
+                break;
+            }
+            commands.swap(m_commands);
+            commandCount = m_commandCount;
+        }
+
+        applyCommands(commands);
+        {
+            std::lock_guard<std::mutex> lock{m_mutex};
+            m_appliedCommandCount = commandCount;
+        }
+        m_commandsAppliedTrigger.notify_all();
+
+        if (m_transfers.empty()) {
+            continue;
+        }
+
+        int runningTransfers = 0;
+        auto result = m_multiHandle->perform(&runningTransfers);
+        while (CURLM_CALL_MULTI_PERFORM == result) {
+            result = m_multiHandle->perform(&runningTransfers);
+        }
+        if (result != CURLM_OK) {
+            failAllTransfers();
+            continue;
+        }
+        completeTransfers();
+
+        if (std::chrono::steady_clock::now() >= m_nextResumeTime) {
+            resumeDueTransfers();
+        }
+
+        if (!m_transfers.empty() && !waitForActivity()) {
+            failAllTransfers();
+        }
+    }
+
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_commandsAppliedTrigger.notify_all();
+}
+
+void LibcurlContentFetchEngine::applyCommands(const std::vector<Command>& commands) {
+    // A transfer removed by another thread must not be restarted by a completion callback that ran before the removal
+    // was applied.
+    std::unordered_set<CURL*> removedHandles;
+    for (const auto& command : commands) {
+        switch (command.type) {
+            case Command::Type::ADD:
+                if (removedHandles.count(command.handle) == 0) {
+                    startTransfer(command.handle, command.onCompleted);
+                }
+                break;
+            case Command::Type::REMOVE:
+                stopTransfer(command.handle);
+                removedHandles.insert(command.handle);
+                break;
+            case Command::Type::RESUME:
+                continueTransfer(command.handle);
+                break;
+        }
+    }
+}
+
+void LibcurlContentFetchEngine::startTransfer(CURL* handle, CompletionCallback onCompleted) {
+    if (m_transfers.count(handle) != 0) {
+        ACSDK_ERROR(LX("startTransferFailed").d("reason", "transferAlreadyRunning"));
+        return;
+    }
+    if (m_shareHandle && !m_shareHandle->attach(handle)) {
+        ACSDK_WARN(LX("attachShareHandleFailed"));
+    }
+    if (m_multiHandle->addHandle(handle) != CURLM_OK) {
+        if (m_shareHandle) {
+            m_shareHandle->detach(handle);
+        }
+        onCompleted(CURLE_FAILED_INIT);
+        return;
+    }
+    m_transfers[handle] = {std::move(onCompleted), false, std::chrono::steady_clock::time_point::max()};
+}
+
+LibcurlContentFetchEngine::CompletionCallback LibcurlContentFetchEngine::stopTransfer(CURL* handle) {
+    auto it = m_transfers.find(handle);
+    if (it == m_transfers.end()) {
+        return nullptr;
+    }
+    auto onCompleted = std::move(it->second.onCompleted);
+    m_transfers.erase(it);
+    m_multiHandle->removeHandle(handle);
+    // Detach the handle from the share handle, so that the handle and the engine can be destroyed in any order.
+    if (m_shareHandle) {
+        m_shareHandle->detach(handle);
+    }
+    return onCompleted;
+}
+
+void LibcurlContentFetchEngine::completeTransfers() {
+    int messagesInQueue = 0;
+    while (auto message = m_multiHandle->infoRead(&messagesInQueue)) {
+        if (message->msg != CURLMSG_DONE) {
+            continue;
+        }
+        auto result = message->data.result;
+        auto onCompleted = stopTransfer(message->easy_handle);
+        if (onCompleted) {
+            onCompleted(result);
+        }
+    }
+}
+
+void LibcurlContentFetchEngine::failAllTransfers() {
+    ACSDK_ERROR(LX("failAllTransfers").d("count", m_transfers.size()));
+    std::vector<CURL*> handles;
+    for (const auto& transfer : m_transfers) {
+        handles.push_back(transfer.first);
+    }
+    for (auto handle : handles) {
+        auto onCompleted = stopTransfer(handle);
+        if (onCompleted) {
+            onCompleted(CURLE_FAILED_INIT);
+        }
+    }
+}
+
+void LibcurlContentFetchEngine::continueTransfer(CURL* handle) {
+    auto it = m_transfers.find(handle);
+    if (it == m_transfers.end() || !it->second.isPaused) {
+        return;
+    }
+    it->second.isPaused = false;
+    it->second.resumeTime = std::chrono::steady_clock::time_point::max();
+    // Resuming a transfer runs its write callback, which may pause it again.
+    auto result = curl_easy_pause(handle, CURLPAUSE_CONT);
+    if (result != CURLE_OK) {
+        ACSDK_ERROR(LX("resumeTransferFailed").d("error", curl_easy_strerror(result)));
+    }
+}
+
+void LibcurlContentFetchEngine::resumeDueTransfers() {
+    auto now = std::chrono::steady_clock::now();
+    m_nextResumeTime = std::chrono::steady_clock::time_point::max();
+    std::vector<CURL*> dueHandles;
+    for (const auto& transfer : m_transfers) {
+        if (!transfer.second.isPaused) {
+            continue;
+        }
+        if (transfer.second.resumeTime <= now) {
+            dueHandles.push_back(transfer.first);
+        } else {
+            m_nextResumeTime = std::min(m_nextResumeTime, transfer.second.resumeTime);
+        }
+    }
+    for (auto handle : dueHandles) {
+        continueTransfer(handle);
+    }
+}
+
+bool LibcurlContentFetchEngine::waitForActivity() {
+    auto timeout = MAX_WAIT_FOR_ACTIVITY;
+    if (m_nextResumeTime != std::chrono::steady_clock::time_point::max()) {
+        auto untilResume = std::chrono::duration_cast<std::chrono::milliseconds>(
+            m_nextResumeTime - std::chrono::steady_clock::now());
+        timeout = std::max(std::chrono::milliseconds::zero(), std::min(timeout, untilResume));
+    }
+    int countHandlesUpdated = 0;
+#ifdef ACSDK_CURL_MULTI_WAKEUP_SUPPORTED
+    auto result = curl_multi_poll(
+        m_multiHandle->getCurlHandle(), nullptr, 0, static_cast<int>(timeout.count()), &countHandlesUpdated);
+    if (result != CURLM_OK) {
+        ACSDK_ERROR(LX("curlMultiPollFailed").d("error", curl_multi_strerror(result)));
+        return false;
+    }
+    return true;
+#else
+    return m_multiHandle->wait(std::min(timeout, MAX_WAIT_WITHOUT_WAKEUP), &countHandlesUpdated) == CURLM_OK;
+#endif
+}
+
+void LibcurlContentFetchEngine::wakeNetworkThread() {
+#ifdef ACSDK_CURL_MULTI_WAKEUP_SUPPORTED
+    curl_multi_wakeup(m_multiHandle->getCurlHandle());
+#endif
+}
+
+}  // namespace libcurlUtils
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
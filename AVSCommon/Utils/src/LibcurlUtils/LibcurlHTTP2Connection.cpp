@@ -45,11 +45,78 @@ static const std::string TAG("LibcurlHTTP2Connection");
  */
 #define LX_P(event) LX(event).p("this", this)
 
+#if LIBCURL_VERSION_NUM >= 0x074400
+/// Whether @c curl_multi_poll() and @c curl_multi_wakeup() are available (libcurl 7.68.0 or later).
+#define ACSDK_CURL_MULTI_WAKEUP_SUPPORTED
+
+/**
+ * Timeout for curl_multi_poll while no stream is paused, or the paused streams are resumed when their sources have more
+ * data.  The network loop is woken when a request is queued or cancelled, or a paused source has more data, so this only
+ * bounds how late a stalled stream is detected.
+ */
+const static std::chrono::milliseconds WAIT_FOR_ACTIVITY_TIMEOUT(1000);
+#else
 /// Timeout for curl_multi_wait
 const static std::chrono::milliseconds WAIT_FOR_ACTIVITY_TIMEOUT(50);
-/// Timeout for curl_multi_wait while all non-intermittent HTTP/2 streams are paused.
+#endif
+/// Timeout for curl_multi_wait while an HTTP/2 stream is paused and has to be polled to be resumed.
 const static std::chrono::milliseconds WAIT_FOR_ACTIVITY_WHILE_STREAMS_PAUSED_TIMEOUT(10);
 
+/**
+ * Wakes the network loop of a @c LibcurlHTTP2Connection while it waits for activity on its multi handle.  This is
+ * thread-safe, and safe to use after the connection is destroyed.
+ */
+class LibcurlHTTP2Connection::NetworkLoopWaker {
+public:
+    /**
+     * Set the multi handle that the network loop waits on.
+     *
+     * @param multi The multi handle, or @c nullptr before it is destroyed.
+     */
+    void setMultiHandle(CURLM* multi) {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_multi = multi;
+    }
+
+    /**
+     * Wake the network loop if it is waiting for activity.
+     */
+    void wake() {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_isWoken = true;
+        m_wakeTrigger.notify_all();
+#ifdef ACSDK_CURL_MULTI_WAKEUP_SUPPORTED
+        if (m_multi) {
+            curl_multi_wakeup(m_multi);
+        }
+#endif
+    }
+
+    /**
+     * Wait for a call to @c wake(), unless there has been one since the last wait.
+     *
+     * @param timeout The maximum time to wait.
+     */
+    void waitForWake(std::chrono::steady_clock::duration timeout) {
+        std::unique_lock<std::mutex> lock{m_mutex};
+        m_wakeTrigger.wait_for(lock, timeout, [this] { return m_isWoken; });
+        m_isWoken = false;
+    }
+
+private:
+    /// Serializes access to @c m_multi and @c m_isWoken.
+    std::mutex m_mutex;
+
+    /// Notified by @c wake().
+    std::condition_variable m_wakeTrigger;
+
+    /// The multi handle that the network loop waits on.
+    CURLM* m_multi = nullptr;
+
+    /// Whether @c wake() has been called since the last wait.
+    bool m_isWoken = false;
+};
+
 #ifdef ACSDK_OPENSSL_MIN_VER_REQUIRED
 /**
  * This function checks the minimum version of OpenSSL required and prints a warning if the version is too old or
@@ -123,10 +190,13 @@ static bool performCurlChecks() {
 }
 
 LibcurlHTTP2Connection::LibcurlHTTP2Connection(
-    const std::shared_ptr<LibcurlSetCurlOptionsCallbackInterface>& setCurlOptionsCallback) :
+    const std::shared_ptr<LibcurlSetCurlOptionsCallbackInterface>& setCurlOptionsCallback,
+    const std::shared_ptr<CurlShareHandleWrapper>& shareHandle) :
         m_isStopping{false},
-        m_setCurlOptionsCallback{setCurlOptionsCallback} {
+        m_setCurlOptionsCallback{setCurlOptionsCallback},
+        m_shareHandle{shareHandle} {
     ACSDK_DEBUG5(LX_P("init"));
+    m_waker = std::make_shared<NetworkLoopWaker>();
     m_networkThread = std::thread(&LibcurlHTTP2Connection::networkLoop, this);
 }
 
@@ -141,16 +211,18 @@ bool LibcurlHTTP2Connection::createMultiHandle() {
         ACSDK_ERROR(LX_P("initFailed").d("reason", "enableHTTP2PipeliningFailed"));
         return false;
     }
+    m_waker->setMultiHandle(m_multi->getCurlHandle());
 
     return true;
 }
 
 std::shared_ptr<LibcurlHTTP2Connection> LibcurlHTTP2Connection::create(
-    const std::shared_ptr<LibcurlSetCurlOptionsCallbackInterface>& setCurlOptionsCallback) {
+    const std::shared_ptr<LibcurlSetCurlOptionsCallbackInterface>& setCurlOptionsCallback,
+    const std::shared_ptr<CurlShareHandleWrapper>& shareHandle) {
     if (!performCurlChecks()) {
         return nullptr;
     }
-    return std::shared_ptr<LibcurlHTTP2Connection>(new LibcurlHTTP2Connection(setCurlOptionsCallback));
+    return std::shared_ptr<LibcurlHTTP2Connection>(new LibcurlHTTP2Connection(setCurlOptionsCallback, shareHandle));
 }
 
 LibcurlHTTP2Connection::~LibcurlHTTP2Connection() {
@@ -167,6 +239,7 @@ void LibcurlHTTP2Connection::setIsStopping() {
     std::lock_guard<std::mutex> lock(m_mutex);
     m_isStopping = true;
     m_cv.notify_one();
+    m_waker->wake();
 }
 
 std::shared_ptr<LibcurlHTTP2Request> LibcurlHTTP2Connection::dequeueRequest() {
@@ -179,21 +252,80 @@ std::shared_ptr<LibcurlHTTP2Request> LibcurlHTTP2Connection::dequeueRequest() {
     return result;
 }
 
-void LibcurlHTTP2Connection::processNextRequest() {
-    auto stream = dequeueRequest();
-    if (!stream) {
-        return;
+int LibcurlHTTP2Connection::processQueuedRequests() {
+    int count = 0;
+    while (auto stream = dequeueRequest()) {
+        stream->setTimeOfLastTransfer();
+        if (m_shareHandle && !m_shareHandle->attach(stream->getCurlHandle())) {
+            // Sharing the caches is an optimization, so carry on without it.
+            ACSDK_WARN(
+                LX_P("processQueuedRequests").d("reason", "attachShareHandleFailed").d("streamId", stream->getId()));
+        }
+        auto result = m_multi->addHandle(stream->getCurlHandle());
+        if (CURLM_OK == result) {
+            auto handle = stream->getCurlHandle();
+            ACSDK_DEBUG9(LX_P("insertActiveStream").d("handle", handle).d("streamId", stream->getId()));
+            m_activeStreams[handle] = stream;
+            count++;
+        } else {
+            ACSDK_ERROR(
+                LX_P("processQueuedRequests").d("reason", "addHandleFailed").d("error", curl_multi_strerror(result)));
+            if (m_shareHandle) {
+                m_shareHandle->detach(stream->getCurlHandle());
+            }
+            stream->reportCompletion(HTTP2ResponseFinishedStatus::INTERNAL_ERROR);
+        }
     }
-    stream->setTimeOfLastTransfer();
-    auto result = m_multi->addHandle(stream->getCurlHandle());
-    if (CURLM_OK == result) {
-        auto handle = stream->getCurlHandle();
-        ACSDK_DEBUG9(LX_P("insertActiveStream").d("handle", handle).d("streamId", stream->getId()));
-        m_activeStreams[handle] = stream;
-    } else {
-        ACSDK_ERROR(LX_P("processNextRequest").d("reason", "addHandleFailed").d("error", curl_multi_strerror(result)));
-        stream->reportCompletion(HTTP2ResponseFinishedStatus::INTERNAL_ERROR);
+    return count;
+}
+
+bool LibcurlHTTP2Connection::waitForActivity() {
+    bool paused = false;
+    for (const auto& entry : m_activeStreams) {
+        const auto& stream = entry.second;
+        if (!stream->isPaused()) {
+            continue;
+        }
+#ifdef ACSDK_CURL_MULTI_WAKEUP_SUPPORTED
+        // The source of this stream wakes the network loop when it has more data, so it need not be polled.
+        if (stream->isPausedUntilDataAvailable()) {
+            continue;
+        }
+#endif
+        paused = true;
+        break;
+    }
+    // A paused stream is resumed when the wait ends, so do not wait long for other activity.
+    auto multiWaitTimeout = paused ? WAIT_FOR_ACTIVITY_WHILE_STREAMS_PAUSED_TIMEOUT : WAIT_FOR_ACTIVITY_TIMEOUT;
+    bool allPaused = paused && areStreamsPaused();
+    auto before = std::chrono::steady_clock::now();
+
+    int numTransfersUpdated = 0;
+#ifdef ACSDK_CURL_MULTI_WAKEUP_SUPPORTED
+    auto result = curl_multi_poll(
+        m_multi->getCurlHandle(), nullptr, 0, static_cast<int>(multiWaitTimeout.count()), &numTransfersUpdated);
+#else
+    auto result = m_multi->wait(multiWaitTimeout, &numTransfersUpdated);
+#endif
+    if (result != CURLM_OK) {
+        ACSDK_ERROR(LX_P("networkLoopStopping").d("reason", "multiWaitFailed").d("error", curl_multi_strerror(result)));
+        return false;
     }
+
+    // @note curl_multi_wait will return immediately even if all streams are paused, because HTTP/2 streams
+    // are full-duplex - so activity may have occurred on the other side. Therefore, if our intent is to pause
+    // transfers to give the readers / writers time to catch up, we must perform a local wait of our own.  A new
+    // request, more data from a paused source, or a call to disconnect() ends the wait early.
+    if (allPaused) {
+        auto elapsed = std::chrono::steady_clock::now() - before;
+        auto remaining = multiWaitTimeout - elapsed;
+
+        // sanity check that remainingMs is valid before waiting.
+        if (remaining.count() > 0 && remaining <= WAIT_FOR_ACTIVITY_WHILE_STREAMS_PAUSED_TIMEOUT) {
+            m_waker->waitForWake(remaining);
+        }
+    }
+    return true;
 }
 
 void LibcurlHTTP2Connection::networkLoop() {
@@ -209,13 +341,13 @@ void LibcurlHTTP2Connection::networkLoop() {
             std::unique_lock<std::mutex> lock(m_mutex);
             m_cv.wait(lock, [this] { return m_isStopping || !m_requestQueue.empty(); });
             if (m_isStopping) {
+                m_waker->setMultiHandle(nullptr);
+                m_multi.reset();
                 break;
             }
         }
 
-        processNextRequest();
-
-        int numTransfersLeft = 1;  // just dequeued the first request.
+        int numTransfersLeft = processQueuedRequests();
         // Call perform repeatedly to transfer data on active streams.
         while (numTransfersLeft > 0 && !isStopping()) {
             auto result = m_multi->perform(&numTransfersLeft);
@@ -235,41 +367,17 @@ void LibcurlHTTP2Connection::networkLoop() {
                 break;
             }
 
-            processNextRequest();
-
-            auto before = std::chrono::time_point<std::chrono::steady_clock>::max();
-            auto multiWaitTimeout = WAIT_FOR_ACTIVITY_TIMEOUT;
-            bool paused = areStreamsPaused();
-            if (paused) {
-                multiWaitTimeout = WAIT_FOR_ACTIVITY_WHILE_STREAMS_PAUSED_TIMEOUT;
-                before = std::chrono::steady_clock::now();
-            }
+            // Requests added here are not yet counted by perform().
+            numTransfersLeft += processQueuedRequests();
 
-            int numTransfersUpdated = 0;
-            result = m_multi->wait(multiWaitTimeout, &numTransfersUpdated);
-            if (result != CURLM_OK) {
-                ACSDK_ERROR(
-                    LX_P("networkLoopStopping").d("reason", "multiWaitFailed").d("error", curl_multi_strerror(result)));
+            if (!waitForActivity()) {
                 setIsStopping();
                 break;
             }
-
-            // @note curl_multi_wait will return immediately even if all streams are paused, because HTTP/2 streams
-            // are full-duplex - so activity may have occurred on the other side. Therefore, if our intent is to pause
-            // transfers to give the readers / writers time to catch up, we must perform a local sleep of our own.
-            if (paused) {
-                auto after = std::chrono::steady_clock::now();
-                auto elapsed = after - before;
-                auto remaining = multiWaitTimeout - elapsed;
-
-                // sanity check that remainingMs is valid before performing a sleep.
-                if (remaining.count() > 0 && remaining <= WAIT_FOR_ACTIVITY_WHILE_STREAMS_PAUSED_TIMEOUT) {
-                    std::this_thread::sleep_for(remaining);
-                }
-            }
             unPauseActiveStreams();
         }
         cancelAllStreams();
+        m_waker->setMultiHandle(nullptr);
         m_multi.reset();
     }
 
@@ -278,6 +386,9 @@ void LibcurlHTTP2Connection::networkLoop() {
 
 std::shared_ptr<HTTP2RequestInterface> LibcurlHTTP2Connection::createAndSendRequest(const HTTP2RequestConfig& config) {
     auto req = std::make_shared<LibcurlHTTP2Request>(config, m_setCurlOptionsCallback, config.getId());
+    auto waker = m_waker;
+    req->setOnCancelled([waker] { waker->wake(); });
+    req->setOnDataAvailable([waker] { waker->wake(); });
     addStream(req);
     return req;
 }
@@ -329,6 +440,7 @@ bool LibcurlHTTP2Connection::addStream(std::shared_ptr<LibcurlHTTP2Request> stre
     }
     m_requestQueue.push_back(std::move(stream));
     m_cv.notify_one();
+    m_waker->wake();
     return true;
 }
 
@@ -431,6 +543,9 @@ bool LibcurlHTTP2Connection::releaseStream(LibcurlHTTP2Request& stream) {
     auto handle = stream.getCurlHandle();
     ACSDK_DEBUG9(LX_P("releaseStream").d("streamId", stream.getId()));
     auto result = m_multi->removeHandle(handle);
+    if (m_shareHandle && CURLM_OK == result) {
+        m_shareHandle->detach(handle);
+    }
     m_activeStreams.erase(handle);
     if (result != CURLM_OK) {
         ACSDK_ERROR(LX_P("releaseStreamFailed").d("reason", "removeHandleFailed").d("streamId", stream.getId()));
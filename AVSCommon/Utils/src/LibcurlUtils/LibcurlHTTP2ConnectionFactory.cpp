@@ -41,7 +41,11 @@ std::shared_ptr<avsCommon::utils::http2::HTTP2ConnectionFactoryInterface> Libcur
 
 LibcurlHTTP2ConnectionFactory::LibcurlHTTP2ConnectionFactory(
     const std::shared_ptr<LibcurlSetCurlOptionsCallbackFactoryInterface>& curlSetOptionsCallbackFactory) :
-        m_setCurlOptionsCallbackFactory{curlSetOptionsCallbackFactory} {
+        m_setCurlOptionsCallbackFactory{curlSetOptionsCallbackFactory},
+        m_shareHandle{CurlShareHandleWrapper::create()} {
+    if (!m_shareHandle) {
+        ACSDK_WARN(LX("createShareHandleFailed").m("connections will not share DNS and TLS session caches"));
+    }
 }
 
 std::shared_ptr<avsCommon::utils::http2::HTTP2ConnectionInterface> LibcurlHTTP2ConnectionFactory::
@@ -53,7 +57,7 @@ std::shared_ptr<avsCommon::utils::http2::HTTP2ConnectionInterface> LibcurlHTTP2C
         setCurlOptionsCallback = m_setCurlOptionsCallbackFactory->createSetCurlOptionsCallback();
     }
 
-    auto result = LibcurlHTTP2Connection::create(setCurlOptionsCallback);
+    auto result = LibcurlHTTP2Connection::create(setCurlOptionsCallback, m_shareHandle);
     return result;
 }
 
@@ -58,6 +58,7 @@ size_t LibcurlHTTP2Request::writeCallback(char* data, size_t size, size_t nmemb,
                 return length;
             case HTTP2ReceiveDataStatus::PAUSE:
                 stream->m_isPaused = true;
+                stream->m_isPausedUntilPolled = true;
                 return CURL_WRITEFUNC_PAUSE;
             case HTTP2ReceiveDataStatus ::ABORT:
                 return 0;
@@ -108,6 +109,9 @@ size_t LibcurlHTTP2Request::readCallback(char* data, size_t size, size_t nmemb,
                 return result.size;
             case HTTP2SendStatus::PAUSE:
                 stream->m_isPaused = true;
+                if (!stream->m_sourceNotifiesDataAvailable) {
+                    stream->m_isPausedUntilPolled = true;
+                }
                 return CURL_READFUNC_PAUSE;
             case HTTP2SendStatus::COMPLETE:
                 return 0;
@@ -147,6 +151,8 @@ LibcurlHTTP2Request::LibcurlHTTP2Request(
         m_stream{std::move(id)},
         m_isIntermittentTransferExpected{config.isIntermittentTransferExpected()},
         m_isPaused{false},
+        m_isPausedUntilPolled{false},
+        m_sourceNotifiesDataAvailable{false},
         m_isCancelled{false},
         m_connectTimeout{std::chrono::milliseconds{0}} {
     switch (config.getRequestType()) {
@@ -218,8 +224,15 @@ bool LibcurlHTTP2Request::isIntermittentTransferExpected() const {
     return m_isIntermittentTransferExpected;
 }
 
+LibcurlHTTP2Request::~LibcurlHTTP2Request() {
+    if (m_sourceNotifiesDataAvailable) {
+        m_source->setDataAvailableCallback(nullptr);
+    }
+}
+
 void LibcurlHTTP2Request::unPause() {
     m_isPaused = false;
+    m_isPausedUntilPolled = false;
     m_stream.pause(CURLPAUSE_CONT);
 }
 
@@ -227,12 +240,28 @@ bool LibcurlHTTP2Request::isPaused() const {
     return m_isPaused;
 }
 
+bool LibcurlHTTP2Request::isPausedUntilDataAvailable() const {
+    return m_isPaused && !m_isPausedUntilPolled;
+}
+
 bool LibcurlHTTP2Request::isCancelled() const {
     return m_isCancelled;
 }
 
+void LibcurlHTTP2Request::setOnCancelled(std::function<void()> onCancelled) {
+    m_onCancelled = std::move(onCancelled);
+}
+
+bool LibcurlHTTP2Request::setOnDataAvailable(std::function<void()> onDataAvailable) {
+    m_sourceNotifiesDataAvailable = m_source && m_source->setDataAvailableCallback(std::move(onDataAvailable));
+    return m_sourceNotifiesDataAvailable;
+}
+
 bool LibcurlHTTP2Request::cancel() {
     m_isCancelled = true;
+    if (m_onCancelled) {
+        m_onCancelled();
+    }
     return true;
 }
 
@@ -0,0 +1,276 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include "AVSCommon/Utils/Logger/AsyncConsoleLogger.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+/// Text appended to entries which were truncated to fit in the ring.
+static const std::string TRUNCATED_SUFFIX = "...<truncated>";
+
+/// The minimum size of the text of an entry.
+static const size_t MIN_ENTRY_SIZE = 64;
+
+/**
+ * Rounds @c value up to a power of two.
+ *
+ * @param value The value to round.
+ * @return The smallest power of two which is not less than @c value, and at least 2.
+ */
+static size_t roundUpToPowerOfTwo(size_t value) {
+    size_t result = 2;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+AsyncConsoleLogger::AsyncConsoleLogger(
+    Level level,
+    std::ostream& stream,
+    std::shared_ptr<std::mutex> streamMutex,
+    size_t numEntries,
+    size_t maxEntrySize,
+    std::chrono::milliseconds flushInterval) :
+        Logger(level),
+        m_stream(stream),
+        m_streamMutex{streamMutex ? streamMutex : std::make_shared<std::mutex>()},
+        m_capacity{roundUpToPowerOfTwo(numEntries)},
+        m_maxEntrySize{std::max(maxEntrySize, MIN_ENTRY_SIZE)},
+        m_flushInterval{flushInterval},
+        m_slots{new Slot[m_capacity]},
+        m_text(m_capacity * m_maxEntrySize),
+        m_producePosition{0},
+        m_consumePosition{0},
+        m_dropped{0},
+        m_droppedReported{0},
+        m_consumerSleeping{false},
+        m_stop{false},
+        m_flushRequests{0} {
+    for (size_t i = 0; i < m_capacity; ++i) {
+        m_slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    m_consumerThread = std::thread(&AsyncConsoleLogger::runConsumer, this);
+}
+
+AsyncConsoleLogger::~AsyncConsoleLogger() {
+    {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_stop = true;
+    }
+    m_wakeCondition.notify_one();
+    if (m_consumerThread.joinable()) {
+        m_consumerThread.join();
+    }
+}
+
+void AsyncConsoleLogger::emit(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const char* text) {
+    size_t position;
+    auto slot = claimSlot(level, time, threadMoniker, &position);
+    if (!slot) {
+        return;
+    }
+    auto destination = &m_text[(position & (m_capacity - 1)) * m_maxEntrySize];
+    auto length = text ? std::strlen(text) : 0;
+    slot->isRecord = false;
+    slot->truncated = length >= m_maxEntrySize;
+    if (slot->truncated) {
+        length = m_maxEntrySize - 1;
+    }
+    std::memcpy(destination, text, length);
+    destination[length] = '\0';
+    publishSlot(slot, position);
+}
+
+void AsyncConsoleLogger::emitRecord(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const LogRecord& record) {
+    static_assert(std::is_trivially_copyable<LogRecord>::value, "LogRecord is copied into the ring with memcpy");
+    if (sizeof(LogRecord) > m_maxEntrySize) {
+        // The record does not fit in a slot, so render it here and queue the text instead.
+        Logger::emitRecord(level, time, threadMoniker, record);
+        return;
+    }
+    size_t position;
+    auto slot = claimSlot(level, time, threadMoniker, &position);
+    if (!slot) {
+        return;
+    }
+    slot->isRecord = true;
+    slot->truncated = false;
+    std::memcpy(&m_text[(position & (m_capacity - 1)) * m_maxEntrySize], &record, sizeof(LogRecord));
+    publishSlot(slot, position);
+}
+
+AsyncConsoleLogger::Slot* AsyncConsoleLogger::claimSlot(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    size_t* position) {
+    // Claim a slot.  This is the producer side of a bounded multi-producer queue: a slot at position p is free when its
+    // sequence number is p, and the slot is still in use by the consumer when its sequence number is p-capacity+1.
+    auto claimed = m_producePosition.load(std::memory_order_relaxed);
+    Slot* slot;
+    while (true) {
+        slot = &m_slots[claimed & (m_capacity - 1)];
+        auto sequence = slot->sequence.load(std::memory_order_acquire);
+        auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(claimed);
+        if (0 == difference) {
+            if (m_producePosition.compare_exchange_weak(claimed, claimed + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        } else {
+            claimed = m_producePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->level = level;
+    slot->time = time;
+    std::strncpy(slot->threadMoniker, threadMoniker ? threadMoniker : "", MAX_MONIKER_SIZE - 1);
+    slot->threadMoniker[MAX_MONIKER_SIZE - 1] = '\0';
+    *position = claimed;
+    return slot;
+}
+
+void AsyncConsoleLogger::publishSlot(Slot* slot, size_t position) {
+    slot->sequence.store(position + 1, std::memory_order_release);
+
+    // Only wake the background thread early when the ring is filling up; otherwise it wakes on its own.
+    // A missed wake-up only delays the batch until the flush interval elapses.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (position + 1 - m_consumePosition.load(std::memory_order_relaxed) >= m_capacity / 2 &&
+        m_consumerSleeping.load()) {
+        std::lock_guard<std::mutex> lock(m_wakeMutex);
+        m_wakeCondition.notify_one();
+    }
+}
+
+void AsyncConsoleLogger::flush() {
+    auto target = m_producePosition.load();
+    std::unique_lock<std::mutex> lock(m_wakeMutex);
+    m_flushRequests++;
+    m_wakeCondition.notify_one();
+    m_flushedCondition.wait(lock, [this, target] { return m_consumePosition.load() >= target || m_stop; });
+    m_flushRequests--;
+}
+
+uint64_t AsyncConsoleLogger::getDroppedCount() const {
+    return m_dropped;
+}
+
+size_t AsyncConsoleLogger::getCapacity() const {
+    return m_capacity;
+}
+
+bool AsyncConsoleLogger::hasReadyEntry() const {
+    auto position = m_consumePosition.load(std::memory_order_relaxed);
+    return m_slots[position & (m_capacity - 1)].sequence.load(std::memory_order_acquire) == position + 1;
+}
+
+size_t AsyncConsoleLogger::writeBatch() {
+    std::string batch;
+    size_t count = 0;
+    auto position = m_consumePosition.load(std::memory_order_relaxed);
+    while (count < m_capacity) {
+        auto& slot = m_slots[position & (m_capacity - 1)];
+        if (slot.sequence.load(std::memory_order_acquire) != position + 1) {
+            break;
+        }
+        const char* text = &m_text[(position & (m_capacity - 1)) * m_maxEntrySize];
+        if (slot.isRecord) {
+            LogRecord record;
+            std::memcpy(&record, text, sizeof(LogRecord));
+            LogEntry entry(record);
+            batch += m_logFormatter.format(slot.level, slot.time, slot.threadMoniker, entry.c_str());
+        } else {
+            batch += m_logFormatter.format(slot.level, slot.time, slot.threadMoniker, text);
+        }
+        if (slot.truncated) {
+            batch += TRUNCATED_SUFFIX;
+        }
+        batch += '\n';
+        // Hand the slot back to the producers for the next lap around the ring.
+        slot.sequence.store(position + m_capacity, std::memory_order_release);
+        position++;
+        count++;
+    }
+
+    auto dropped = m_dropped.load(std::memory_order_relaxed);
+    if (dropped != m_droppedReported) {
+        std::string text = "AsyncConsoleLogger:entriesDropped:count=" + std::to_string(dropped - m_droppedReported) +
+                           ",total=" + std::to_string(dropped);
+        batch += m_logFormatter.format(Level::WARN, std::chrono::system_clock::now(), "", text.c_str());
+        batch += '\n';
+        m_droppedReported = dropped;
+    }
+
+    if (!batch.empty()) {
+        std::lock_guard<std::mutex> lock(*m_streamMutex);
+        m_stream << batch << std::flush;
+    }
+    m_consumePosition.store(position);
+    return count;
+}
+
+void AsyncConsoleLogger::runConsumer() {
+    while (true) {
+        auto written = writeBatch();
+
+        std::unique_lock<std::mutex> lock(m_wakeMutex);
+        m_flushedCondition.notify_all();
+        if (written > 0 || m_flushRequests > 0) {
+            continue;
+        }
+        if (m_stop) {
+            // Write anything emitted since the last batch before stopping.
+            if (hasReadyEntry()) {
+                continue;
+            }
+            break;
+        }
+        m_consumerSleeping = true;
+        m_wakeCondition.wait_for(lock, m_flushInterval, [this] {
+            return m_stop || m_flushRequests > 0 ||
+                m_producePosition.load() - m_consumePosition.load() >= m_capacity / 2;
+        });
+        m_consumerSleeping = false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_wakeMutex);
+    m_flushedCondition.notify_all();
+}
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -13,6 +13,7 @@
  * permissions and limitations under the License.
  */
 
+#include <algorithm>
 #include <cstdio>
 #include <ctime>
 #include <iostream>
@@ -31,6 +32,15 @@ namespace logger {
 /// Configuration key for DefaultLogger settings
 static const std::string CONFIG_KEY_DEFAULT_LOGGER = "consoleLogger";
 
+/// Configuration key to enable writing to the console from a background thread.
+static const std::string CONFIG_KEY_ASYNCHRONOUS = "asynchronous";
+
+/// Configuration key for the number of entries buffered when logging asynchronously.
+static const std::string CONFIG_KEY_ASYNC_BUFFER_ENTRIES = "asyncBufferEntries";
+
+/// Configuration key for the maximum size of an entry buffered when logging asynchronously.
+static const std::string CONFIG_KEY_ASYNC_MAX_ENTRY_SIZE = "asyncMaxEntrySize";
+
 std::shared_ptr<Logger> ConsoleLogger::instance() {
     static std::shared_ptr<Logger> singleConsoleLogger = std::shared_ptr<ConsoleLogger>(new ConsoleLogger);
     return singleConsoleLogger;
@@ -41,19 +51,50 @@ void ConsoleLogger::emit(
     std::chrono::system_clock::time_point time,
     const char* threadMoniker,
     const char* text) {
-    if (m_coutMutex) {
+    if (m_asyncLogger) {
+        m_asyncLogger->emit(level, time, threadMoniker, text);
+    } else if (m_coutMutex) {
         std::lock_guard<std::mutex> lock(*m_coutMutex);
         std::cout << m_logFormatter.format(level, time, threadMoniker, text) << std::endl;
     }
 }
 
+void ConsoleLogger::emitRecord(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const LogRecord& record) {
+    if (m_asyncLogger) {
+        m_asyncLogger->emitRecord(level, time, threadMoniker, record);
+    } else {
+        Logger::emitRecord(level, time, threadMoniker, record);
+    }
+}
+
 ConsoleLogger::ConsoleLogger() : Logger(Level::UNKNOWN), m_coutMutex{getCoutMutex()} {
 #ifdef DEBUG
     setLevel(Level::DEBUG9);
 #else
     setLevel(Level::INFO);
 #endif  // DEBUG
-    init(configuration::ConfigurationNode::getRoot()[CONFIG_KEY_DEFAULT_LOGGER]);
+    auto configuration = configuration::ConfigurationNode::getRoot()[CONFIG_KEY_DEFAULT_LOGGER];
+    init(configuration);
+
+    bool asynchronous = false;
+    configuration.getBool(CONFIG_KEY_ASYNCHRONOUS, &asynchronous, false);
+    if (asynchronous) {
+        int bufferEntries = 0;
+        int maxEntrySize = 0;
+        configuration.getInt(CONFIG_KEY_ASYNC_BUFFER_ENTRIES, &bufferEntries, DEFAULT_ASYNC_LOGGER_ENTRIES);
+        configuration.getInt(CONFIG_KEY_ASYNC_MAX_ENTRY_SIZE, &maxEntrySize, DEFAULT_ASYNC_LOGGER_MAX_ENTRY_SIZE);
+        // Level filtering is done by this logger, so the asynchronous logger accepts everything it is given.
+        m_asyncLogger.reset(new AsyncConsoleLogger(
+            Level::DEBUG9,
+            std::cout,
+            m_coutMutex,
+            static_cast<size_t>(std::max(bufferEntries, 1)),
+            static_cast<size_t>(std::max(maxEntrySize, 1))));
+    }
 }
 
 std::shared_ptr<Logger> getConsoleLogger() {
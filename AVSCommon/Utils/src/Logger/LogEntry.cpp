@@ -17,6 +17,7 @@
 
 #include <cstring>
 #include <iomanip>
+#include <new>
 
 namespace alexaClientSDK {
 namespace avsCommon {
@@ -53,24 +54,45 @@ static const std::string BOOL_TRUE = "true";
 /// String for boolean FALSE
 static const std::string BOOL_FALSE = "false";
 
-LogEntry::LogEntry(const std::string& source, const char* event) : m_hasMetadata(false) {
-    m_stream << source << SECTION_SEPARATOR;
-    if (event) {
-        m_stream << event;
+LogEntry::LogEntry(const std::string& source, const char* event) :
+        m_hasMetadata(false),
+        m_deferred(true),
+        m_hasStream(false) {
+    if (!m_record.reset(source, event)) {
+        m_deferred = false;
+        stream() << source << SECTION_SEPARATOR;
+        if (event) {
+            stream() << event;
+        }
     }
 }
 
-LogEntry::LogEntry(const std::string& source, const std::string& event) : m_hasMetadata(false) {
-    m_stream << source << SECTION_SEPARATOR << event;
+LogEntry::LogEntry(const std::string& source, const std::string& event) : LogEntry(source, event.c_str()) {
+}
+
+LogEntry::LogEntry(const LogRecord& record) :
+        m_record(record),
+        m_hasMetadata(false),
+        m_deferred(true),
+        m_hasStream(false) {
+}
+
+LogEntry::~LogEntry() {
+    if (m_hasStream) {
+        reinterpret_cast<LogEntryStream*>(&m_streamStorage)->~LogEntryStream();
+    }
 }
 
 LogEntry& LogEntry::d(const char* key, const char* value) {
-    prefixKeyValuePair();
     if (!key) {
         key = "";
     }
-    m_stream << key << KEY_VALUE_SEPARATOR;
-    appendEscapedString(value);
+    if (m_deferred && m_record.addString(key, value)) {
+        return *this;
+    }
+    prefixKeyValuePair();
+    stream() << key << KEY_VALUE_SEPARATOR;
+    appendEscapedString(stream(), value);
     return *this;
 }
 
@@ -83,17 +105,18 @@ LogEntry& LogEntry::d(const char* key, bool value) {
 }
 
 LogEntry& LogEntry::m(const char* message) {
+    if (m_deferred && m_record.addMessage(message)) {
+        return *this;
+    }
     prefixMessage();
     if (message) {
-        m_stream << message;
+        stream() << message;
     }
     return *this;
 }
 
 LogEntry& LogEntry::m(const std::string& message) {
-    prefixMessage();
-    m_stream << message;
-    return *this;
+    return m(message.c_str());
 }
 
 LogEntry& LogEntry::p(const char* key, const void* ptr) {
@@ -101,26 +124,81 @@ LogEntry& LogEntry::p(const char* key, const void* ptr) {
 }
 
 const char* LogEntry::c_str() const {
-    return m_stream.c_str();
+    return stream().c_str();
+}
+
+const LogRecord* LogEntry::getRecord() const {
+    return m_deferred ? &m_record : nullptr;
+}
+
+LogEntryStream& LogEntry::stream() const {
+    auto out = reinterpret_cast<LogEntryStream*>(&m_streamStorage);
+    if (!m_hasStream) {
+        new (out) LogEntryStream();
+        m_hasStream = true;
+    }
+    if (m_deferred) {
+        m_deferred = false;
+        renderRecord(*out);
+    }
+    return *out;
+}
+
+void LogEntry::renderRecord(LogEntryStream& out) const {
+    out << m_record.getSource() << SECTION_SEPARATOR << m_record.getEvent();
+    for (size_t i = 0; i < m_record.getNumFields(); ++i) {
+        auto& field = m_record.getField(i);
+        if (LogRecord::FieldType::MESSAGE == field.type) {
+            if (!m_hasMetadata) {
+                out << SECTION_SEPARATOR;
+            }
+            out << SECTION_SEPARATOR << m_record.getText(field.text);
+            continue;
+        }
+        out << (m_hasMetadata ? PAIR_SEPARATOR : SECTION_SEPARATOR);
+        m_hasMetadata = true;
+        out << m_record.getText(field.key) << KEY_VALUE_SEPARATOR;
+        switch (field.type) {
+            case LogRecord::FieldType::STRING:
+                appendEscapedString(out, m_record.getText(field.text));
+                break;
+            case LogRecord::FieldType::SIGNED:
+                out << field.signedValue;
+                break;
+            case LogRecord::FieldType::UNSIGNED:
+                out << field.unsignedValue;
+                break;
+            case LogRecord::FieldType::FLOATING:
+                out << field.floatingValue;
+                break;
+            case LogRecord::FieldType::POINTER:
+                out << field.pointerValue;
+                break;
+            case LogRecord::FieldType::MESSAGE:
+                break;
+        }
+    }
 }
 
 void LogEntry::prefixKeyValuePair() {
+    auto& out = stream();
     if (m_hasMetadata) {
-        m_stream << PAIR_SEPARATOR;
+        out << PAIR_SEPARATOR;
     } else {
-        m_stream << SECTION_SEPARATOR;
+        out << SECTION_SEPARATOR;
         m_hasMetadata = true;
     }
 }
 
 void LogEntry::prefixMessage() {
+    auto& out = stream();
     if (!m_hasMetadata) {
-        m_stream << SECTION_SEPARATOR;
+        out << SECTION_SEPARATOR;
     }
-    m_stream << SECTION_SEPARATOR;
+    out << SECTION_SEPARATOR;
 }
 
-void LogEntry::appendEscapedString(const char* in) {
+void LogEntry::appendEscapedString(std::ostream& out, const char* in) {
     if (!in) {
         return;
     }
@@ -130,24 +208,24 @@ void LogEntry::appendEscapedString(const char* in) {
     while (maxCount-- > 0 && *pos != 0) {
         auto next = strpbrk(pos, RESERVED_METADATA_CHARS);
         if (next) {
-            m_stream.write(pos, next - pos);
+            out.write(pos, next - pos);
             switch (*next) {
                 case METADATA_ESCAPE:
-                    m_stream << ESCAPED_METADATA_ESCAPE;
+                    out << ESCAPED_METADATA_ESCAPE;
                     break;
                 case PAIR_SEPARATOR:
-                    m_stream << ESCAPED_PAIR_SEPARATOR;
+                    out << ESCAPED_PAIR_SEPARATOR;
                     break;
                 case SECTION_SEPARATOR:
-                    m_stream << ESCAPED_SECTION_SEPARATOR;
+                    out << ESCAPED_SECTION_SEPARATOR;
                     break;
                 case KEY_VALUE_SEPARATOR:
-                    m_stream << ESCAPED_KEY_VALUE_SEPARATOR;
+                    out << ESCAPED_KEY_VALUE_SEPARATOR;
                     break;
             }
             pos = next + 1;
         } else {
-            m_stream << pos;
+            out << pos;
             return;
         }
     }
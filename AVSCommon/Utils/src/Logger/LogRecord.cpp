@@ -0,0 +1,150 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cstring>
+
+#include "AVSCommon/Utils/Logger/LogRecord.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+
+constexpr size_t LogRecord::MAX_FIELDS;
+constexpr size_t LogRecord::TEXT_SIZE;
+
+LogRecord::LogRecord() : m_numFields{0}, m_textSize{1}, m_event{0} {
+    // Offset 0 holds an empty source until reset() is called.
+    m_text[0] = '\0';
+}
+
+bool LogRecord::reset(const std::string& source, const char* event) {
+    m_numFields = 0;
+    m_textSize = 0;
+    uint16_t offset;
+    return storeText(source.c_str(), &offset) && storeText(event, &m_event);
+}
+
+bool LogRecord::addString(const char* key, const char* value) {
+    auto field = addField(FieldType::STRING, key);
+    if (!field || !storeText(value, &field->text)) {
+        return false;
+    }
+    m_numFields++;
+    return true;
+}
+
+bool LogRecord::addSigned(const char* key, long long value) {
+    auto field = addField(FieldType::SIGNED, key);
+    if (!field) {
+        return false;
+    }
+    field->signedValue = value;
+    m_numFields++;
+    return true;
+}
+
+bool LogRecord::addUnsigned(const char* key, unsigned long long value) {
+    auto field = addField(FieldType::UNSIGNED, key);
+    if (!field) {
+        return false;
+    }
+    field->unsignedValue = value;
+    m_numFields++;
+    return true;
+}
+
+bool LogRecord::addFloating(const char* key, double value) {
+    auto field = addField(FieldType::FLOATING, key);
+    if (!field) {
+        return false;
+    }
+    field->floatingValue = value;
+    m_numFields++;
+    return true;
+}
+
+bool LogRecord::addPointer(const char* key, const void* value) {
+    auto field = addField(FieldType::POINTER, key);
+    if (!field) {
+        return false;
+    }
+    field->pointerValue = value;
+    m_numFields++;
+    return true;
+}
+
+bool LogRecord::addMessage(const char* message) {
+    if (m_numFields >= MAX_FIELDS) {
+        return false;
+    }
+    auto& field = m_fields[m_numFields];
+    field.type = FieldType::MESSAGE;
+    field.key = 0;
+    if (!storeText(message, &field.text)) {
+        return false;
+    }
+    m_numFields++;
+    return true;
+}
+
+const char* LogRecord::getSource() const {
+    return m_text;
+}
+
+const char* LogRecord::getEvent() const {
+    return m_text + m_event;
+}
+
+size_t LogRecord::getNumFields() const {
+    return m_numFields;
+}
+
+const LogRecord::Field& LogRecord::getField(size_t index) const {
+    return m_fields[index];
+}
+
+const char* LogRecord::getText(uint16_t offset) const {
+    return m_text + offset;
+}
+
+bool LogRecord::storeText(const char* in, uint16_t* offset) {
+    auto length = in ? std::strlen(in) : 0;
+    if (length >= TEXT_SIZE - m_textSize) {
+        return false;
+    }
+    std::memcpy(m_text + m_textSize, in ? in : "", length);
+    m_text[m_textSize + length] = '\0';
+    *offset = m_textSize;
+    m_textSize += static_cast<uint16_t>(length + 1);
+    return true;
+}
+
+LogRecord::Field* LogRecord::addField(FieldType type, const char* key) {
+    if (m_numFields >= MAX_FIELDS) {
+        return nullptr;
+    }
+    auto field = &m_fields[m_numFields];
+    field->type = type;
+    if (!storeText(key, &field->key)) {
+        return nullptr;
+    }
+    return field;
+}
+
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
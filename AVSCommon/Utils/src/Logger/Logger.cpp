@@ -36,7 +36,17 @@ Logger::Logger(Level level) : m_level{level} {
 
 void Logger::log(Level level, const LogEntry& entry) {
     if (shouldLog(level)) {
-        emit(level, std::chrono::system_clock::now(), ThreadMoniker::getThisThreadMoniker().c_str(), entry.c_str());
+        auto record = entry.getRecord();
+        if (record) {
+            emitRecord(
+                level, std::chrono::system_clock::now(), ThreadMoniker::getThisThreadMoniker().c_str(), *record);
+        } else {
+            emit(
+                level,
+                std::chrono::system_clock::now(),
+                ThreadMoniker::getThisThreadMoniker().c_str(),
+                entry.c_str());
+        }
     }
 }
 
@@ -134,6 +144,15 @@ void Logger::emit(
     // no-op.
 }
 
+void Logger::emitRecord(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadMoniker,
+    const LogRecord& record) {
+    LogEntry entry(record);
+    emit(level, time, threadMoniker, entry.c_str());
+}
+
 }  // namespace logger
 }  // namespace utils
 }  // namespace avsCommon
@@ -32,6 +32,16 @@ void ModuleLogger::emit(
     }
 }
 
+void ModuleLogger::emitRecord(
+    Level level,
+    std::chrono::system_clock::time_point time,
+    const char* threadId,
+    const LogRecord& record) {
+    if (shouldLog(level)) {
+        m_sink->emitRecord(level, time, threadId, record);
+    }
+}
+
 void ModuleLogger::setLevel(Level level) {
     m_moduleLogLevel = level;
     updateLogLevel();
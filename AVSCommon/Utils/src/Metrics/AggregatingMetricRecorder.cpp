@@ -0,0 +1,336 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+
+#include <map>
+
+#include "AVSCommon/Utils/Logger/Logger.h"
+#include "AVSCommon/Utils/Metrics/AggregatingMetricRecorder.h"
+#include "AVSCommon/Utils/Metrics/DataPointCounterBuilder.h"
+#include "AVSCommon/Utils/Metrics/DataPointDurationBuilder.h"
+#include "AVSCommon/Utils/Metrics/MetricEventBuilder.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace metrics {
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("AggregatingMetricRecorder");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+/// Suffix of the data point holding the number of values recorded in a histogram.
+static const std::string HISTOGRAM_COUNT_SUFFIX = ".count";
+
+/// Suffix of the data point holding the sum of the values recorded in a histogram.
+static const std::string HISTOGRAM_SUM_SUFFIX = ".sum";
+
+/// The percentiles reported for a histogram, and the suffixes of their data points.
+static const std::vector<std::pair<unsigned, std::string>> HISTOGRAM_PERCENTILES = {{50, ".p50"},
+                                                                                    {90, ".p90"},
+                                                                                    {99, ".p99"}};
+
+/// The number of entries in the per-thread cache of slots.
+static const size_t THREAD_CACHE_SIZE = 4;
+
+/// An entry in the per-thread cache of slots.  Trivially destructible, so that it is safe as a @c thread_local.
+struct CachedSlots {
+    /// The @c m_instanceId of the recorder the slots belong to, or zero if the entry is unused.
+    uint64_t instanceId;
+
+    /// The slots of the calling thread.
+    void* slots;
+};
+
+/// The slots most recently used by this thread, so that recording normally does not take a lock.
+static thread_local CachedSlots g_threadCache[THREAD_CACHE_SIZE];
+
+/// The entry of @c g_threadCache to replace next.
+static thread_local size_t g_threadCacheNext;
+
+/**
+ * Obtain a token which lives as long as the calling thread, so that the slots of a thread can tell when it has exited.
+ *
+ * @return The token of the calling thread.
+ */
+static std::shared_ptr<void> getThreadToken() {
+    static thread_local std::shared_ptr<void> token = std::make_shared<char>(0);
+    return token;
+}
+
+/// The source of @c m_instanceId.  Starts at one, since zero marks an unused cache entry.
+static std::atomic<uint64_t> g_nextInstanceId{1};
+
+const AggregatingMetricRecorder::MetricId AggregatingMetricRecorder::INVALID_METRIC_ID;
+constexpr std::chrono::milliseconds AggregatingMetricRecorder::DEFAULT_FLUSH_INTERVAL;
+const size_t AggregatingMetricRecorder::DEFAULT_MAX_METRICS;
+
+/**
+ * Obtain the histogram bucket of a value.
+ *
+ * @param value The value.
+ * @param numBuckets The number of buckets.
+ * @return The bucket holding @c value.
+ */
+static size_t getBucket(uint64_t value, size_t numBuckets) {
+    size_t bucket = 0;
+    while (value != 0 && bucket < numBuckets - 1) {
+        value >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+/**
+ * Obtain the largest value held by a histogram bucket.
+ *
+ * @param bucket The bucket.
+ * @return The largest value held by @c bucket.
+ */
+static uint64_t getBucketUpperBound(size_t bucket) {
+    return bucket == 0 ? 0 : (static_cast<uint64_t>(1) << bucket) - 1;
+}
+
+AggregatingMetricRecorder::ThreadSlots::ThreadSlots(size_t numSlots) :
+        values{new std::atomic<uint64_t>[numSlots]},
+        flushed{new uint64_t[numSlots]} {
+    for (size_t i = 0; i < numSlots; ++i) {
+        values[i].store(0, std::memory_order_relaxed);
+        flushed[i] = 0;
+    }
+}
+
+std::shared_ptr<AggregatingMetricRecorder> AggregatingMetricRecorder::create(
+    std::shared_ptr<MetricRecorderInterface> recorder,
+    std::chrono::milliseconds flushInterval,
+    size_t maxMetrics) {
+    if (!recorder) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "nullRecorder"));
+        return nullptr;
+    }
+    if (maxMetrics == 0 || maxMetrics >= INVALID_METRIC_ID) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "invalidMaxMetrics").d("maxMetrics", maxMetrics));
+        return nullptr;
+    }
+    if (flushInterval < std::chrono::milliseconds::zero()) {
+        ACSDK_ERROR(LX("createFailed").d("reason", "negativeFlushInterval"));
+        return nullptr;
+    }
+
+    std::shared_ptr<AggregatingMetricRecorder> aggregator(new AggregatingMetricRecorder(recorder, maxMetrics));
+    if (flushInterval > std::chrono::milliseconds::zero()) {
+        auto rawAggregator = aggregator.get();
+        if (!aggregator->m_flushTimer.start(
+                flushInterval, timing::Timer::PeriodType::ABSOLUTE, timing::Timer::getForever(), [rawAggregator] {
+                    rawAggregator->flush();
+                })) {
+            ACSDK_ERROR(LX("createFailed").d("reason", "startFlushTimerFailed"));
+            return nullptr;
+        }
+    }
+    return aggregator;
+}
+
+AggregatingMetricRecorder::AggregatingMetricRecorder(
+    std::shared_ptr<MetricRecorderInterface> recorder,
+    size_t maxMetrics) :
+        m_recorder{recorder},
+        m_maxMetrics{maxMetrics},
+        m_instanceId{g_nextInstanceId++} {
+    m_metrics.reserve(maxMetrics);
+}
+
+AggregatingMetricRecorder::~AggregatingMetricRecorder() {
+    m_flushTimer.stop();
+    flush();
+}
+
+AggregatingMetricRecorder::MetricId AggregatingMetricRecorder::getCounter(
+    const std::string& activityName,
+    const std::string& name) {
+    return registerMetric(activityName, name, false);
+}
+
+AggregatingMetricRecorder::MetricId AggregatingMetricRecorder::getHistogram(
+    const std::string& activityName,
+    const std::string& name) {
+    return registerMetric(activityName, name, true);
+}
+
+AggregatingMetricRecorder::MetricId AggregatingMetricRecorder::registerMetric(
+    const std::string& activityName,
+    const std::string& name,
+    bool isHistogram) {
+    if (activityName.empty() || name.empty()) {
+        ACSDK_ERROR(LX("registerMetricFailed").d("reason", "emptyName"));
+        return INVALID_METRIC_ID;
+    }
+
+    // The key joins the type and both names with characters which cannot appear in a metric name.
+    std::string key = (isHistogram ? "H" : "C") + activityName + '\n' + name;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_metricIds.find(key);
+    if (it != m_metricIds.end()) {
+        return it->second;
+    }
+    if (m_metrics.size() >= m_maxMetrics) {
+        ACSDK_ERROR(LX("registerMetricFailed")
+                        .d("reason", "tooManyMetrics")
+                        .d("activityName", activityName)
+                        .d("name", name)
+                        .d("maxMetrics", m_maxMetrics));
+        return INVALID_METRIC_ID;
+    }
+    auto id = static_cast<MetricId>(m_metrics.size());
+    m_metrics.push_back({activityName, name, isHistogram});
+    m_metricIds[key] = id;
+    return id;
+}
+
+void AggregatingMetricRecorder::increment(MetricId id, uint64_t count) {
+    if (id >= m_maxMetrics) {
+        return;
+    }
+    auto values = getThreadSlots()->values.get() + id * SLOTS_PER_METRIC;
+    values[COUNT_SLOT].fetch_add(count, std::memory_order_relaxed);
+}
+
+void AggregatingMetricRecorder::recordValue(MetricId id, uint64_t value) {
+    if (id >= m_maxMetrics) {
+        return;
+    }
+    auto values = getThreadSlots()->values.get() + id * SLOTS_PER_METRIC;
+    values[COUNT_SLOT].fetch_add(1, std::memory_order_relaxed);
+    values[SUM_SLOT].fetch_add(value, std::memory_order_relaxed);
+    values[FIRST_BUCKET_SLOT + getBucket(value, NUM_BUCKETS)].fetch_add(1, std::memory_order_relaxed);
+}
+
+AggregatingMetricRecorder::ThreadSlots* AggregatingMetricRecorder::getThreadSlots() {
+    for (size_t i = 0; i < THREAD_CACHE_SIZE; ++i) {
+        if (g_threadCache[i].instanceId == m_instanceId) {
+            return static_cast<ThreadSlots*>(g_threadCache[i].slots);
+        }
+    }
+    auto slots = lookupThreadSlots();
+    auto& entry = g_threadCache[g_threadCacheNext++ % THREAD_CACHE_SIZE];
+    entry.instanceId = m_instanceId;
+    entry.slots = slots;
+    return slots;
+}
+
+AggregatingMetricRecorder::ThreadSlots* AggregatingMetricRecorder::lookupThreadSlots() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& slots = m_threadSlots[std::this_thread::get_id()];
+    if (!slots) {
+        slots.reset(new ThreadSlots(m_maxMetrics * SLOTS_PER_METRIC));
+    }
+    slots->owner = getThreadToken();
+    return slots.get();
+}
+
+void AggregatingMetricRecorder::flush() {
+    std::vector<std::shared_ptr<MetricEvent>> events;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_metrics.empty() || m_threadSlots.empty()) {
+            return;
+        }
+
+        // Sum the change in every slot since the last flush, across all threads.  Once a thread has exited, nothing
+        // more is recorded to its slots, so they are released after their last change has been summed.
+        std::vector<uint64_t> deltas(m_metrics.size() * SLOTS_PER_METRIC, 0);
+        for (auto it = m_threadSlots.begin(); it != m_threadSlots.end();) {
+            auto& slots = *it->second;
+            bool hasExited = !slots.owner.lock();
+            for (size_t i = 0; i < deltas.size(); ++i) {
+                auto value = slots.values[i].load(std::memory_order_relaxed);
+                deltas[i] += value - slots.flushed[i];
+                slots.flushed[i] = value;
+            }
+            if (hasExited) {
+                it = m_threadSlots.erase(it);
+            } else {
+                ++it;
+            }
+        }
+
+        std::map<std::string, MetricEventBuilder> builders;
+        for (size_t id = 0; id < m_metrics.size(); ++id) {
+            auto delta = &deltas[id * SLOTS_PER_METRIC];
+            auto count = delta[COUNT_SLOT];
+            if (count == 0) {
+                continue;
+            }
+            const auto& metric = m_metrics[id];
+            auto& builder = builders[metric.activityName];
+            if (!metric.isHistogram) {
+                builder.addDataPoint(DataPointCounterBuilder{}.setName(metric.name).increment(count).build());
+                continue;
+            }
+            builder.addDataPoint(
+                DataPointCounterBuilder{}.setName(metric.name + HISTOGRAM_COUNT_SUFFIX).increment(count).build());
+            builder.addDataPoint(DataPointCounterBuilder{}
+                                     .setName(metric.name + HISTOGRAM_SUM_SUFFIX)
+                                     .increment(delta[SUM_SLOT])
+                                     .build());
+            for (const auto& percentile : HISTOGRAM_PERCENTILES) {
+                // The smallest bucket which, with those below it, holds at least the percentile of the values.
+                auto rank = (count * percentile.first + 99) / 100;
+                uint64_t seen = 0;
+                size_t bucket = 0;
+                for (; bucket < NUM_BUCKETS - 1; ++bucket) {
+                    seen += delta[FIRST_BUCKET_SLOT + bucket];
+                    if (seen >= rank) {
+                        break;
+                    }
+                }
+                std::chrono::milliseconds duration(getBucketUpperBound(bucket));
+                builder.addDataPoint(
+                    DataPointDurationBuilder{duration}.setName(metric.name + percentile.second).build());
+            }
+        }
+
+        for (auto& builder : builders) {
+            auto event = builder.second.setActivityName(builder.first).build();
+            if (event) {
+                events.push_back(event);
+            }
+        }
+    }
+
+    for (auto& event : events) {
+        m_recorder->recordMetric(event);
+    }
+}
+
+void AggregatingMetricRecorder::recordMetric(std::shared_ptr<MetricEvent> metricEvent) {
+    if (!metricEvent) {
+        ACSDK_ERROR(LX("recordMetricFailed").d("reason", "nullMetricEvent"));
+        return;
+    }
+    m_recorder->recordMetric(metricEvent);
+}
+
+}  // namespace metrics
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,114 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/Utils/Threading/PooledTaskQueue.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+
+PooledTaskQueue::PooledTaskQueue(size_t maxFreeNodes) :
+        m_head{nullptr},
+        m_tail{nullptr},
+        m_freeNodes{nullptr},
+        m_freeCount{0},
+        m_maxFreeNodes{maxFreeNodes} {
+}
+
+PooledTaskQueue::~PooledTaskQueue() {
+    clear();
+    while (m_freeNodes) {
+        auto node = m_freeNodes;
+        m_freeNodes = node->next;
+        delete node;
+    }
+}
+
+void PooledTaskQueue::pushBack(SmallTask task) {
+    auto node = obtainNode(std::move(task));
+    if (m_tail) {
+        m_tail->next = node;
+    } else {
+        m_head = node;
+    }
+    m_tail = node;
+}
+
+void PooledTaskQueue::pushFront(SmallTask task) {
+    auto node = obtainNode(std::move(task));
+    node->next = m_head;
+    m_head = node;
+    if (!m_tail) {
+        m_tail = node;
+    }
+}
+
+SmallTask PooledTaskQueue::popFront() {
+    if (!m_head) {
+        return SmallTask();
+    }
+    auto node = m_head;
+    m_head = node->next;
+    if (!m_head) {
+        m_tail = nullptr;
+    }
+    auto task = std::move(node->task);
+    releaseNode(node);
+    return task;
+}
+
+bool PooledTaskQueue::empty() const {
+    return nullptr == m_head;
+}
+
+void PooledTaskQueue::clear() {
+    while (m_head) {
+        auto node = m_head;
+        m_head = node->next;
+        releaseNode(node);
+    }
+    m_tail = nullptr;
+}
+
+PooledTaskQueue::Node* PooledTaskQueue::obtainNode(SmallTask task) {
+    Node* node;
+    if (m_freeNodes) {
+        node = m_freeNodes;
+        m_freeNodes = node->next;
+        m_freeCount--;
+        node->task = std::move(task);
+    } else {
+        node = new Node{std::move(task), nullptr};
+    }
+    node->next = nullptr;
+    return node;
+}
+
+void PooledTaskQueue::releaseNode(Node* node) {
+    node->task = nullptr;
+    if (m_freeCount < m_maxFreeNodes) {
+        node->next = m_freeNodes;
+        m_freeNodes = node;
+        m_freeCount++;
+    } else {
+        delete node;
+    }
+}
+
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
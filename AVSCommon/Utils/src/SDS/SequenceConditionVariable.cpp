@@ -0,0 +1,93 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+#include "AVSCommon/Utils/SDS/SequenceConditionVariable.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+
+#ifdef __linux__
+static_assert(
+    sizeof(std::atomic<uint32_t>) == sizeof(uint32_t),
+    "std::atomic<uint32_t> must have the same layout as a futex word");
+#endif
+
+SequenceConditionVariable::SequenceConditionVariable() : m_sequence{0}, m_sleepers{0} {
+}
+
+void SequenceConditionVariable::notify_all() {
+    // The increment must be ordered before the load of m_sleepers; it pairs with the increment of m_sleepers (ordered
+    // before the sequence comparison) in waitForChange(), so either we see the sleeper or the sleeper sees the change.
+    m_sequence.fetch_add(1);
+    if (0 == m_sleepers.load()) {
+        return;
+    }
+#ifdef __linux__
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&m_sequence), FUTEX_WAKE_PRIVATE, INT32_MAX, nullptr, nullptr, 0);
+#else
+    {
+        // Taking the mutex guarantees that a sleeper which has evaluated its predicate is now waiting on the condition.
+        std::lock_guard<std::mutex> lock(m_sleepMutex);
+    }
+    m_sleepCondition.notify_all();
+#endif
+}
+
+void SequenceConditionVariable::wait(std::unique_lock<std::mutex>& lock) {
+    auto sequence = m_sequence.load();
+    lock.unlock();
+    waitForChange(sequence, std::chrono::nanoseconds(-1));
+    lock.lock();
+}
+
+void SequenceConditionVariable::waitForChange(uint32_t sequence, std::chrono::nanoseconds timeout) {
+    m_sleepers.fetch_add(1);
+#ifdef __linux__
+    if (timeout.count() < 0) {
+        syscall(
+            SYS_futex, reinterpret_cast<uint32_t*>(&m_sequence), FUTEX_WAIT_PRIVATE, sequence, nullptr, nullptr, 0);
+    } else {
+        auto seconds = std::chrono::duration_cast<std::chrono::seconds>(timeout);
+        struct timespec relative;
+        relative.tv_sec = static_cast<time_t>(seconds.count());
+        relative.tv_nsec = static_cast<long>((timeout - seconds).count());
+        syscall(
+            SYS_futex, reinterpret_cast<uint32_t*>(&m_sequence), FUTEX_WAIT_PRIVATE, sequence, &relative, nullptr, 0);
+    }
+#else
+    std::unique_lock<std::mutex> lock(m_sleepMutex);
+    auto changed = [this, sequence] { return m_sequence.load() != sequence; };
+    if (timeout.count() < 0) {
+        m_sleepCondition.wait(lock, changed);
+    } else {
+        m_sleepCondition.wait_for(lock, timeout, changed);
+    }
+#endif
+    m_sleepers.fetch_sub(1);
+}
+
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
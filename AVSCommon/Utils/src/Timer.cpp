@@ -16,7 +16,7 @@
 #include <AVSCommon/Utils/Logger/Logger.h>
 
 #include "AVSCommon/Utils/Timing/Timer.h"
-#include "AVSCommon/Utils/Timing/TimerDelegateFactory.h"
+#include "AVSCommon/Utils/Timing/TimerWheelDelegateFactory.h"
 
 namespace alexaClientSDK {
 namespace avsCommon {
@@ -35,9 +35,10 @@ static const std::string TAG(Timer::getTag());
 
 Timer::Timer(std::shared_ptr<sdkInterfaces::timing::TimerDelegateFactoryInterface> timerDelegateFactory) {
     if (!timerDelegateFactory) {
-        ACSDK_WARN(
-            LX(__func__).d("reason", "nullTimerDelegateFactory").m("Falling back to default TimerDelegateFactory"));
-        timerDelegateFactory = std::make_shared<TimerDelegateFactory>();
+        ACSDK_WARN(LX(__func__)
+                       .d("reason", "nullTimerDelegateFactory")
+                       .m("Falling back to default TimerWheelDelegateFactory"));
+        timerDelegateFactory = std::make_shared<TimerWheelDelegateFactory>();
         if (!timerDelegateFactory) {
             ACSDK_ERROR(LX(__func__).d("reason", "nullDefaultTimerDelegateFactory"));
             return;
@@ -0,0 +1,360 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+#include <limits>
+
+#include "AVSCommon/Utils/Timing/TimerWheel.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+constexpr std::chrono::milliseconds TimerWheel::TICK_DURATION;
+constexpr int TimerWheel::BITS_PER_LEVEL;
+constexpr size_t TimerWheel::SLOTS_PER_LEVEL;
+constexpr size_t TimerWheel::NUM_LEVELS;
+constexpr std::chrono::milliseconds TimerWheel::CALLBACK_GRACE_PERIOD;
+
+/// Mask selecting the slot index from a tick number shifted down to a level.
+static const uint64_t SLOT_MASK = TimerWheel::SLOTS_PER_LEVEL - 1;
+
+/// The number of ticks covered by the whole wheel.
+static const uint64_t WHEEL_SPAN = uint64_t(1) << (TimerWheel::BITS_PER_LEVEL * TimerWheel::NUM_LEVELS);
+
+/// Value of @c m_wakeTick and of @c nextEventTickLocked() when there is nothing to wait for.
+static const uint64_t NO_TICK = std::numeric_limits<uint64_t>::max();
+
+/**
+ * Obtain the shift which converts a tick number to the slot numbering of a level.
+ *
+ * @param level The level.
+ * @return The shift.
+ */
+static int levelShift(size_t level) {
+    return static_cast<int>(level) * TimerWheel::BITS_PER_LEVEL;
+}
+
+TimerWheel::Entry::Entry(std::function<void()> callback) :
+        m_callback{std::move(callback)},
+        m_expiry{0},
+        m_prev{nullptr},
+        m_next{nullptr},
+        m_list{nullptr},
+        m_level{0},
+        m_isRunning{false} {
+}
+
+std::shared_ptr<TimerWheel> TimerWheel::getDefault() {
+    static std::mutex mutex;
+    static std::weak_ptr<TimerWheel> defaultWheel;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto wheel = defaultWheel.lock();
+    if (!wheel) {
+        wheel = std::make_shared<TimerWheel>();
+        defaultWheel = wheel;
+    }
+    return wheel;
+}
+
+TimerWheel::TimerWheel() :
+        m_epoch{std::chrono::steady_clock::now()},
+        m_currentTick{0},
+        m_wakeTick{0},
+        m_levelCounts{},
+        m_expired{nullptr},
+        m_expiredTail{nullptr},
+        m_numWorkers{0},
+        m_numIdleWorkers{0},
+        m_stop{false} {
+    for (auto& level : m_slots) {
+        for (auto& slot : level) {
+            slot = nullptr;
+        }
+    }
+    m_thread = std::thread(&TimerWheel::run, this);
+}
+
+TimerWheel::~TimerWheel() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wakeCondition.notify_one();
+    m_workerCondition.notify_all();
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+    // The wheel thread has stopped, so nothing adds to m_workers any more.
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+}
+
+void TimerWheel::schedule(Entry* entry, std::chrono::steady_clock::time_point deadline) {
+    bool wake = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (entry->m_list) {
+            unlinkLocked(entry);
+        }
+        entry->m_expiry = std::max(toTick(deadline), m_currentTick + 1);
+        insertLocked(entry);
+        wake = entry->m_expiry < m_wakeTick;
+    }
+    if (wake) {
+        m_wakeCondition.notify_one();
+    }
+}
+
+void TimerWheel::cancel(Entry* entry) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (entry->m_isRunning && entry->m_runningThread != std::this_thread::get_id()) {
+        m_callbackDone.wait(lock, [entry] { return !entry->m_isRunning; });
+    }
+    if (entry->m_list) {
+        unlinkLocked(entry);
+    }
+}
+
+size_t TimerWheel::getNumScheduled() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t count = 0;
+    for (auto levelCount : m_levelCounts) {
+        count += levelCount;
+    }
+    return count;
+}
+
+void TimerWheel::run() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stop) {
+        joinExitedWorkersLocked();
+
+        auto now = std::chrono::steady_clock::now();
+        advanceLocked(static_cast<uint64_t>((now - m_epoch) / TICK_DURATION));
+
+        auto wakeTick = nextEventTickLocked();
+        auto wakeTime = std::chrono::steady_clock::time_point::max();
+        if (NO_TICK != wakeTick) {
+            wakeTime = m_epoch + TICK_DURATION * static_cast<std::chrono::milliseconds::rep>(wakeTick);
+        }
+        if (m_expired) {
+            if (m_numIdleWorkers > 0) {
+                m_workerCondition.notify_one();
+            } else if (0 == m_numWorkers || now - m_lastProgress >= CALLBACK_GRACE_PERIOD) {
+                // Every worker is busy, and the queue has not moved for a while.
+                m_numWorkers++;
+                m_lastProgress = now;
+                m_workers.emplace_back(&TimerWheel::runWorker, this);
+            }
+            // Check again that the queue is moving once the grace period has passed.
+            wakeTime = std::min(wakeTime, m_lastProgress + CALLBACK_GRACE_PERIOD);
+        }
+
+        m_wakeTick = wakeTick;
+        if (std::chrono::steady_clock::time_point::max() == wakeTime) {
+            m_wakeCondition.wait(lock);
+        } else {
+            m_wakeCondition.wait_until(lock, wakeTime);
+        }
+        m_wakeTick = 0;
+    }
+}
+
+void TimerWheel::runWorker() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stop) {
+        // Skip entries which were rescheduled by their own callback and expired again before it returned.
+        auto entry = m_expired;
+        while (entry && entry->m_isRunning) {
+            entry = entry->m_next;
+        }
+        if (entry) {
+            unlinkLocked(entry);
+            entry->m_isRunning = true;
+            entry->m_runningThread = std::this_thread::get_id();
+            m_lastProgress = std::chrono::steady_clock::now();
+            lock.unlock();
+            entry->m_callback();
+            lock.lock();
+            entry->m_isRunning = false;
+            m_callbackDone.notify_all();
+            continue;
+        }
+        if (m_numIdleWorkers > 0) {
+            // Another worker is already waiting for work.
+            break;
+        }
+        m_numIdleWorkers++;
+        m_workerCondition.wait(lock);
+        m_numIdleWorkers--;
+    }
+    m_numWorkers--;
+    if (!m_stop) {
+        m_exitedWorkers.push_back(std::this_thread::get_id());
+        m_wakeCondition.notify_one();
+    }
+}
+
+void TimerWheel::joinExitedWorkersLocked() {
+    for (auto id : m_exitedWorkers) {
+        for (auto it = m_workers.begin(); it != m_workers.end(); ++it) {
+            if (it->get_id() == id) {
+                // The worker has released the lock for good, so joining here cannot deadlock.
+                it->join();
+                m_workers.erase(it);
+                break;
+            }
+        }
+    }
+    m_exitedWorkers.clear();
+}
+
+void TimerWheel::insertLocked(Entry* entry) {
+    auto delta = entry->m_expiry - m_currentTick;
+    auto slotTick = entry->m_expiry;
+    if (delta >= WHEEL_SPAN) {
+        // Park the entry in the furthest top level slot; it is redistributed from there until it is in range.
+        slotTick = m_currentTick + WHEEL_SPAN - 1;
+        delta = WHEEL_SPAN - 1;
+    }
+    size_t level = 0;
+    while (level + 1 < NUM_LEVELS && delta >= (uint64_t(1) << levelShift(level + 1))) {
+        level++;
+    }
+
+    auto& head = m_slots[level][(slotTick >> levelShift(level)) & SLOT_MASK];
+    entry->m_list = &head;
+    entry->m_level = level;
+    entry->m_prev = nullptr;
+    entry->m_next = head;
+    if (head) {
+        head->m_prev = entry;
+    }
+    head = entry;
+    m_levelCounts[level]++;
+}
+
+void TimerWheel::enqueueExpiredLocked(Entry* entry) {
+    if (!m_expired) {
+        m_lastProgress = std::chrono::steady_clock::now();
+    }
+    entry->m_list = &m_expired;
+    entry->m_level = NUM_LEVELS;
+    entry->m_prev = m_expiredTail;
+    entry->m_next = nullptr;
+    if (m_expiredTail) {
+        m_expiredTail->m_next = entry;
+    } else {
+        m_expired = entry;
+    }
+    m_expiredTail = entry;
+}
+
+void TimerWheel::unlinkLocked(Entry* entry) {
+    if (entry->m_prev) {
+        entry->m_prev->m_next = entry->m_next;
+    } else {
+        *entry->m_list = entry->m_next;
+    }
+    if (entry->m_next) {
+        entry->m_next->m_prev = entry->m_prev;
+    } else if (&m_expired == entry->m_list) {
+        m_expiredTail = entry->m_prev;
+    }
+    if (entry->m_level < NUM_LEVELS) {
+        m_levelCounts[entry->m_level]--;
+    }
+    entry->m_list = nullptr;
+    entry->m_prev = nullptr;
+    entry->m_next = nullptr;
+}
+
+void TimerWheel::advanceLocked(uint64_t tick) {
+    while (m_currentTick < tick) {
+        // Every level below the lowest non-empty one is empty, so nothing happens before that level's next slot.
+        size_t lowest = 0;
+        while (lowest < NUM_LEVELS && 0 == m_levelCounts[lowest]) {
+            lowest++;
+        }
+        if (NUM_LEVELS == lowest) {
+            m_currentTick = tick;
+            return;
+        }
+        auto shift = levelShift(lowest);
+        m_currentTick = std::min(tick, ((m_currentTick >> shift) + 1) << shift);
+
+        // Redistribute the higher level slots which start at this tick, top down.
+        for (size_t level = NUM_LEVELS - 1; level > 0; --level) {
+            if (m_currentTick & ((uint64_t(1) << levelShift(level)) - 1)) {
+                continue;
+            }
+            auto& head = m_slots[level][(m_currentTick >> levelShift(level)) & SLOT_MASK];
+            auto entry = head;
+            head = nullptr;
+            while (entry) {
+                auto next = entry->m_next;
+                m_levelCounts[level]--;
+                insertLocked(entry);
+                entry = next;
+            }
+        }
+
+        auto& head = m_slots[0][m_currentTick & SLOT_MASK];
+        auto entry = head;
+        head = nullptr;
+        while (entry) {
+            auto next = entry->m_next;
+            m_levelCounts[0]--;
+            enqueueExpiredLocked(entry);
+            entry = next;
+        }
+    }
+}
+
+uint64_t TimerWheel::nextEventTickLocked() const {
+    auto next = NO_TICK;
+    for (size_t level = 0; level < NUM_LEVELS; ++level) {
+        if (0 == m_levelCounts[level]) {
+            continue;
+        }
+        auto shift = levelShift(level);
+        auto base = m_currentTick >> shift;
+        for (uint64_t offset = 1; offset <= SLOTS_PER_LEVEL; ++offset) {
+            if (m_slots[level][(base + offset) & SLOT_MASK]) {
+                next = std::min(next, (base + offset) << shift);
+                break;
+            }
+        }
+    }
+    return next;
+}
+
+uint64_t TimerWheel::toTick(std::chrono::steady_clock::time_point time) const {
+    if (time <= m_epoch) {
+        return 0;
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(time - m_epoch);
+    auto tick = std::chrono::duration_cast<std::chrono::nanoseconds>(TICK_DURATION);
+    return static_cast<uint64_t>((elapsed.count() + tick.count() - 1) / tick.count());
+}
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
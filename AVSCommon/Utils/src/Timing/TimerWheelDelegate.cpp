@@ -0,0 +1,116 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include "AVSCommon/Utils/Timing/TimerWheelDelegate.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+
+TimerWheelDelegate::TimerWheelDelegate(std::shared_ptr<TimerWheel> wheel) :
+        m_wheel{std::move(wheel)},
+        m_entry{[this] { onExpired(); }},
+        m_running{false} {
+}
+
+TimerWheelDelegate::~TimerWheelDelegate() {
+    stop();
+}
+
+void TimerWheelDelegate::start(
+    std::chrono::nanoseconds delay,
+    std::chrono::nanoseconds period,
+    PeriodType periodType,
+    size_t maxCount,
+    std::function<void()> task) {
+    std::lock_guard<std::mutex> lock(m_callMutex);
+    {
+        std::lock_guard<std::mutex> scheduleLock(m_scheduleMutex);
+        m_schedule.reset();
+    }
+    m_wheel->cancel(&m_entry);
+
+    std::shared_ptr<Schedule> schedule(new Schedule{
+        period, periodType, maxCount, std::move(task), 0, std::chrono::steady_clock::now() + delay, false});
+    std::lock_guard<std::mutex> scheduleLock(m_scheduleMutex);
+    m_schedule = schedule;
+    m_running = true;
+    m_wheel->schedule(&m_entry, schedule->deadline);
+}
+
+void TimerWheelDelegate::stop() {
+    std::lock_guard<std::mutex> lock(m_callMutex);
+    {
+        std::lock_guard<std::mutex> scheduleLock(m_scheduleMutex);
+        m_schedule.reset();
+        m_running = false;
+    }
+    // Waits for a task call in progress, unless called from the task.
+    m_wheel->cancel(&m_entry);
+}
+
+bool TimerWheelDelegate::activate() {
+    std::lock_guard<std::mutex> lock(m_callMutex);
+    return !m_running.exchange(true);
+}
+
+bool TimerWheelDelegate::isActive() const {
+    return m_running;
+}
+
+void TimerWheelDelegate::onExpired() {
+    std::shared_ptr<Schedule> schedule;
+    {
+        std::lock_guard<std::mutex> lock(m_scheduleMutex);
+        schedule = m_schedule;
+    }
+    if (!schedule) {
+        return;
+    }
+
+    // As with TimerDelegate, an ABSOLUTE timer which overran its period skips a call to get back on schedule.
+    if (PeriodType::RELATIVE == schedule->periodType || !schedule->offSchedule) {
+        schedule->task();
+    }
+
+    std::lock_guard<std::mutex> lock(m_scheduleMutex);
+    if (m_schedule != schedule) {
+        // Stopped or restarted by the task.
+        return;
+    }
+    schedule->count++;
+    if (FOREVER != schedule->maxCount && schedule->count >= schedule->maxCount) {
+        m_schedule.reset();
+        m_running = false;
+        return;
+    }
+    auto now = std::chrono::steady_clock::now();
+    switch (schedule->periodType) {
+        case PeriodType::ABSOLUTE:
+            schedule->offSchedule = schedule->deadline + schedule->period < now;
+            schedule->deadline += schedule->period;
+            break;
+        case PeriodType::RELATIVE:
+            schedule->deadline = now + schedule->period;
+            break;
+    }
+    m_wheel->schedule(&m_entry, schedule->deadline);
+}
+
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -13,17 +13,18 @@
  * permissions and limitations under the License.
  */
 
-#include <random>
+#include <algorithm>
+#include <atomic>
 #include <chrono>
-#include <sstream>
-#include <string>
-#include <iomanip>
-#include <cmath>
-#include <mutex>
 #include <climits>
-#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <deque>
 #include <functional>
-#include <list>
+#include <limits>
+#include <mutex>
+#include <random>
+#include <string>
 
 #include "AVSCommon/Utils/Logger/Logger.h"
 #include "AVSCommon/Utils/UUIDGeneration/UUIDGeneration.h"
@@ -47,37 +48,53 @@ static const std::string TAG("UUIDGeneration");
 static const uint8_t UUID_VERSION_VALUE = 4 << 4;
 
 /// The UUID variant (Variant 1), shifted into the correct position in the byte.
-static const size_t UUID_VARIANT_VALUE = 2 << 6;
+static const uint8_t UUID_VARIANT_VALUE = 2 << 6;
 
-/// Separator used between UUID fields.
-static const std::string SEPARATOR("-");
+/// The number of random bytes in a UUID.
+static const size_t UUID_BYTES = 16;
 
-/// Number of bits in the replacement value.
-static const size_t MAX_NUM_REPLACEMENT_BITS = CHAR_BIT;
+/// The index of the byte holding the version.
+static const size_t UUID_VERSION_BYTE = 6;
 
-/// Number of bits in a hex digit.
-static const size_t BITS_IN_HEX_DIGIT = 4;
+/// The index of the byte holding the variant.
+static const size_t UUID_VARIANT_BYTE = 8;
 
-/// Indicates if next UUID should be seeded. Must not be accessed unless g_mutex is locked.
-static bool g_seedNeeded = true;
+/// Whether a hyphen follows each byte of the UUID when it is formatted.
+static const bool HYPHEN_AFTER_BYTE[UUID_BYTES] =
+    {false, false, false, true, false, true, false, true, false, true, false, false, false, false, false, false};
 
-/// Lock to avoid collisions in generationing uuid and setting seed.
-static std::mutex g_mutex;
+/// The hexadecimal digits.
+static const char HEX_DIGITS[] = "0123456789abcdef";
 
 /// Entropy Threshold for sufficient uniqueness. Value chosen by experiment.
 static const double ENTROPY_THRESHOLD = 600;
 
+/// Catch for platforms where entropy is a hard coded value. Value chosen by experiment.
+static const int ENTROPY_REPEAT_THRESHOLD = 16;
+
 /// extra seeds
 static const size_t MAX_SEEDS_POOL_SIZE = 1024;
 
-/// pool of seeds
-static std::list<uint32_t> seedsPool;
+/// The number of 32 bit words in a ChaCha20 key.
+static const size_t KEY_WORDS = 8;
 
-/// last time generateUUID was invoked
-static uint64_t lastInvokeTime;
+/// The number of 32 bit words in a ChaCha20 block.
+static const size_t BLOCK_WORDS = 16;
 
-/// Catch for platforms where entropy is a hard coded value. Value chosen by experiment.
-static const int ENTROPY_REPEAT_THRESHOLD = 16;
+/// The number of bytes in a ChaCha20 block.
+static const size_t BLOCK_BYTES = BLOCK_WORDS * 4;
+
+/// Lock protecting the seeds pool.  Only taken when a thread (re)seeds its generator.
+static std::mutex g_mutex;
+
+/// pool of seeds, most recent first.  Must not be accessed unless g_mutex is locked.
+static std::deque<uint32_t> seedsPool;
+
+/// Incremented whenever seeds are added, which makes every thread reseed its generator before its next UUID.
+static std::atomic<uint32_t> g_seedGeneration{1};
+
+/// Counter used to give every thread's keystream a distinct nonce.
+static std::atomic<uint64_t> g_streamCounter{0};
 
 /// The default read entropy function. This can be customized using UUIDGeneration::setEntropyReader().
 static std::function<double(void)> readEntropyFunc = []() {
@@ -85,6 +102,39 @@ static std::function<double(void)> readEntropyFunc = []() {
     return rd.entropy();
 };
 
+/**
+ * The per-thread state of the UUID generator: a ChaCha20 keystream and the bytes of it not used yet.  This is kept
+ * trivially destructible so that threads do not register a destructor for it.
+ */
+struct ThreadGenerator {
+    /// The seed generation the generator was last seeded for, or 0 if it has not been seeded.
+    uint32_t seedGeneration;
+
+    /// Whether the generator should be reseeded before its next UUID, because the entropy was low when it was seeded.
+    bool reseedNeeded;
+
+    /// The number of consecutive seedings which reported the same entropy.
+    int consistentEntropyReports;
+
+    /// The entropy reported at the last seeding.
+    double priorEntropyResult;
+
+    /// The time of the last seeding.
+    uint64_t lastSeedTime;
+
+    /// The ChaCha20 input block: constants, key, block counter and nonce.
+    uint32_t input[BLOCK_WORDS];
+
+    /// The current keystream block.
+    uint8_t block[BLOCK_BYTES];
+
+    /// The number of bytes of @c block already used.
+    size_t used;
+};
+
+/// The generator of the calling thread.
+static thread_local ThreadGenerator t_generator;
+
 void setEntropyReader(std::function<double(void)> func) {
     readEntropyFunc = func;
 }
@@ -92,145 +142,210 @@ void setEntropyReader(std::function<double(void)> func) {
 void setSalt(const std::string& newSalt) {
     std::unique_lock<std::mutex> lock(g_mutex);
     std::copy_n(newSalt.begin(), std::min(newSalt.size(), MAX_SEEDS_POOL_SIZE), std::front_inserter(seedsPool));
-    g_seedNeeded = true;
+    if (seedsPool.size() > MAX_SEEDS_POOL_SIZE) {
+        seedsPool.resize(MAX_SEEDS_POOL_SIZE);
+    }
+    g_seedGeneration++;
 }
 
 void addSeeds(const std::vector<uint32_t>& seeds) {
     std::unique_lock<std::mutex> lock(g_mutex);
     std::copy_n(seeds.begin(), std::min(seeds.size(), MAX_SEEDS_POOL_SIZE), std::front_inserter(seedsPool));
-    g_seedNeeded = true;
+    if (seedsPool.size() > MAX_SEEDS_POOL_SIZE) {
+        seedsPool.resize(MAX_SEEDS_POOL_SIZE);
+    }
+    g_seedGeneration++;
 }
 
 /**
- * Randomly generate a string of hex digits. Before the conversion of hex to string,
- * the function allows replacement of the bits of the first two generated hex digits.
- * Replacement happens starting at the most significant, to the least significant bit.
- *
- * @param ibe A random number generator.
- * @param numDigits The number of hex digits [0-9],[a-f] to generate.
- * @param replacementBits The replacement value for up to the first two digits generated.
- * @param numReplacementBits The number of bits of @c replacementBits to use.
+ * Rotates a 32 bit word left.
  *
- * @return A hex string of length @c numDigits.
+ * @param value The word.
+ * @param bits The number of bits to rotate by.
+ * @return The rotated word.
  */
-static const std::string generateHexWithReplacement(
-    std::independent_bits_engine<std::mt19937, CHAR_BIT, uint32_t>& ibe,
-    unsigned int numDigits,
-    uint8_t replacementBits,
-    uint8_t numReplacementBits) {
-    if (numReplacementBits > MAX_NUM_REPLACEMENT_BITS) {
-        ACSDK_ERROR(LX("generateHexWithReplacementFailed")
-                        .d("reason", "replacingMoreBitsThanProvided")
-                        .d("numReplacementBitsLimit", MAX_NUM_REPLACEMENT_BITS)
-                        .d("numReplacementBits", numReplacementBits));
-        return "";
-    }
-
-    if (numReplacementBits > (numDigits * BITS_IN_HEX_DIGIT)) {
-        ACSDK_ERROR(LX("generateHexWithReplacementFailed")
-                        .d("reason", "replacingMoreBitsThanGenerated")
-                        .d("numDigitsInBits", numDigits * BITS_IN_HEX_DIGIT)
-                        .d("numReplacementBits", numReplacementBits));
-        return "";
-    }
-
-    const size_t arrayLen = (numDigits + 1) / 2;
-
-    std::vector<uint8_t> bytes(arrayLen);
-    std::generate(bytes.begin(), bytes.end(), std::ref(ibe));
-
-    // Replace the specified number of bits from the first byte.
-    bytes.at(0) &= (0xff >> numReplacementBits);
-    replacementBits &= (0xff << (MAX_NUM_REPLACEMENT_BITS - numReplacementBits));
-    bytes.at(0) |= replacementBits;
-
-    std::ostringstream oss;
-    for (const auto& byte : bytes) {
-        oss << std::hex << std::setfill('0') << std::setw(2) << static_cast<int>(byte);
-    }
-
-    std::string bytesText = oss.str();
-    // Remove the last digit for odd numDigits case.
-    bytesText.resize(numDigits);
-
-    return bytesText;
+static inline uint32_t rotateLeft(uint32_t value, int bits) {
+    return (value << bits) | (value >> (32 - bits));
 }
 
 /**
- * Randomly generate a string of hex digits.
+ * The ChaCha quarter round.
  *
- * @param ibe A random number generator.
- * @param numDigits The number of hex digits [0-9],[a-f] to generate.
+ * @param x The working state.
+ * @param a,b,c,d The indices of the words to mix.
+ */
+static inline void quarterRound(uint32_t* x, int a, int b, int c, int d) {
+    x[a] += x[b];
+    x[d] = rotateLeft(x[d] ^ x[a], 16);
+    x[c] += x[d];
+    x[b] = rotateLeft(x[b] ^ x[c], 12);
+    x[a] += x[b];
+    x[d] = rotateLeft(x[d] ^ x[a], 8);
+    x[c] += x[d];
+    x[b] = rotateLeft(x[b] ^ x[c], 7);
+}
+
+/**
+ * Computes the next ChaCha20 keystream block of a generator, and advances its block counter.
  *
- * @return A hex string of length @c numDigits.
+ * @param generator The generator.
  */
-static const std::string generateHex(
-    std::independent_bits_engine<std::mt19937, CHAR_BIT, uint32_t>& ibe,
-    unsigned int numDigits) {
-    return generateHexWithReplacement(ibe, numDigits, 0, 0);
+static void nextBlock(ThreadGenerator* generator) {
+    uint32_t x[BLOCK_WORDS];
+    std::memcpy(x, generator->input, sizeof(x));
+    for (int round = 0; round < 10; ++round) {
+        quarterRound(x, 0, 4, 8, 12);
+        quarterRound(x, 1, 5, 9, 13);
+        quarterRound(x, 2, 6, 10, 14);
+        quarterRound(x, 3, 7, 11, 15);
+        quarterRound(x, 0, 5, 10, 15);
+        quarterRound(x, 1, 6, 11, 12);
+        quarterRound(x, 2, 7, 8, 13);
+        quarterRound(x, 3, 4, 9, 14);
+    }
+    for (size_t i = 0; i < BLOCK_WORDS; ++i) {
+        uint32_t word = x[i] + generator->input[i];
+        generator->block[i * 4] = static_cast<uint8_t>(word);
+        generator->block[i * 4 + 1] = static_cast<uint8_t>(word >> 8);
+        generator->block[i * 4 + 2] = static_cast<uint8_t>(word >> 16);
+        generator->block[i * 4 + 3] = static_cast<uint8_t>(word >> 24);
+    }
+    if (0 == ++generator->input[12]) {
+        ++generator->input[13];
+    }
+    generator->used = 0;
 }
 
 /**
- * Add default seed to the pool, should only be used in generateUUID and locked by g_mutex.
+ * Keys a generator's keystream from @c std::random_device, mixed with the seeds pool and the time and address seeds
+ * this file has always used.
+ *
+ * @param generator The generator.
+ * @param seedGeneration The seed generation to record in @c generator.
  */
-static void addDefaultSeedLocked() {
+static void seed(ThreadGenerator* generator, uint32_t seedGeneration) {
     std::random_device rd;
     uint64_t timeSeed = std::chrono::high_resolution_clock::now().time_since_epoch().count();
-    if (lastInvokeTime > 0) {
-        seedsPool.push_front((uint32_t)(timeSeed - lastInvokeTime));  // interval between two invocations
-    }
-    lastInvokeTime = timeSeed;
-    seedsPool.push_front((uint32_t)timeSeed);  // lower 32bits of current time
-    seedsPool.push_front(rd());                // random device
-    seedsPool.push_front(
-        reinterpret_cast<std::intptr_t>(&timeSeed));  // lower 32bits of memory address of temporary variable
 
-    if (seedsPool.size() > MAX_SEEDS_POOL_SIZE) {
-        seedsPool.resize(MAX_SEEDS_POOL_SIZE);
+    std::vector<uint32_t> seeds;
+    {
+        std::lock_guard<std::mutex> lock(g_mutex);
+        seeds.assign(seedsPool.begin(), seedsPool.end());
+    }
+    if (generator->lastSeedTime > 0) {
+        seeds.push_back(static_cast<uint32_t>(timeSeed - generator->lastSeedTime));  // interval between two seedings
+    }
+    generator->lastSeedTime = timeSeed;
+    seeds.push_back(static_cast<uint32_t>(timeSeed));  // lower 32bits of current time
+    seeds.push_back(static_cast<uint32_t>(reinterpret_cast<std::intptr_t>(&timeSeed)));  // address of a local
+
+    // The key is random_device output, xor'ed with the mixed seeds, so the seeds cannot make it any weaker.
+    std::seed_seq seedSequence(seeds.begin(), seeds.end());
+    uint32_t mixed[KEY_WORDS];
+    seedSequence.generate(mixed, mixed + KEY_WORDS);
+
+    // "expand 32-byte k"
+    generator->input[0] = 0x61707865;
+    generator->input[1] = 0x3320646e;
+    generator->input[2] = 0x79622d32;
+    generator->input[3] = 0x6b206574;
+    for (size_t i = 0; i < KEY_WORDS; ++i) {
+        generator->input[4 + i] = rd() ^ mixed[i];
+    }
+    generator->input[12] = 0;
+    generator->input[13] = 0;
+    auto stream = g_streamCounter.fetch_add(1);
+    generator->input[14] = static_cast<uint32_t>(stream);
+    generator->input[15] = static_cast<uint32_t>(stream >> 32);
+    generator->seedGeneration = seedGeneration;
+    generator->used = BLOCK_BYTES;
+
+    double currentEntropy = readEntropyFunc();
+    if (std::fabs(currentEntropy - generator->priorEntropyResult) < std::numeric_limits<double>::epsilon()) {
+        ++generator->consistentEntropyReports;
+    } else {
+        generator->consistentEntropyReports = 0;
+    }
+    generator->priorEntropyResult = currentEntropy;
+
+    if (currentEntropy > ENTROPY_THRESHOLD) {
+        generator->reseedNeeded = false;
+    } else {
+        ACSDK_INFO(LX("low entropy on call to generate UUID").d("current entropy", currentEntropy));
+        generator->reseedNeeded = true;
+        if (generator->consistentEntropyReports > ENTROPY_REPEAT_THRESHOLD) {
+            generator->reseedNeeded = false;
+            ACSDK_INFO(LX("multiple repeat values for entropy")
+                           .d("current entropy", currentEntropy)
+                           .d("consistent entropy reports", generator->consistentEntropyReports));
+        }
     }
 }
 
-const std::string generateUUID() {
-    static std::independent_bits_engine<std::mt19937, CHAR_BIT, uint32_t> ibe;
-    std::unique_lock<std::mutex> lock(g_mutex);
-
-    if (g_seedNeeded) {
-        static int consistentEntropyReports = 0;
-        static double priorEntropyResult = 0;
-        addDefaultSeedLocked();
-        std::seed_seq seed(seedsPool.begin(), seedsPool.end());
-        ibe.seed(seed);
-
-        double currentEntropy = readEntropyFunc();
+/**
+ * Obtain the calling thread's generator, seeding it first if it has not been seeded since seeds were last added.
+ *
+ * @return The generator.
+ */
+static ThreadGenerator* getGenerator() {
+    auto generator = &t_generator;
+    auto seedGeneration = g_seedGeneration.load(std::memory_order_relaxed);
+    if (generator->seedGeneration != seedGeneration || generator->reseedNeeded) {
+        seed(generator, seedGeneration);
+    }
+    return generator;
+}
 
-        if (std::fabs(currentEntropy - priorEntropyResult) < std::numeric_limits<double>::epsilon()) {
-            ++consistentEntropyReports;
-        } else {
-            consistentEntropyReports = 0;
-        }
-        priorEntropyResult = currentEntropy;
-
-        if (currentEntropy > ENTROPY_THRESHOLD) {
-            g_seedNeeded = false;
-        } else {
-            ACSDK_INFO(LX("low entropy on call to generate UUID").d("current entropy", currentEntropy));
-            if (consistentEntropyReports > ENTROPY_REPEAT_THRESHOLD) {
-                g_seedNeeded = false;
-                ACSDK_INFO(LX("multiple repeat values for entropy")
-                               .d("current entropy", currentEntropy)
-                               .d("consistent entropy reports", consistentEntropyReports));
-            }
+/**
+ * Writes the next UUID from a generator's keystream.
+ *
+ * @param generator The generator.
+ * @param[out] buffer The buffer to write the @c UUID_STRING_LENGTH characters of the UUID to.
+ */
+static void formatUUID(ThreadGenerator* generator, char* buffer) {
+    // Blocks are a multiple of the UUID size, so a UUID never straddles two blocks.
+    static_assert(0 == BLOCK_BYTES % UUID_BYTES, "UUIDs must not straddle keystream blocks");
+    if (generator->used >= BLOCK_BYTES) {
+        nextBlock(generator);
+    }
+    uint8_t bytes[UUID_BYTES];
+    std::memcpy(bytes, generator->block + generator->used, UUID_BYTES);
+    // Do not leave the bytes of a UUID which has been handed out in the buffer.
+    std::memset(generator->block + generator->used, 0, UUID_BYTES);
+    generator->used += UUID_BYTES;
+
+    bytes[UUID_VERSION_BYTE] = (bytes[UUID_VERSION_BYTE] & 0x0f) | UUID_VERSION_VALUE;
+    bytes[UUID_VARIANT_BYTE] = (bytes[UUID_VARIANT_BYTE] & 0x3f) | UUID_VARIANT_VALUE;
+
+    for (size_t i = 0; i < UUID_BYTES; ++i) {
+        *buffer++ = HEX_DIGITS[bytes[i] >> 4];
+        *buffer++ = HEX_DIGITS[bytes[i] & 0x0f];
+        if (HYPHEN_AFTER_BYTE[i]) {
+            *buffer++ = '-';
         }
     }
+}
 
-    std::ostringstream uuidText;
-    uuidText << generateHex(ibe, 8) << SEPARATOR << generateHex(ibe, 4) << SEPARATOR
-             << generateHexWithReplacement(ibe, 4, UUID_VERSION_VALUE, 4) << SEPARATOR
-             << generateHexWithReplacement(ibe, 4, UUID_VARIANT_VALUE, 2) << SEPARATOR << generateHex(ibe, 12);
+void generateUUID(char* buffer) {
+    formatUUID(getGenerator(), buffer);
+}
 
-    lock.unlock();
+const std::string generateUUID() {
+    char buffer[UUID_STRING_LENGTH];
+    generateUUID(buffer);
+    return std::string(buffer, UUID_STRING_LENGTH);
+}
 
-    return uuidText.str();
+std::vector<std::string> generateUUIDs(size_t count) {
+    std::vector<std::string> uuids;
+    uuids.reserve(count);
+    auto generator = getGenerator();
+    char buffer[UUID_STRING_LENGTH];
+    for (size_t i = 0; i < count; ++i) {
+        formatUUID(generator, buffer);
+        uuids.emplace_back(buffer, UUID_STRING_LENGTH);
+    }
+    return uuids;
 }
 
 }  // namespace uuidGeneration
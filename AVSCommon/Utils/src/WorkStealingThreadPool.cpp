@@ -0,0 +1,192 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <algorithm>
+
+#include "AVSCommon/Utils/Logger/Logger.h"
+#include "AVSCommon/Utils/Logger/ThreadMoniker.h"
+#include "AVSCommon/Utils/Memory/Memory.h"
+#include "AVSCommon/Utils/Threading/WorkStealingThreadPool.h"
+
+/// String to identify log entries originating from this file.
+static const std::string TAG("WorkStealingThreadPool");
+
+/**
+ * Create a LogEntry using this file's TAG and the specified event string.
+ *
+ * @param The event string for this @c LogEntry.
+ */
+#define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+
+using namespace logger;
+
+/// The pool the current thread is a worker of, or @c nullptr.
+static thread_local WorkStealingThreadPool* g_currentPool = nullptr;
+
+/// The index of the current thread within @c g_currentPool.
+static thread_local size_t g_currentIndex = 0;
+
+WorkStealingThreadPool::WorkStealingThreadPool(size_t numThreads) :
+        m_pending{0},
+        m_idle{0},
+        m_stop{false},
+        m_executed{0},
+        m_stolen{0} {
+    if (0 == numThreads) {
+        numThreads = std::max<size_t>(MIN_WORK_STEALING_THREADS, std::thread::hardware_concurrency());
+    }
+    m_workerQueues.reserve(numThreads);
+    for (size_t i = 0; i < numThreads; ++i) {
+        m_workerQueues.push_back(memory::make_unique<TaskQueue>());
+    }
+    m_threads.reserve(numThreads);
+    for (size_t i = 0; i < numThreads; ++i) {
+        m_threads.emplace_back(&WorkStealingThreadPool::runWorker, this, i);
+    }
+    ACSDK_DEBUG5(LX("created").d("threads", numThreads));
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_idleMutex);
+        m_stop = true;
+    }
+    m_workAvailable.notify_all();
+    for (auto& thread : m_threads) {
+        if (thread.get_id() == std::this_thread::get_id()) {
+            ACSDK_ERROR(LX("destructorWarning").d("reason", "destroyedFromWorkerThread"));
+            thread.detach();
+        } else if (thread.joinable()) {
+            thread.join();
+        }
+    }
+}
+
+bool WorkStealingThreadPool::submit(Task task) {
+    if (!task) {
+        ACSDK_ERROR(LX("submitFailed").d("reason", "invalidTask"));
+        return false;
+    }
+    if (m_stop) {
+        ACSDK_ERROR(LX("submitFailed").d("reason", "shuttingDown"));
+        return false;
+    }
+
+    auto& queue = (this == g_currentPool) ? *m_workerQueues[g_currentIndex] : m_injectionQueue;
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(std::move(task));
+    }
+
+    // The increment of m_pending must be ordered before the load of m_idle.  It pairs with the increment of m_idle
+    // (ordered before the load of m_pending) in runWorker(), so either we see the idle worker or it sees the task.
+    m_pending.fetch_add(1);
+    if (m_idle.load() > 0) {
+        {
+            // Taking the mutex guarantees that a worker which has checked m_pending is now waiting on the condition.
+            std::lock_guard<std::mutex> lock(m_idleMutex);
+        }
+        m_workAvailable.notify_one();
+    }
+    return true;
+}
+
+size_t WorkStealingThreadPool::getNumThreads() const {
+    return m_threads.size();
+}
+
+void WorkStealingThreadPool::getStats(uint64_t& tasksExecuted, uint64_t& tasksStolen) {
+    tasksExecuted = m_executed;
+    tasksStolen = m_stolen;
+}
+
+bool WorkStealingThreadPool::popFrom(TaskQueue& queue, bool fromFront, Task* task) {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty()) {
+        return false;
+    }
+    if (fromFront) {
+        *task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+    } else {
+        *task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+    }
+    m_pending.fetch_sub(1);
+    return true;
+}
+
+bool WorkStealingThreadPool::takeTask(size_t index, Task* task) {
+    if (popFrom(*m_workerQueues[index], true, task) || popFrom(m_injectionQueue, true, task)) {
+        return true;
+    }
+    // Steal the newest task from the other workers, starting with our neighbour so that thieves spread out.
+    auto numQueues = m_workerQueues.size();
+    for (size_t offset = 1; offset < numQueues; ++offset) {
+        if (popFrom(*m_workerQueues[(index + offset) % numQueues], false, task)) {
+            m_stolen++;
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorkStealingThreadPool::runWorker(size_t index) {
+    ThreadMoniker::setThisThreadMoniker(ThreadMoniker::generateMoniker());
+    g_currentPool = this;
+    g_currentIndex = index;
+
+    while (true) {
+        Task task;
+        if (takeTask(index, &task)) {
+            task();
+            m_executed++;
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_idleMutex);
+        m_idle.fetch_add(1);
+        m_workAvailable.wait(lock, [this] { return m_pending.load() > 0 || m_stop; });
+        m_idle.fetch_sub(1);
+        if (m_stop && 0 == m_pending.load()) {
+            break;
+        }
+    }
+
+    g_currentPool = nullptr;
+}
+
+std::shared_ptr<WorkStealingThreadPool> WorkStealingThreadPool::getDefaultThreadPool() {
+    static std::mutex singletonMutex;
+    static std::weak_ptr<WorkStealingThreadPool> weakPoolRef;
+
+    std::lock_guard<std::mutex> lock(singletonMutex);
+    auto sharedPoolRef = weakPoolRef.lock();
+    if (!sharedPoolRef) {
+        sharedPoolRef = std::make_shared<WorkStealingThreadPool>();
+        weakPoolRef = sharedPoolRef;
+    }
+    return sharedPoolRef;
+}
+
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,377 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/Metrics/AggregatingMetricRecorder.h"
+#include "AVSCommon/Utils/Metrics/DataPointCounterBuilder.h"
+#include "AVSCommon/Utils/Metrics/MetricEventBuilder.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace metrics {
+namespace test {
+
+using namespace ::testing;
+
+/// Activity name used in the tests.
+static const std::string ACTIVITY = "activity";
+
+/// Another activity name used in the tests.
+static const std::string OTHER_ACTIVITY = "otherActivity";
+
+/// Flush interval used when testing periodic flushes.
+static const std::chrono::milliseconds SHORT_FLUSH_INTERVAL{20};
+
+/// How long to wait for a periodic flush.
+static const std::chrono::seconds FLUSH_TIMEOUT{5};
+
+/// The number of threads recording concurrently.
+static const int NUM_THREADS = 8;
+
+/// The number of values each thread records.
+static const int RECORDS_PER_THREAD = 10000;
+
+/// The number of increments the benchmarks count.
+static const int BENCHMARK_INCREMENTS = 200000;
+
+/**
+ * A @c MetricRecorderInterface which keeps the events it is given.
+ */
+class CapturingMetricRecorder : public MetricRecorderInterface {
+public:
+    void recordMetric(std::shared_ptr<MetricEvent> metricEvent) override {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_events.push_back(metricEvent);
+        m_wakeCondition.notify_all();
+    }
+
+    /**
+     * Obtain the events recorded so far, and forget them.
+     *
+     * @return The events.
+     */
+    std::vector<std::shared_ptr<MetricEvent>> takeEvents() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto events = std::move(m_events);
+        m_events.clear();
+        return events;
+    }
+
+    /**
+     * Waits for an event to be recorded.
+     *
+     * @param timeout How long to wait.
+     * @return Whether an event was recorded.
+     */
+    bool waitForEvent(std::chrono::milliseconds timeout) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_wakeCondition.wait_for(lock, timeout, [this] { return !m_events.empty(); });
+    }
+
+private:
+    /// Serializes access to @c m_events.
+    std::mutex m_mutex;
+
+    /// Notified when an event is recorded.
+    std::condition_variable m_wakeCondition;
+
+    /// The recorded events.
+    std::vector<std::shared_ptr<MetricEvent>> m_events;
+};
+
+/**
+ * Obtain the value of a counter data point of an event.
+ *
+ * @param event The event.
+ * @param name The name of the data point.
+ * @return The value of the data point, or an empty string if there is none.
+ */
+static std::string getCounter(const std::shared_ptr<MetricEvent>& event, const std::string& name) {
+    return event->getDataPoint(name, DataType::COUNTER).value().getValue();
+}
+
+/**
+ * Obtain the value of a duration data point of an event.
+ *
+ * @param event The event.
+ * @param name The name of the data point.
+ * @return The value of the data point, or an empty string if there is none.
+ */
+static std::string getDuration(const std::shared_ptr<MetricEvent>& event, const std::string& name) {
+    return event->getDataPoint(name, DataType::DURATION).value().getValue();
+}
+
+class AggregatingMetricRecorderTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_sink = std::make_shared<CapturingMetricRecorder>();
+    }
+
+protected:
+    /// The recorder receiving the flushed events.
+    std::shared_ptr<CapturingMetricRecorder> m_sink;
+};
+
+/**
+ * Verify that @c create() rejects invalid parameters.
+ */
+TEST_F(AggregatingMetricRecorderTest, test_createWithInvalidParameters) {
+    EXPECT_EQ(AggregatingMetricRecorder::create(nullptr), nullptr);
+    EXPECT_EQ(AggregatingMetricRecorder::create(m_sink, std::chrono::milliseconds(-1)), nullptr);
+    EXPECT_EQ(AggregatingMetricRecorder::create(m_sink, std::chrono::milliseconds::zero(), 0), nullptr);
+}
+
+/**
+ * Verify that names are interned: registering a name again returns the same id, and the type is part of the name.
+ */
+TEST_F(AggregatingMetricRecorderTest, test_registerMetrics) {
+    auto recorder = AggregatingMetricRecorder::create(m_sink, std::chrono::milliseconds::zero(), 3);
+    ASSERT_NE(recorder, nullptr);
+
+    auto counter = recorder->getCounter(ACTIVITY, "name");
+    EXPECT_NE(counter, AggregatingMetricRecorder::INVALID_METRIC_ID);
+    EXPECT_EQ(recorder->getCounter(ACTIVITY, "name"), counter);
+
+    auto histogram = recorder->getHistogram(ACTIVITY, "name");
+    EXPECT_NE(histogram, AggregatingMetricRecorder::INVALID_METRIC_ID);
+    EXPECT_NE(histogram, counter);
+
+    auto other = recorder->getCounter(OTHER_ACTIVITY, "name");
+    EXPECT_NE(other, AggregatingMetricRecorder::INVALID_METRIC_ID);
+    EXPECT_NE(other, counter);
+
+    EXPECT_EQ(recorder->getCounter(ACTIVITY, ""), AggregatingMetricRecorder::INVALID_METRIC_ID);
+    EXPECT_EQ(recorder->getCounter(ACTIVITY, "tooMany"), AggregatingMetricRecorder::INVALID_METRIC_ID);
+
+    // Recording to an invalid id is ignored.
+    recorder->increment(AggregatingMetricRecorder::INVALID_METRIC_ID);
+    recorder->flush();
+    EXPECT_TRUE(m_sink->takeEvents().empty());
+}
+
+/**
+ * Verify that counters are summed and sent as one event per activity, and that unchanged counters are not sent.
+ */
+TEST_F(AggregatingMetricRecorderTest, test_flushCounters) {
+    auto recorder = AggregatingMetricRecorder::create(m_sink, std::chrono::milliseconds::zero());
+    ASSERT_NE(recorder, nullptr);
+    auto first = recorder->getCounter(ACTIVITY, "first");
+    auto second = recorder->getCounter(ACTIVITY, "second");
+    auto other = recorder->getCounter(OTHER_ACTIVITY, "other");
+
+    recorder->increment(first);
+    recorder->increment(first, 4);
+    recorder->increment(second, 2);
+    recorder->increment(other);
+    recorder->flush();
+
+    auto events = m_sink->takeEvents();
+    ASSERT_EQ(events.size(), 2u);
+    EXPECT_EQ(events[0]->getActivityName(), ACTIVITY);
+    EXPECT_EQ(getCounter(events[0], "first"), "5");
+    EXPECT_EQ(getCounter(events[0], "second"), "2");
+    EXPECT_EQ(events[1]->getActivityName(), OTHER_ACTIVITY);
+    EXPECT_EQ(getCounter(events[1], "other"), "1");
+
+    // Only the change since the last flush is sent.
+    recorder->increment(second, 3);
+    recorder->flush();
+    events = m_sink->takeEvents();
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(getCounter(events[0], "second"), "3");
+    EXPECT_EQ(getCounter(events[0], "first"), "");
+
+    recorder->flush();
+    EXPECT_TRUE(m_sink->takeEvents().empty());
+}
+
+/**
+ * Verify the data points sent for a histogram.
+ */
+TEST_F(AggregatingMetricRecorderTest, test_flushHistogram) {
+    auto recorder = AggregatingMetricRecorder::create(m_sink, std::chrono::milliseconds::zero());
+    ASSERT_NE(recorder, nullptr);
+    auto histogram = recorder->getHistogram(ACTIVITY, "latency");
+
+    // 89 values of 3, 10 values of 100, and one value of 1000.
+    uint64_t sum = 0;
+    for (int i = 0; i < 89; ++i) {
+        recorder->recordValue(histogram, 3);
+        sum += 3;
+    }
+    for (int i = 0; i < 10; ++i) {
+        recorder->recordValue(histogram, 100);
+        sum += 100;
+    }
+    recorder->recordValue(histogram, 1000);
+    sum += 1000;
+    recorder->flush();
+
+    auto events = m_sink->takeEvents();
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(getCounter(events[0], "latency.count"), "100");
+    EXPECT_EQ(getCounter(events[0], "latency.sum"), std::to_string(sum));
+    // Percentiles are the upper bounds of the power of two buckets holding them.
+    EXPECT_EQ(getDuration(events[0], "latency.p50"), "3");
+    EXPECT_EQ(getDuration(events[0], "latency.p90"), "127");
+    EXPECT_EQ(getDuration(events[0], "latency.p99"), "127");
+    EXPECT_EQ(getCounter(events[0], "latency.p50"), "");
+}
+
+/**
+ * Verify that values recorded concurrently on many threads are all counted.
+ */
+TEST_F(AggregatingMetricRecorderTest, test_concurrentRecording) {
+    auto recorder = AggregatingMetricRecorder::create(m_sink, std::chrono::milliseconds::zero());
+    ASSERT_NE(recorder, nullptr);
+    auto counter = recorder->getCounter(ACTIVITY, "counter");
+    auto histogram = recorder->getHistogram(ACTIVITY, "histogram");
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < NUM_THREADS; ++t) {
+        threads.emplace_back([&recorder, counter, histogram] {
+            for (int i = 0; i < RECORDS_PER_THREAD; ++i) {
+                recorder->increment(counter);
+                recorder->recordValue(histogram, 1);
+            }
+        });
+    }
+    // Flush while the threads are recording, too.
+    for (int i = 0; i < 10; ++i) {
+        recorder->flush();
+        std::this_thread::yield();
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    recorder->flush();
+
+    uint64_t total = 0;
+    for (const auto& event : m_sink->takeEvents()) {
+        auto value = getCounter(event, "counter");
+        if (!value.empty()) {
+            total += std::stoull(value);
+        }
+    }
+    EXPECT_EQ(total, static_cast<uint64_t>(NUM_THREADS * RECORDS_PER_THREAD));
+}
+
+/**
+ * Verify that values recorded by threads which exit before or between flushes are all counted.
+ */
+TEST_F(AggregatingMetricRecorderTest, test_exitedThreadsCounted) {
+    auto recorder = AggregatingMetricRecorder::create(m_sink, std::chrono::milliseconds::zero());
+    ASSERT_NE(recorder, nullptr);
+    auto counter = recorder->getCounter(ACTIVITY, "counter");
+
+    for (int t = 0; t < NUM_THREADS; ++t) {
+        std::thread([&recorder, counter] { recorder->increment(counter); }).join();
+        std::thread([&recorder, counter] { recorder->increment(counter); }).join();
+        recorder->flush();
+    }
+    recorder->increment(counter);
+    recorder->flush();
+
+    uint64_t total = 0;
+    for (const auto& event : m_sink->takeEvents()) {
+        total += std::stoull(getCounter(event, "counter"));
+    }
+    EXPECT_EQ(total, static_cast<uint64_t>(2 * NUM_THREADS + 1));
+}
+
+/**
+ * Verify that metrics are flushed periodically, and when the recorder is destroyed.
+ */
+TEST_F(AggregatingMetricRecorderTest, test_periodicAndFinalFlush) {
+    auto recorder = AggregatingMetricRecorder::create(m_sink, SHORT_FLUSH_INTERVAL);
+    ASSERT_NE(recorder, nullptr);
+    auto counter = recorder->getCounter(ACTIVITY, "counter");
+
+    recorder->increment(counter);
+    ASSERT_TRUE(m_sink->waitForEvent(FLUSH_TIMEOUT));
+    auto events = m_sink->takeEvents();
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(getCounter(events[0], "counter"), "1");
+
+    recorder->increment(counter, 2);
+    recorder.reset();
+    events = m_sink->takeEvents();
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(getCounter(events[0], "counter"), "2");
+}
+
+/**
+ * Verify that events passed to @c recordMetric() are forwarded unchanged.
+ */
+TEST_F(AggregatingMetricRecorderTest, test_recordMetricForwardsEvents) {
+    auto recorder = AggregatingMetricRecorder::create(m_sink, std::chrono::milliseconds::zero());
+    ASSERT_NE(recorder, nullptr);
+    auto event = MetricEventBuilder{}.setActivityName(ACTIVITY).build();
+    recorder->recordMetric(event);
+    recorder->recordMetric(nullptr);
+
+    auto events = m_sink->takeEvents();
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(events[0], event);
+}
+
+/**
+ * Benchmark counting with a @c MetricEvent per increment.
+ */
+TEST_F(AggregatingMetricRecorderTest, testSlow_benchmarkMetricEventPerIncrement) {
+    auto recorder = AggregatingMetricRecorder::create(m_sink, std::chrono::milliseconds::zero());
+    ASSERT_NE(recorder, nullptr);
+
+    for (int i = 0; i < BENCHMARK_INCREMENTS; ++i) {
+        recorder->recordMetric(MetricEventBuilder{}
+                                   .setActivityName(ACTIVITY)
+                                   .addDataPoint(DataPointCounterBuilder{}.setName("counter").increment(1).build())
+                                   .build());
+    }
+    EXPECT_EQ(m_sink->takeEvents().size(), static_cast<size_t>(BENCHMARK_INCREMENTS));
+}
+
+/**
+ * Benchmark counting with an aggregated counter.
+ */
+TEST_F(AggregatingMetricRecorderTest, testSlow_benchmarkAggregatedCounter) {
+    auto recorder = AggregatingMetricRecorder::create(m_sink, std::chrono::milliseconds::zero());
+    ASSERT_NE(recorder, nullptr);
+
+    auto counter = recorder->getCounter(ACTIVITY, "counter");
+    for (int i = 0; i < BENCHMARK_INCREMENTS; ++i) {
+        recorder->increment(counter);
+    }
+    recorder->flush();
+
+    auto events = m_sink->takeEvents();
+    ASSERT_EQ(events.size(), 1u);
+    EXPECT_EQ(getCounter(events[0], "counter"), std::to_string(BENCHMARK_INCREMENTS));
+}
+
+}  // namespace test
+}  // namespace metrics
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,191 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/Logger/AsyncConsoleLogger.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+namespace test {
+
+/// A ring size used by the tests below.
+static const size_t TEST_ENTRIES = 16;
+
+/// Number of threads logging concurrently in @c test_concurrentProducers.
+static const int NUM_PRODUCERS = 8;
+
+/// Number of entries logged by each thread in @c test_concurrentProducers.
+static const int ENTRIES_PER_PRODUCER = 500;
+
+/**
+ * Splits @c text into lines.
+ *
+ * @param text The text to split.
+ * @return The lines of @c text.
+ */
+static std::vector<std::string> splitLines(const std::string& text) {
+    std::vector<std::string> lines;
+    std::istringstream stream(text);
+    std::string line;
+    while (std::getline(stream, line)) {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+/// Test that entries are written in order, formatted, after a flush.
+TEST(AsyncConsoleLoggerTest, test_entriesWrittenInOrder) {
+    std::stringstream output;
+    AsyncConsoleLogger logger(Level::DEBUG9, output, nullptr, TEST_ENTRIES);
+    EXPECT_EQ(logger.getCapacity(), TEST_ENTRIES);
+    for (int i = 0; i < 10; ++i) {
+        logger.log(Level::INFO, LogEntry("AsyncConsoleLoggerTest", "entry").d("index", i));
+    }
+    logger.flush();
+
+    auto lines = splitLines(output.str());
+    ASSERT_EQ(lines.size(), 10u);
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_NE(lines[i].find(" I AsyncConsoleLoggerTest:entry:index=" + std::to_string(i)), std::string::npos)
+            << lines[i];
+    }
+    EXPECT_EQ(logger.getDroppedCount(), 0u);
+}
+
+/// Test that entries are dropped and counted, rather than blocking, when the output stalls.
+TEST(AsyncConsoleLoggerTest, test_overflowDropsAndCounts) {
+    std::stringstream output;
+    auto streamMutex = std::make_shared<std::mutex>();
+    AsyncConsoleLogger logger(Level::DEBUG9, output, streamMutex, TEST_ENTRIES);
+    {
+        // Stall the background thread while it writes.
+        std::lock_guard<std::mutex> lock(*streamMutex);
+        for (size_t i = 0; i < TEST_ENTRIES * 3; ++i) {
+            logger.log(Level::INFO, LogEntry("AsyncConsoleLoggerTest", "entry"));
+        }
+    }
+    logger.flush();
+
+    auto dropped = logger.getDroppedCount();
+    EXPECT_GE(dropped, TEST_ENTRIES);
+    auto text = output.str();
+    EXPECT_NE(text.find("AsyncConsoleLogger:entriesDropped"), std::string::npos);
+    EXPECT_NE(text.find("total=" + std::to_string(dropped)), std::string::npos);
+}
+
+/// Test that long entries are truncated.
+TEST(AsyncConsoleLoggerTest, test_longEntryTruncated) {
+    std::stringstream output;
+    const size_t maxEntrySize = 100;
+    AsyncConsoleLogger logger(Level::DEBUG9, output, nullptr, TEST_ENTRIES, maxEntrySize);
+    logger.log(Level::INFO, LogEntry("AsyncConsoleLoggerTest", "entry").m(std::string(maxEntrySize * 2, 'x')));
+    logger.flush();
+
+    auto text = output.str();
+    EXPECT_NE(text.find(std::string(maxEntrySize / 2, 'x') + "...<truncated>"), std::string::npos);
+    EXPECT_EQ(text.find(std::string(maxEntrySize, 'x')), std::string::npos);
+}
+
+/// Test that the log level is honored.
+TEST(AsyncConsoleLoggerTest, test_levelFiltering) {
+    std::stringstream output;
+    AsyncConsoleLogger logger(Level::WARN, output);
+    logger.log(Level::INFO, LogEntry("AsyncConsoleLoggerTest", "filtered"));
+    logger.log(Level::ERROR, LogEntry("AsyncConsoleLoggerTest", "written"));
+    logger.flush();
+
+    auto text = output.str();
+    EXPECT_EQ(text.find("filtered"), std::string::npos);
+    EXPECT_NE(text.find("written"), std::string::npos);
+}
+
+/// Test that entries from many threads are all written, each thread's entries in order.
+TEST(AsyncConsoleLoggerTest, test_concurrentProducers) {
+    std::stringstream output;
+    AsyncConsoleLogger logger(Level::DEBUG9, output, nullptr, NUM_PRODUCERS * ENTRIES_PER_PRODUCER);
+    std::vector<std::thread> producers;
+    for (int p = 0; p < NUM_PRODUCERS; ++p) {
+        producers.emplace_back([&logger, p] {
+            for (int i = 0; i < ENTRIES_PER_PRODUCER; ++i) {
+                logger.log(Level::INFO, LogEntry("producer" + std::to_string(p), "entry").d("index", i));
+            }
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    logger.flush();
+    EXPECT_EQ(logger.getDroppedCount(), 0u);
+
+    std::vector<int> nextIndex(NUM_PRODUCERS, 0);
+    auto lines = splitLines(output.str());
+    ASSERT_EQ(lines.size(), static_cast<size_t>(NUM_PRODUCERS * ENTRIES_PER_PRODUCER));
+    for (const auto& line : lines) {
+        auto position = line.find(" producer");
+        ASSERT_NE(position, std::string::npos) << line;
+        int producer = std::stoi(line.substr(position + 9));
+        auto indexPosition = line.find("index=");
+        ASSERT_NE(indexPosition, std::string::npos) << line;
+        EXPECT_EQ(std::stoi(line.substr(indexPosition + 6)), nextIndex[producer]++);
+    }
+}
+
+/// Test that entries captured as records are rendered by the background thread with the same text.
+TEST(AsyncConsoleLoggerTest, test_recordsRenderedInBackground) {
+    std::stringstream output;
+    AsyncConsoleLogger logger(Level::DEBUG9, output, nullptr, TEST_ENTRIES);
+    std::string value = "a,b";
+    LogEntry entry("AsyncConsoleLoggerTest", "record");
+    entry.d("count", -2).d("ratio", 0.25).d("value", value).m("done");
+    ASSERT_NE(entry.getRecord(), nullptr);
+    logger.log(Level::INFO, entry);
+    // The record was copied, so changing the caller's values does not change the output.
+    value = "changed";
+    logger.flush();
+
+    EXPECT_NE(
+        output.str().find(R"( I AsyncConsoleLoggerTest:record:count=-2,ratio=0.25,value=a\,b:done)"), std::string::npos)
+        << output.str();
+}
+
+/// Test that destroying the logger writes entries which have not been flushed.
+TEST(AsyncConsoleLoggerTest, test_destructorWritesPendingEntries) {
+    std::stringstream output;
+    {
+        AsyncConsoleLogger logger(
+            Level::DEBUG9,
+            output,
+            nullptr,
+            TEST_ENTRIES,
+            DEFAULT_ASYNC_LOGGER_MAX_ENTRY_SIZE,
+            std::chrono::seconds(10));
+        logger.log(Level::INFO, LogEntry("AsyncConsoleLoggerTest", "pending"));
+    }
+    EXPECT_NE(output.str().find("pending"), std::string::npos);
+}
+
+}  // namespace test
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -15,11 +15,14 @@
 
 // @file ConfigurationNodeTest.cpp
 
+#include <atomic>
 #include <sstream>
+#include <thread>
 
 #include <gtest/gtest.h>
 
 #include "AVSCommon/Utils/Configuration/ConfigurationNode.h"
+#include "AVSCommon/Utils/Configuration/ConfigurationValue.h"
 
 namespace alexaClientSDK {
 namespace avsCommon {
@@ -56,6 +59,9 @@ static const std::string OBJECT2 = "object2";
 /// Name of first string in second root level object.
 static const std::string STRING2_1 = "string2.1";
 
+/// Value of first string in second root level object.
+static const std::string STRING_VALUE2_1 = "stringValue2.1";
+
 /// Replaced value of first string in second root level object.
 static const std::string NEW_STRING_VALUE2_1 = "new-stringValue2.1";
 
@@ -142,6 +148,27 @@ static const std::string ARRAY_JSON = R"(
     })";
 // clang-format on
 
+/// The number of components in the benchmark configuration.
+static const int BENCHMARK_COMPONENT_COUNT = 200;
+
+/// The number of keys in the settings of each component of the benchmark configuration.
+static const int BENCHMARK_KEYS_PER_COMPONENT = 20;
+
+/// The number of times the benchmarks read a value.
+static const int BENCHMARK_READ_COUNT = 1000000;
+
+/// Name of the object holding the keys of each component of the benchmark configuration.
+static const std::string BENCHMARK_SETTINGS = "settings";
+
+/// Name of the component the benchmarks read from.
+static const std::string BENCHMARK_COMPONENT = "component" + std::to_string(BENCHMARK_COMPONENT_COUNT - 1);
+
+/// Name of the key the benchmarks read.
+static const std::string BENCHMARK_KEY = "key" + std::to_string(BENCHMARK_KEYS_PER_COMPONENT - 1);
+
+/// Value of the key the benchmarks read.
+static const std::string BENCHMARK_VALUE = "value" + std::to_string(BENCHMARK_KEYS_PER_COMPONENT - 1);
+
 /**
  * Class for testing the ConfigurationNode class
  */
@@ -166,6 +193,25 @@ bool initializeConfiguration(const std::string& jsonConfiguration) {
     return ConfigurationNode::initialize(jsonStream);
 }
 
+/**
+ * Initializes the root configuration with many components, each with many settings, for the benchmarks.
+ *
+ * @return Whether it succeeded or not.
+ */
+bool initializeBenchmarkConfiguration() {
+    std::stringstream json;
+    json << "{";
+    for (int component = 0; component < BENCHMARK_COMPONENT_COUNT; ++component) {
+        json << (component ? "," : "") << "\"component" << component << "\":{\"" << BENCHMARK_SETTINGS << "\":{";
+        for (int key = 0; key < BENCHMARK_KEYS_PER_COMPONENT; ++key) {
+            json << (key ? "," : "") << "\"key" << key << "\":\"value" << key << "\"";
+        }
+        json << "}}";
+    }
+    json << "}";
+    return initializeConfiguration(json.str());
+}
+
 /**
  * Verify initialization a configuration. Verify both the implementation of accessor methods and the results
  * of merging JSON streams.
@@ -324,6 +370,133 @@ TEST_F(ConfigurationNodeTest, test_emptyArrayElement) {
     EXPECT_TRUE(configValue.empty());
 }
 
+/**
+ * Verify resolving typed values by path, from the root and relative to a node, including missing values and values
+ * of the wrong type.
+ */
+TEST_F(ConfigurationNodeTest, test_configurationValue) {
+    ASSERT_TRUE(initializeConfiguration(FIRST_JSON));
+
+    auto boolValue = ConfigurationValue<bool>::resolve({OBJECT1, BOOL1_1});
+    ASSERT_TRUE(boolValue.isSet());
+    ASSERT_EQ(boolValue.get(), BOOL_VALUE1_1);
+
+    auto intValue = ConfigurationValue<int>::resolve({OBJECT2, INT2_1});
+    ASSERT_TRUE(intValue.isSet());
+    ASSERT_EQ(intValue.get(), 21);
+
+    auto uint32Value = ConfigurationValue<uint32_t>::resolve({OBJECT2, INT2_1});
+    ASSERT_TRUE(uint32Value.isSet());
+    ASSERT_EQ(uint32Value.get(), 21u);
+
+    auto stringValue =
+        ConfigurationValue<std::string>::resolve(ConfigurationNode::getRoot()[OBJECT2], {OBJECT2_1, STRING2_1_1});
+    ASSERT_TRUE(stringValue.isSet());
+    ASSERT_EQ(stringValue.get(), "stringValue2.1.1");
+
+    auto missingValue = ConfigurationValue<int>::resolve({NON_OBJECT, INT2_1}, NON_EXISTENT_INT_VALUE2_1);
+    ASSERT_FALSE(missingValue.isSet());
+    ASSERT_EQ(missingValue.get(), NON_EXISTENT_INT_VALUE2_1);
+
+    auto wrongTypeValue = ConfigurationValue<std::string>::resolve({OBJECT2, INT2_1}, NEW_STRING_VALUE2_1);
+    ASSERT_FALSE(wrongTypeValue.isSet());
+    ASSERT_EQ(wrongTypeValue.get(), NEW_STRING_VALUE2_1);
+
+    auto emptyPathValue = ConfigurationValue<bool>::resolve({}, true);
+    ASSERT_FALSE(emptyPathValue.isSet());
+    ASSERT_TRUE(emptyPathValue.get());
+}
+
+/**
+ * Verify that threads reading the root configuration while it is being initialized either see no configuration or
+ * the complete one.
+ */
+TEST_F(ConfigurationNodeTest, test_concurrentReadDuringInitialize) {
+    static const int READER_COUNT = 4;
+    std::atomic<bool> sawPartialConfiguration{false};
+    std::vector<std::thread> readers;
+    for (int i = 0; i < READER_COUNT; ++i) {
+        readers.emplace_back([&sawPartialConfiguration] {
+            ConfigurationNode root;
+            while (!(root = ConfigurationNode::getRoot())) {
+                std::this_thread::yield();
+            }
+            std::string value;
+            if (!root[OBJECT2].getString(STRING2_1, &value) || value != NEW_STRING_VALUE2_1 ||
+                !root[OBJECT1][OBJECT1_1]) {
+                sawPartialConfiguration = true;
+            }
+        });
+    }
+
+    std::vector<std::shared_ptr<std::istream>> jsonStreams;
+    jsonStreams.push_back(std::make_shared<std::stringstream>(FIRST_JSON));
+    jsonStreams.push_back(std::make_shared<std::stringstream>(SECOND_JSON));
+    jsonStreams.push_back(std::make_shared<std::stringstream>(THIRD_JSON));
+    ASSERT_TRUE(ConfigurationNode::initialize(jsonStreams));
+
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    ASSERT_FALSE(sawPartialConfiguration);
+}
+
+/**
+ * Verify that nodes obtained before @c uninitialize() still read the configuration they were obtained from, after it
+ * has been uninitialized and after a new configuration has been initialized.
+ */
+TEST_F(ConfigurationNodeTest, test_nodesOutliveUninitialize) {
+    ASSERT_TRUE(initializeConfiguration(FIRST_JSON));
+    auto root = ConfigurationNode::getRoot();
+    auto object2 = root[OBJECT2];
+
+    ConfigurationNode::uninitialize();
+    ASSERT_FALSE(ConfigurationNode::getRoot());
+    std::string value;
+    ASSERT_TRUE(object2.getString(STRING2_1, &value));
+    ASSERT_EQ(value, STRING_VALUE2_1);
+
+    ASSERT_TRUE(initializeConfiguration(THIRD_JSON));
+    ASSERT_TRUE(root[OBJECT2].getString(STRING2_1, &value));
+    ASSERT_EQ(value, STRING_VALUE2_1);
+    ASSERT_TRUE(ConfigurationNode::getRoot()[OBJECT2].getString(STRING2_1, &value));
+    ASSERT_EQ(value, NEW_STRING_VALUE2_1);
+}
+
+/**
+ * Benchmark initializing a configuration with many components.
+ */
+TEST_F(ConfigurationNodeTest, testSlow_benchmarkInitializeConfiguration) {
+    ASSERT_TRUE(initializeBenchmarkConfiguration());
+}
+
+/**
+ * Benchmark reading a value of a configuration with many components repeatedly by walking its path.
+ */
+TEST_F(ConfigurationNodeTest, testSlow_benchmarkReadsByPath) {
+    ASSERT_TRUE(initializeBenchmarkConfiguration());
+    std::string value;
+    for (int i = 0; i < BENCHMARK_READ_COUNT; ++i) {
+        ASSERT_TRUE(
+            ConfigurationNode::getRoot()[BENCHMARK_COMPONENT][BENCHMARK_SETTINGS].getString(BENCHMARK_KEY, &value));
+    }
+    ASSERT_EQ(value, BENCHMARK_VALUE);
+}
+
+/**
+ * Benchmark reading a value of a configuration with many components repeatedly through a resolved
+ * @c ConfigurationValue.
+ */
+TEST_F(ConfigurationNodeTest, testSlow_benchmarkResolvedReads) {
+    ASSERT_TRUE(initializeBenchmarkConfiguration());
+    auto resolved = ConfigurationValue<std::string>::resolve({BENCHMARK_COMPONENT, BENCHMARK_SETTINGS, BENCHMARK_KEY});
+    size_t totalLength = 0;
+    for (int i = 0; i < BENCHMARK_READ_COUNT; ++i) {
+        totalLength += resolved.get().size();
+    }
+    ASSERT_EQ(totalLength, BENCHMARK_READ_COUNT * BENCHMARK_VALUE.size());
+}
+
 }  // namespace test
 }  // namespace configuration
 }  // namespace utils
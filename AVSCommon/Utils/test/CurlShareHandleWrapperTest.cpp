@@ -0,0 +1,215 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/Utils/LibcurlUtils/CurlShareHandleWrapper.h>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace libcurlUtils {
+namespace test {
+
+/// A host name which never resolves, so that it can only be found in a DNS cache.
+static const std::string UNRESOLVABLE_HOST = "share-handle-test.invalid";
+
+/// The port used in the URLs.  Nothing is ever connected to it.
+static const std::string PORT = "4433";
+
+/// The URL of the unresolvable host.
+static const std::string URL = "http://" + UNRESOLVABLE_HOST + ":" + PORT + "/";
+
+/// The @c CURLOPT_RESOLVE entry which adds the unresolvable host to the DNS cache of a handle.
+static const std::string RESOLVE_ENTRY = UNRESOLVABLE_HOST + ":" + PORT + ":127.0.0.1";
+
+/// The number of threads using the share handle concurrently.
+static const int NUM_THREADS = 8;
+
+/// The number of transfers done by each thread.
+static const int TRANSFERS_PER_THREAD = 20;
+
+/**
+ * A @c CURLOPT_OPENSOCKETFUNCTION which counts the sockets libcurl tries to open, which it only does once the host
+ * name has been resolved, and then fails so that nothing is sent.
+ *
+ * @param userData The @c std::atomic<int> counting the sockets.
+ * @param purpose The purpose of the socket.
+ * @param address The address the socket is for.
+ * @return @c CURL_SOCKET_BAD.
+ */
+static curl_socket_t countSocket(void* userData, curlsocktype purpose, struct curl_sockaddr* address) {
+    ++*static_cast<std::atomic<int>*>(userData);
+    return CURL_SOCKET_BAD;
+}
+
+/**
+ * A @c libcurl @c handle which is cleaned up when it goes out of scope.
+ */
+class EasyHandle {
+public:
+    /**
+     * Constructor.
+     *
+     * @param socketCount Counts the sockets opened by transfers of this handle.
+     */
+    explicit EasyHandle(std::atomic<int>* socketCount) : m_handle{curl_easy_init()}, m_resolve{nullptr} {
+        curl_easy_setopt(m_handle, CURLOPT_URL, URL.c_str());
+        curl_easy_setopt(m_handle, CURLOPT_OPENSOCKETFUNCTION, countSocket);
+        curl_easy_setopt(m_handle, CURLOPT_OPENSOCKETDATA, socketCount);
+    }
+
+    /// Destructor.
+    ~EasyHandle() {
+        curl_easy_cleanup(m_handle);
+        curl_slist_free_all(m_resolve);
+    }
+
+    /// Make the next transfer add the unresolvable host to the DNS cache.
+    void addResolveEntry() {
+        m_resolve = curl_slist_append(m_resolve, RESOLVE_ENTRY.c_str());
+        curl_easy_setopt(m_handle, CURLOPT_RESOLVE, m_resolve);
+    }
+
+    /// @return The wrapped handle.
+    CURL* get() {
+        return m_handle;
+    }
+
+    /// @return The result of a transfer.
+    CURLcode perform() {
+        return curl_easy_perform(m_handle);
+    }
+
+private:
+    /// The wrapped handle.
+    CURL* m_handle;
+
+    /// The @c CURLOPT_RESOLVE list, which must outlive the handle.
+    curl_slist* m_resolve;
+};
+
+class CurlShareHandleWrapperTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        m_shareHandle = CurlShareHandleWrapper::create();
+        ASSERT_NE(m_shareHandle, nullptr);
+    }
+
+protected:
+    /**
+     * Adds the unresolvable host to the shared DNS cache with a handle which is detached afterwards.
+     */
+    void primeSharedCache() {
+        std::atomic<int> socketCount{0};
+        EasyHandle handle(&socketCount);
+        handle.addResolveEntry();
+        ASSERT_TRUE(m_shareHandle->attach(handle.get()));
+        EXPECT_EQ(handle.perform(), CURLE_COULDNT_CONNECT);
+        EXPECT_EQ(socketCount, 1);
+        m_shareHandle->detach(handle.get());
+    }
+
+    /// The share handle under test.
+    std::shared_ptr<CurlShareHandleWrapper> m_shareHandle;
+};
+
+/**
+ * Verify that a handle attached to the share handle finds a host name resolved through another handle.
+ */
+TEST_F(CurlShareHandleWrapperTest, test_attachedHandleUsesSharedDnsCache) {
+    primeSharedCache();
+
+    std::atomic<int> socketCount{0};
+    EasyHandle handle(&socketCount);
+    ASSERT_TRUE(m_shareHandle->attach(handle.get()));
+    EXPECT_EQ(handle.perform(), CURLE_COULDNT_CONNECT);
+    EXPECT_EQ(socketCount, 1);
+    m_shareHandle->detach(handle.get());
+}
+
+/**
+ * Verify that a handle which is not attached, or has been detached, does not see the shared DNS cache.
+ */
+TEST_F(CurlShareHandleWrapperTest, test_detachedHandleDoesNotUseSharedDnsCache) {
+    primeSharedCache();
+
+    std::atomic<int> socketCount{0};
+    EasyHandle handle(&socketCount);
+    EXPECT_EQ(handle.perform(), CURLE_COULDNT_RESOLVE_HOST);
+
+    ASSERT_TRUE(m_shareHandle->attach(handle.get()));
+    m_shareHandle->detach(handle.get());
+    EXPECT_EQ(handle.perform(), CURLE_COULDNT_RESOLVE_HOST);
+    EXPECT_EQ(socketCount, 0);
+}
+
+/**
+ * Verify that the share handle outlives the caches of the handles which used it, so that a host resolved by a handle
+ * which has been cleaned up is still known.
+ */
+TEST_F(CurlShareHandleWrapperTest, test_sharedDnsCacheOutlivesHandles) {
+    for (int i = 0; i < 3; ++i) {
+        std::atomic<int> socketCount{0};
+        EasyHandle handle(&socketCount);
+        if (0 == i) {
+            handle.addResolveEntry();
+        }
+        ASSERT_TRUE(m_shareHandle->attach(handle.get()));
+        EXPECT_EQ(handle.perform(), CURLE_COULDNT_CONNECT);
+        EXPECT_EQ(socketCount, 1);
+        m_shareHandle->detach(handle.get());
+    }
+}
+
+/**
+ * Verify that handles on many threads can use the share handle at the same time.  libcurl calls the lock and unlock
+ * functions of the share handle around every access to the shared caches, so unbalanced locking would deadlock here.
+ */
+TEST_F(CurlShareHandleWrapperTest, test_concurrentHandlesOnManyThreads) {
+    primeSharedCache();
+
+    std::atomic<int> socketCount{0};
+    std::atomic<int> failures{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < NUM_THREADS; ++t) {
+        threads.emplace_back([this, &socketCount, &failures] {
+            for (int i = 0; i < TRANSFERS_PER_THREAD; ++i) {
+                EasyHandle handle(&socketCount);
+                if (!m_shareHandle->attach(handle.get()) || handle.perform() != CURLE_COULDNT_CONNECT) {
+                    ++failures;
+                }
+                m_shareHandle->detach(handle.get());
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(failures, 0);
+    EXPECT_EQ(socketCount, NUM_THREADS * TRANSFERS_PER_THREAD);
+}
+
+}  // namespace test
+}  // namespace libcurlUtils
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
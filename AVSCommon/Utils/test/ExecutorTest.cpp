@@ -13,13 +13,35 @@
  * permissions and limitations under the License.
  */
 
+#include <cstdlib>
 #include <list>
+#include <new>
+#include <vector>
 #include <gtest/gtest.h>
 
 #include "ExecutorTestUtils.h"
 #include "AVSCommon/Utils/Threading/Executor.h"
 #include "AVSCommon/Utils/WaitEvent.h"
 
+/// The number of calls to the global operator new, used to measure allocations per submitted task.
+static std::atomic<size_t> g_allocations{0};
+
+void* operator new(std::size_t size) {
+    g_allocations++;
+    if (void* ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
 namespace alexaClientSDK {
 namespace avsCommon {
 namespace utils {
@@ -374,6 +396,242 @@ TEST_F(ExecutorTest, test_taskException) {
     }
 }
 
+/// Test that tasks queued with execute run in order with submitted tasks.
+TEST_F(ExecutorTest, test_executeRunsInOrder) {
+    std::vector<int> order;
+    for (int i = 0; i < 10; ++i) {
+        if (i % 2) {
+            EXPECT_TRUE(executor.execute([&order, i] { order.push_back(i); }));
+        } else {
+            executor.submit([&order, i] { order.push_back(i); });
+        }
+    }
+    executor.waitForSubmittedTasks();
+    EXPECT_EQ(order, (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+}
+
+/// Test that execute accepts move-only callables.
+TEST_F(ExecutorTest, test_executeMoveOnlyTask) {
+    struct MoveOnlyTask {
+        std::unique_ptr<int> value;
+        std::promise<int>* result;
+        void operator()() {
+            result->set_value(*value);
+        }
+    };
+    std::promise<int> result;
+    EXPECT_TRUE(executor.execute(MoveOnlyTask{std::unique_ptr<int>(new int(VALUE)), &result}));
+    auto future = result.get_future();
+    ASSERT_EQ(future.wait_for(SHORT_TIMEOUT_MS), std::future_status::ready);
+    EXPECT_EQ(future.get(), VALUE);
+}
+
+/// Test that an exception thrown by an executed task does not stop the executor.
+TEST_F(ExecutorTest, test_executeTaskException) {
+    EXPECT_TRUE(executor.execute([] { throw std::runtime_error("catch me"); }));
+    EXPECT_EQ(executor.submit(TASK, VALUE).get(), VALUE);
+}
+
+/// Test that execute fails after shutdown.
+TEST_F(ExecutorTest, test_executeAfterShutdownFails) {
+    executor.shutdown();
+    bool executed = false;
+    EXPECT_FALSE(executor.execute([&executed] { executed = true; }));
+    EXPECT_FALSE(executed);
+}
+
+/// The number of tasks in each batch queued by @c measureAllocationsPerTask().
+static const int ALLOCATION_BATCH_SIZE = 32;
+
+/// The number of batches queued by @c measureAllocationsPerTask().
+static const int ALLOCATION_BATCHES = 200;
+
+/**
+ * Queues @c ALLOCATION_BATCHES batches of @c ALLOCATION_BATCH_SIZE tasks on @c executor, waiting for each batch to
+ * complete, and returns the average number of heap allocations made per task on any thread.
+ *
+ * @param executor The executor to queue tasks on.
+ * @param queueTask Function which queues a single task.
+ * @return The average number of allocations per task.
+ */
+static double measureAllocationsPerTask(Executor& executor, std::function<void(int*)> queueTask) {
+    int counter = 0;
+    // Warm up the executor, its thread and its node pool.
+    for (int i = 0; i < ALLOCATION_BATCH_SIZE; ++i) {
+        queueTask(&counter);
+    }
+    executor.waitForSubmittedTasks();
+
+    size_t before = g_allocations;
+    for (int batch = 0; batch < ALLOCATION_BATCHES; ++batch) {
+        for (int i = 0; i < ALLOCATION_BATCH_SIZE; ++i) {
+            queueTask(&counter);
+        }
+        // Waiting costs an allocation or two per batch, which is included in the results.
+        executor.waitForSubmittedTasks();
+    }
+    size_t after = g_allocations;
+    EXPECT_EQ(counter, ALLOCATION_BATCH_SIZE * (ALLOCATION_BATCHES + 1));
+    return static_cast<double>(after - before) / (ALLOCATION_BATCH_SIZE * ALLOCATION_BATCHES);
+}
+
+/**
+ * Benchmark comparing the heap allocations made per task by submit(), discarding the returned future, with those made
+ * by execute(), which should make almost none.
+ */
+TEST_F(ExecutorTest, testSlow_benchmarkAllocationsPerTask) {
+    auto submitAllocations = measureAllocationsPerTask(executor, [this](int* counter) {
+        executor.submit([counter] { (*counter)++; });
+    });
+    auto executeAllocations = measureAllocationsPerTask(executor, [this](int* counter) {
+        executor.execute([counter] { (*counter)++; });
+    });
+    EXPECT_LT(executeAllocations, submitAllocations);
+    EXPECT_LT(executeAllocations, 0.5);
+}
+
+/// Number of threads in the pool used by the strand tests below.
+static const size_t STRAND_POOL_THREADS = 2;
+
+/// Number of executors sharing a pool in @c test_manyStrandsShareFewThreads.
+static const size_t NUM_STRANDS = 64;
+
+/// Number of tasks submitted to each executor by the strand tests below.
+static const int STRAND_TASKS = 200;
+
+/// Test harness for executors running as strands on a @c WorkStealingThreadPool.
+class ExecutorStrandTest : public ::testing::Test {
+public:
+    /// The shared pool.
+    std::shared_ptr<WorkStealingThreadPool> pool = std::make_shared<WorkStealingThreadPool>(STRAND_POOL_THREADS);
+};
+
+/// Test that a strand runs tasks in submission order, with @c submitToFront tasks ahead of queued tasks.
+TEST_F(ExecutorStrandTest, test_strandPreservesOrder) {
+    Executor strand{pool};
+    std::vector<int> order;
+    std::promise<void> release;
+    auto releaseFuture = release.get_future().share();
+
+    strand.submit([releaseFuture] { releaseFuture.wait(); });
+    for (int i = 1; i <= STRAND_TASKS; ++i) {
+        strand.submit([&order, i] { order.push_back(i); });
+    }
+    strand.submitToFront([&order] { order.push_back(0); });
+    release.set_value();
+    strand.waitForSubmittedTasks();
+
+    ASSERT_EQ(order.size(), static_cast<size_t>(STRAND_TASKS + 1));
+    for (int i = 0; i <= STRAND_TASKS; ++i) {
+        EXPECT_EQ(order[i], i);
+    }
+}
+
+/// Test that futures and exceptions are delivered by a strand.
+TEST_F(ExecutorStrandTest, test_strandReturnsValues) {
+    Executor strand{pool};
+    EXPECT_EQ(strand.submit(TASK, VALUE).get(), VALUE);
+    auto future = strand.submit([] { throw std::runtime_error("catch me"); });
+    EXPECT_THROW(future.get(), std::runtime_error);
+}
+
+/// Test that shutting down a strand cancels queued tasks and rejects new ones.
+TEST_F(ExecutorStrandTest, test_strandShutdownCancelsQueuedTasks) {
+    Executor strand{pool};
+    std::atomic<bool> executed{false};
+    WaitEvent started;
+    std::promise<void> release;
+    auto releaseFuture = release.get_future().share();
+
+    strand.submit([&started, releaseFuture] {
+        started.wakeUp();
+        releaseFuture.wait();
+    });
+    strand.submit([&executed] { executed = true; });
+    ASSERT_TRUE(started.wait(std::chrono::seconds(5)));
+
+    auto shutdownResult = std::async(std::launch::async, [&strand] { strand.shutdown(); });
+    while (!strand.isShutdown()) {
+        std::this_thread::yield();
+    }
+    release.set_value();
+    shutdownResult.wait();
+
+    EXPECT_FALSE(executed);
+    EXPECT_FALSE(strand.submit([] {}).valid());
+}
+
+/// Test that many strands make progress on a pool with fewer threads, and never run two of their own tasks at once.
+TEST_F(ExecutorStrandTest, test_manyStrandsShareFewThreads) {
+    std::vector<std::unique_ptr<Executor>> strands;
+    std::vector<std::vector<int>> orders(NUM_STRANDS);
+    std::vector<std::atomic<int>> running(NUM_STRANDS);
+    std::atomic<bool> overlapped{false};
+    for (size_t s = 0; s < NUM_STRANDS; ++s) {
+        strands.emplace_back(new Executor(pool));
+        running[s] = 0;
+    }
+
+    for (int i = 0; i < STRAND_TASKS; ++i) {
+        for (size_t s = 0; s < NUM_STRANDS; ++s) {
+            strands[s]->submit([&, s, i] {
+                if (++running[s] != 1) {
+                    overlapped = true;
+                }
+                orders[s].push_back(i);
+                --running[s];
+            });
+        }
+    }
+
+    // Wait for every strand to drain before checking the results.
+    for (auto& strand : strands) {
+        strand->waitForSubmittedTasks();
+    }
+    strands.clear();
+
+    EXPECT_FALSE(overlapped);
+    for (auto& order : orders) {
+        ASSERT_EQ(order.size(), static_cast<size_t>(STRAND_TASKS));
+        for (int i = 0; i < STRAND_TASKS; ++i) {
+            EXPECT_EQ(order[i], i);
+        }
+    }
+}
+
+/// Test that a strand may be destroyed straight after submitting work without waiting for it.
+TEST_F(ExecutorStrandTest, test_strandDestroyedWithQueuedTasks) {
+    for (int i = 0; i < STRAND_TASKS; ++i) {
+        Executor strand{pool};
+        strand.submit([] { std::this_thread::yield(); });
+    }
+}
+
+/// Test that a strand which is destroyed by one of its own tasks does not wait for itself or run later tasks.
+TEST_F(ExecutorStrandTest, test_strandDestroyedByOwnTask) {
+    auto owner = std::make_shared<Executor>(pool);
+    auto strand = owner.get();
+    WaitEvent destroyed;
+    std::atomic<bool> laterTaskRan{false};
+    std::promise<void> release;
+    auto releaseFuture = release.get_future().share();
+
+    strand->submit([releaseFuture] { releaseFuture.wait(); });
+    strand->submit([&owner, &destroyed] {
+        owner.reset();
+        destroyed.wakeUp();
+    });
+    strand->submit([&laterTaskRan] { laterTaskRan = true; });
+    release.set_value();
+
+    ASSERT_TRUE(destroyed.wait(SHORT_TIMEOUT_MS));
+    // Run a task on every pool thread, after the strand has had a chance to run anything left in its queue.
+    for (size_t i = 0; i < STRAND_POOL_THREADS; ++i) {
+        Executor(pool).submit([] {}).wait();
+    }
+    EXPECT_FALSE(laterTaskRan);
+}
+
 }  // namespace test
 }  // namespace threading
 }  // namespace utils
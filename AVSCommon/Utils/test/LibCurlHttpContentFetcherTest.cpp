@@ -0,0 +1,542 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/AVS/Attachment/InProcessAttachment.h>
+#include <AVSCommon/Utils/LibcurlUtils/HTTPContentFetcherFactory.h>
+#include <AVSCommon/Utils/LibcurlUtils/LibCurlHttpContentFetcher.h>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace libcurlUtils {
+namespace test {
+
+using namespace avsCommon::avs::attachment;
+using namespace avsCommon::sdkInterfaces;
+
+/// Size of a body which fits in the buffer of an attachment.
+static const size_t SMALL_BODY_SIZE = 4096;
+
+/// Size of a body which does not fit in the buffer of an attachment, so the transfer has to pause.
+static const size_t LARGE_BODY_SIZE = 3 * InProcessAttachment::SDS_BUFFER_DEFAULT_SIZE_IN_BYTES + 123;
+
+/// Number of fetchers run concurrently on one factory.
+static const size_t NUM_CONCURRENT_FETCHERS = 8;
+
+/// Timeout used when reading the body and waiting for the fetch to end.
+static const std::chrono::seconds TIMEOUT{10};
+
+/// Interval at which the state of a fetcher is polled.
+static const std::chrono::milliseconds POLL_INTERVAL{5};
+
+/// How long the reader stops reading in tests of a transfer paused by a full writer.
+static const std::chrono::milliseconds READER_STALL{300};
+
+/// The most writes which may time out while the reader is stalled, if the transfer waits for space without polling.
+static const int MAX_TIMED_OUT_WRITES_WHILE_STALLED = 2;
+
+/**
+ * Builds a body filled with a known pattern.
+ *
+ * @param size The size of the body.
+ * @return The body.
+ */
+static std::string expectedBody(size_t size) {
+    std::string body(size, '\0');
+    for (size_t i = 0; i < size; ++i) {
+        body[i] = static_cast<char>('a' + (i * 7) % 26);
+    }
+    return body;
+}
+
+/**
+ * A minimal HTTP/1.1 server on the loopback interface.  Every request gets a body of the size given by its path, and
+ * connections are kept alive, so that reuse of connections by the client can be observed.
+ */
+class LoopbackHttpServer {
+public:
+    /// Destructor.
+    ~LoopbackHttpServer();
+
+    /**
+     * Starts listening on an ephemeral port.
+     *
+     * @return Whether the server started.
+     */
+    bool start();
+
+    /**
+     * Builds the URL of a body.
+     *
+     * @param size The size of the body.
+     * @return The URL.
+     */
+    std::string getUrl(size_t size) const;
+
+    /// @return The number of connections accepted so far.
+    size_t getConnectionCount() const;
+
+private:
+    /// Accepts connections until the listening socket is closed.
+    void acceptLoop();
+
+    /**
+     * Serves the requests of a connection until the client closes it.
+     *
+     * @param fd The socket of the connection.
+     */
+    void serveConnection(int fd);
+
+    /// The listening socket.
+    int m_listenFd = -1;
+
+    /// The port the server listens on.
+    int m_port = 0;
+
+    /// The number of connections accepted.
+    std::atomic<size_t> m_connectionCount{0};
+
+    /// Serializes access to @c m_connections.
+    std::mutex m_mutex;
+
+    /// The sockets and threads of the accepted connections.
+    std::vector<std::pair<int, std::thread>> m_connections;
+
+    /// The thread accepting connections.
+    std::thread m_acceptThread;
+};
+
+LoopbackHttpServer::~LoopbackHttpServer() {
+    if (m_listenFd >= 0) {
+        ::shutdown(m_listenFd, SHUT_RDWR);
+        ::close(m_listenFd);
+    }
+    if (m_acceptThread.joinable()) {
+        m_acceptThread.join();
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& connection : m_connections) {
+        ::shutdown(connection.first, SHUT_RDWR);
+        connection.second.join();
+        ::close(connection.first);
+    }
+}
+
+bool LoopbackHttpServer::start() {
+    m_listenFd = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (m_listenFd < 0) {
+        return false;
+    }
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0;
+    socklen_t length = sizeof(address);
+    if (::bind(m_listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        ::listen(m_listenFd, 16) != 0 ||
+        ::getsockname(m_listenFd, reinterpret_cast<sockaddr*>(&address), &length) != 0) {
+        return false;
+    }
+    m_port = ntohs(address.sin_port);
+    m_acceptThread = std::thread(&LoopbackHttpServer::acceptLoop, this);
+    return true;
+}
+
+std::string LoopbackHttpServer::getUrl(size_t size) const {
+    return "http://127.0.0.1:" + std::to_string(m_port) + "/" + std::to_string(size);
+}
+
+size_t LoopbackHttpServer::getConnectionCount() const {
+    return m_connectionCount;
+}
+
+void LoopbackHttpServer::acceptLoop() {
+    while (true) {
+        int fd = ::accept(m_listenFd, nullptr, nullptr);
+        if (fd < 0) {
+            return;
+        }
+        m_connectionCount++;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_connections.emplace_back(fd, std::thread(&LoopbackHttpServer::serveConnection, this, fd));
+    }
+}
+
+void LoopbackHttpServer::serveConnection(int fd) {
+    std::string request;
+    char buffer[1024];
+    while (true) {
+        auto endOfRequest = request.find("\r\n\r\n");
+        if (std::string::npos == endOfRequest) {
+            auto received = ::recv(fd, buffer, sizeof(buffer), 0);
+            if (received <= 0) {
+                return;
+            }
+            request.append(buffer, received);
+            continue;
+        }
+        // The request line looks like "GET /<size> HTTP/1.1".
+        auto pathStart = request.find('/');
+        size_t size = std::strtoul(request.c_str() + pathStart + 1, nullptr, 10);
+        request.erase(0, endOfRequest + 4);
+
+        std::string response = "HTTP/1.1 200 OK\r\nContent-Type: audio/mpeg\r\nContent-Length: " +
+                               std::to_string(size) + "\r\n\r\n" + expectedBody(size);
+        size_t sent = 0;
+        while (sent < response.size()) {
+            auto result = ::send(fd, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+            if (result <= 0) {
+                return;
+            }
+            sent += result;
+        }
+    }
+}
+
+/**
+ * Class for testing @c LibCurlHttpContentFetcher.  The bodies are fetched from a @c LoopbackHttpServer, or from local
+ * files with @c file:// URLs.
+ */
+/**
+ * An @c AttachmentWriter which counts the writes to another writer which timed out, and which may hide that the other
+ * writer can call a function when space is freed.
+ */
+class CountingAttachmentWriter : public AttachmentWriter {
+public:
+    /**
+     * Constructor.
+     *
+     * @param writer The writer to write to.
+     * @param notifySpaceAvailable Whether @c setSpaceAvailableCallback() is passed on to @c writer.
+     */
+    CountingAttachmentWriter(std::unique_ptr<AttachmentWriter> writer, bool notifySpaceAvailable) :
+            m_writer{std::move(writer)},
+            m_notifySpaceAvailable{notifySpaceAvailable},
+            m_timedOutWrites{0} {
+    }
+
+    std::size_t write(
+        const void* buf,
+        std::size_t numBytes,
+        WriteStatus* writeStatus,
+        std::chrono::milliseconds timeout = std::chrono::milliseconds(0)) override {
+        auto bytesWritten = m_writer->write(buf, numBytes, writeStatus, timeout);
+        if (WriteStatus::TIMEDOUT == *writeStatus) {
+            m_timedOutWrites++;
+        }
+        return bytesWritten;
+    }
+
+    void close() override {
+        m_writer->close();
+    }
+
+    bool setSpaceAvailableCallback(std::function<void()> callback) override {
+        return m_notifySpaceAvailable && m_writer->setSpaceAvailableCallback(std::move(callback));
+    }
+
+    /// @return The number of writes which timed out so far.
+    int getTimedOutWrites() const {
+        return m_timedOutWrites;
+    }
+
+private:
+    /// The writer to write to.
+    std::unique_ptr<AttachmentWriter> m_writer;
+
+    /// Whether @c setSpaceAvailableCallback() is passed on to @c m_writer.
+    const bool m_notifySpaceAvailable;
+
+    /// The number of writes which timed out.
+    std::atomic<int> m_timedOutWrites;
+};
+
+class LibCurlHttpContentFetcherTest : public ::testing::Test {
+protected:
+    void SetUp() override;
+
+    void TearDown() override;
+
+    /**
+     * Creates a file filled with a known pattern.
+     *
+     * @param size The size of the file.
+     * @return The @c file:// URL of the file.
+     */
+    std::string createFile(size_t size);
+
+    /**
+     * Fetches the entire body of a URL with a fetcher, reading it while it is written.
+     *
+     * @param fetcher The fetcher.
+     * @param[out] body The body.
+     * @return Whether the fetch ended in the @c BODY_DONE state.
+     */
+    bool fetchBody(HTTPContentFetcherInterface* fetcher, std::string* body);
+
+    /**
+     * Fetches a body larger than the buffer of an attachment, with a reader which stops reading once the buffer is
+     * full, and then reads the rest of the body.
+     *
+     * @param notifySpaceAvailable Whether the writer can call a function when the reader frees space.
+     * @param[out] timedOutWritesWhileStalled The number of writes which timed out while the reader was stalled.
+     * @return Whether the entire body was fetched.
+     */
+    bool fetchBodyWithStalledReader(bool notifySpaceAvailable, int* timedOutWritesWhileStalled);
+
+    /// The server to fetch from.
+    LoopbackHttpServer m_server;
+
+    /// The files created by the test.
+    std::vector<std::string> m_files;
+};
+
+void LibCurlHttpContentFetcherTest::SetUp() {
+    ASSERT_TRUE(m_server.start());
+}
+
+void LibCurlHttpContentFetcherTest::TearDown() {
+    for (auto& file : m_files) {
+        std::remove(file.c_str());
+    }
+}
+
+std::string LibCurlHttpContentFetcherTest::createFile(size_t size) {
+    char path[] = "/tmp/LibCurlHttpContentFetcherTestXXXXXX";
+    int fd = mkstemp(path);
+    if (fd < 0) {
+        return "";
+    }
+    close(fd);
+    m_files.push_back(path);
+    std::ofstream file(path, std::ios::binary);
+    file << expectedBody(size);
+    return std::string("file://") + path;
+}
+
+bool LibCurlHttpContentFetcherTest::fetchBody(HTTPContentFetcherInterface* fetcher, std::string* body) {
+    fetcher->getContent(HTTPContentFetcherInterface::FetchOptions::ENTIRE_BODY);
+    if (!fetcher->getHeader(nullptr).successful) {
+        return false;
+    }
+
+    auto attachment = std::make_shared<InProcessAttachment>("test");
+    std::shared_ptr<AttachmentWriter> writer = attachment->createWriter(sds::WriterPolicy::BLOCKING);
+    auto reader = attachment->createReader(sds::ReaderPolicy::BLOCKING);
+    auto readResult = std::async(std::launch::async, [&reader, body] {
+        char buffer[4096];
+        auto status = AttachmentReader::ReadStatus::OK;
+        while (AttachmentReader::ReadStatus::CLOSED != status) {
+            auto bytesRead = reader->read(buffer, sizeof(buffer), &status, TIMEOUT);
+            if (AttachmentReader::ReadStatus::OK_TIMEDOUT == status) {
+                return false;
+            }
+            body->append(buffer, bytesRead);
+        }
+        return true;
+    });
+    if (!fetcher->getBody(writer)) {
+        writer->close();
+        return false;
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + TIMEOUT;
+    auto state = fetcher->getState();
+    while (HTTPContentFetcherInterface::State::BODY_DONE != state &&
+           HTTPContentFetcherInterface::State::ERROR != state && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(POLL_INTERVAL);
+        state = fetcher->getState();
+    }
+    // The writer was passed in, so it is up to the caller to close it.
+    writer->close();
+    return readResult.get() && HTTPContentFetcherInterface::State::BODY_DONE == state;
+}
+
+bool LibCurlHttpContentFetcherTest::fetchBodyWithStalledReader(
+    bool notifySpaceAvailable,
+    int* timedOutWritesWhileStalled) {
+    HTTPContentFetcherFactory factory;
+    auto fetcher = factory.create(m_server.getUrl(LARGE_BODY_SIZE));
+    fetcher->getContent(HTTPContentFetcherInterface::FetchOptions::ENTIRE_BODY);
+    if (!fetcher->getHeader(nullptr).successful) {
+        return false;
+    }
+
+    auto attachment = std::make_shared<InProcessAttachment>("test");
+    auto reader = attachment->createReader(sds::ReaderPolicy::BLOCKING);
+    auto writer = std::make_shared<CountingAttachmentWriter>(
+        attachment->createWriter(sds::WriterPolicy::BLOCKING), notifySpaceAvailable);
+    if (!fetcher->getBody(writer)) {
+        return false;
+    }
+
+    // Give the transfer time to fill the buffer, then count the writes it attempts while nothing is read.
+    std::this_thread::sleep_for(READER_STALL);
+    auto timedOutWritesBeforeStall = writer->getTimedOutWrites();
+    std::this_thread::sleep_for(READER_STALL);
+    *timedOutWritesWhileStalled = writer->getTimedOutWrites() - timedOutWritesBeforeStall;
+
+    std::string body;
+    char buffer[4096];
+    auto status = AttachmentReader::ReadStatus::OK;
+    while (body.size() < LARGE_BODY_SIZE && AttachmentReader::ReadStatus::OK_TIMEDOUT != status) {
+        auto bytesRead = reader->read(buffer, sizeof(buffer), &status, TIMEOUT);
+        body.append(buffer, bytesRead);
+    }
+    writer->close();
+    return body == expectedBody(LARGE_BODY_SIZE);
+}
+
+/**
+ * Test that a fetcher created without an engine creates its own, and fetches the entire body.
+ */
+TEST_F(LibCurlHttpContentFetcherTest, test_fetchBodyWithPrivateEngine) {
+    LibCurlHttpContentFetcher fetcher(m_server.getUrl(SMALL_BODY_SIZE));
+    std::string body;
+    EXPECT_TRUE(fetchBody(&fetcher, &body));
+    EXPECT_EQ(body, expectedBody(SMALL_BODY_SIZE));
+}
+
+/**
+ * Test that a body larger than the buffer of the attachment is fetched entirely, which requires the transfer to pause
+ * while the attachment is full and to resume once it has been read.
+ */
+TEST_F(LibCurlHttpContentFetcherTest, test_fetchBodyLargerThanAttachmentBuffer) {
+    HTTPContentFetcherFactory factory;
+    auto fetcher = factory.create(m_server.getUrl(LARGE_BODY_SIZE));
+    std::string body;
+    EXPECT_TRUE(fetchBody(fetcher.get(), &body));
+    EXPECT_EQ(body.size(), LARGE_BODY_SIZE);
+    EXPECT_TRUE(body == expectedBody(LARGE_BODY_SIZE));
+}
+
+/**
+ * Test that fetchers created by one factory can run concurrently on its shared engine, including while some of them
+ * are paused waiting for the reader.
+ */
+TEST_F(LibCurlHttpContentFetcherTest, test_concurrentFetchersShareFactoryEngine) {
+    HTTPContentFetcherFactory factory;
+    std::vector<std::future<bool>> results;
+    for (size_t i = 0; i < NUM_CONCURRENT_FETCHERS; ++i) {
+        auto size = (i % 2) ? LARGE_BODY_SIZE : SMALL_BODY_SIZE;
+        std::shared_ptr<HTTPContentFetcherInterface> fetcher = factory.create(m_server.getUrl(size));
+        results.push_back(std::async(std::launch::async, [this, fetcher, size] {
+            std::string body;
+            return fetchBody(fetcher.get(), &body) && body == expectedBody(size);
+        }));
+    }
+    for (auto& result : results) {
+        EXPECT_TRUE(result.get());
+    }
+}
+
+/**
+ * Test that consecutive fetchers created by one factory reuse the connection of the previous fetch.
+ */
+TEST_F(LibCurlHttpContentFetcherTest, test_consecutiveFetchersReuseConnection) {
+    HTTPContentFetcherFactory factory;
+    for (int i = 0; i < 3; ++i) {
+        auto fetcher = factory.create(m_server.getUrl(SMALL_BODY_SIZE));
+        std::string body;
+        EXPECT_TRUE(fetchBody(fetcher.get(), &body));
+        EXPECT_EQ(body, expectedBody(SMALL_BODY_SIZE));
+    }
+    EXPECT_EQ(m_server.getConnectionCount(), 1u);
+}
+
+/**
+ * Test that a fetcher can be destroyed while its transfer is paused waiting for @c getBody(), without affecting the
+ * other fetchers of its factory.
+ */
+TEST_F(LibCurlHttpContentFetcherTest, test_destroyFetcherWhileTransferPaused) {
+    HTTPContentFetcherFactory factory;
+    {
+        auto fetcher = factory.create(m_server.getUrl(LARGE_BODY_SIZE));
+        fetcher->getContent(HTTPContentFetcherInterface::FetchOptions::ENTIRE_BODY);
+        EXPECT_TRUE(fetcher->getHeader(nullptr).successful);
+    }
+
+    auto fetcher = factory.create(m_server.getUrl(LARGE_BODY_SIZE));
+    std::string body;
+    EXPECT_TRUE(fetchBody(fetcher.get(), &body));
+    EXPECT_TRUE(body == expectedBody(LARGE_BODY_SIZE));
+}
+
+/**
+ * Test that a transfer paused because the writer is full stays paused until the reader frees space, rather than
+ * retrying the write periodically.
+ */
+TEST_F(LibCurlHttpContentFetcherTest, test_pausedTransferResumedByReader) {
+    int timedOutWritesWhileStalled = 0;
+    EXPECT_TRUE(fetchBodyWithStalledReader(true, &timedOutWritesWhileStalled));
+    EXPECT_LE(timedOutWritesWhileStalled, MAX_TIMED_OUT_WRITES_WHILE_STALLED);
+}
+
+/**
+ * Test that a body is still fetched entirely when the writer cannot tell the fetcher that the reader freed space.
+ */
+TEST_F(LibCurlHttpContentFetcherTest, test_fetchBodyWithWriterWithoutSpaceAvailableCallback) {
+    int timedOutWritesWhileStalled = 0;
+    EXPECT_TRUE(fetchBodyWithStalledReader(false, &timedOutWritesWhileStalled));
+}
+
+/**
+ * Test that a URL which libcurl cannot pause, such as a local file, is still fetched entirely.
+ */
+TEST_F(LibCurlHttpContentFetcherTest, test_fetchFileBody) {
+    auto url = createFile(LARGE_BODY_SIZE);
+    ASSERT_FALSE(url.empty());
+    HTTPContentFetcherFactory factory;
+    auto fetcher = factory.create(url);
+    std::string body;
+    EXPECT_TRUE(fetchBody(fetcher.get(), &body));
+    EXPECT_TRUE(body == expectedBody(LARGE_BODY_SIZE));
+}
+
+/**
+ * Test that a fetch of a URL which cannot be transferred ends in the @c ERROR state.
+ */
+TEST_F(LibCurlHttpContentFetcherTest, test_fetchMissingFileEndsInError) {
+    HTTPContentFetcherFactory factory;
+    auto fetcher = factory.create("file:///nonexistent/LibCurlHttpContentFetcherTest");
+    fetcher->getContent(HTTPContentFetcherInterface::FetchOptions::ENTIRE_BODY);
+    EXPECT_FALSE(fetcher->getHeader(nullptr).successful);
+    EXPECT_EQ(fetcher->getState(), HTTPContentFetcherInterface::State::ERROR);
+}
+
+}  // namespace test
+}  // namespace libcurlUtils
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,234 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/Utils/HTTP2/HTTP2RequestConfig.h>
+#include <AVSCommon/Utils/HTTP2/HTTP2ResponseSinkInterface.h>
+#include <AVSCommon/Utils/LibcurlUtils/CurlEasyHandleWrapper.h>
+#include <AVSCommon/Utils/LibcurlUtils/LibcurlHTTP2Connection.h>
+#include <AVSCommon/Utils/LibcurlUtils/LibcurlHTTP2ConnectionFactory.h>
+#include <AVSCommon/Utils/LibcurlUtils/LibcurlSetCurlOptionsCallbackFactoryInterface.h>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace libcurlUtils {
+namespace test {
+
+using namespace avsCommon::utils::http2;
+
+/// A host name which never resolves, so that it can only be found in a DNS cache.
+static const std::string UNRESOLVABLE_HOST = "connection-factory-test.invalid";
+
+/// The port used in the URLs.  Nothing is ever connected to it.
+static const std::string PORT = "4433";
+
+/// The URL of the unresolvable host.
+static const std::string URL = "https://" + UNRESOLVABLE_HOST + ":" + PORT + "/";
+
+/// The @c CURLOPT_RESOLVE entry which adds the unresolvable host to the DNS cache of a handle.
+static const std::string RESOLVE_ENTRY = UNRESOLVABLE_HOST + ":" + PORT + ":127.0.0.1";
+
+/// How long to wait for a request to finish.
+static const std::chrono::seconds TIMEOUT{10};
+
+/**
+ * A @c CURLOPT_OPENSOCKETFUNCTION which counts the sockets libcurl tries to open, which it only does once the host
+ * name has been resolved, and then fails so that nothing is sent.
+ *
+ * @param userData The @c std::atomic<int> counting the sockets.
+ * @param purpose The purpose of the socket.
+ * @param address The address the socket is for.
+ * @return @c CURL_SOCKET_BAD.
+ */
+static curl_socket_t countSocket(void* userData, curlsocktype purpose, struct curl_sockaddr* address) {
+    ++*static_cast<std::atomic<int>*>(userData);
+    return CURL_SOCKET_BAD;
+}
+
+/**
+ * A @c LibcurlSetCurlOptionsCallbackInterface which counts the sockets opened by the requests of a connection, and can
+ * add the unresolvable host to their DNS cache.
+ */
+class SocketCountingCallback : public LibcurlSetCurlOptionsCallbackInterface {
+public:
+    /**
+     * Constructor.
+     *
+     * @param addResolveEntry Whether requests add the unresolvable host to their DNS cache.
+     */
+    explicit SocketCountingCallback(bool addResolveEntry) : m_socketCount{0}, m_resolve{nullptr} {
+        if (addResolveEntry) {
+            m_resolve = curl_slist_append(m_resolve, RESOLVE_ENTRY.c_str());
+        }
+    }
+
+    /// Destructor.
+    ~SocketCountingCallback() override {
+        curl_slist_free_all(m_resolve);
+    }
+
+    bool processCallback(CurlEasyHandleWrapperOptionsSettingAdapter& optionsSetter) override {
+        if (m_resolve && !optionsSetter.setopt(CURLOPT_RESOLVE, m_resolve)) {
+            return false;
+        }
+        return optionsSetter.setopt(CURLOPT_OPENSOCKETFUNCTION, countSocket) &&
+               optionsSetter.setopt(CURLOPT_OPENSOCKETDATA, static_cast<void*>(&m_socketCount));
+    }
+
+    /// @return The number of sockets opened so far.
+    int getSocketCount() const {
+        return m_socketCount;
+    }
+
+private:
+    /// The number of sockets opened so far.
+    std::atomic<int> m_socketCount;
+
+    /// The @c CURLOPT_RESOLVE list, which must outlive the requests.
+    curl_slist* m_resolve;
+};
+
+/**
+ * A @c LibcurlSetCurlOptionsCallbackFactoryInterface which gives each connection a @c SocketCountingCallback.  Only the
+ * first connection adds the unresolvable host to the DNS cache.
+ */
+class SocketCountingCallbackFactory : public LibcurlSetCurlOptionsCallbackFactoryInterface {
+public:
+    std::shared_ptr<LibcurlSetCurlOptionsCallbackInterface> createSetCurlOptionsCallback() override {
+        auto callback = std::make_shared<SocketCountingCallback>(!m_lastCallback);
+        m_lastCallback = callback;
+        return callback;
+    }
+
+    /// @return The callback given to the last connection created.
+    std::shared_ptr<SocketCountingCallback> getLastCallback() const {
+        return m_lastCallback;
+    }
+
+private:
+    /// The callback given to the last connection created.
+    std::shared_ptr<SocketCountingCallback> m_lastCallback;
+};
+
+/**
+ * A @c HTTP2ResponseSinkInterface which only reports how a response finished.
+ */
+class FinishedResponseSink : public HTTP2ResponseSinkInterface {
+public:
+    bool onReceiveResponseCode(long responseCode) override {
+        return true;
+    }
+
+    bool onReceiveHeaderLine(const std::string& line) override {
+        return true;
+    }
+
+    HTTP2ReceiveDataStatus onReceiveData(const char* bytes, size_t size) override {
+        return HTTP2ReceiveDataStatus::SUCCESS;
+    }
+
+    void onResponseFinished(HTTP2ResponseFinishedStatus status) override {
+        m_finished.set_value(status);
+    }
+
+    /**
+     * Waits for the response to finish.
+     *
+     * @return Whether the response finished within @c TIMEOUT.
+     */
+    bool waitForFinished() {
+        return m_finished.get_future().wait_for(TIMEOUT) == std::future_status::ready;
+    }
+
+private:
+    /// Set when the response finishes.
+    std::promise<HTTP2ResponseFinishedStatus> m_finished;
+};
+
+/**
+ * Sends a request to the unresolvable host, and waits for it to finish.
+ *
+ * @param connection The connection to send the request on.
+ * @return Whether the request finished.
+ */
+static bool sendRequest(const std::shared_ptr<HTTP2ConnectionInterface>& connection) {
+    auto sink = std::make_shared<FinishedResponseSink>();
+    HTTP2RequestConfig config(HTTP2RequestType::GET, URL, "ConnectionFactoryTest-");
+    config.setResponseSink(sink);
+    if (!connection->createAndSendRequest(config)) {
+        return false;
+    }
+    return sink->waitForFinished();
+}
+
+/**
+ * Verify that a connection created by the factory finds a host name resolved by an earlier connection from the same
+ * factory, even after that connection has been disconnected.
+ */
+TEST(LibcurlHTTP2ConnectionFactoryTest, test_connectionsShareDnsCache) {
+    auto callbackFactory = std::make_shared<SocketCountingCallbackFactory>();
+    auto factory = LibcurlHTTP2ConnectionFactory::createHTTP2ConnectionFactoryInterface(callbackFactory);
+    ASSERT_NE(factory, nullptr);
+
+    auto first = factory->createHTTP2Connection();
+    ASSERT_NE(first, nullptr);
+    ASSERT_TRUE(sendRequest(first));
+    EXPECT_GT(callbackFactory->getLastCallback()->getSocketCount(), 0);
+    first->disconnect();
+    first.reset();
+
+    auto second = factory->createHTTP2Connection();
+    ASSERT_NE(second, nullptr);
+    ASSERT_TRUE(sendRequest(second));
+    EXPECT_GT(callbackFactory->getLastCallback()->getSocketCount(), 0);
+    second->disconnect();
+}
+
+/**
+ * Verify that a connection which is not created by the factory does not see the caches shared by its connections.
+ */
+TEST(LibcurlHTTP2ConnectionFactoryTest, test_connectionOutsideFactoryDoesNotShareDnsCache) {
+    auto callbackFactory = std::make_shared<SocketCountingCallbackFactory>();
+    auto factory = LibcurlHTTP2ConnectionFactory::createHTTP2ConnectionFactoryInterface(callbackFactory);
+    ASSERT_NE(factory, nullptr);
+
+    auto first = factory->createHTTP2Connection();
+    ASSERT_NE(first, nullptr);
+    ASSERT_TRUE(sendRequest(first));
+    EXPECT_GT(callbackFactory->getLastCallback()->getSocketCount(), 0);
+
+    auto callback = std::make_shared<SocketCountingCallback>(false);
+    auto other = LibcurlHTTP2Connection::create(callback);
+    ASSERT_NE(other, nullptr);
+    ASSERT_TRUE(sendRequest(other));
+    EXPECT_EQ(callback->getSocketCount(), 0);
+
+    other->disconnect();
+    first->disconnect();
+}
+
+}  // namespace test
+}  // namespace libcurlUtils
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
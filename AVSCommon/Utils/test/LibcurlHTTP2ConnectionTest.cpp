@@ -0,0 +1,422 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <AVSCommon/AVS/Attachment/InProcessAttachment.h>
+#include <AVSCommon/Utils/HTTP2/HTTP2RequestConfig.h>
+#include <AVSCommon/Utils/HTTP2/HTTP2RequestSourceInterface.h>
+#include <AVSCommon/Utils/HTTP2/HTTP2ResponseSinkInterface.h>
+#include <AVSCommon/Utils/LibcurlUtils/CurlEasyHandleWrapper.h>
+#include <AVSCommon/Utils/LibcurlUtils/LibcurlHTTP2Connection.h>
+#include <AVSCommon/Utils/LibcurlUtils/LibcurlSetCurlOptionsCallbackInterface.h>
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace libcurlUtils {
+namespace test {
+
+using namespace avsCommon::avs::attachment;
+using namespace avsCommon::utils::http2;
+
+/// How long to wait for a request to finish.
+static const std::chrono::seconds TIMEOUT{10};
+
+/// How long the writer of the uploaded attachment waits before writing, while the request is paused.
+static const std::chrono::milliseconds WRITE_DELAY{200};
+
+/// The body uploaded by the tests.
+static const std::string BODY = "uploaded body";
+
+/**
+ * The most times the source of a request may be asked for data it does not have yet, if it wakes the connection when
+ * the data arrives.  A connection polling the source every 10 ms instead asks about 20 times during @c WRITE_DELAY.
+ */
+static const int MAX_PAUSES_WHEN_WOKEN = 4;
+
+/**
+ * A minimal HTTP/1.1 server on the loopback interface, which reads the chunked body of one request at a time and
+ * replies with an empty 200 response.
+ */
+class LoopbackUploadServer {
+public:
+    /// Destructor.
+    ~LoopbackUploadServer();
+
+    /**
+     * Starts listening on an ephemeral port.
+     *
+     * @return Whether the server started.
+     */
+    bool start();
+
+    /// @return The URL of the server.
+    std::string getUrl() const;
+
+private:
+    /// Accepts connections until the listening socket is closed.
+    void acceptLoop();
+
+    /**
+     * Serves the requests received on a connection.
+     *
+     * @param fd The socket of the connection.
+     */
+    void serveConnection(int fd);
+
+    /// The listening socket.
+    int m_listenFd = -1;
+
+    /// The port the server listens on.
+    int m_port = 0;
+
+    /// Serializes access to @c m_connections.
+    std::mutex m_mutex;
+
+    /// The sockets of the accepted connections, and the threads serving them.
+    std::vector<std::pair<int, std::thread>> m_connections;
+
+    /// The thread accepting connections.
+    std::thread m_acceptThread;
+};
+
+LoopbackUploadServer::~LoopbackUploadServer() {
+    if (m_listenFd >= 0) {
+        ::shutdown(m_listenFd, SHUT_RDWR);
+        ::close(m_listenFd);
+    }
+    if (m_acceptThread.joinable()) {
+        m_acceptThread.join();
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& connection : m_connections) {
+        ::shutdown(connection.first, SHUT_RDWR);
+        connection.second.join();
+        ::close(connection.first);
+    }
+}
+
+bool LoopbackUploadServer::start() {
+    m_listenFd = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (m_listenFd < 0) {
+        return false;
+    }
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0;
+    socklen_t length = sizeof(address);
+    if (::bind(m_listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        ::listen(m_listenFd, 16) != 0 ||
+        ::getsockname(m_listenFd, reinterpret_cast<sockaddr*>(&address), &length) != 0) {
+        return false;
+    }
+    m_port = ntohs(address.sin_port);
+    m_acceptThread = std::thread(&LoopbackUploadServer::acceptLoop, this);
+    return true;
+}
+
+std::string LoopbackUploadServer::getUrl() const {
+    return "http://127.0.0.1:" + std::to_string(m_port) + "/upload";
+}
+
+void LoopbackUploadServer::acceptLoop() {
+    while (true) {
+        int fd = ::accept(m_listenFd, nullptr, nullptr);
+        if (fd < 0) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_connections.emplace_back(fd, std::thread(&LoopbackUploadServer::serveConnection, this, fd));
+    }
+}
+
+void LoopbackUploadServer::serveConnection(int fd) {
+    static const std::string END_OF_CHUNKED_BODY = "\r\n0\r\n\r\n";
+    static const std::string RESPONSE = "HTTP/1.1 200 OK\r\nContent-Length: 0\r\n\r\n";
+    std::string request;
+    char buffer[1024];
+    while (true) {
+        auto endOfRequest = request.find(END_OF_CHUNKED_BODY);
+        if (std::string::npos == endOfRequest) {
+            auto received = ::recv(fd, buffer, sizeof(buffer), 0);
+            if (received <= 0) {
+                return;
+            }
+            request.append(buffer, received);
+            continue;
+        }
+        request.erase(0, endOfRequest + END_OF_CHUNKED_BODY.size());
+        if (::send(fd, RESPONSE.data(), RESPONSE.size(), MSG_NOSIGNAL) <= 0) {
+            return;
+        }
+    }
+}
+
+/**
+ * A @c LibcurlSetCurlOptionsCallbackInterface which makes requests use HTTP/1.1, which @c LoopbackUploadServer speaks.
+ */
+class Http11Callback : public LibcurlSetCurlOptionsCallbackInterface {
+public:
+    bool processCallback(CurlEasyHandleWrapperOptionsSettingAdapter& optionsSetter) override {
+        return optionsSetter.setopt(CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_1_1);
+    }
+};
+
+/**
+ * A @c HTTP2RequestSourceInterface which uploads the data of an attachment as it is written, pausing the request while
+ * there is none.
+ */
+class AttachmentRequestSource : public HTTP2RequestSourceInterface {
+public:
+    /**
+     * Constructor.
+     *
+     * @param reader A non-blocking reader of the attachment to upload.
+     * @param notifyDataAvailable Whether this source wakes the connection when the attachment has more data.
+     */
+    AttachmentRequestSource(std::unique_ptr<AttachmentReader> reader, bool notifyDataAvailable) :
+            m_reader{std::move(reader)},
+            m_notifyDataAvailable{notifyDataAvailable},
+            m_pauseCount{0} {
+    }
+
+    std::vector<std::string> getRequestHeaderLines() override {
+        // Without this, libcurl waits for a 100 Continue response before sending the body.
+        return {"Expect:"};
+    }
+
+    HTTP2SendDataResult onSendData(char* bytes, size_t size) override {
+        auto readStatus = AttachmentReader::ReadStatus::OK;
+        auto count = m_reader->read(bytes, size, &readStatus);
+        if (count > 0) {
+            return HTTP2SendDataResult(count);
+        }
+        switch (readStatus) {
+            case AttachmentReader::ReadStatus::OK_WOULDBLOCK: {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                ++m_pauseCount;
+                m_pauseTrigger.notify_all();
+                return HTTP2SendDataResult::PAUSE;
+            }
+            case AttachmentReader::ReadStatus::CLOSED:
+                return HTTP2SendDataResult::COMPLETE;
+            default:
+                return HTTP2SendDataResult::ABORT;
+        }
+    }
+
+    bool setDataAvailableCallback(std::function<void()> callback) override {
+        return m_notifyDataAvailable && m_reader->setDataAvailableCallback(std::move(callback));
+    }
+
+    /**
+     * Waits for the request to be paused for the first time.
+     *
+     * @return Whether the request was paused within @c TIMEOUT.
+     */
+    bool waitForPause() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_pauseTrigger.wait_for(lock, TIMEOUT, [this] { return m_pauseCount > 0; });
+    }
+
+    /// @return The number of times the request was paused.
+    int getPauseCount() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_pauseCount;
+    }
+
+private:
+    /// The reader of the attachment to upload.
+    std::unique_ptr<AttachmentReader> m_reader;
+
+    /// Whether this source wakes the connection when the attachment has more data.
+    const bool m_notifyDataAvailable;
+
+    /// Serializes access to @c m_pauseCount.
+    std::mutex m_mutex;
+
+    /// Notified when the request is paused.
+    std::condition_variable m_pauseTrigger;
+
+    /// The number of times the request was paused.
+    int m_pauseCount;
+};
+
+/**
+ * A @c HTTP2ResponseSinkInterface which only reports how a response finished.
+ */
+class FinishedResponseSink : public HTTP2ResponseSinkInterface {
+public:
+    bool onReceiveResponseCode(long responseCode) override {
+        return true;
+    }
+
+    bool onReceiveHeaderLine(const std::string& line) override {
+        return true;
+    }
+
+    HTTP2ReceiveDataStatus onReceiveData(const char* bytes, size_t size) override {
+        return HTTP2ReceiveDataStatus::SUCCESS;
+    }
+
+    void onResponseFinished(HTTP2ResponseFinishedStatus status) override {
+        m_finished.set_value(status);
+    }
+
+    /**
+     * Waits for the response to finish.
+     *
+     * @param[out] status How the response finished.
+     * @return Whether the response finished within @c TIMEOUT.
+     */
+    bool waitForFinished(HTTP2ResponseFinishedStatus* status) {
+        auto future = m_finished.get_future();
+        if (future.wait_for(TIMEOUT) != std::future_status::ready) {
+            return false;
+        }
+        *status = future.get();
+        return true;
+    }
+
+private:
+    /// Set when the response finishes.
+    std::promise<HTTP2ResponseFinishedStatus> m_finished;
+};
+
+/**
+ * Class for testing @c LibcurlHTTP2Connection.  Attachments are uploaded to a @c LoopbackUploadServer.
+ */
+class LibcurlHTTP2ConnectionTest : public ::testing::Test {
+protected:
+    void SetUp() override;
+
+    void TearDown() override;
+
+    /**
+     * Uploads an attachment which is written only after the request has been paused waiting for its data.
+     *
+     * @param attachment The attachment to upload.
+     * @param notifyDataAvailable Whether the source of the request wakes the connection when the attachment has more
+     * data.
+     * @param[out] pauseCount The number of times the request was paused.
+     */
+    void uploadLateAttachment(InProcessAttachment* attachment, bool notifyDataAvailable, int* pauseCount);
+
+    /// The server the attachments are uploaded to.
+    std::unique_ptr<LoopbackUploadServer> m_server;
+
+    /// The connection under test.
+    std::shared_ptr<LibcurlHTTP2Connection> m_connection;
+};
+
+void LibcurlHTTP2ConnectionTest::SetUp() {
+    m_server.reset(new LoopbackUploadServer());
+    ASSERT_TRUE(m_server->start());
+    m_connection = LibcurlHTTP2Connection::create(std::make_shared<Http11Callback>());
+    ASSERT_NE(m_connection, nullptr);
+}
+
+void LibcurlHTTP2ConnectionTest::TearDown() {
+    if (m_connection) {
+        m_connection->disconnect();
+    }
+    m_server.reset();
+}
+
+void LibcurlHTTP2ConnectionTest::uploadLateAttachment(
+    InProcessAttachment* attachment,
+    bool notifyDataAvailable,
+    int* pauseCount) {
+    auto writer = attachment->createWriter();
+    ASSERT_NE(writer, nullptr);
+    auto reader = attachment->createReader(sds::ReaderPolicy::NONBLOCKING);
+    ASSERT_NE(reader, nullptr);
+    auto source = std::make_shared<AttachmentRequestSource>(std::move(reader), notifyDataAvailable);
+    auto sink = std::make_shared<FinishedResponseSink>();
+
+    HTTP2RequestConfig config(HTTP2RequestType::POST, m_server->getUrl(), "ConnectionTest-");
+    config.setRequestSource(source);
+    config.setResponseSink(sink);
+    ASSERT_NE(m_connection->createAndSendRequest(config), nullptr);
+
+    ASSERT_TRUE(source->waitForPause());
+    std::this_thread::sleep_for(WRITE_DELAY);
+    auto writeStatus = AttachmentWriter::WriteStatus::OK;
+    ASSERT_EQ(writer->write(BODY.data(), BODY.size(), &writeStatus), BODY.size());
+    writer->close();
+
+    auto status = HTTP2ResponseFinishedStatus::INTERNAL_ERROR;
+    ASSERT_TRUE(sink->waitForFinished(&status));
+    ASSERT_EQ(status, HTTP2ResponseFinishedStatus::COMPLETE);
+    *pauseCount = source->getPauseCount();
+}
+
+/**
+ * Verify that an upload paused waiting for an attachment is resumed as soon as the attachment's writer writes, rather
+ * than by polling the attachment while the request is paused.
+ */
+TEST_F(LibcurlHTTP2ConnectionTest, test_pausedUploadResumedWhenDataWritten) {
+    InProcessAttachment attachment("upload");
+    int pauseCount = 0;
+    uploadLateAttachment(&attachment, true, &pauseCount);
+    ASSERT_LE(pauseCount, MAX_PAUSES_WHEN_WOKEN);
+}
+
+/**
+ * Verify that an upload paused waiting for an attachment stored in a memory pool is resumed as soon as the attachment's
+ * writer writes.
+ */
+TEST_F(LibcurlHTTP2ConnectionTest, test_pausedUploadOfPooledAttachmentResumedWhenDataWritten) {
+    auto pool = std::make_shared<AttachmentMemoryPool>(64 * 1024, 1024, 64 * 1024);
+    auto attachment = InProcessAttachment::createWithMemoryPool("upload", pool);
+    ASSERT_NE(attachment, nullptr);
+    int pauseCount = 0;
+    uploadLateAttachment(attachment.get(), true, &pauseCount);
+    ASSERT_LE(pauseCount, MAX_PAUSES_WHEN_WOKEN);
+}
+
+/**
+ * Verify that an upload whose source cannot wake the connection is still resumed, by polling the source while the
+ * request is paused.
+ */
+TEST_F(LibcurlHTTP2ConnectionTest, test_pausedUploadPolledWithoutDataAvailableCallback) {
+    InProcessAttachment attachment("upload");
+    int pauseCount = 0;
+    uploadLateAttachment(&attachment, false, &pauseCount);
+    ASSERT_GT(pauseCount, MAX_PAUSES_WHEN_WOKEN);
+}
+
+}  // namespace test
+}  // namespace libcurlUtils
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,125 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+// Compile out debug logs below DEBUG3 in this file, as acsdk_log_min_level() does for the sources of a module.
+#define ACSDK_LOG_MODULE_MIN_LEVEL ACSDK_LOG_LEVEL_DEBUG3
+
+#include <atomic>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/Logger/ConsoleLogger.h"
+#include "AVSCommon/Utils/Logger/Logger.h"
+#include "AVSCommon/Utils/Logger/LoggerSinkManager.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+namespace test {
+
+static_assert(ACSDK_LOG_COMPILED_MIN_LEVEL == ACSDK_LOG_LEVEL_DEBUG3, "ACSDK_LOG_MODULE_MIN_LEVEL was not applied");
+
+/// The number of levels from DEBUG9 to INFO.
+static const size_t NUM_LEVELS = static_cast<size_t>(Level::INFO) + 1;
+
+/// Macro used to create log entries for this source.
+#define LX(event) LogEntry("LogMinLevelTest", event)
+
+/// A sink which counts the entries emitted at each level.
+class CountingLogger : public Logger {
+public:
+    /// Constructor.
+    CountingLogger() : Logger(Level::DEBUG9) {
+        for (auto& count : m_counts) {
+            count = 0;
+        }
+    }
+
+    void emit(Level level, std::chrono::system_clock::time_point, const char*, const char*) override {
+        auto index = static_cast<size_t>(level);
+        if (index < NUM_LEVELS) {
+            m_counts[index]++;
+        }
+    }
+
+    /// The number of entries emitted at each level.
+    std::atomic<int> m_counts[NUM_LEVELS];
+};
+
+/// Test fixture which sends logs to a @c CountingLogger, with every level enabled at run time.
+class LogMinLevelTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_sink = std::make_shared<CountingLogger>();
+        LoggerSinkManager::instance().initialize(m_sink);
+        ACSDK_GET_LOGGER_FUNCTION()->setLevel(Level::DEBUG9);
+    }
+
+    void TearDown() override {
+        LoggerSinkManager::instance().initialize(getConsoleLogger());
+    }
+
+    /// The sink receiving the logs.
+    std::shared_ptr<CountingLogger> m_sink;
+};
+
+/**
+ * Test that debug logs below the compile-time minimum level are neither evaluated nor emitted, even though they are
+ * enabled at run time, and that logs at or above it are.
+ */
+TEST_F(LogMinLevelTest, test_logsBelowMinimumCompiledOut) {
+    int evaluated[NUM_LEVELS] = {};
+    ACSDK_DEBUG9(LX("debug9").d("evaluated", ++evaluated[0]));
+    ACSDK_DEBUG8(LX("debug8").d("evaluated", ++evaluated[1]));
+    ACSDK_DEBUG7(LX("debug7").d("evaluated", ++evaluated[2]));
+    ACSDK_DEBUG6(LX("debug6").d("evaluated", ++evaluated[3]));
+    ACSDK_DEBUG5(LX("debug5").d("evaluated", ++evaluated[4]));
+    ACSDK_DEBUG4(LX("debug4").d("evaluated", ++evaluated[5]));
+    ACSDK_DEBUG3(LX("debug3").d("evaluated", ++evaluated[6]));
+    ACSDK_DEBUG2(LX("debug2").d("evaluated", ++evaluated[7]));
+    ACSDK_DEBUG1(LX("debug1").d("evaluated", ++evaluated[8]));
+    ACSDK_DEBUG0(LX("debug0").d("evaluated", ++evaluated[9]));
+    ACSDK_INFO(LX("info").d("evaluated", ++evaluated[10]));
+
+#ifdef ACSDK_DEBUG_LOG_ENABLED
+    const int debugCount = 1;
+#else
+    const int debugCount = 0;
+#endif
+#ifdef ACSDK_LOG_ENABLED
+    const int logCount = 1;
+#else
+    const int logCount = 0;
+#endif
+
+    for (size_t i = 0; i < NUM_LEVELS; ++i) {
+        int expected = 0;
+        if (i == static_cast<size_t>(Level::INFO)) {
+            expected = 1;
+        } else if (i >= static_cast<size_t>(Level::DEBUG3)) {
+            expected = debugCount;
+        }
+        EXPECT_EQ(evaluated[i], expected) << convertLevelToName(static_cast<Level>(i));
+        EXPECT_EQ(m_sink->m_counts[i], expected * logCount) << convertLevelToName(static_cast<Level>(i));
+    }
+}
+
+}  // namespace test
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,113 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <cstring>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/Logger/LogEntry.h"
+#include "AVSCommon/Utils/Logger/LogRecord.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace logger {
+namespace test {
+
+/// The source used by the tests below.
+static const std::string TEST_SOURCE = "LogRecordTest";
+
+/// The event used by the tests below.
+static const char* TEST_EVENT = "event";
+
+/// Test that the values added to a record can be read back.
+TEST(LogRecordTest, test_fieldsReadBack) {
+    LogRecord record;
+    ASSERT_TRUE(record.reset(TEST_SOURCE, TEST_EVENT));
+    int value = 0;
+    ASSERT_TRUE(record.addString("string", "text"));
+    ASSERT_TRUE(record.addSigned("signed", -1));
+    ASSERT_TRUE(record.addUnsigned("unsigned", 1));
+    ASSERT_TRUE(record.addFloating("floating", 0.5));
+    ASSERT_TRUE(record.addPointer("pointer", &value));
+    ASSERT_TRUE(record.addMessage("message"));
+
+    EXPECT_STREQ(record.getSource(), TEST_SOURCE.c_str());
+    EXPECT_STREQ(record.getEvent(), TEST_EVENT);
+    ASSERT_EQ(record.getNumFields(), 6u);
+    EXPECT_EQ(record.getField(0).type, LogRecord::FieldType::STRING);
+    EXPECT_STREQ(record.getText(record.getField(0).key), "string");
+    EXPECT_STREQ(record.getText(record.getField(0).text), "text");
+    EXPECT_EQ(record.getField(1).signedValue, -1);
+    EXPECT_EQ(record.getField(2).unsignedValue, 1u);
+    EXPECT_EQ(record.getField(3).floatingValue, 0.5);
+    EXPECT_EQ(record.getField(4).pointerValue, &value);
+    EXPECT_EQ(record.getField(5).type, LogRecord::FieldType::MESSAGE);
+    EXPECT_STREQ(record.getText(record.getField(5).text), "message");
+}
+
+/// Test that a null event and null values are stored as empty strings.
+TEST(LogRecordTest, test_nullStringsStoredEmpty) {
+    LogRecord record;
+    ASSERT_TRUE(record.reset(TEST_SOURCE, nullptr));
+    ASSERT_TRUE(record.addString("key", nullptr));
+    ASSERT_TRUE(record.addMessage(nullptr));
+    EXPECT_STREQ(record.getEvent(), "");
+    EXPECT_STREQ(record.getText(record.getField(0).text), "");
+    EXPECT_STREQ(record.getText(record.getField(1).text), "");
+}
+
+/// Test that fields are rejected once the record is full, and the fields already added are kept.
+TEST(LogRecordTest, test_fullRecordRejectsFields) {
+    LogRecord record;
+    ASSERT_TRUE(record.reset(TEST_SOURCE, TEST_EVENT));
+    for (size_t i = 0; i < LogRecord::MAX_FIELDS; ++i) {
+        ASSERT_TRUE(record.addSigned("i", i));
+    }
+    EXPECT_FALSE(record.addSigned("i", 0));
+    EXPECT_FALSE(record.addMessage("message"));
+    EXPECT_EQ(record.getNumFields(), LogRecord::MAX_FIELDS);
+}
+
+/// Test that strings which do not fit are rejected, and do not add a field.
+TEST(LogRecordTest, test_longStringRejected) {
+    LogRecord record;
+    ASSERT_TRUE(record.reset(TEST_SOURCE, TEST_EVENT));
+    std::string longValue(LogRecord::TEXT_SIZE, 'x');
+    EXPECT_FALSE(record.addString("key", longValue.c_str()));
+    EXPECT_EQ(record.getNumFields(), 0u);
+    EXPECT_FALSE(record.reset(longValue, TEST_EVENT));
+}
+
+/// Test that a copy of a record made with memcpy renders the same text as the original entry.
+TEST(LogRecordTest, test_copiedRecordRendersSameText) {
+    LogEntry entry(TEST_SOURCE, TEST_EVENT);
+    entry.d("count", 3).d("name", "a:b").m("done");
+    auto original = entry.getRecord();
+    ASSERT_NE(original, nullptr);
+
+    LogRecord copy;
+    std::memcpy(&copy, original, sizeof(LogRecord));
+    LogEntry rendered(copy);
+    EXPECT_STREQ(rendered.c_str(), entry.c_str());
+    EXPECT_STREQ(rendered.c_str(), R"(LogRecordTest:event:count=3,name=a\:b:done)");
+}
+
+}  // namespace test
+}  // namespace logger
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -506,6 +506,59 @@ TEST_F(LoggerTest, test_multipleModuleLoggerObservers) {
     ASSERT_EQ(mockModuleLogger3.getLogLevel(), Level::NONE);
 }
 
+/**
+ * Test that an entry built from strings, numbers and pointers captures them without rendering, and renders the same
+ * text as an entry built as text.
+ */
+TEST_F(LoggerTest, test_deferredEntryRendersExpectedText) {
+    int value = 0;
+    std::ostringstream pointer;
+    pointer << static_cast<const void*>(&value);
+
+    LogEntry entry(TEST_SOURCE_STRING, TEST_EVENT_STRING);
+    entry.d("signed", -42)
+        .d("unsigned", 42u)
+        .d("floating", 0.5)
+        .d(METADATA_KEY, UNESCAPED_METADATA_VALUE)
+        .d(METADATA_KEY_TRUE, true)
+        .p("pointer", &value)
+        .m("message");
+    ASSERT_NE(entry.getRecord(), nullptr);
+
+    std::string expected = TEST_SOURCE_STRING + ":" + TEST_EVENT_STRING +
+                           ":signed=-42,unsigned=42,floating=0.5,"
+                           METADATA_KEY KEY_VALUE_SEPARATOR ESCAPED_METADATA_VALUE
+                           "," METADATA_KEY_TRUE KEY_VALUE_SEPARATOR "true,pointer=" +
+                           pointer.str() + ":message";
+    ASSERT_EQ(std::string(entry.c_str()), expected);
+    ASSERT_EQ(entry.getRecord(), nullptr);
+}
+
+/**
+ * Test that a value which cannot be captured renders the entry at that point, and that the text is unchanged.
+ */
+TEST_F(LoggerTest, test_uncapturedValueRendersEntry) {
+    LogEntry entry(TEST_SOURCE_STRING, TEST_EVENT_STRING);
+    entry.d("before", 1).d("level", Level::WARN);
+    ASSERT_EQ(entry.getRecord(), nullptr);
+    entry.d("after", 'x');
+    ASSERT_EQ(
+        std::string(entry.c_str()), TEST_SOURCE_STRING + ":" + TEST_EVENT_STRING + ":before=1,level=WARN,after=x");
+}
+
+/**
+ * Test that an entry with more values than fit in a @c LogRecord renders all of them.
+ */
+TEST_F(LoggerTest, test_fullRecordRendersAllValues) {
+    LogEntry entry(TEST_SOURCE_STRING, TEST_EVENT_STRING);
+    std::string expected = TEST_SOURCE_STRING + ":" + TEST_EVENT_STRING;
+    for (size_t i = 0; i < LogRecord::MAX_FIELDS * 2; ++i) {
+        entry.d("index", i);
+        expected += (i ? ",index=" : ":index=") + std::to_string(i);
+    }
+    ASSERT_EQ(std::string(entry.c_str()), expected);
+}
+
 #ifdef ACSDK_LOG_ENABLED
 
 /// String used to test that the message component is logged
@@ -0,0 +1,215 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file LowLatencySharedDataStreamTest.cpp
+
+#include <chrono>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/SDS/InProcessSDS.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace sds {
+namespace test {
+
+/// Alias for the low-latency SDS under test.
+using Sds = LowLatencyInProcessSDS;
+
+/// Word size used by the tests below (16-bit PCM).
+static const size_t WORD_SIZE = 2;
+
+/// Number of words per write, matching a 20ms frame of 16kHz audio.
+static const size_t FRAME_WORDS = 320;
+
+/// Timeout used when waiting for something which is expected to happen.
+static const std::chrono::milliseconds WAIT_TIMEOUT{1000};
+
+/// Timeout used when waiting for something which is not expected to happen.
+static const std::chrono::milliseconds SHORT_TIMEOUT{50};
+
+/// Number of frames pushed through the stream by the benchmark.
+static const size_t BENCHMARK_FRAMES = 5000;
+
+/// Maximum number of readers exercised by the benchmark.
+static const size_t BENCHMARK_MAX_READERS = 8;
+
+/// Number of frames the benchmark stream can buffer.
+static const size_t BENCHMARK_BUFFER_FRAMES = 32;
+
+/**
+ * Pushes @c BENCHMARK_FRAMES frames from an @c ALL_OR_NOTHING @c Writer through @c numReaders @c BLOCKING @c Readers,
+ * each on their own thread, and checks that every reader receives every frame.
+ *
+ * @tparam SdsType The @c SharedDataStream type to measure.
+ * @param numReaders The number of concurrent readers.
+ */
+template <typename SdsType>
+static void runReaderBenchmark(size_t numReaders) {
+    auto bufferSize = SdsType::calculateBufferSize(FRAME_WORDS * BENCHMARK_BUFFER_FRAMES, WORD_SIZE, numReaders);
+    auto buffer = std::make_shared<typename SdsType::Buffer>(bufferSize);
+    auto sds = SdsType::create(buffer, WORD_SIZE, numReaders);
+    EXPECT_TRUE(sds);
+    if (!sds) {
+        return;
+    }
+    auto writer = sds->createWriter(SdsType::Writer::Policy::ALL_OR_NOTHING);
+
+    std::vector<std::future<size_t>> readerResults;
+    for (size_t i = 0; i < numReaders; ++i) {
+        std::shared_ptr<typename SdsType::Reader> reader = sds->createReader(SdsType::Reader::Policy::BLOCKING);
+        EXPECT_TRUE(reader);
+        readerResults.push_back(std::async(std::launch::async, [reader] {
+            std::vector<int16_t> frame(FRAME_WORDS);
+            size_t wordsRead = 0;
+            ssize_t result;
+            while ((result = reader->read(frame.data(), frame.size())) > 0) {
+                wordsRead += result;
+            }
+            return wordsRead;
+        }));
+    }
+
+    std::vector<int16_t> frame(FRAME_WORDS, 0x55);
+    for (size_t i = 0; i < BENCHMARK_FRAMES; ++i) {
+        while (writer->write(frame.data(), frame.size()) == SdsType::Writer::Error::WOULDBLOCK) {
+            std::this_thread::yield();
+        }
+    }
+    writer->close();
+    for (auto& result : readerResults) {
+        EXPECT_EQ(result.get(), BENCHMARK_FRAMES * FRAME_WORDS);
+    }
+}
+
+/// The test harness for the tests below.
+class LowLatencySharedDataStreamTest : public ::testing::Test {
+protected:
+    /// Creates a stream with room for @c nFrames frames and @c maxReaders readers.
+    std::unique_ptr<Sds> createSds(size_t nFrames, size_t maxReaders = 1) {
+        auto bufferSize = Sds::calculateBufferSize(nFrames * FRAME_WORDS, WORD_SIZE, maxReaders);
+        return Sds::create(std::make_shared<Sds::Buffer>(bufferSize), WORD_SIZE, maxReaders);
+    }
+};
+
+/// Verify that the optional lockFreeNotify trait is detected, and that it defaults to false for existing traits.
+TEST_F(LowLatencySharedDataStreamTest, test_lockFreeNotifyTraitDetection) {
+    EXPECT_TRUE(SdsLockFreeNotify<LowLatencyInProcessSDSTraits>::value);
+    EXPECT_FALSE(SdsLockFreeNotify<InProcessSDSTraits>::value);
+}
+
+/// Verify that a blocked @c Reader is woken by every @c Writer policy.
+TEST_F(LowLatencySharedDataStreamTest, test_blockingReaderWokenByWrite) {
+    for (auto policy :
+         {Sds::Writer::Policy::NONBLOCKABLE, Sds::Writer::Policy::ALL_OR_NOTHING, Sds::Writer::Policy::BLOCKING}) {
+        auto sds = createSds(4);
+        ASSERT_TRUE(sds);
+        auto writer = sds->createWriter(policy);
+        ASSERT_TRUE(writer);
+        std::shared_ptr<Sds::Reader> reader = sds->createReader(Sds::Reader::Policy::BLOCKING);
+        ASSERT_TRUE(reader);
+
+        auto readResult = std::async(std::launch::async, [reader] {
+            std::vector<int16_t> frame(FRAME_WORDS);
+            return reader->read(frame.data(), frame.size(), WAIT_TIMEOUT);
+        });
+        ASSERT_EQ(readResult.wait_for(SHORT_TIMEOUT), std::future_status::timeout);
+
+        std::vector<int16_t> frame(FRAME_WORDS, 1);
+        ASSERT_EQ(writer->write(frame.data(), frame.size()), static_cast<ssize_t>(FRAME_WORDS));
+        ASSERT_EQ(readResult.wait_for(WAIT_TIMEOUT), std::future_status::ready);
+        EXPECT_EQ(readResult.get(), static_cast<ssize_t>(FRAME_WORDS));
+    }
+}
+
+/// Verify that a blocked @c Reader times out when no data arrives.
+TEST_F(LowLatencySharedDataStreamTest, test_blockingReaderTimesOut) {
+    auto sds = createSds(1);
+    ASSERT_TRUE(sds);
+    auto writer = sds->createWriter(Sds::Writer::Policy::NONBLOCKABLE);
+    auto reader = sds->createReader(Sds::Reader::Policy::BLOCKING);
+    ASSERT_TRUE(reader);
+
+    std::vector<int16_t> frame(FRAME_WORDS);
+    EXPECT_EQ(reader->read(frame.data(), frame.size(), SHORT_TIMEOUT), Sds::Reader::Error::TIMEDOUT);
+}
+
+/// Verify that a blocked @c Reader is woken when the @c Writer closes.
+TEST_F(LowLatencySharedDataStreamTest, test_blockingReaderWokenByClose) {
+    auto sds = createSds(1);
+    ASSERT_TRUE(sds);
+    auto writer = sds->createWriter(Sds::Writer::Policy::NONBLOCKABLE);
+    std::shared_ptr<Sds::Reader> reader = sds->createReader(Sds::Reader::Policy::BLOCKING);
+    ASSERT_TRUE(reader);
+
+    auto readResult = std::async(std::launch::async, [reader] {
+        std::vector<int16_t> frame(FRAME_WORDS);
+        return reader->read(frame.data(), frame.size());
+    });
+    ASSERT_EQ(readResult.wait_for(SHORT_TIMEOUT), std::future_status::timeout);
+    writer->close();
+    ASSERT_EQ(readResult.wait_for(WAIT_TIMEOUT), std::future_status::ready);
+    EXPECT_EQ(readResult.get(), Sds::Reader::Error::CLOSED);
+}
+
+/// Verify that a @c BLOCKING @c Writer waiting for space is woken when a @c Reader consumes data.
+TEST_F(LowLatencySharedDataStreamTest, test_blockingWriterWokenByRead) {
+    auto sds = createSds(1);
+    ASSERT_TRUE(sds);
+    std::shared_ptr<Sds::Writer> writer = sds->createWriter(Sds::Writer::Policy::BLOCKING);
+    auto reader = sds->createReader(Sds::Reader::Policy::NONBLOCKING);
+    ASSERT_TRUE(reader);
+
+    std::vector<int16_t> frame(FRAME_WORDS, 1);
+    ASSERT_EQ(writer->write(frame.data(), frame.size()), static_cast<ssize_t>(FRAME_WORDS));
+    auto writeResult = std::async(std::launch::async, [writer, &frame] {
+        return writer->write(frame.data(), frame.size(), WAIT_TIMEOUT);
+    });
+    ASSERT_EQ(writeResult.wait_for(SHORT_TIMEOUT), std::future_status::timeout);
+
+    ASSERT_EQ(reader->read(frame.data(), frame.size()), static_cast<ssize_t>(FRAME_WORDS));
+    ASSERT_EQ(writeResult.wait_for(WAIT_TIMEOUT), std::future_status::ready);
+    EXPECT_EQ(writeResult.get(), static_cast<ssize_t>(FRAME_WORDS));
+}
+
+/// Verify that many readers receive every word from a fast writer without missing a wake-up.
+TEST_F(LowLatencySharedDataStreamTest, test_multipleBlockingReadersReceiveAllData) {
+    runReaderBenchmark<Sds>(BENCHMARK_MAX_READERS);
+}
+
+/// Benchmark streaming 20ms frames through @c InProcessSDS to 1-8 @c BLOCKING readers.
+TEST_F(LowLatencySharedDataStreamTest, testSlow_benchmarkInProcessSDSReaders) {
+    for (size_t numReaders = 1; numReaders <= BENCHMARK_MAX_READERS; ++numReaders) {
+        runReaderBenchmark<InProcessSDS>(numReaders);
+    }
+}
+
+/// Benchmark streaming 20ms frames through @c LowLatencyInProcessSDS to 1-8 @c BLOCKING readers.
+TEST_F(LowLatencySharedDataStreamTest, testSlow_benchmarkLowLatencyInProcessSDSReaders) {
+    for (size_t numReaders = 1; numReaders <= BENCHMARK_MAX_READERS; ++numReaders) {
+        runReaderBenchmark<LowLatencyInProcessSDS>(numReaders);
+    }
+}
+
+}  // namespace test
+}  // namespace sds
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -13,6 +13,9 @@
  * permissions and limitations under the License.
  */
 
+#include <atomic>
+#include <cstdlib>
+#include <new>
 #include <string>
 #include <cstring>
 #include <future>
@@ -31,6 +34,25 @@
 #include "AVSCommon/Utils/HTTP2/MockHTTP2MimeResponseDecodeSink.h"
 #include "AVSCommon/Utils/Logger/LoggerUtils.h"
 
+/// The number of calls to the global operator new, used to measure allocations while decoding.
+static std::atomic<size_t> g_allocations{0};
+
+void* operator new(std::size_t size) {
+    g_allocations++;
+    if (void* ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
 namespace alexaClientSDK {
 namespace avsCommon {
 namespace test {
@@ -1172,6 +1194,309 @@ TEST_F(MIMEParserTest, test_prefixCases) {
     }
 }
 
+/**
+ * A sink which reads the headers of each part from the @c HTTP2MimePartHeaders table, or optionally from the multimap
+ * built from it, and only counts the data it receives, so that it does not allocate while decoding.
+ */
+class HeaderTableSink : public HTTP2MimeResponseSinkInterface {
+public:
+    bool onReceiveResponseCode(long responseCode) override {
+        return true;
+    }
+
+    bool onReceiveHeaderLine(const std::string& line) override {
+        return true;
+    }
+
+    bool onBeginMimePart(const std::multimap<std::string, std::string>& headers) override {
+        m_multimapParts++;
+        return true;
+    }
+
+    bool onBeginMimePartHeaders(const HTTP2MimePartHeaders& headers) override {
+        if (!m_useHeaderTable) {
+            return HTTP2MimeResponseSinkInterface::onBeginMimePartHeaders(headers);
+        }
+        m_parts++;
+        m_overflowed = m_overflowed || headers.hasOverflowed();
+        HTTP2MimePartHeaders::Text contentType;
+        if (headers.find("Content-Type", &contentType) && contentType.contains("application/octet-stream")) {
+            m_attachmentParts++;
+        }
+        if (m_recordHeaders) {
+            m_headers.clear();
+            for (size_t i = 0; i < headers.getCount(); ++i) {
+                m_headers.push_back(headers.getName(i).str() + SEPARATOR + headers.getValue(i).str());
+            }
+        }
+        return true;
+    }
+
+    HTTP2ReceiveDataStatus onReceiveMimeData(const char* bytes, size_t size) override {
+        m_dataSize += size;
+        return HTTP2ReceiveDataStatus::SUCCESS;
+    }
+
+    bool onEndMimePart() override {
+        return true;
+    }
+
+    HTTP2ReceiveDataStatus onReceiveNonMimeData(const char* bytes, size_t size) override {
+        return HTTP2ReceiveDataStatus::SUCCESS;
+    }
+
+    void onResponseFinished(HTTP2ResponseFinishedStatus status) override {
+    }
+
+    /// Whether to read the header table, rather than falling back to @c onBeginMimePart().
+    bool m_useHeaderTable = true;
+
+    /// Whether to copy the headers of the last part into @c m_headers.
+    bool m_recordHeaders = false;
+
+    /// The headers of the last part, as "name: value" lines.
+    std::vector<std::string> m_headers;
+
+    /// The number of parts started through @c onBeginMimePartHeaders().
+    size_t m_parts = 0;
+
+    /// The number of parts started through @c onBeginMimePart().
+    size_t m_multimapParts = 0;
+
+    /// The number of parts with an application/octet-stream content type.
+    size_t m_attachmentParts = 0;
+
+    /// The number of bytes of part data received.
+    size_t m_dataSize = 0;
+
+    /// Whether any part had more headers than fit in the table.
+    bool m_overflowed = false;
+};
+
+/**
+ * Build a mime response body from the given parts.
+ *
+ * @param partBoundary The boundary separating the parts.
+ * @param parts The parts, each a list of header lines and the data of the part.
+ * @return The body.
+ */
+static std::string buildMimeBody(
+    const std::string& partBoundary,
+    const std::vector<std::pair<std::vector<std::string>, std::string>>& parts) {
+    std::string body;
+    for (auto& part : parts) {
+        body += MIME_BOUNDARY_DASHES + partBoundary + MIME_NEWLINE;
+        for (auto& header : part.first) {
+            body += header + MIME_NEWLINE;
+        }
+        body += MIME_NEWLINE + part.second + MIME_NEWLINE;
+    }
+    body += MIME_BOUNDARY_DASHES + partBoundary + MIME_BOUNDARY_DASHES + MIME_NEWLINE;
+    return body;
+}
+
+/**
+ * Feed a response body to a decoder in chunks of a fixed size.
+ *
+ * @param decoder The decoder.
+ * @param body The body.
+ * @param chunkSize The size of each chunk.
+ * @return The status returned for the last chunk.
+ */
+static HTTP2ReceiveDataStatus feedInChunks(
+    HTTP2MimeResponseDecoder& decoder,
+    const std::string& body,
+    size_t chunkSize) {
+    HTTP2ReceiveDataStatus status{HTTP2ReceiveDataStatus::SUCCESS};
+    for (size_t index = 0; index < body.size() && HTTP2ReceiveDataStatus::SUCCESS == status; index += chunkSize) {
+        status = decoder.onReceiveData(body.data() + index, std::min(chunkSize, body.size() - index));
+    }
+    return status;
+}
+
+/**
+ * Verify that headers split across many chunks are passed to @c onBeginMimePartHeaders() intact and in order, and
+ * that a sink which handles the header table is not also called with a multimap.
+ */
+TEST_F(MIMEParserTest, test_headerTableWithSplitHeaders) {
+    std::vector<std::string> partHeaders{
+        "Content-Type: application/octet-stream", "Content-ID: <audio-1>", key3 + SEPARATOR + value3};
+    auto body = buildMimeBody(boundary, {{partHeaders, payload2}, {{header1}, payload1}});
+
+    auto sink = std::make_shared<HeaderTableSink>();
+    sink->m_recordHeaders = true;
+    HTTP2MimeResponseDecoder decoder{sink};
+    ASSERT_TRUE(decoder.onReceiveHeaderLine(BOUNDARY_HEADER_PREFIX + boundary));
+    decoder.onReceiveResponseCode(HTTPResponseCode::SUCCESS_OK);
+    ASSERT_EQ(HTTP2ReceiveDataStatus::SUCCESS, feedInChunks(decoder, body, 1));
+
+    ASSERT_EQ(2u, sink->m_parts);
+    ASSERT_EQ(0u, sink->m_multimapParts);
+    ASSERT_EQ(1u, sink->m_attachmentParts);
+    ASSERT_EQ(payload1.size() + payload2.size(), sink->m_dataSize);
+    ASSERT_EQ(std::vector<std::string>{header1}, sink->m_headers);
+    ASSERT_FALSE(sink->m_overflowed);
+}
+
+/**
+ * Verify the lookups of @c HTTP2MimePartHeaders, and that headers beyond the capacity of the table are dropped and
+ * reported rather than overflowing it.
+ */
+TEST_F(MIMEParserTest, test_headerTableOverflow) {
+    HTTP2MimePartHeaders headers;
+    const size_t headerCount = HTTP2MimePartHeaders::MAX_HEADERS + 2;
+    for (size_t i = 0; i < headerCount; ++i) {
+        headers.appendName("X-Hea", 5);
+        headers.appendName("der", 3);
+        auto value = std::to_string(i);
+        headers.appendValue(value.data(), value.size());
+        headers.endHeader();
+    }
+    ASSERT_EQ(HTTP2MimePartHeaders::MAX_HEADERS, headers.getCount());
+    ASSERT_TRUE(headers.hasOverflowed());
+    ASSERT_EQ(HTTP2MimePartHeaders::MAX_HEADERS, headers.count("x-header"));
+    HTTP2MimePartHeaders::Text value;
+    ASSERT_TRUE(headers.find("X-HEADER", &value));
+    ASSERT_EQ("0", value.str());
+    ASSERT_FALSE(headers.find("Content-Type", &value));
+    ASSERT_EQ(HTTP2MimePartHeaders::MAX_HEADERS, headers.toMultimap().size());
+
+    headers.clear();
+    ASSERT_EQ(0u, headers.getCount());
+    ASSERT_FALSE(headers.hasOverflowed());
+    std::string longValue(HTTP2MimePartHeaders::TEXT_SIZE, 'a');
+    headers.appendName("Content-ID", 10);
+    headers.appendValue(longValue.data(), longValue.size());
+    headers.endHeader();
+    ASSERT_EQ(0u, headers.getCount());
+    ASSERT_TRUE(headers.hasOverflowed());
+}
+
+/// The size of the chunks fed to the decoder when counting allocations, similar to the HTTP/2 frames received from AVS.
+static const size_t DECODE_CHUNK_SIZE = 16 * 1024;
+
+/// The size of the audio attachment in the Speak response decoded when counting allocations.
+static const size_t SPEAK_ATTACHMENT_SIZE = 200 * 1024;
+
+/// The number of times the Speak response is decoded when counting allocations.
+static const int ALLOCATION_TEST_ITERATIONS = 20;
+
+/// The number of times the benchmarks decode the Speak response.
+static const int BENCHMARK_ITERATIONS = 500;
+
+/**
+ * Build a typical Speak response: a JSON directive followed by its audio attachment.
+ *
+ * @return The response body.
+ */
+static std::string buildSpeakResponseBody() {
+    const std::string directive =
+        "{\"directive\":{\"header\":{\"namespace\":\"SpeechSynthesizer\",\"name\":\"Speak\","
+        "\"messageId\":\"7a2dd8a4-3b5e-4cb8-9d3c-4a3f5b3f2f11\",\"dialogRequestId\":"
+        "\"d7a2f0a6-0c55-4c1c-8c28-8b8cf9a8bd47\"},\"payload\":{\"url\":\"cid:DeviceTTSRendererV4_"
+        "0f1e2d3c-4b5a-6978-8796-a5b4c3d2e1f0\",\"format\":\"AUDIO_MPEG\",\"token\":\"amzn1.as-ct.v1.ThirdPartySdk"
+        "SpeakDirective#ACRI#DeviceTTSRendererV4_0f1e2d3c-4b5a-6978-8796-a5b4c3d2e1f0\"}}}";
+    std::string audio;
+    audio.reserve(SPEAK_ATTACHMENT_SIZE);
+    std::mt19937 generator(1);
+    std::uniform_int_distribution<int> distribution(0, 255);
+    for (size_t i = 0; i < SPEAK_ATTACHMENT_SIZE; ++i) {
+        audio.push_back(static_cast<char>(distribution(generator)));
+    }
+    return buildMimeBody(
+        MIME_TEST_BOUNDARY_STRING,
+        {{{"Content-Type: application/json; charset=UTF-8"}, directive},
+         {{"Content-Type: application/octet-stream",
+           "Content-ID: <DeviceTTSRendererV4_0f1e2d3c-4b5a-6978-8796-a5b4c3d2e1f0>"},
+          audio}});
+}
+
+/**
+ * Decode a response repeatedly with debug logging turned off, after decoding it once to warm up, so that buffers which
+ * keep their capacity between parts have grown.
+ *
+ * @param body The response body.
+ * @param sink The sink to decode into.
+ * @param iterations The number of times to decode the response after warming up.
+ * @return The average number of allocations made per chunk fed to the decoder after warming up.
+ */
+static double decodeRepeatedly(
+    const std::string& body,
+    std::shared_ptr<HTTP2MimeResponseSinkInterface> sink,
+    int iterations) {
+    // Debug logs are formatted as they are emitted, which would dominate the allocations counted.
+    auto logger = ACSDK_GET_LOGGER_FUNCTION();
+    auto previousLevel = Level::NONE;
+    for (int level = static_cast<int>(Level::DEBUG9); level < static_cast<int>(Level::NONE); ++level) {
+        if (logger->shouldLog(static_cast<Level>(level))) {
+            previousLevel = static_cast<Level>(level);
+            break;
+        }
+    }
+    logger->setLevel(Level::WARN);
+
+    const std::string boundaryHeader{BOUNDARY_HEADER_PREFIX + MIME_TEST_BOUNDARY_STRING};
+    {
+        HTTP2MimeResponseDecoder decoder{sink};
+        decoder.onReceiveHeaderLine(boundaryHeader);
+        decoder.onReceiveResponseCode(HTTPResponseCode::SUCCESS_OK);
+        EXPECT_EQ(HTTP2ReceiveDataStatus::SUCCESS, feedInChunks(decoder, body, DECODE_CHUNK_SIZE));
+    }
+
+    size_t allocations = 0;
+    for (int i = 0; i < iterations; ++i) {
+        HTTP2MimeResponseDecoder decoder{sink};
+        decoder.onReceiveHeaderLine(boundaryHeader);
+        decoder.onReceiveResponseCode(HTTPResponseCode::SUCCESS_OK);
+        size_t before = g_allocations;
+        auto status = feedInChunks(decoder, body, DECODE_CHUNK_SIZE);
+        allocations += g_allocations - before;
+        EXPECT_EQ(HTTP2ReceiveDataStatus::SUCCESS, status);
+    }
+    logger->setLevel(previousLevel);
+
+    auto chunks = iterations * ((body.size() + DECODE_CHUNK_SIZE - 1) / DECODE_CHUNK_SIZE);
+    return static_cast<double>(allocations) / chunks;
+}
+
+/**
+ * Verify that decoding a typical Speak response into a sink which reads the header table allocates less than once per
+ * chunk, while decoding it into a sink which takes the headers as a multimap allocates more.
+ */
+TEST_F(MIMEParserTest, test_decodeWithHeaderTableAllocatesLessThanOncePerChunk) {
+    auto body = buildSpeakResponseBody();
+
+    auto multimapSink = std::make_shared<HeaderTableSink>();
+    multimapSink->m_useHeaderTable = false;
+    auto multimapAllocations = decodeRepeatedly(body, multimapSink, ALLOCATION_TEST_ITERATIONS);
+    auto tableSink = std::make_shared<HeaderTableSink>();
+    auto tableAllocations = decodeRepeatedly(body, tableSink, ALLOCATION_TEST_ITERATIONS);
+
+    EXPECT_EQ(static_cast<size_t>(ALLOCATION_TEST_ITERATIONS + 1), tableSink->m_attachmentParts);
+    EXPECT_EQ(0u, tableSink->m_multimapParts);
+    EXPECT_LT(tableAllocations, 1.0);
+    EXPECT_LT(tableAllocations, multimapAllocations);
+}
+
+/**
+ * Benchmark decoding a typical Speak response into a sink which takes the headers as a multimap.
+ */
+TEST_F(MIMEParserTest, testSlow_benchmarkDecodeWithMultimapHeaders) {
+    auto sink = std::make_shared<HeaderTableSink>();
+    sink->m_useHeaderTable = false;
+    decodeRepeatedly(buildSpeakResponseBody(), sink, BENCHMARK_ITERATIONS);
+    EXPECT_EQ(static_cast<size_t>(2 * (BENCHMARK_ITERATIONS + 1)), sink->m_multimapParts);
+}
+
+/**
+ * Benchmark decoding a typical Speak response into a sink which reads the header table.
+ */
+TEST_F(MIMEParserTest, testSlow_benchmarkDecodeWithHeaderTable) {
+    auto sink = std::make_shared<HeaderTableSink>();
+    EXPECT_LT(decodeRepeatedly(buildSpeakResponseBody(), sink, BENCHMARK_ITERATIONS), 1.0);
+    EXPECT_EQ(static_cast<size_t>(BENCHMARK_ITERATIONS + 1), sink->m_attachmentParts);
+}
+
 }  // namespace test
 }  // namespace avsCommon
 }  // namespace alexaClientSDK
@@ -0,0 +1,99 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/JSON/PooledJSONDocument.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace json {
+namespace test {
+
+/**
+ * Verify that a valid JSON string is parsed.
+ */
+TEST(PooledJSONDocumentTest, test_parseValidJson) {
+    auto document = PooledJSONDocument::parse(R"({"key":"value","array":[1,2,3]})");
+    ASSERT_NE(document, nullptr);
+    auto& root = document->getDocument();
+    ASSERT_TRUE(root.IsObject());
+    EXPECT_STREQ(root["key"].GetString(), "value");
+    ASSERT_TRUE(root["array"].IsArray());
+    EXPECT_EQ(root["array"].Size(), 3u);
+}
+
+/**
+ * Verify that parsing a string which is not valid JSON fails.
+ */
+TEST(PooledJSONDocumentTest, test_parseInvalidJson) {
+    EXPECT_EQ(PooledJSONDocument::parse("{\"key\":"), nullptr);
+    EXPECT_EQ(PooledJSONDocument::parse(""), nullptr);
+}
+
+/**
+ * Verify that a document larger than the arena spills over into the heap and is parsed correctly.
+ */
+TEST(PooledJSONDocumentTest, test_parseDocumentLargerThanArena) {
+    std::string json = "[";
+    const size_t count = PooledJSONDocument::ARENA_SIZE / 4;
+    for (size_t i = 0; i < count; ++i) {
+        json += (i ? ",\"" : "\"") + std::to_string(i) + "\"";
+    }
+    json += "]";
+
+    auto document = PooledJSONDocument::parse(json);
+    ASSERT_NE(document, nullptr);
+    auto& root = document->getDocument();
+    ASSERT_TRUE(root.IsArray());
+    ASSERT_EQ(root.Size(), count);
+    EXPECT_EQ(std::string(root[static_cast<rapidjson::SizeType>(count - 1)].GetString()), std::to_string(count - 1));
+}
+
+/**
+ * Verify that the arenas of destroyed documents are returned to the pool, up to its limit.
+ */
+TEST(PooledJSONDocumentTest, test_arenasAreReturnedToPool) {
+    if (!PooledJSONDocument::usesArena()) {
+        // rapidjson is built with an allocator which cannot use an arena, so there is nothing to pool.
+        EXPECT_EQ(PooledJSONDocument::getPooledArenaCount(), 0u);
+        return;
+    }
+
+    std::vector<std::shared_ptr<PooledJSONDocument>> documents;
+    for (size_t i = 0; i < PooledJSONDocument::MAX_POOLED_ARENAS * 2; ++i) {
+        documents.push_back(PooledJSONDocument::create());
+    }
+    EXPECT_EQ(PooledJSONDocument::getPooledArenaCount(), 0u);
+
+    documents.clear();
+    EXPECT_EQ(PooledJSONDocument::getPooledArenaCount(), PooledJSONDocument::MAX_POOLED_ARENAS);
+
+    auto document = PooledJSONDocument::parse(R"({"key":"value"})");
+    ASSERT_NE(document, nullptr);
+    EXPECT_EQ(PooledJSONDocument::getPooledArenaCount(), PooledJSONDocument::MAX_POOLED_ARENAS - 1);
+}
+
+}  // namespace test
+}  // namespace json
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
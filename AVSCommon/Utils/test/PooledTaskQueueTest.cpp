@@ -0,0 +1,76 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/Threading/PooledTaskQueue.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+namespace test {
+
+/// Test that tasks are popped in FIFO order, with tasks pushed to the front first.
+TEST(PooledTaskQueueTest, test_order) {
+    PooledTaskQueue queue;
+    std::vector<int> order;
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.popFront());
+
+    queue.pushBack([&order] { order.push_back(1); });
+    queue.pushBack([&order] { order.push_back(2); });
+    queue.pushFront([&order] { order.push_back(0); });
+    EXPECT_FALSE(queue.empty());
+    while (auto task = queue.popFront()) {
+        task();
+    }
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(order, (std::vector<int>{0, 1, 2}));
+
+    // The queue remains usable after being drained through its recycled nodes.
+    queue.pushFront([&order] { order.push_back(3); });
+    queue.pushBack([&order] { order.push_back(4); });
+    while (auto task = queue.popFront()) {
+        task();
+    }
+    EXPECT_EQ(order, (std::vector<int>{0, 1, 2, 3, 4}));
+}
+
+/// Test that clear destroys queued tasks without running them.
+TEST(PooledTaskQueueTest, test_clear) {
+    PooledTaskQueue queue{1};
+    auto value = std::make_shared<int>(0);
+    std::weak_ptr<int> weakValue = value;
+    bool ran = false;
+    for (int i = 0; i < 4; ++i) {
+        queue.pushBack([value, &ran] { ran = true; });
+    }
+    value.reset();
+    EXPECT_FALSE(weakValue.expired());
+    queue.clear();
+    EXPECT_TRUE(queue.empty());
+    EXPECT_TRUE(weakValue.expired());
+    EXPECT_FALSE(ran);
+}
+
+}  // namespace test
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -18,6 +18,7 @@
 #include <algorithm>
 #include <chrono>
 #include <climits>
+#include <cstring>
 #include <functional>
 #include <random>
 #include <unordered_map>
@@ -1132,6 +1133,148 @@ TEST_F(SharedDataStreamTest, test_writerGetWordSize) {
     }
 }
 
+/// This tests @c SharedDataStream::Reader::peek() and @c SharedDataStream::Reader::consume().
+TEST_F(SharedDataStreamTest, test_readerPeekAndConsume) {
+    static const size_t WORDSIZE = 2;
+    static const size_t WORDCOUNT = 4;
+    static const size_t MAXREADERS = 1;
+    static const std::chrono::milliseconds TIMEOUT{10};
+
+    // Initialize an sds.
+    size_t bufferSize = Sds::calculateBufferSize(WORDCOUNT, WORDSIZE, MAXREADERS);
+    auto buffer = std::make_shared<Sds::Buffer>(bufferSize);
+    auto sds = Sds::create(buffer, WORDSIZE, MAXREADERS);
+    ASSERT_NE(sds, nullptr);
+
+    auto writer = sds->createWriter(Sds::Writer::Policy::ALL_OR_NOTHING);
+    ASSERT_NE(writer, nullptr);
+    auto reader = sds->createReader(Sds::Reader::Policy::BLOCKING);
+    ASSERT_NE(reader, nullptr);
+
+    // Verify bad parameter handling and timeout with no data.
+    Sds::Spans spans;
+    ASSERT_EQ(reader->peek(nullptr, WORDCOUNT), Sds::Reader::Error::INVALID);
+    ASSERT_EQ(reader->peek(&spans, 0), Sds::Reader::Error::INVALID);
+    ASSERT_EQ(reader->peek(&spans, WORDCOUNT, TIMEOUT), Sds::Reader::Error::TIMEDOUT);
+    ASSERT_EQ(spans[0].nWords, 0U);
+    ASSERT_EQ(spans[1].nWords, 0U);
+
+    // Write three words and verify they are exposed in a single span without being consumed.
+    uint16_t writeBuf[WORDCOUNT] = {1, 2, 3, 4};
+    ASSERT_EQ(writer->write(writeBuf, 3), 3);
+    ASSERT_EQ(reader->peek(&spans, WORDCOUNT), 3);
+    ASSERT_EQ(spans[0].nWords, 3U);
+    ASSERT_EQ(spans[1].nWords, 0U);
+    ASSERT_EQ(memcmp(spans[0].data, writeBuf, 3 * WORDSIZE), 0);
+    ASSERT_EQ(reader->tell(), 0U);
+    ASSERT_EQ(reader->peek(&spans, 2), 2);
+
+    // Verify consume() validates its argument and advances the reader.
+    ASSERT_EQ(reader->consume(4), Sds::Reader::Error::INVALID);
+    ASSERT_EQ(reader->consume(2), 2);
+    ASSERT_EQ(reader->tell(), 2U);
+
+    // Write across the wrap and verify that two spans are returned in order.
+    ASSERT_EQ(writer->write(writeBuf, 3), 3);
+    ASSERT_EQ(reader->peek(&spans, WORDCOUNT), 4);
+    ASSERT_EQ(spans[0].nWords, 2U);
+    ASSERT_EQ(spans[1].nWords, 2U);
+    uint16_t expected[WORDCOUNT] = {3, 1, 2, 3};
+    ASSERT_EQ(memcmp(spans[0].data, expected, 2 * WORDSIZE), 0);
+    ASSERT_EQ(memcmp(spans[1].data, expected + 2, 2 * WORDSIZE), 0);
+    ASSERT_EQ(reader->consume(4), 4);
+
+    // Verify a closed writer is reported once everything has been consumed.
+    writer->close();
+    ASSERT_EQ(reader->peek(&spans, WORDCOUNT), Sds::Reader::Error::CLOSED);
+}
+
+/// This tests that @c SharedDataStream::Reader::consume() reports data overwritten after @c peek().
+TEST_F(SharedDataStreamTest, test_readerConsumeDetectsOverrun) {
+    static const size_t WORDSIZE = 1;
+    static const size_t WORDCOUNT = 4;
+    static const size_t MAXREADERS = 1;
+
+    size_t bufferSize = Sds::calculateBufferSize(WORDCOUNT, WORDSIZE, MAXREADERS);
+    auto buffer = std::make_shared<Sds::Buffer>(bufferSize);
+    auto sds = Sds::create(buffer, WORDSIZE, MAXREADERS);
+    ASSERT_NE(sds, nullptr);
+
+    auto writer = sds->createWriter(Sds::Writer::Policy::NONBLOCKABLE);
+    ASSERT_NE(writer, nullptr);
+    auto reader = sds->createReader(Sds::Reader::Policy::NONBLOCKING);
+    ASSERT_NE(reader, nullptr);
+
+    uint8_t writeBuf[WORDCOUNT * 2] = {};
+    ASSERT_EQ(writer->write(writeBuf, WORDCOUNT), static_cast<ssize_t>(WORDCOUNT));
+    Sds::Spans spans;
+    ASSERT_EQ(reader->peek(&spans, 1), 1);
+
+    // The writer overwrites the peeked word before it is consumed.
+    ASSERT_EQ(writer->write(writeBuf, WORDCOUNT + 1), static_cast<ssize_t>(WORDCOUNT));
+    ASSERT_EQ(reader->consume(1), Sds::Reader::Error::OVERRUN);
+}
+
+/// This tests @c SharedDataStream::Writer::reserve() and @c SharedDataStream::Writer::commit().
+TEST_F(SharedDataStreamTest, test_writerReserveAndCommit) {
+    static const size_t WORDSIZE = 2;
+    static const size_t WORDCOUNT = 4;
+    static const size_t MAXREADERS = 1;
+
+    size_t bufferSize = Sds::calculateBufferSize(WORDCOUNT, WORDSIZE, MAXREADERS);
+    auto buffer = std::make_shared<Sds::Buffer>(bufferSize);
+    auto sds = Sds::create(buffer, WORDSIZE, MAXREADERS);
+    ASSERT_NE(sds, nullptr);
+
+    auto writer = sds->createWriter(Sds::Writer::Policy::ALL_OR_NOTHING);
+    ASSERT_NE(writer, nullptr);
+    auto reader = sds->createReader(Sds::Reader::Policy::NONBLOCKING);
+    ASSERT_NE(reader, nullptr);
+
+    // Verify bad parameter handling.
+    Sds::Spans spans;
+    ASSERT_EQ(writer->reserve(nullptr, WORDCOUNT), Sds::Writer::Error::INVALID);
+    ASSERT_EQ(writer->reserve(&spans, 0), Sds::Writer::Error::INVALID);
+    ASSERT_EQ(writer->commit(1), Sds::Writer::Error::INVALID);
+
+    // Reserve three words; they must not be visible to the reader until committed.
+    ASSERT_EQ(writer->reserve(&spans, 3), 3);
+    ASSERT_EQ(spans[0].nWords, 3U);
+    ASSERT_EQ(spans[1].nWords, 0U);
+    uint16_t values[3] = {7, 8, 9};
+    memcpy(spans[0].data, values, sizeof(values));
+    Sds::Spans secondSpans;
+    ASSERT_EQ(writer->reserve(&secondSpans, 1), Sds::Writer::Error::INVALID);
+    ASSERT_EQ(writer->write(values, 1), Sds::Writer::Error::INVALID);
+    uint16_t readBuf[WORDCOUNT];
+    ASSERT_EQ(reader->read(readBuf, WORDCOUNT), Sds::Reader::Error::WOULDBLOCK);
+
+    // Commit only part of the reservation and verify the rest is released.
+    ASSERT_EQ(writer->commit(4), Sds::Writer::Error::INVALID);
+    ASSERT_EQ(writer->commit(2), 2);
+    ASSERT_EQ(writer->tell(), 2U);
+    ASSERT_EQ(reader->read(readBuf, WORDCOUNT), 2);
+    ASSERT_EQ(readBuf[0], 7);
+    ASSERT_EQ(readBuf[1], 8);
+
+    // Reserve across the wrap; the reservation is capped at the buffer size.
+    ASSERT_EQ(writer->reserve(&spans, WORDCOUNT * 2), static_cast<ssize_t>(WORDCOUNT));
+    ASSERT_EQ(spans[0].nWords, 2U);
+    ASSERT_EQ(spans[1].nWords, 2U);
+    uint16_t wrapValues[WORDCOUNT] = {1, 2, 3, 4};
+    memcpy(spans[0].data, wrapValues, 2 * WORDSIZE);
+    memcpy(spans[1].data, wrapValues + 2, 2 * WORDSIZE);
+    ASSERT_EQ(writer->commit(WORDCOUNT), static_cast<ssize_t>(WORDCOUNT));
+    ASSERT_EQ(reader->read(readBuf, WORDCOUNT), static_cast<ssize_t>(WORDCOUNT));
+    ASSERT_EQ(memcmp(readBuf, wrapValues, sizeof(wrapValues)), 0);
+
+    // Verify an all-or-nothing writer can't reserve over unconsumed data, and that a closed writer can't reserve.
+    ASSERT_EQ(writer->write(wrapValues, 1), 1);
+    ASSERT_EQ(writer->reserve(&spans, WORDCOUNT), Sds::Writer::Error::WOULDBLOCK);
+    writer->close();
+    ASSERT_EQ(writer->reserve(&spans, 1), Sds::Writer::Error::CLOSED);
+}
+
 // Disabled test due to ACSDK-3414
 /// This tests a nonblockable, slow @c Writer streaming concurrently to two fast @c Readers (one of each type).
 TEST_F(SharedDataStreamTest, DISABLED_testTimer_concurrencyNonblockableWriterDualReader) {
@@ -1317,6 +1460,88 @@ TEST_F(SharedDataStreamTest, test_firstReaderCanSeekSDSBeginning) {
     EXPECT_TRUE(reader->seek(0, Sds::Reader::Reference::ABSOLUTE));
 }
 
+/// This tests that the data available callback of a @c Reader is called when a @c Writer writes or closes, and is
+/// no longer called once it is cleared or the @c Reader is destroyed.
+TEST_F(SharedDataStreamTest, test_dataAvailableCallback) {
+    static const size_t WORDSIZE = 2;
+    static const size_t WORDCOUNT = 4;
+    static const size_t MAXREADERS = 2;
+
+    size_t bufferSize = Sds::calculateBufferSize(WORDCOUNT, WORDSIZE, MAXREADERS);
+    auto buffer = std::make_shared<Sds::Buffer>(bufferSize);
+    auto sds = Sds::create(buffer, WORDSIZE, MAXREADERS);
+    ASSERT_NE(sds, nullptr);
+
+    auto writer = sds->createWriter(Sds::Writer::Policy::NONBLOCKABLE);
+    ASSERT_NE(writer, nullptr);
+    auto reader = sds->createReader(Sds::Reader::Policy::NONBLOCKING);
+    ASSERT_NE(reader, nullptr);
+    auto otherReader = sds->createReader(Sds::Reader::Policy::NONBLOCKING);
+    ASSERT_NE(otherReader, nullptr);
+
+    int readerCalls = 0;
+    int otherReaderCalls = 0;
+    reader->setDataAvailableCallback([&readerCalls] { ++readerCalls; });
+    otherReader->setDataAvailableCallback([&otherReaderCalls] { ++otherReaderCalls; });
+
+    uint8_t writeBuf[WORDSIZE] = {1, 2};
+    EXPECT_EQ(writer->write(writeBuf, 1), 1);
+    EXPECT_EQ(readerCalls, 1);
+    EXPECT_EQ(otherReaderCalls, 1);
+
+    // A cleared callback is no longer called.
+    otherReader->setDataAvailableCallback(nullptr);
+    EXPECT_EQ(writer->write(writeBuf, 1), 1);
+    EXPECT_EQ(readerCalls, 2);
+    EXPECT_EQ(otherReaderCalls, 1);
+
+    // The callback of a destroyed reader is no longer called, and a new reader with the same id does not inherit it.
+    reader.reset();
+    reader = sds->createReader(Sds::Reader::Policy::NONBLOCKING);
+    ASSERT_NE(reader, nullptr);
+    otherReader->setDataAvailableCallback([&otherReaderCalls] { ++otherReaderCalls; });
+    writer->close();
+    EXPECT_EQ(readerCalls, 2);
+    EXPECT_EQ(otherReaderCalls, 2);
+}
+
+/// This tests that the space available callback of a @c Writer is called when a @c Reader consumes data, and is no
+/// longer called once the @c Writer is closed.
+TEST_F(SharedDataStreamTest, test_spaceAvailableCallback) {
+    static const size_t WORDSIZE = 2;
+    static const size_t WORDCOUNT = 4;
+    static const size_t MAXREADERS = 1;
+
+    size_t bufferSize = Sds::calculateBufferSize(WORDCOUNT, WORDSIZE, MAXREADERS);
+    auto buffer = std::make_shared<Sds::Buffer>(bufferSize);
+    auto sds = Sds::create(buffer, WORDSIZE, MAXREADERS);
+    ASSERT_NE(sds, nullptr);
+
+    auto writer = sds->createWriter(Sds::Writer::Policy::ALL_OR_NOTHING);
+    ASSERT_NE(writer, nullptr);
+    auto reader = sds->createReader(Sds::Reader::Policy::NONBLOCKING);
+    ASSERT_NE(reader, nullptr);
+
+    int writerCalls = 0;
+    writer->setSpaceAvailableCallback([&writerCalls] { ++writerCalls; });
+
+    std::vector<uint8_t> writeBuf(WORDCOUNT * WORDSIZE);
+    EXPECT_EQ(writer->write(writeBuf.data(), WORDCOUNT), static_cast<ssize_t>(WORDCOUNT));
+    EXPECT_EQ(writer->write(writeBuf.data(), 1), Sds::Writer::Error::WOULDBLOCK);
+    EXPECT_EQ(writerCalls, 0);
+
+    // Consuming a word frees space for the writer.
+    uint8_t readBuf[WORDSIZE];
+    EXPECT_EQ(reader->read(readBuf, 1), 1);
+    EXPECT_EQ(writerCalls, 1);
+    EXPECT_EQ(writer->write(writeBuf.data(), 1), 1);
+
+    // The callback of a closed writer is no longer called.
+    writer->close();
+    EXPECT_EQ(reader->read(readBuf, 1), 1);
+    EXPECT_EQ(writerCalls, 1);
+}
+
 }  // namespace test
 }  // namespace sds
 }  // namespace utils
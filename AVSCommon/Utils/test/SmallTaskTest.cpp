@@ -0,0 +1,114 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/Threading/SmallTask.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+namespace test {
+
+/// Test that a default constructed task is empty.
+TEST(SmallTaskTest, test_defaultIsEmpty) {
+    SmallTask task;
+    EXPECT_FALSE(task);
+    EXPECT_FALSE(task.isInline());
+    SmallTask nullTask{nullptr};
+    EXPECT_FALSE(nullTask);
+}
+
+/// Test that a small lambda is stored inline and invoked.
+TEST(SmallTaskTest, test_smallCallableIsInline) {
+    int calls = 0;
+    SmallTask task{[&calls] { calls++; }};
+    ASSERT_TRUE(task);
+    EXPECT_TRUE(task.isInline());
+    task();
+    task();
+    EXPECT_EQ(calls, 2);
+}
+
+/// Test that a callable larger than the inline buffer is stored on the heap and invoked.
+TEST(SmallTaskTest, test_largeCallableIsOnHeap) {
+    struct Large {
+        char data[SmallTask::INLINE_SIZE + 1];
+    };
+    Large large;
+    large.data[0] = 'x';
+    char seen = 0;
+    SmallTask task{[large, &seen] { seen = large.data[0]; }};
+    ASSERT_TRUE(task);
+    EXPECT_FALSE(task.isInline());
+    task();
+    EXPECT_EQ(seen, 'x');
+}
+
+/// Test that a move-only callable can be wrapped, and that moving a task transfers ownership of its captures.
+TEST(SmallTaskTest, test_moveTransfersCallable) {
+    auto value = std::make_shared<int>(42);
+    std::weak_ptr<int> weakValue = value;
+    std::unique_ptr<int> moveOnly{new int(7)};
+    int seen = 0;
+    struct MoveOnlyCallable {
+        std::shared_ptr<int> value;
+        std::unique_ptr<int> moveOnly;
+        int* seen;
+        void operator()() {
+            *seen = *value + *moveOnly;
+        }
+    };
+    SmallTask first{MoveOnlyCallable{std::move(value), std::move(moveOnly), &seen}};
+    SmallTask second{std::move(first)};
+    EXPECT_FALSE(first);
+    ASSERT_TRUE(second);
+    second();
+    EXPECT_EQ(seen, 49);
+
+    SmallTask third;
+    third = std::move(second);
+    EXPECT_FALSE(second);
+    EXPECT_FALSE(weakValue.expired());
+    third = nullptr;
+    EXPECT_TRUE(weakValue.expired());
+}
+
+/// Test that destroying a heap stored task releases its captures.
+TEST(SmallTaskTest, test_heapCallableIsDestroyed) {
+    auto value = std::make_shared<std::string>(SmallTask::INLINE_SIZE * 2, 'a');
+    std::weak_ptr<std::string> weakValue = value;
+    {
+        struct Large {
+            char data[SmallTask::INLINE_SIZE];
+        };
+        Large large;
+        SmallTask task{[large, value] { (void)large; }};
+        EXPECT_FALSE(task.isInline());
+        value.reset();
+        EXPECT_FALSE(weakValue.expired());
+    }
+    EXPECT_TRUE(weakValue.expired());
+}
+
+}  // namespace test
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
@@ -0,0 +1,273 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+/// @file TimerWheelTest.cpp
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/Timing/Timer.h"
+#include "AVSCommon/Utils/Timing/TimerWheel.h"
+#include "AVSCommon/Utils/Timing/TimerWheelDelegateFactory.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace timing {
+namespace test {
+
+/// A delay long enough for an entry to be placed above level 0 of the wheel.
+static const auto LEVEL_ONE_DELAY = std::chrono::milliseconds(150);
+
+/// A short delay.
+static const auto SHORT_DELAY = std::chrono::milliseconds(20);
+
+/// Used to limit the amount of time tests will wait for an operation to finish.
+static const auto TIMEOUT = std::chrono::seconds(2);
+
+/// Number of timers to run in the tests with many timers.
+static const size_t MANY_TIMERS = 500;
+
+/// The most threads the tests with many timers expect the callbacks to be spread over, even on a loaded machine.
+static const size_t MAX_CALLBACK_THREADS = 10;
+
+/// Records the expiries of entries on a @c TimerWheel.
+class Expiries {
+public:
+    /**
+     * Records an expiry.
+     *
+     * @param index The index of the entry which expired.
+     */
+    void record(size_t index) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_indices.push_back(index);
+        m_times.push_back(std::chrono::steady_clock::now());
+        m_threads.insert(std::this_thread::get_id());
+        m_condition.notify_all();
+    }
+
+    /**
+     * Waits for a number of expiries.
+     *
+     * @param count The number of expiries to wait for.
+     * @return Whether @c count expiries were recorded before @c TIMEOUT.
+     */
+    bool waitFor(size_t count) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        return m_condition.wait_for(lock, TIMEOUT, [this, count] { return m_indices.size() >= count; });
+    }
+
+    /// Mutex protecting the members below.
+    std::mutex m_mutex;
+
+    /// Notified on each expiry.
+    std::condition_variable m_condition;
+
+    /// The indices of the entries which expired, in order of expiry.
+    std::vector<size_t> m_indices;
+
+    /// The times of the expiries.
+    std::vector<std::chrono::steady_clock::time_point> m_times;
+
+    /// The threads the expiries happened on.
+    std::set<std::thread::id> m_threads;
+};
+
+/// Test harness for @c TimerWheel.
+class TimerWheelTest : public ::testing::Test {
+protected:
+    /// Set up the test harness for running a test.
+    void SetUp() override {
+        m_wheel = std::make_shared<TimerWheel>();
+    }
+
+    /**
+     * Adds entries which record their expiry in @c m_expiries.
+     *
+     * @param count The number of entries to add.
+     */
+    void addEntries(size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            auto index = m_entries.size();
+            m_entries.emplace_back(new TimerWheel::Entry([this, index] { m_expiries.record(index); }));
+        }
+    }
+
+    /// Records the expiries.
+    Expiries m_expiries;
+
+    /// The wheel under test.
+    std::shared_ptr<TimerWheel> m_wheel;
+
+    /// The entries used in the test.  Declared last so that they are cancelled before the wheel is destroyed.
+    std::vector<std::unique_ptr<TimerWheel::Entry>> m_entries;
+};
+
+/// Verify that entries expire in deadline order, and not before their deadline, including across levels.
+TEST_F(TimerWheelTest, test_entriesExpireInOrder) {
+    addEntries(4);
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::chrono::milliseconds> delays = {
+        LEVEL_ONE_DELAY + SHORT_DELAY, SHORT_DELAY, LEVEL_ONE_DELAY, std::chrono::milliseconds(0)};
+    for (size_t i = 0; i < delays.size(); ++i) {
+        m_wheel->schedule(m_entries[i].get(), start + delays[i]);
+    }
+    ASSERT_TRUE(m_expiries.waitFor(delays.size()));
+
+    std::lock_guard<std::mutex> lock(m_expiries.m_mutex);
+    EXPECT_EQ(m_expiries.m_indices, (std::vector<size_t>{3, 1, 2, 0}));
+    for (size_t i = 0; i < m_expiries.m_indices.size(); ++i) {
+        auto elapsed = m_expiries.m_times[i] - start;
+        auto delay = delays[m_expiries.m_indices[i]];
+        EXPECT_GE(elapsed, delay);
+    }
+    EXPECT_EQ(m_wheel->getNumScheduled(), 0u);
+}
+
+/// Verify that cancelled entries do not expire, and that rescheduling an entry moves its expiry.
+TEST_F(TimerWheelTest, test_cancelAndReschedule) {
+    addEntries(3);
+    auto start = std::chrono::steady_clock::now();
+    m_wheel->schedule(m_entries[0].get(), start + SHORT_DELAY);
+    m_wheel->schedule(m_entries[1].get(), start + SHORT_DELAY);
+    m_wheel->schedule(m_entries[2].get(), start + LEVEL_ONE_DELAY);
+    EXPECT_EQ(m_wheel->getNumScheduled(), 3u);
+
+    m_wheel->cancel(m_entries[0].get());
+    m_wheel->schedule(m_entries[2].get(), start);
+    EXPECT_EQ(m_wheel->getNumScheduled(), 2u);
+
+    ASSERT_TRUE(m_expiries.waitFor(2));
+    std::this_thread::sleep_for(LEVEL_ONE_DELAY);
+    std::lock_guard<std::mutex> lock(m_expiries.m_mutex);
+    EXPECT_EQ(m_expiries.m_indices, (std::vector<size_t>{2, 1}));
+}
+
+/// Verify that cancelling an entry whose callback is running waits for the callback to return.
+TEST_F(TimerWheelTest, test_cancelWaitsForCallback) {
+    std::atomic<bool> inCallback{false};
+    std::atomic<bool> callbackDone{false};
+    TimerWheel::Entry entry([&] {
+        inCallback = true;
+        std::this_thread::sleep_for(SHORT_DELAY * 2);
+        callbackDone = true;
+    });
+    m_wheel->schedule(&entry, std::chrono::steady_clock::now());
+    while (!inCallback) {
+        std::this_thread::yield();
+    }
+    m_wheel->cancel(&entry);
+    EXPECT_TRUE(callbackDone);
+}
+
+/// Verify that many entries with spread out deadlines all expire, on far fewer threads than there are entries.
+TEST_F(TimerWheelTest, test_manyEntriesExpireOnFewThreads) {
+    addEntries(MANY_TIMERS);
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < MANY_TIMERS; ++i) {
+        m_wheel->schedule(m_entries[i].get(), start + std::chrono::milliseconds(i % 200));
+    }
+    ASSERT_TRUE(m_expiries.waitFor(MANY_TIMERS));
+    std::lock_guard<std::mutex> lock(m_expiries.m_mutex);
+    EXPECT_LE(m_expiries.m_threads.size(), MAX_CALLBACK_THREADS);
+}
+
+/// Verify that a callback which blocks does not stop other entries from expiring.
+TEST_F(TimerWheelTest, test_blockedCallbackDoesNotHoldUpOthers) {
+    addEntries(1);
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool released = false;
+    TimerWheel::Entry blocking([&] {
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait_for(lock, TIMEOUT, [&released] { return released; });
+    });
+    auto start = std::chrono::steady_clock::now();
+    m_wheel->schedule(&blocking, start);
+    m_wheel->schedule(m_entries[0].get(), start + SHORT_DELAY);
+
+    EXPECT_TRUE(m_expiries.waitFor(1));
+    auto releaseTime = std::chrono::steady_clock::now();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        released = true;
+    }
+    condition.notify_all();
+    m_wheel->cancel(&blocking);
+    std::lock_guard<std::mutex> lock(m_expiries.m_mutex);
+    ASSERT_EQ(m_expiries.m_times.size(), 1u);
+    EXPECT_LT(m_expiries.m_times[0], releaseTime);
+}
+
+/// Verify that @c Timer instances created through @c TimerWheelDelegateFactory share the wheel's threads.
+TEST_F(TimerWheelTest, test_timersShareWheelThreads) {
+    auto factory = std::make_shared<TimerWheelDelegateFactory>(m_wheel);
+    std::vector<std::unique_ptr<Timer>> timers;
+    for (size_t i = 0; i < MANY_TIMERS; ++i) {
+        timers.emplace_back(new Timer(factory));
+        ASSERT_TRUE(timers.back()->start(SHORT_DELAY + std::chrono::milliseconds(i % 50), [this, i] {
+            m_expiries.record(i);
+        }).valid());
+    }
+    ASSERT_TRUE(m_expiries.waitFor(MANY_TIMERS));
+    std::lock_guard<std::mutex> lock(m_expiries.m_mutex);
+    EXPECT_LE(m_expiries.m_threads.size(), MAX_CALLBACK_THREADS);
+}
+
+/// Verify that a periodic @c Timer can stop itself from its task, and that it is not called again.
+TEST_F(TimerWheelTest, test_timerStopsFromTask) {
+    Timer timer(std::make_shared<TimerWheelDelegateFactory>(m_wheel));
+    std::atomic<size_t> calls{0};
+    ASSERT_TRUE(timer.start(SHORT_DELAY, Timer::PeriodType::ABSOLUTE, Timer::FOREVER, [&] {
+        if (++calls == 3) {
+            timer.stop();
+        }
+    }));
+    auto deadline = std::chrono::steady_clock::now() + TIMEOUT;
+    while (timer.isActive() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(SHORT_DELAY);
+    }
+    EXPECT_FALSE(timer.isActive());
+    std::this_thread::sleep_for(SHORT_DELAY * 3);
+    EXPECT_EQ(calls, 3u);
+    EXPECT_EQ(m_wheel->getNumScheduled(), 0u);
+}
+
+/// Verify that destroying a running periodic @c Timer removes it from the wheel.
+TEST_F(TimerWheelTest, test_destroyedTimerIsCancelled) {
+    std::atomic<size_t> calls{0};
+    {
+        Timer timer(std::make_shared<TimerWheelDelegateFactory>(m_wheel));
+        ASSERT_TRUE(timer.start(LEVEL_ONE_DELAY, Timer::PeriodType::RELATIVE, Timer::FOREVER, [&] { calls++; }));
+        EXPECT_EQ(m_wheel->getNumScheduled(), 1u);
+    }
+    EXPECT_EQ(m_wheel->getNumScheduled(), 0u);
+    std::this_thread::sleep_for(LEVEL_ONE_DELAY + SHORT_DELAY);
+    EXPECT_EQ(calls, 0u);
+}
+
+}  // namespace test
+}  // namespace timing
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
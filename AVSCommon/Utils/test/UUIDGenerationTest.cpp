@@ -18,7 +18,12 @@
 #include <vector>
 #include <unordered_set>
 #include <cctype>
+#include <climits>
+#include <iomanip>
+#include <mutex>
 #include <random>
+#include <sstream>
+#include <thread>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -71,6 +76,73 @@ static const unsigned int MAX_TEST_THREADS(10);
 /// The maximum number of retries.
 static const unsigned int MAX_RETRIES(20);
 
+/// The number of UUIDs generated by each thread in the benchmark.
+static const size_t BENCHMARK_UUIDS_PER_THREAD(100000);
+
+/// The numbers of threads the benchmark runs with.
+static const std::vector<size_t> BENCHMARK_THREAD_COUNTS = {1, 4, 8};
+
+/**
+ * Checks that a UUID has the expected layout, version and variant.
+ *
+ * @param uuid The UUID.
+ */
+static void verifyUUID(const std::string& uuid) {
+    ASSERT_EQ(UUID_LENGTH, uuid.length());
+    for (unsigned int i = 0; i < uuid.length(); i++) {
+        if (i == HYPHEN1_POSITION || i == HYPHEN2_POSITION || i == HYPHEN3_POSITION || i == HYPHEN4_POSITION) {
+            ASSERT_EQ(HYPHEN, uuid.substr(i, 1));
+        } else {
+            ASSERT_TRUE(isxdigit(uuid[i]) && !isupper(uuid[i]));
+        }
+    }
+    ASSERT_EQ(UUID_VERSION, uuid.substr(UUID_VERSION_OFFSET, 1));
+    ASSERT_EQ(UUID_VARIANT, strtoul(uuid.substr(UUID_VARIANT_OFFSET, 1).c_str(), nullptr, 16) & UUID_VARIANT);
+}
+
+/**
+ * Generates a UUID the way @c generateUUID() did before it used per-thread generators: from one generator behind a
+ * global lock, formatted through @c std::ostringstream.  Used as the baseline of the benchmark.
+ *
+ * @return A UUID.
+ */
+static std::string generateSerializedUUID() {
+    static std::mutex mutex;
+    static std::independent_bits_engine<std::mt19937, CHAR_BIT, uint32_t> engine;
+    std::lock_guard<std::mutex> lock(mutex);
+    std::ostringstream text;
+    for (int i = 0; i < 16; ++i) {
+        int byte = engine();
+        if (6 == i) {
+            byte = (byte & 0x0f) | 0x40;
+        } else if (8 == i) {
+            byte = (byte & 0x3f) | 0x80;
+        }
+        text << std::hex << std::setfill('0') << std::setw(2) << byte;
+        if (3 == i || 5 == i || 7 == i || 9 == i) {
+            text << "-";
+        }
+    }
+    return text.str();
+}
+
+/**
+ * Generates UUIDs on each of the benchmark's numbers of threads in turn.
+ *
+ * @param generate A function generating @c count UUIDs.
+ */
+static void generateConcurrently(std::function<void(size_t count)> generate) {
+    for (auto numThreads : BENCHMARK_THREAD_COUNTS) {
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < numThreads; ++i) {
+            threads.emplace_back(generate, BENCHMARK_UUIDS_PER_THREAD);
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+}
+
 class UUIDGenerationTest : public ::testing::Test {};
 
 /**
@@ -240,6 +312,106 @@ TEST_F(UUIDGenerationTest, test_allHexValuesGenerated) {
     ASSERT_TRUE(hexCharacters.empty());
 }
 
+/**
+ * Call @c generateUUID with a buffer and check the text written to it.
+ */
+TEST_F(UUIDGenerationTest, test_generateIntoBuffer) {
+    char buffer[UUID_STRING_LENGTH + 1];
+    buffer[UUID_STRING_LENGTH] = '!';
+    generateUUID(buffer);
+    ASSERT_EQ('!', buffer[UUID_STRING_LENGTH]);
+    verifyUUID(std::string(buffer, UUID_STRING_LENGTH));
+}
+
+/**
+ * Call @c generateUUIDs and check that the batch holds the requested number of distinct, well formed UUIDs, which are
+ * also distinct from those generated one at a time.
+ */
+TEST_F(UUIDGenerationTest, test_generateBatch) {
+    ASSERT_TRUE(generateUUIDs(0).empty());
+    auto uuids = generateUUIDs(MAX_UUIDS_TO_GENERATE);
+    ASSERT_EQ(MAX_UUIDS_TO_GENERATE, uuids.size());
+    std::unordered_set<std::string> uuidsGenerated(uuids.begin(), uuids.end());
+    for (unsigned int i = 0; i < MAX_UUIDS_TO_GENERATE; ++i) {
+        uuidsGenerated.insert(generateUUID());
+    }
+    ASSERT_EQ(2 * MAX_UUIDS_TO_GENERATE, uuidsGenerated.size());
+    for (const auto& uuid : uuids) {
+        verifyUUID(uuid);
+    }
+}
+
+/**
+ * Generate many UUIDs on several threads at once, adding seeds part way through, and check they are all distinct.
+ */
+TEST_F(UUIDGenerationTest, test_manyConcurrentUUIDsAreDistinct) {
+    std::vector<std::future<std::vector<std::string>>> requesters;
+    for (unsigned int i = 0; i < MAX_TEST_THREADS; ++i) {
+        requesters.push_back(std::async(std::launch::async, [i] {
+            std::vector<std::string> uuids;
+            for (unsigned int j = 0; j < MAX_UUIDS_TO_GENERATE * 10; ++j) {
+                if (j == MAX_UUIDS_TO_GENERATE * i) {
+                    addSeeds({i});
+                }
+                uuids.push_back(generateUUID());
+            }
+            return uuids;
+        }));
+    }
+    std::unordered_set<std::string> uuidsGenerated;
+    for (auto& requester : requesters) {
+        for (const auto& uuid : requester.get()) {
+            ASSERT_TRUE(uuidsGenerated.insert(uuid).second);
+        }
+    }
+}
+
+/**
+ * Benchmark generating UUIDs from several threads through the single locked generator UUIDs used to come from.
+ */
+TEST_F(UUIDGenerationTest, testSlow_benchmarkSerializedGeneration) {
+    generateConcurrently([](size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            generateSerializedUUID();
+        }
+    });
+}
+
+/**
+ * Benchmark generating UUIDs as strings from several threads.
+ */
+TEST_F(UUIDGenerationTest, testSlow_benchmarkStringGeneration) {
+    generateConcurrently([](size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            generateUUID();
+        }
+    });
+}
+
+/**
+ * Benchmark generating UUIDs into caller-provided buffers from several threads.
+ */
+TEST_F(UUIDGenerationTest, testSlow_benchmarkBufferGeneration) {
+    generateConcurrently([](size_t count) {
+        char buffer[UUID_STRING_LENGTH];
+        for (size_t i = 0; i < count; ++i) {
+            generateUUID(buffer);
+        }
+    });
+}
+
+/**
+ * Benchmark generating UUIDs in batches from several threads.
+ */
+TEST_F(UUIDGenerationTest, testSlow_benchmarkBatchGeneration) {
+    generateConcurrently([](size_t count) {
+        static const size_t BATCH_SIZE = 64;
+        for (size_t i = 0; i < count; i += BATCH_SIZE) {
+            generateUUIDs(BATCH_SIZE);
+        }
+    });
+}
+
 }  // namespace test
 }  // namespace avsCommon
 }  // namespace alexaClientSDK
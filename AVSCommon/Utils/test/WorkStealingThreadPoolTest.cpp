@@ -0,0 +1,122 @@
+/*
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License").
+ * You may not use this file except in compliance with the License.
+ * A copy of the License is located at
+ *
+ *     http://aws.amazon.com/apache2.0/
+ *
+ * or in the "license" file accompanying this file. This file is distributed
+ * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+ * express or implied. See the License for the specific language governing
+ * permissions and limitations under the License.
+ */
+
+#include <atomic>
+#include <future>
+
+#include <gtest/gtest.h>
+
+#include "AVSCommon/Utils/Threading/WorkStealingThreadPool.h"
+
+namespace alexaClientSDK {
+namespace avsCommon {
+namespace utils {
+namespace threading {
+namespace test {
+
+/// Timeout used when waiting for something which is expected to happen.
+static const std::chrono::seconds WAIT_TIMEOUT{5};
+
+/// Number of tasks submitted by the tests below.
+static const int NUM_TASKS = 1000;
+
+/// Test that submitted tasks run and are counted.
+TEST(WorkStealingThreadPoolTest, test_submittedTasksRun) {
+    WorkStealingThreadPool pool{4};
+    EXPECT_EQ(pool.getNumThreads(), 4u);
+
+    std::atomic<int> count{0};
+    std::promise<void> done;
+    for (int i = 0; i < NUM_TASKS; ++i) {
+        EXPECT_TRUE(pool.submit([&count, &done] {
+            if (++count == NUM_TASKS) {
+                done.set_value();
+            }
+        }));
+    }
+    ASSERT_EQ(done.get_future().wait_for(WAIT_TIMEOUT), std::future_status::ready);
+
+    uint64_t tasksExecuted, tasksStolen;
+    // The counter is updated after the task returns, so give the last worker a moment.
+    for (int i = 0; i < NUM_TASKS; ++i) {
+        pool.getStats(tasksExecuted, tasksStolen);
+        if (tasksExecuted == static_cast<uint64_t>(NUM_TASKS)) {
+            break;
+        }
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(tasksExecuted, static_cast<uint64_t>(NUM_TASKS));
+}
+
+/// Test that an empty task is rejected.
+TEST(WorkStealingThreadPoolTest, test_submitEmptyTaskFails) {
+    WorkStealingThreadPool pool{1};
+    EXPECT_FALSE(pool.submit(WorkStealingThreadPool::Task()));
+}
+
+/// Test that the default pool is shared and has at least the minimum number of threads.
+TEST(WorkStealingThreadPoolTest, test_defaultThreadPool) {
+    auto pool = WorkStealingThreadPool::getDefaultThreadPool();
+    ASSERT_TRUE(pool);
+    EXPECT_EQ(pool, WorkStealingThreadPool::getDefaultThreadPool());
+    EXPECT_GE(pool->getNumThreads(), MIN_WORK_STEALING_THREADS);
+}
+
+/// Test that tasks queued on a busy worker are stolen by idle workers.
+TEST(WorkStealingThreadPoolTest, test_idleWorkersStealFromBusyWorker) {
+    WorkStealingThreadPool pool{2};
+    std::promise<void> release;
+    auto releaseFuture = release.get_future().share();
+    std::promise<void> childrenDone;
+    std::atomic<int> count{0};
+
+    // Submitted from a worker, so the children go to that worker's own queue while it stays blocked.
+    pool.submit([&] {
+        for (int i = 0; i < NUM_TASKS; ++i) {
+            pool.submit([&count, &childrenDone] {
+                if (++count == NUM_TASKS) {
+                    childrenDone.set_value();
+                }
+            });
+        }
+        releaseFuture.wait();
+    });
+
+    auto childrenFuture = childrenDone.get_future();
+    EXPECT_EQ(childrenFuture.wait_for(WAIT_TIMEOUT), std::future_status::ready);
+    release.set_value();
+
+    uint64_t tasksExecuted, tasksStolen;
+    pool.getStats(tasksExecuted, tasksStolen);
+    EXPECT_GT(tasksStolen, 0u);
+}
+
+/// Test that tasks already submitted are run before the pool is destroyed.
+TEST(WorkStealingThreadPoolTest, test_destructorRunsPendingTasks) {
+    std::atomic<int> count{0};
+    {
+        WorkStealingThreadPool pool{2};
+        for (int i = 0; i < NUM_TASKS; ++i) {
+            pool.submit([&count] { ++count; });
+        }
+    }
+    EXPECT_EQ(count, NUM_TASKS);
+}
+
+}  // namespace test
+}  // namespace threading
+}  // namespace utils
+}  // namespace avsCommon
+}  // namespace alexaClientSDK
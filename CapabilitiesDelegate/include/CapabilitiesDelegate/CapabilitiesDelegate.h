@@ -216,7 +216,8 @@ private:
         const std::vector<avsCommon::sdkInterfaces::endpoints::EndpointIdentifier>& deleteReportEndpoints);
 
     /**
-     * Updates the storage with the AddOrUpdateReport and DeleteReport endpoints.
+     * Updates the storage with the AddOrUpdateReport and DeleteReport endpoints.  The digest of each AddOrUpdateReport
+     * endpoint configuration is stored instead of the full configuration.
      * @note: This method is called after successfully publishing Discovery events and the endpoints used in the
      * discovery events are updated in the storage.
      *
@@ -260,8 +261,9 @@ private:
     void addStaleEndpointsToPendingDeleteLocked(std::unordered_map<std::string, std::string>* storedEndpointConfig);
 
     /**
-     * Filters m_addOrUpdate.pending endpoints to remove those that are already in the database, and therefore
-     * do not need to be sent in an addOrUpdateReport. @c m_endpointsMutex must be locked to call this method.
+     * Filters m_addOrUpdate.pending endpoints to remove those that are already in the database with the same
+     * configuration digest, and therefore do not need to be sent in an addOrUpdateReport. @c m_endpointsMutex must be
+     * locked to call this method.
      *
      * @param storedEndpointConfig The reference to the stored map of endpointId to configuration. This map
      * is filtered to remove endpoints that do not need to be registered to AVS.
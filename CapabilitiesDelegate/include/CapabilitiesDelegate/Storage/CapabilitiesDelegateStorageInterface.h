@@ -59,7 +59,7 @@ public:
      * Stores the endpointConfig with the endpointId in the database.
      *
      * @param endpointId The endpoint ID string.
-     * @param endpointConfig The full endpoint config sent in the discovery.
+     * @param endpointConfig The endpoint config sent in the discovery, or its digest.
      * @return True if successful, else false.
      */
     virtual bool store(const std::string& endpointId, const std::string& endpointConfig) = 0;
@@ -66,6 +66,36 @@ bool compareEndpointConfigurations(
     const std::string& firstEndpointConfigJson,
     const std::string& secondEndpointConfigJson);
 
+/**
+ * Computes the digest of an endpoint configuration JSON that is stored instead of the full configuration once the
+ * endpoint has been registered with AVS.  The digest does not depend on the platform or the build, so it can be
+ * persisted and compared across restarts.
+ *
+ * @param endpointConfigJson The endpoint config json string, as returned by @c getEndpointConfigJson().
+ * @return The digest of the endpoint configuration.
+ */
+std::string getEndpointConfigHash(const std::string& endpointConfigJson);
+
+/**
+ * Checks whether a stored endpoint configuration is a digest returned by @c getEndpointConfigHash(), rather than a full
+ * endpoint config json string stored by an earlier version of the SDK.
+ *
+ * @param storedEndpointConfig The stored endpoint configuration.
+ * @return True if the stored endpoint configuration is a digest, else false.
+ */
+bool isEndpointConfigHash(const std::string& storedEndpointConfig);
+
+/**
+ * Checks whether an endpoint configuration is the same as the one stored for the endpoint.  The stored configuration
+ * is either a digest returned by @c getEndpointConfigHash(), or a full endpoint config json string stored by an earlier
+ * version of the SDK, which is compared using @c compareEndpointConfigurations().
+ *
+ * @param endpointConfigJson The endpoint config json string.
+ * @param storedEndpointConfig The stored endpoint configuration.
+ * @return True if the endpoint configuration has not changed, else false.
+ */
+bool isEndpointConfigUnchanged(const std::string& endpointConfigJson, const std::string& storedEndpointConfig);
+
 /**
  * Formats the given @c EndpointAttributes and @c CapabilityConfigurations into a JSON required to send in the
  * @c Discovery.AddOrUpdateReport event.
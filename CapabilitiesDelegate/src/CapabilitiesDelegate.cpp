@@ -661,7 +661,15 @@ bool CapabilitiesDelegate::updateEndpointConfigInStorage(
         return false;
     }
 
-    if (!m_capabilitiesDelegateStorage->store(addOrUpdateReportEndpoints)) {
+    /// Only the digest of each endpoint configuration is needed to detect changes on the next post-connect operation.
+    std::unordered_map<std::string, std::string> endpointIdToConfigHash;
+    endpointIdToConfigHash.reserve(addOrUpdateReportEndpoints.size());
+    for (const auto& endpointIdToConfigPair : addOrUpdateReportEndpoints) {
+        endpointIdToConfigHash.insert(
+            {endpointIdToConfigPair.first, getEndpointConfigHash(endpointIdToConfigPair.second)});
+    }
+
+    if (!m_capabilitiesDelegateStorage->store(endpointIdToConfigHash)) {
         ACSDK_ERROR(LX("updateStorageFailed").d("reason", "storeFailed"));
         return false;
     }
@@ -792,11 +800,14 @@ void CapabilitiesDelegate::filterUnchangedPendingAddOrUpdateEndpointsLocked(
         }
     }
 
+    /// Unchanged endpoints stored in full by an earlier version of the SDK, to be stored again as digests.
+    std::unordered_map<std::string, std::string> legacyEndpointIdToConfigHash;
+
     /// Find the endpoints that are unchanged
     for (auto& endpointIdToConfigPair : addOrUpdateEndpointIdToConfigPairs) {
         auto storedEndpointConfigId = storedEndpointConfig->find(endpointIdToConfigPair.first);
         if (storedEndpointConfig->end() != storedEndpointConfigId) {
-            if (compareEndpointConfigurations(endpointIdToConfigPair.second, storedEndpointConfigId->second)) {
+            if (isEndpointConfigUnchanged(endpointIdToConfigPair.second, storedEndpointConfigId->second)) {
                 ACSDK_DEBUG9(LX(__func__)
                                  .d("step", "endpoint not be included in addOrUpdateReport")
                                  .sensitive("endpointId", endpointIdToConfigPair.first));
@@ -809,6 +820,11 @@ void CapabilitiesDelegate::filterUnchangedPendingAddOrUpdateEndpointsLocked(
                 /// have been checked (ie. this is the first post-connect operation since starting the client).
                 m_endpoints[endpointIdToConfigPair.first] = endpointIdToConfigPair.second;
 
+                if (!isEndpointConfigHash(storedEndpointConfigId->second)) {
+                    legacyEndpointIdToConfigHash.insert(
+                        {endpointIdToConfigPair.first, getEndpointConfigHash(endpointIdToConfigPair.second)});
+                }
+
                 /// Remove this endpoint from the stored endpoint list.
                 storedEndpointConfig->erase(endpointIdToConfigPair.first);
             } else {
@@ -824,6 +840,12 @@ void CapabilitiesDelegate::filterUnchangedPendingAddOrUpdateEndpointsLocked(
                              .sensitive("endpointId", endpointIdToConfigPair.first));
         }
     }
+
+    /// Endpoints which are sent are stored as digests once AVS accepts them, so only unchanged ones are stored here.
+    if (!legacyEndpointIdToConfigHash.empty() && m_capabilitiesDelegateStorage &&
+        !m_capabilitiesDelegateStorage->store(legacyEndpointIdToConfigHash)) {
+        ACSDK_WARN(LX(__func__).d("reason", "storeDigestsFailed").d("count", legacyEndpointIdToConfigHash.size()));
+    }
 }
 
 void CapabilitiesDelegate::moveInFlightEndpointsToPendingLocked() {
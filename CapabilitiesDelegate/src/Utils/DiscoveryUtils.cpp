@@ -15,13 +15,14 @@
 
 #include "CapabilitiesDelegate/Utils/DiscoveryUtils.h"
 
-#include <AVSCommon/AVS/AVSMessageEndpoint.h>
+#include <cstdint>
+#include <iomanip>
+#include <sstream>
+
 #include <AVSCommon/AVS/AVSMessageHeader.h>
-#include <AVSCommon/AVS/EventBuilder.h>
 #include <AVSCommon/Utils/JSON/JSONGenerator.h>
 #include <AVSCommon/Utils/JSON/JSONUtils.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
-#include <AVSCommon/Utils/Optional.h>
 #include <Endpoints/EndpointAttributeValidation.h>
 
 /// String to identify log entries originating from this file.
@@ -93,6 +94,22 @@ static const std::string ADDITIONAL_CUSTOM_IDENTIFIER_KEY = "customIdentifier";
 /// Capabilities key in message body
 static const std::string CAPABILITIES_KEY = "capabilities";
 
+/// Endpoint configuration digest
+/// Prefix of the digests returned by getEndpointConfigHash(), which identifies the hash function.
+static const std::string ENDPOINT_CONFIG_HASH_PREFIX = "fnv1a64:";
+/// The offset basis of the 64-bit FNV-1a hash function.
+static constexpr uint64_t FNV1A_64_OFFSET_BASIS = 14695981039346656037ULL;
+/// The prime of the 64-bit FNV-1a hash function.
+static constexpr uint64_t FNV1A_64_PRIME = 1099511628211ULL;
+
+/// Event Keys
+/// Event key
+static const std::string EVENT_KEY = "event";
+/// Header key
+static const std::string HEADER_KEY = "header";
+/// Payload key
+static const std::string PAYLOAD_KEY = "payload";
+
 /// Discovery Keys
 /// Discovery Namespace
 static const std::string DISCOVERY_NAMESPACE = "Alexa.Discovery";
@@ -129,18 +146,34 @@ struct JsonObjectScope {
 };
 
 /**
- * Formats the scope object that needs to be included in the @c AddOrUpdateReport and @c DeleteReport events.
+ * Formats a Discovery event.  The header, the scope and the endpoint configurations are written directly into the
+ * event JSON, without building and validating the payload as a separate string first.  The endpoint configurations
+ * were generated by @c getEndpointConfigJson() or @c getDeleteReportEndpointConfigJson(), so they are not parsed again.
  *
+ * @param header The header of the event.
+ * @param endpointConfigurations The endpointConfiguration jsons to be included in the event.
  * @param authToken The authorization token to be included in the event.
- * @return The JSON formatted scope object.
+ * @return The JSON formatted event.
  */
-static std::string getScopeJson(const std::string& authToken) {
-    JsonGenerator scopeGenerator;
-
-    scopeGenerator.addMember(SCOPE_TYPE_KEY, SCOPE_TYPE_BEARER_TOKEN);
-    scopeGenerator.addMember(SCOPE_TOKEN_KEY, authToken);
+static std::string getDiscoveryEventJson(
+    const AVSMessageHeader& header,
+    const std::vector<std::string>& endpointConfigurations,
+    const std::string& authToken) {
+    JsonGenerator generator;
+    {
+        JsonObjectScope event(&generator, EVENT_KEY);
+        generator.addRawJsonMember(HEADER_KEY, header.toJson(), false);
+
+        JsonObjectScope payload(&generator, PAYLOAD_KEY);
+        {
+            JsonObjectScope scope(&generator, SCOPE_KEY);
+            generator.addMember(SCOPE_TYPE_KEY, SCOPE_TYPE_BEARER_TOKEN);
+            generator.addMember(SCOPE_TOKEN_KEY, authToken);
+        }
+        generator.addMembersArray(ENDPOINTS_KEY, endpointConfigurations);
+    }
 
-    return scopeGenerator.toString();
+    return generator.toString();
 }
 
 /**
@@ -293,6 +326,31 @@ bool compareEndpointConfigurations(const std::string& firstEndpointJson, const s
     return (firstEndpointDocument == secondEndpointDocument);
 }
 
+std::string getEndpointConfigHash(const std::string& endpointConfigJson) {
+    uint64_t hash = FNV1A_64_OFFSET_BASIS;
+    for (unsigned char c : endpointConfigJson) {
+        hash ^= c;
+        hash *= FNV1A_64_PRIME;
+    }
+
+    std::ostringstream digest;
+    digest << ENDPOINT_CONFIG_HASH_PREFIX << std::hex << std::setfill('0') << std::setw(16) << hash;
+    return digest.str();
+}
+
+bool isEndpointConfigHash(const std::string& storedEndpointConfig) {
+    return 0 == storedEndpointConfig.compare(0, ENDPOINT_CONFIG_HASH_PREFIX.length(), ENDPOINT_CONFIG_HASH_PREFIX);
+}
+
+bool isEndpointConfigUnchanged(const std::string& endpointConfigJson, const std::string& storedEndpointConfig) {
+    if (isEndpointConfigHash(storedEndpointConfig)) {
+        return getEndpointConfigHash(endpointConfigJson) == storedEndpointConfig;
+    }
+
+    /// The endpoint was stored by an earlier version of the SDK, which stored the full endpoint configuration.
+    return compareEndpointConfigurations(endpointConfigJson, storedEndpointConfig);
+}
+
 std::string getEndpointConfigJson(
     const AVSDiscoveryEndpointAttributes& endpointAttributes,
     const std::vector<avsCommon::avs::CapabilityConfiguration>& capabilities) {
@@ -386,15 +444,8 @@ std::pair<std::string, std::string> getAddOrUpdateReportEventJson(
 
     auto header = AVSMessageHeader::createAVSEventHeader(
         DISCOVERY_NAMESPACE, ADD_OR_UPDATE_REPORT_NAME, "", "", PAYLOAD_VERSION, "");
-    JsonGenerator payloadGenerator;
-    {
-        payloadGenerator.addRawJsonMember(SCOPE_KEY, getScopeJson(authToken));
-        payloadGenerator.addMembersArray(ENDPOINTS_KEY, endpointConfigurations);
-    }
 
-    std::string addOrUpdateEvent =
-        buildJsonEventString(header, Optional<AVSMessageEndpoint>(), payloadGenerator.toString());
-    return {addOrUpdateEvent, header.getEventCorrelationToken()};
+    return {getDiscoveryEventJson(header, endpointConfigurations, authToken), header.getEventCorrelationToken()};
 }
 
 std::string getDeleteReportEventJson(
@@ -405,13 +456,7 @@ std::string getDeleteReportEventJson(
     auto header =
         AVSMessageHeader::createAVSEventHeader(DISCOVERY_NAMESPACE, DELETE_REPORT_NAME, "", "", PAYLOAD_VERSION, "");
 
-    JsonGenerator payloadGenerator;
-    {
-        payloadGenerator.addRawJsonMember(SCOPE_KEY, getScopeJson(authToken));
-        payloadGenerator.addMembersArray(ENDPOINTS_KEY, endpointConfigurations);
-    }
-
-    return buildJsonEventString(header, Optional<AVSMessageEndpoint>(), payloadGenerator.toString());
+    return getDiscoveryEventJson(header, endpointConfigurations, authToken);
 }
 
 }  // namespace utils
@@ -13,6 +13,7 @@
  * permissions and limitations under the License.
  */
 
+#include <chrono>
 #include <memory>
 
 #include <gtest/gtest.h>
@@ -57,6 +58,10 @@ static const std::string EVENT_CORRELATION_TOKEN_KEY = "eventCorrelationToken";
 /// Constant representing the timeout for test events.
 /// @note Use a large enough value that should not fail even in slower systems.
 static const std::chrono::seconds MY_WAIT_TIMEOUT{5};
+/// The number of endpoints registered in the benchmarks.
+static const int BENCHMARK_ENDPOINT_COUNT = 500;
+/// The number of capabilities of each endpoint registered in the benchmarks.
+static const int BENCHMARK_CAPABILITIES_PER_ENDPOINT = 10;
 
 /**
  * Structure to store event data from a Discovery event JSON.
@@ -102,6 +107,20 @@ CapabilityConfiguration createCapabilityConfiguration(
         additionalConfigurationsIn);
 }
 
+/**
+ * Gets the endpoint configuration digests that @c CapabilitiesDelegate stores for the given endpoints.
+ * @param endpoints The map of endpointId to configuration.
+ * @return The map of endpointId to configuration digest.
+ */
+std::unordered_map<std::string, std::string> getEndpointConfigHashes(
+    const std::unordered_map<std::string, std::string>& endpoints) {
+    std::unordered_map<std::string, std::string> endpointConfigHashes;
+    for (const auto& endpoint : endpoints) {
+        endpointConfigHashes[endpoint.first] = utils::getEndpointConfigHash(endpoint.second);
+    }
+    return endpointConfigHashes;
+}
+
 /**
  * Test harness for @c CapabilitiesDelegate class.
  */
@@ -133,6 +152,13 @@ protected:
         std::shared_ptr<MessageRequest> request,
         std::string& eventCorrelationTokenString);
 
+    /**
+     * Helper that re-connects with many registered endpoints, none of which changed since they were stored.
+     * @param storeDigests Whether the storage holds the configuration digests of the endpoints, rather than their full
+     * configurations as stored by an earlier version of the SDK.
+     */
+    void reconnectWithUnchangedEndpoints(bool storeDigests);
+
     /// The mock Auth Delegate instance.
     std::shared_ptr<MockAuthDelegate> m_mockAuthDelegate;
 
@@ -208,6 +234,40 @@ void CapabilitiesDelegateTest::getEventCorrelationTokenString(
     retrieveValue(headerString, EVENT_CORRELATION_TOKEN_KEY, &eventCorrelationTokenString);
 }
 
+void CapabilitiesDelegateTest::reconnectWithUnchangedEndpoints(bool storeDigests) {
+    std::vector<std::pair<AVSDiscoveryEndpointAttributes, std::vector<CapabilityConfiguration>>> endpoints;
+    std::unordered_map<std::string, std::string> endpointConfigs;
+    for (int i = 0; i < BENCHMARK_ENDPOINT_COUNT; ++i) {
+        auto endpointAttributes = createEndpointAttributes("endpointId" + std::to_string(i));
+        std::vector<CapabilityConfiguration> capabilityConfigs;
+        for (int j = 0; j < BENCHMARK_CAPABILITIES_PER_ENDPOINT; ++j) {
+            capabilityConfigs.push_back(createCapabilityConfiguration(
+                {{"configuration", R"({"index":)" + std::to_string(j) + R"(,"supportedModes":["A","B","C"]})"}}));
+        }
+        endpointConfigs[endpointAttributes.endpointId] =
+            utils::getEndpointConfigJson(endpointAttributes, capabilityConfigs);
+        endpoints.push_back({endpointAttributes, capabilityConfigs});
+    }
+    auto storedEndpoints = storeDigests ? getEndpointConfigHashes(endpointConfigs) : endpointConfigs;
+
+    EXPECT_CALL(*m_mockCapabilitiesStorage, open()).WillOnce(Return(true));
+    EXPECT_CALL(*m_mockCapabilitiesStorage, load(_))
+        .WillOnce(Invoke([storedEndpoints](std::unordered_map<std::string, std::string>* endpointConfigMap) {
+            *endpointConfigMap = storedEndpoints;
+            return true;
+        }));
+    /// Full configurations stored by an earlier version of the SDK are stored again as digests.
+    EXPECT_CALL(*m_mockCapabilitiesStorage, store(_)).WillRepeatedly(Return(true));
+    auto instance = CapabilitiesDelegate::create(m_mockAuthDelegate, m_mockCapabilitiesStorage, m_dataManager);
+    ASSERT_NE(instance, nullptr);
+    for (const auto& endpoint : endpoints) {
+        instance->addOrUpdateEndpoint(endpoint.first, endpoint.second);
+    }
+
+    EXPECT_EQ(instance->createPostConnectOperation(), nullptr);
+    instance->shutdown();
+}
+
 void CapabilitiesDelegateTest::addEndpoint(
     AVSDiscoveryEndpointAttributes attributes,
     CapabilityConfiguration configuration) {
@@ -356,7 +416,8 @@ TEST_F(CapabilitiesDelegateTest, test_onDiscoveryCompleted) {
     std::unordered_map<std::string, std::string> addOrUpdateReportEndpoints = {{"add_1", "1"}, {"update_1", "2"}};
     std::unordered_map<std::string, std::string> deleteReportEndpoints = {{"delete_1", "1"}};
 
-    EXPECT_CALL(*m_mockCapabilitiesStorage, store(addOrUpdateReportEndpoints)).WillOnce(Return(true));
+    EXPECT_CALL(*m_mockCapabilitiesStorage, store(getEndpointConfigHashes(addOrUpdateReportEndpoints)))
+        .WillOnce(Return(true));
     EXPECT_CALL(*m_mockCapabilitiesStorage, erase(deleteReportEndpoints)).WillOnce(Return(true));
 
     EXPECT_CALL(*m_mockCapabilitiesDelegateObserver, onCapabilitiesStateChange(_, _, _, _))
@@ -378,7 +439,8 @@ TEST_F(CapabilitiesDelegateTest, test_onDiscoveryCompleted) {
     /// Check removing observer does not send notifications to the observer.
     m_capabilitiesDelegate->removeCapabilitiesObserver(m_mockCapabilitiesDelegateObserver);
 
-    EXPECT_CALL(*m_mockCapabilitiesStorage, store(addOrUpdateReportEndpoints)).WillOnce(Return(true));
+    EXPECT_CALL(*m_mockCapabilitiesStorage, store(getEndpointConfigHashes(addOrUpdateReportEndpoints)))
+        .WillOnce(Return(true));
     EXPECT_CALL(*m_mockCapabilitiesStorage, erase(deleteReportEndpoints)).WillOnce(Return(true));
 
     /// Only store and erase is triggered, observer does not get notified (should fail as we use strict mock for
@@ -393,7 +455,8 @@ TEST_F(CapabilitiesDelegateTest, test_onDiscoveryCompletedButStorageFails) {
     std::unordered_map<std::string, std::string> addOrUpdateReportEndpoints = {{"add_1", "1"}, {"update_1", "2"}};
     std::unordered_map<std::string, std::string> deleteReportEndpoints = {{"delete_1", "1"}};
 
-    EXPECT_CALL(*m_mockCapabilitiesStorage, store(addOrUpdateReportEndpoints)).WillOnce(Return(false));
+    EXPECT_CALL(*m_mockCapabilitiesStorage, store(getEndpointConfigHashes(addOrUpdateReportEndpoints)))
+        .WillOnce(Return(false));
 
     EXPECT_CALL(*m_mockCapabilitiesDelegateObserver, onCapabilitiesStateChange(_, _, _, _))
         .WillOnce(Invoke([](CapabilitiesDelegateObserverInterface::State newState,
@@ -670,6 +733,7 @@ TEST_F(CapabilitiesDelegateTest, test_createPostConnectOperationWithDifferentEnd
  * Tests if the createPostConnectOperation() does not create a new @c PostConnectCapabilitiesPublisher when registered
  * pending endpoint configurations are same as the ones in storage.
  * Tests if CapabilitiesDelegate reports this as a success to observers as there are pending endpoints.
+ * Tests that the full endpoint configurations stored by an earlier version of the SDK are stored again as digests.
  */
 TEST_F(CapabilitiesDelegateTest, test_createPostConnectOperationWithPendingEndpointsWithSameEndpointConfigs) {
     auto endpointAttributes = createEndpointAttributes("endpointId");
@@ -685,6 +749,11 @@ TEST_F(CapabilitiesDelegateTest, test_createPostConnectOperationWithPendingEndpo
                 storedEndpoints->insert({endpointAttributes.endpointId, endpointConfig});
                 return true;
             }));
+    EXPECT_CALL(
+        *m_mockCapabilitiesStorage,
+        store((std::unordered_map<std::string, std::string>{
+            {endpointAttributes.endpointId, utils::getEndpointConfigHash(endpointConfig)}})))
+        .WillOnce(Return(true));
     EXPECT_CALL(*m_mockCapabilitiesDelegateObserver, onCapabilitiesStateChange(_, _, _, _))
         .WillOnce(Invoke([](CapabilitiesDelegateObserverInterface::State newState,
                             CapabilitiesDelegateObserverInterface::Error newError,
@@ -718,6 +787,35 @@ TEST_F(CapabilitiesDelegateTest, test_createPostConnectOperationWithPendingEndpo
     instance->shutdown();
 }
 
+/**
+ * Tests if the createPostConnectOperation() does not create a new @c PostConnectCapabilitiesPublisher when the digests
+ * of the pending endpoint configurations are the ones in storage.
+ */
+TEST_F(CapabilitiesDelegateTest, test_createPostConnectOperationWithPendingEndpointsWithSameEndpointConfigHash) {
+    auto endpointAttributes = createEndpointAttributes("endpointId");
+    std::vector<CapabilityConfiguration> capabilityConfigs = {createCapabilityConfiguration()};
+
+    std::string endpointConfigHash =
+        utils::getEndpointConfigHash(utils::getEndpointConfigJson(endpointAttributes, capabilityConfigs));
+    EXPECT_CALL(*m_mockCapabilitiesStorage, open()).Times(1).WillOnce(Return(true));
+    EXPECT_CALL(*m_mockCapabilitiesStorage, load(_))
+        .Times(1)
+        .WillOnce(Invoke(
+            [endpointAttributes, endpointConfigHash](std::unordered_map<std::string, std::string>* storedEndpoints) {
+                storedEndpoints->insert({endpointAttributes.endpointId, endpointConfigHash});
+                return true;
+            }));
+
+    auto instance = CapabilitiesDelegate::create(m_mockAuthDelegate, m_mockCapabilitiesStorage, m_dataManager);
+    instance->addOrUpdateEndpoint(endpointAttributes, capabilityConfigs);
+
+    /// The stored digest matches the endpoint configuration, so a post connect operation is not created.
+    auto publisher = instance->createPostConnectOperation();
+    instance->shutdown();
+
+    ASSERT_EQ(publisher, nullptr);
+}
+
 /**
  * Tests if the createPostConnectOperation() does not create a new @c PostConnectCapabilitiesPublisher when registered
  * pending endpoint configurations are same as the ones in storage.
@@ -739,6 +837,10 @@ TEST_F(CapabilitiesDelegateTest, test_createPostConnectOperationWithoutPendingEn
                 storedEndpoints->insert({endpointAttributes.endpointId, endpointConfig});
                 return true;
             }));
+    EXPECT_CALL(
+        *m_mockCapabilitiesStorage,
+        store((std::unordered_map<std::string, std::string>{{endpointAttributes.endpointId, utils::getEndpointConfigHash(endpointConfig)}})))
+        .WillOnce(Return(true));
     EXPECT_CALL(*m_mockCapabilitiesDelegateObserver, onCapabilitiesStateChange(_, _, _, _))
         .WillOnce(Invoke([](CapabilitiesDelegateObserverInterface::State newState,
                             CapabilitiesDelegateObserverInterface::Error newError,
@@ -809,6 +911,10 @@ TEST_F(CapabilitiesDelegateTest, test_createPostConnectOperationCachesEndpoints)
                 /// time, we can verify that it creates a non-null post-connect publisher to send the cached endpoint.
                 return true;
             }));
+    EXPECT_CALL(
+        *m_mockCapabilitiesStorage,
+        store((std::unordered_map<std::string, std::string>{{endpointAttributes.endpointId, utils::getEndpointConfigHash(endpointConfig)}})))
+        .WillOnce(Return(true));
     EXPECT_CALL(*m_mockCapabilitiesDelegateObserver, onCapabilitiesStateChange(_, _, _, _))
         .WillOnce(Invoke([](CapabilitiesDelegateObserverInterface::State newState,
                             CapabilitiesDelegateObserverInterface::Error newError,
@@ -886,6 +992,10 @@ TEST_F(
             storedEndpoints->insert({staleEndpointAttributes.endpointId, staleEndpointConfig});
             return true;
         }));
+    EXPECT_CALL(
+        *m_mockCapabilitiesStorage,
+        store((std::unordered_map<std::string, std::string>{{endpointAttributes.endpointId, utils::getEndpointConfigHash(endpointConfig)}})))
+        .WillOnce(Return(true));
     EXPECT_CALL(*m_mockCapabilitiesDelegateObserver, onCapabilitiesStateChange(_, _, _, _))
         .WillOnce(Invoke([](CapabilitiesDelegateObserverInterface::State newState,
                             CapabilitiesDelegateObserverInterface::Error newError,
@@ -1000,6 +1110,10 @@ TEST_F(
                 storedEndpoints->insert({staleEndpointAttributes.endpointId, staleEndpointConfig});
                 return true;
             }));
+    EXPECT_CALL(
+        *m_mockCapabilitiesStorage,
+        store((std::unordered_map<std::string, std::string>{{unchangedEndpointAttributes.endpointId, utils::getEndpointConfigHash(unchangedEndpointConfig)}})))
+        .WillOnce(Return(true));
     EXPECT_CALL(*m_mockCapabilitiesDelegateObserver, onCapabilitiesStateChange(_, _, _, _))
         .WillOnce(Invoke([](CapabilitiesDelegateObserverInterface::State newState,
                             CapabilitiesDelegateObserverInterface::Error newError,
@@ -1063,6 +1177,14 @@ TEST_F(
                 return true;
             }));
     int numCallbacks = 0;
+    EXPECT_CALL(
+        *m_mockCapabilitiesStorage,
+        store((std::unordered_map<std::string, std::string>{{unchangedEndpointAttributes.endpointId, utils::getEndpointConfigHash(unchangedEndpointConfig)}})))
+        .WillOnce(Return(true));
+    EXPECT_CALL(
+        *m_mockCapabilitiesStorage,
+        store((std::unordered_map<std::string, std::string>{{staleEndpointAttributes.endpointId, utils::getEndpointConfigHash(staleEndpointConfig)}})))
+        .WillOnce(Return(true));
     EXPECT_CALL(*m_mockCapabilitiesDelegateObserver, onCapabilitiesStateChange(_, _, _, _))
         .Times(2)
         .WillRepeatedly(Invoke([&numCallbacks](
@@ -1126,6 +1248,7 @@ TEST_F(CapabilitiesDelegateTest, test_createPostConnectOperationWithReconnects)
     std::string endpointConfig = utils::getEndpointConfigJson(endpointAttributes, capabilityConfigs);
     std::unordered_map<std::string, std::string> addOrUpdateReportEndpoints = {
         {endpointAttributes.endpointId, endpointConfig}};
+    auto storedEndpoints = getEndpointConfigHashes(addOrUpdateReportEndpoints);
     std::unordered_map<std::string, std::string> emptyDeleteReportEndpoints;
 
     EXPECT_CALL(*m_mockCapabilitiesStorage, open()).Times(1).WillOnce(Return(true));
@@ -1138,11 +1261,11 @@ TEST_F(CapabilitiesDelegateTest, test_createPostConnectOperationWithReconnects)
     auto publisher = instance->createPostConnectOperation();
     ASSERT_NE(publisher, nullptr);
 
-    /// Expect the successfully published endpoint configuration to be stored and erase.
+    /// Expect the digest of the successfully published endpoint configuration to be stored and erase.
     EXPECT_CALL(*m_mockCapabilitiesStorage, store(_))
-        .WillOnce(Invoke(
-            [addOrUpdateReportEndpoints](const std::unordered_map<std::string, std::string>& endpointIdToConfigMap) {
-                EXPECT_EQ(endpointIdToConfigMap, addOrUpdateReportEndpoints);
+        .WillOnce(
+            Invoke([storedEndpoints](const std::unordered_map<std::string, std::string>& endpointIdToConfigMap) {
+                EXPECT_EQ(endpointIdToConfigMap, storedEndpoints);
                 return true;
             }));
 
@@ -1158,8 +1281,8 @@ TEST_F(CapabilitiesDelegateTest, test_createPostConnectOperationWithReconnects)
 
     /// Expect call to load endpoint configuration
     EXPECT_CALL(*m_mockCapabilitiesStorage, load(_))
-        .WillOnce(Invoke([addOrUpdateReportEndpoints](std::unordered_map<std::string, std::string>* storedEndpoints) {
-            *storedEndpoints = addOrUpdateReportEndpoints;
+        .WillOnce(Invoke([storedEndpoints](std::unordered_map<std::string, std::string>* endpointConfigMap) {
+            *endpointConfigMap = storedEndpoints;
             return true;
         }));
 
@@ -1534,6 +1657,22 @@ TEST_F(CapabilitiesDelegateTest, test_duplicateEndpointInPendingAddOrUpdateAndDe
     ASSERT_FALSE(m_capabilitiesDelegate->addOrUpdateEndpoint(deleteEndpointAttributes, {capabilityConfig}));
 }
 
+/**
+ * Benchmark re-connecting with many registered endpoints, none of which changed, when the storage holds their
+ * configuration digests.
+ */
+TEST_F(CapabilitiesDelegateTest, testSlow_benchmarkReconnectWithStoredDigests) {
+    reconnectWithUnchangedEndpoints(true);
+}
+
+/**
+ * Benchmark re-connecting with many registered endpoints, none of which changed, when the storage holds their full
+ * configurations.
+ */
+TEST_F(CapabilitiesDelegateTest, testSlow_benchmarkReconnectWithStoredConfigurations) {
+    reconnectWithUnchangedEndpoints(false);
+}
+
 }  // namespace test
 }  // namespace capabilitiesDelegate
 }  // namespace alexaClientSDK
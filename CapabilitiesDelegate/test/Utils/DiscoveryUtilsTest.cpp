@@ -565,6 +565,38 @@ TEST_F(DiscoveryUtilsTest, test_compareEndpointConfigJsons) {
     ASSERT_FALSE(compareEndpointConfigurations(endpointConfig1, endpointConfig2));
 }
 
+/**
+ * Test that endpoint configuration digests are stable, and that changes are detected against both digests and full
+ * endpoint configurations stored by earlier versions of the SDK.
+ */
+TEST_F(DiscoveryUtilsTest, test_endpointConfigHash) {
+    /// Digests must not change between builds, since they are persisted.
+    EXPECT_EQ(getEndpointConfigHash(""), "fnv1a64:cbf29ce484222325");
+    EXPECT_EQ(getEndpointConfigHash("a"), "fnv1a64:af63dc4c8601ec8c");
+
+    std::vector<CapabilityConfiguration> capabilities = {
+        CapabilityConfiguration(TEST_TYPE_1, TEST_INTERFACE_NAME_1, TEST_VERSION_1)};
+    auto endpointConfig = getEndpointConfigJson(getTestEndpointAttributes(), capabilities);
+    auto endpointConfigHash = getEndpointConfigHash(endpointConfig);
+    EXPECT_EQ(
+        endpointConfigHash, getEndpointConfigHash(getEndpointConfigJson(getTestEndpointAttributes(), capabilities)));
+
+    auto changedAttributes = getTestEndpointAttributes();
+    changedAttributes.friendlyName += "_CHANGED";
+    auto changedEndpointConfig = getEndpointConfigJson(changedAttributes, capabilities);
+    EXPECT_NE(endpointConfigHash, getEndpointConfigHash(changedEndpointConfig));
+
+    EXPECT_TRUE(isEndpointConfigHash(endpointConfigHash));
+    EXPECT_FALSE(isEndpointConfigHash(endpointConfig));
+
+    EXPECT_TRUE(isEndpointConfigUnchanged(endpointConfig, endpointConfigHash));
+    EXPECT_FALSE(isEndpointConfigUnchanged(changedEndpointConfig, endpointConfigHash));
+
+    /// Full endpoint configurations stored by earlier versions of the SDK are still compared by content.
+    EXPECT_TRUE(isEndpointConfigUnchanged(endpointConfig, endpointConfig));
+    EXPECT_FALSE(isEndpointConfigUnchanged(changedEndpointConfig, endpointConfig));
+}
+
 }  // namespace test
 }  // namespace utils
 }  // namespace capabilitiesDelegate
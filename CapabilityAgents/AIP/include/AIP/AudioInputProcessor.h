@@ -24,6 +24,7 @@
 #include <vector>
 
 #include <AVSCommon/AVS/Attachment/InProcessAttachmentReader.h>
+#include <AVSCommon/AVS/AVSContext.h>
 #include <AVSCommon/AVS/CapabilityAgent.h>
 #include <AVSCommon/AVS/CapabilityConfiguration.h>
 #include <AVSCommon/AVS/CapabilityChangeNotifierInterface.h>
@@ -36,6 +37,7 @@
 #include <AVSCommon/SDKInterfaces/CapabilityConfigurationInterface.h>
 #include <AVSCommon/SDKInterfaces/ChannelObserverInterface.h>
 #include <AVSCommon/SDKInterfaces/ContextManagerInterface.h>
+#include <AVSCommon/SDKInterfaces/ContextManagerObserverInterface.h>
 #include <AVSCommon/SDKInterfaces/DialogUXStateObserverInterface.h>
 #include <AVSCommon/SDKInterfaces/DirectiveSequencerInterface.h>
 #include <AVSCommon/SDKInterfaces/ExceptionEncounteredSenderInterface.h>
@@ -84,6 +86,7 @@ class AudioInputProcessor
         , public avsCommon::sdkInterfaces::DialogUXStateObserverInterface
         , public avsCommon::sdkInterfaces::MessageRequestObserverInterface
         , public avsCommon::sdkInterfaces::InternetConnectionObserverInterface
+        , public avsCommon::sdkInterfaces::ContextManagerObserverInterface
         , public avsCommon::utils::RequiresShutdown
         , public std::enable_shared_from_this<AudioInputProcessor> {
 public:
@@ -280,10 +283,48 @@ public:
      */
     std::future<void> resetState();
 
+    /**
+     * Enables or disables the warm context mode.  While enabled, the @c AudioInputProcessor keeps a snapshot of the
+     * context ready, so that a Recognize event can be sent as soon as it is started rather than after a round trip
+     * through the @c ContextManager.
+     *
+     * The snapshot is fetched when the mode is enabled and consumed by the next Recognize event.  A state change which
+     * is proactively reported to the @c ContextManager is applied to the snapshot in place.  A change to any other state
+     * in the snapshot discards it, and a new one is fetched.  Providers which change their state without telling the
+     * @c ContextManager are not observed, so a snapshot is only used while it is younger than @c maxAge.  Each Recognize
+     * event submits a metric saying whether the snapshot was used, and how long the context request it replaced took.
+     *
+     * @param maxAge The maximum age of a snapshot which may be sent with a Recognize event.  Zero disables the mode.
+     */
+    void enableWarmContext(std::chrono::milliseconds maxAge);
+
+    /**
+     * Asks the @c AudioInputProcessor to refresh its warm context snapshot, if the warm context mode is enabled.
+     * Applications should call this when a Recognize event becomes likely, e.g. as soon as the wake word engine sees
+     * the start of a possible wake word, so that the snapshot is ready by the time the wake word is confirmed.
+     */
+    void prefetchContext();
+
     /// @name ContextRequesterInterface Functions
     /// @{
     void onContextAvailable(const std::string& jsonContext) override;
+    void onContextAvailable(
+        const avsCommon::sdkInterfaces::endpoints::EndpointIdentifier& endpointId,
+        const avsCommon::avs::AVSContext& endpointContext,
+        avsCommon::sdkInterfaces::ContextRequestToken requestToken) override;
     void onContextFailure(const avsCommon::sdkInterfaces::ContextRequestError error) override;
+    void onContextFailure(
+        const avsCommon::sdkInterfaces::ContextRequestError error,
+        avsCommon::sdkInterfaces::ContextRequestToken requestToken) override;
+    /// @}
+
+    /// @name ContextManagerObserverInterface Functions
+    /// @{
+    void onStateChanged(
+        const avsCommon::avs::CapabilityTag& identifier,
+        const avsCommon::avs::CapabilityState& state,
+        avsCommon::sdkInterfaces::AlexaStateChangeCauseType cause) override;
+    void onStateInvalidated(const avsCommon::avs::CapabilityTag& identifier) override;
     /// @}
 
     /// @name MessageRequestObserverInterface Functions
@@ -581,6 +622,52 @@ private:
      */
     void executeOnContextFailure(const avsCommon::sdkInterfaces::ContextRequestError error);
 
+    /**
+     * This function enables or disables the warm context mode.
+     *
+     * @param maxAge The maximum age of a snapshot which may be sent with a Recognize event.  Zero disables the mode.
+     */
+    void executeEnableWarmContext(std::chrono::milliseconds maxAge);
+
+    /**
+     * This function requests a new warm context snapshot from the @c ContextManager, unless a request is already in
+     * flight, in which case the result of that request is discarded and requested again when it arrives.
+     */
+    void executePrefetchContext();
+
+    /**
+     * This function receives the result of a warm context request.
+     *
+     * @param context The context, or no value if the request failed.
+     */
+    void executeOnPrefetchedContext(const avsCommon::utils::Optional<avsCommon::avs::AVSContext>& context);
+
+    /**
+     * This function applies a proactively reported state change to the warm context snapshot.
+     *
+     * @param identifier Identifies the state which changed.
+     * @param state The new state.
+     */
+    void executeOnWarmContextStateChanged(
+        const avsCommon::avs::CapabilityTag& identifier,
+        const avsCommon::avs::CapabilityState& state);
+
+    /**
+     * This function discards the warm context snapshot if it holds a state which has changed, and fetches a new one.
+     *
+     * @param identifier Identifies the state which changed.
+     */
+    void executeOnWarmContextStateInvalidated(const avsCommon::avs::CapabilityTag& identifier);
+
+    /**
+     * This function takes the warm context snapshot if it may be sent with a Recognize event.
+     *
+     * @param[out] jsonContext The snapshot, if one was taken.
+     * @param[out] fetchDuration How long the request for the snapshot took, if one was taken.
+     * @return Whether a snapshot was taken.
+     */
+    bool executeTakeWarmContext(std::string* jsonContext, std::chrono::milliseconds* fetchDuration);
+
     /**
      * This function is called when the @c FocusManager focus changes.  This might occur when another component
      * acquires focus on the dialog channel, in which case the @c AudioInputProcessor will end any activity and return
@@ -903,6 +990,33 @@ private:
      */
     std::string m_preCachedDialogRequestId;
 
+    /// The maximum age of a warm context snapshot which may be sent with a Recognize event.  Zero when disabled.
+    std::chrono::milliseconds m_warmContextMaxAge;
+
+    /// Whether a warm context request is in flight.
+    bool m_prefetchInFlight;
+
+    /// Whether a new snapshot was requested while the warm context request was in flight, making its result out of date.
+    bool m_prefetchStale;
+
+    /// The token of the warm context request in flight.
+    avsCommon::sdkInterfaces::ContextRequestToken m_prefetchToken;
+
+    /// The time the warm context request in flight was made.
+    std::chrono::steady_clock::time_point m_prefetchStartTime;
+
+    /// Whether there is a warm context snapshot.
+    bool m_hasWarmContext;
+
+    /// The warm context snapshot, if @c m_hasWarmContext is set.
+    avsCommon::avs::AVSContext m_warmContext;
+
+    /// The time the request for @c m_warmContext was made.
+    std::chrono::steady_clock::time_point m_warmContextTime;
+
+    /// How long the request for @c m_warmContext took.
+    std::chrono::milliseconds m_warmContextFetchDuration;
+
     /**
      * Value that will contain the time since last wake from suspend when AIP acquires the wakelock.
      */
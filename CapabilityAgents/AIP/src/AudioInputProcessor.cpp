@@ -227,6 +227,13 @@ static const std::string STOP_CAPTURE_TO_END_OF_SPEECH_METRIC_NAME = "STOP_CAPTU
 static const std::string STOP_CAPTURE_TO_END_OF_SPEECH_ACTIVITY_NAME =
     METRIC_ACTIVITY_NAME_PREFIX_AIP + STOP_CAPTURE_TO_END_OF_SPEECH_METRIC_NAME;
 
+/// The warm context metric, reporting whether a Recognize event used the warm context snapshot, and the latency saved.
+static const std::string WARM_CONTEXT = "WARM_CONTEXT";
+static const std::string WARM_CONTEXT_ACTIVITY_NAME = METRIC_ACTIVITY_NAME_PREFIX_AIP + WARM_CONTEXT;
+static const std::string WARM_CONTEXT_HIT = "WARM_CONTEXT_HIT";
+static const std::string WARM_CONTEXT_MISS = "WARM_CONTEXT_MISS";
+static const std::string WARM_CONTEXT_LATENCY_SAVED = "WARM_CONTEXT_LATENCY_SAVED";
+
 /// The recognize request initiator metric.
 static const std::string INITIATOR_PREFIX = "INITIATOR_";
 static const std::string INITIATOR_ACTIVITY_NAME_PREFIX = METRIC_ACTIVITY_NAME_PREFIX_AIP + INITIATOR_PREFIX;
@@ -578,14 +585,57 @@ std::future<void> AudioInputProcessor::resetState() {
     return m_executor.submit([this]() { executeResetState(); });
 }
 
+void AudioInputProcessor::enableWarmContext(std::chrono::milliseconds maxAge) {
+    m_executor.submit([this, maxAge]() { executeEnableWarmContext(maxAge); });
+}
+
+void AudioInputProcessor::prefetchContext() {
+    m_executor.submit([this]() { executePrefetchContext(); });
+}
+
 void AudioInputProcessor::onContextAvailable(const std::string& jsonContext) {
     m_executor.submit([this, jsonContext]() { executeOnContextAvailable(jsonContext); });
 }
 
+void AudioInputProcessor::onContextAvailable(
+    const avsCommon::sdkInterfaces::endpoints::EndpointIdentifier& endpointId,
+    const avsCommon::avs::AVSContext& endpointContext,
+    ContextRequestToken requestToken) {
+    m_executor.submit([this, endpointContext, requestToken]() {
+        if (m_prefetchInFlight && requestToken == m_prefetchToken) {
+            executeOnPrefetchedContext(endpointContext);
+        } else {
+            executeOnContextAvailable(endpointContext.toJson());
+        }
+    });
+}
+
 void AudioInputProcessor::onContextFailure(const ContextRequestError error) {
     m_executor.submit([this, error]() { executeOnContextFailure(error); });
 }
 
+void AudioInputProcessor::onContextFailure(const ContextRequestError error, ContextRequestToken requestToken) {
+    m_executor.submit([this, error, requestToken]() {
+        if (m_prefetchInFlight && requestToken == m_prefetchToken) {
+            ACSDK_WARN(LX("prefetchContextFailed").d("reason", error));
+            executeOnPrefetchedContext(Optional<AVSContext>());
+        } else {
+            executeOnContextFailure(error);
+        }
+    });
+}
+
+void AudioInputProcessor::onStateChanged(
+    const avsCommon::avs::CapabilityTag& identifier,
+    const avsCommon::avs::CapabilityState& state,
+    avsCommon::sdkInterfaces::AlexaStateChangeCauseType cause) {
+    m_executor.submit([this, identifier, state]() { executeOnWarmContextStateChanged(identifier, state); });
+}
+
+void AudioInputProcessor::onStateInvalidated(const avsCommon::avs::CapabilityTag& identifier) {
+    m_executor.submit([this, identifier]() { executeOnWarmContextStateInvalidated(identifier); });
+}
+
 void AudioInputProcessor::handleDirectiveImmediately(std::shared_ptr<avsCommon::avs::AVSDirective> directive) {
     handleDirective(std::make_shared<DirectiveInfo>(directive, nullptr));
 }
@@ -702,6 +752,12 @@ AudioInputProcessor::AudioInputProcessor(
         m_wakeWordsSetting{wakeWordsSetting},
         m_powerResourceManager{powerResourceManager},
         m_expectSpeechTimeoutHandler{expectSpeechTimeoutHandler},
+        m_warmContextMaxAge{std::chrono::milliseconds::zero()},
+        m_prefetchInFlight{false},
+        m_prefetchStale{false},
+        m_prefetchToken{0},
+        m_hasWarmContext{false},
+        m_warmContextFetchDuration{std::chrono::milliseconds::zero()},
         m_timeSinceLastResumeMS{std::chrono::milliseconds(0)},
         m_timeSinceLastPartialMS{std::chrono::milliseconds(0)},
         m_resourceFlags{0},
@@ -772,6 +828,10 @@ settings::SettingEventMetadata AudioInputProcessor::getWakeWordsEventsMetadata()
 
 void AudioInputProcessor::doShutdown() {
     m_executor.shutdown();
+    if (m_warmContextMaxAge != milliseconds::zero()) {
+        m_contextManager->removeContextManagerObserver(shared_from_this());
+        m_warmContextMaxAge = milliseconds::zero();
+    }
     executeResetState();
     m_directiveSequencer.reset();
     m_messageSender.reset();
@@ -1250,8 +1310,14 @@ bool AudioInputProcessor::executeRecognize(
     m_localStopCapturePerformed = false;
     m_streamIsClosedInRecognizingState = false;
 
-    //  Start assembling the context; we'll service the callback after assembling our Recognize event.
-    m_contextManager->getContextWithoutReportableStateProperties(shared_from_this());
+    // Use the warm context snapshot if there is a fresh one, otherwise start assembling the context; either way, we'll
+    // service it after assembling our Recognize event.
+    std::string warmContext;
+    auto contextLatencySaved = milliseconds::zero();
+    bool usingWarmContext = executeTakeWarmContext(&warmContext, &contextLatencySaved);
+    if (!usingWarmContext) {
+        m_contextManager->getContextWithoutReportableStateProperties(shared_from_this());
+    }
 
     // Stop the ExpectSpeech timer so we don't get a timeout.
     m_expectingSpeechTimer.stop();
@@ -1324,6 +1390,116 @@ bool AudioInputProcessor::executeRecognize(
         START_OF_UTTERANCE,
         std::map<std::string, std::string>{{"initiator", !initiatorString.empty() ? initiatorString : "unknown"}});
 
+    if (m_warmContextMaxAge != milliseconds::zero()) {
+        MetricEventBuilder metricEventBuilder;
+        metricEventBuilder.setActivityName(WARM_CONTEXT_ACTIVITY_NAME);
+        if (usingWarmContext) {
+            metricEventBuilder.addDataPoint(DataPointCounterBuilder{}.setName(WARM_CONTEXT_HIT).increment(1).build())
+                .addDataPoint(
+                    DataPointDurationBuilder{contextLatencySaved}.setName(WARM_CONTEXT_LATENCY_SAVED).build());
+        } else {
+            metricEventBuilder.addDataPoint(
+                DataPointCounterBuilder{}.setName(WARM_CONTEXT_MISS).increment(1).build());
+        }
+        submitMetric(m_metricRecorder, metricEventBuilder, m_preCachedDialogRequestId);
+    }
+
+    if (usingWarmContext) {
+        ACSDK_DEBUG5(LX("usingWarmContext").d("latencySavedMs", contextLatencySaved.count()));
+        executeOnContextAvailable(warmContext);
+    }
+
+    return true;
+}
+
+void AudioInputProcessor::executeEnableWarmContext(std::chrono::milliseconds maxAge) {
+    ACSDK_DEBUG5(LX(__func__).d("maxAgeMs", maxAge.count()));
+    if (!m_contextManager) {
+        ACSDK_ERROR(LX("executeEnableWarmContextFailed").d("reason", "nullContextManager"));
+        return;
+    }
+    if (maxAge < milliseconds::zero()) {
+        maxAge = milliseconds::zero();
+    }
+
+    bool wasEnabled = m_warmContextMaxAge != milliseconds::zero();
+    m_warmContextMaxAge = maxAge;
+    if (maxAge == milliseconds::zero()) {
+        m_hasWarmContext = false;
+        m_warmContext = AVSContext();
+        if (wasEnabled) {
+            m_contextManager->removeContextManagerObserver(shared_from_this());
+        }
+        return;
+    }
+    if (!wasEnabled) {
+        m_contextManager->addContextManagerObserver(shared_from_this());
+    }
+    executePrefetchContext();
+}
+
+void AudioInputProcessor::executePrefetchContext() {
+    if (m_warmContextMaxAge == milliseconds::zero() || !m_contextManager) {
+        return;
+    }
+    if (m_prefetchInFlight) {
+        // The request in flight may already have collected the old state, so ask again when it completes.
+        m_prefetchStale = true;
+        return;
+    }
+    m_prefetchInFlight = true;
+    m_prefetchStale = false;
+    m_prefetchStartTime = steady_clock::now();
+    m_prefetchToken = m_contextManager->getContextWithoutReportableStateProperties(shared_from_this());
+}
+
+void AudioInputProcessor::executeOnPrefetchedContext(const Optional<AVSContext>& context) {
+    m_prefetchInFlight = false;
+    if (m_warmContextMaxAge == milliseconds::zero()) {
+        return;
+    }
+    if (m_prefetchStale) {
+        executePrefetchContext();
+        return;
+    }
+    m_hasWarmContext = context.hasValue();
+    m_warmContext = context.valueOr(AVSContext());
+    m_warmContextTime = m_prefetchStartTime;
+    m_warmContextFetchDuration = duration_cast<milliseconds>(steady_clock::now() - m_prefetchStartTime);
+}
+
+void AudioInputProcessor::executeOnWarmContextStateChanged(const CapabilityTag& identifier, const CapabilityState& state) {
+    // A change reported while a request is in flight is already in its result, as the ContextManager assembles the
+    // context after notifying us.  Only states in the snapshot are updated; the others were left out on purpose.
+    if (!m_hasWarmContext || !m_warmContext.getState(identifier).hasValue()) {
+        return;
+    }
+    m_warmContext.removeState(identifier);
+    m_warmContext.addState(identifier, state);
+}
+
+void AudioInputProcessor::executeOnWarmContextStateInvalidated(const CapabilityTag& identifier) {
+    if (!m_hasWarmContext || !m_warmContext.getState(identifier).hasValue()) {
+        return;
+    }
+    ACSDK_DEBUG5(LX("warmContextInvalidated").d("namespace", identifier.nameSpace).d("name", identifier.name));
+    m_hasWarmContext = false;
+    m_warmContext = AVSContext();
+    executePrefetchContext();
+}
+
+bool AudioInputProcessor::executeTakeWarmContext(std::string* jsonContext, std::chrono::milliseconds* fetchDuration) {
+    if (m_warmContextMaxAge == milliseconds::zero() || !m_hasWarmContext) {
+        return false;
+    }
+    m_hasWarmContext = false;
+    auto context = std::move(m_warmContext);
+    m_warmContext = AVSContext();
+    if (steady_clock::now() - m_warmContextTime > m_warmContextMaxAge) {
+        return false;
+    }
+    *jsonContext = context.toJson();
+    *fetchDuration = m_warmContextFetchDuration;
     return true;
 }
 
@@ -1650,6 +1826,11 @@ void AudioInputProcessor::setState(ObserverInterface::State state) {
     m_state = state;
     managePowerResource(m_state);
 
+    // The snapshot was consumed by the interaction which just ended, so warm up the next one.
+    if (ObserverInterface::State::IDLE == m_state && !m_hasWarmContext) {
+        executePrefetchContext();
+    }
+
     for (auto observer : m_observers) {
         observer->onStateChanged(m_state);
     }
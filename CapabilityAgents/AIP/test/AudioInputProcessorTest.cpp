@@ -3895,6 +3895,163 @@ TEST_F(AudioInputProcessorTest, test_recognizeWorksWithOneFormatInRequestEncodin
     auto end = AudioInputProcessor::INVALID_INDEX;
     EXPECT_TRUE(testRecognizeSucceeds(*m_audioProvider, Initiator::WAKEWORD, begin, end, KEYWORD_TEXT));
 }
+
+/**
+ * This function verifies that once a warm context snapshot is available, a Recognize event is sent with it without
+ * requesting the context again.
+ */
+TEST_F(AudioInputProcessorTest, test_recognizeUsesWarmContext) {
+    std::mutex mutex;
+    std::condition_variable conditionVariable;
+    bool prefetchRequested = false;
+    bool sent = false;
+
+    EXPECT_CALL(*m_mockContextManager, addContextManagerObserver(_));
+    EXPECT_CALL(*m_mockContextManager, getContextWithoutReportableStateProperties(_, _, _))
+        .WillOnce(InvokeWithoutArgs([&] {
+            std::lock_guard<std::mutex> lock(mutex);
+            prefetchRequested = true;
+            conditionVariable.notify_one();
+            return CONTEXT_REQUEST_TOKEN;
+        }));
+    m_audioInputProcessor->enableWarmContext(std::chrono::minutes(1));
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        ASSERT_TRUE(conditionVariable.wait_for(lock, TEST_TIMEOUT, [&] { return prefetchRequested; }));
+    }
+    m_audioInputProcessor->onContextAvailable("", avsCommon::avs::AVSContext(), CONTEXT_REQUEST_TOKEN);
+
+    EXPECT_CALL(*m_mockObserver, onStateChanged(AudioInputProcessorObserverInterface::State::RECOGNIZING));
+    EXPECT_CALL(*m_mockUserInactivityMonitor, onUserActive()).Times(AtLeast(1));
+    EXPECT_CALL(*m_mockPowerResourceManager, acquire(IsSamePowerResource(COMPONENT_NAME), _)).Times(AtLeast(1));
+    EXPECT_CALL(*m_mockFocusManager, acquireChannel(CHANNEL_NAME, _)).WillOnce(InvokeWithoutArgs([this] {
+        m_audioInputProcessor->onFocusChanged(avsCommon::avs::FocusState::FOREGROUND, MixingBehavior::PRIMARY);
+        return true;
+    }));
+    EXPECT_CALL(*m_mockMessageSender, sendMessage(_)).WillOnce(InvokeWithoutArgs([&] {
+        std::lock_guard<std::mutex> lock(mutex);
+        sent = true;
+        conditionVariable.notify_one();
+    }));
+
+    RecognizeEvent recognize(*m_audioProvider, Initiator::TAP);
+    ASSERT_TRUE(recognize.send(m_audioInputProcessor).get());
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        ASSERT_TRUE(conditionVariable.wait_for(lock, TEST_TIMEOUT, [&] { return sent; }));
+    }
+
+    EXPECT_CALL(*m_mockObserver, onStateChanged(AudioInputProcessorObserverInterface::State::IDLE));
+    EXPECT_CALL(*m_mockContextManager, removeContextManagerObserver(_));
+    m_audioInputProcessor->enableWarmContext(std::chrono::milliseconds::zero());
+    m_audioInputProcessor->resetState().get();
+}
+
+/**
+ * This function verifies that a state change reported to the @c ContextManager is applied to the warm context snapshot
+ * without requesting the context again.
+ */
+TEST_F(AudioInputProcessorTest, test_reportedStateChangeUpdatesWarmContext) {
+    std::mutex mutex;
+    std::condition_variable conditionVariable;
+    bool prefetchRequested = false;
+    std::string sentJson;
+    const avsCommon::avs::CapabilityTag tag(NAMESPACE, "RecognizerState", "");
+
+    EXPECT_CALL(*m_mockContextManager, addContextManagerObserver(_));
+    EXPECT_CALL(*m_mockContextManager, getContextWithoutReportableStateProperties(_, _, _))
+        .WillOnce(InvokeWithoutArgs([&] {
+            std::lock_guard<std::mutex> lock(mutex);
+            prefetchRequested = true;
+            conditionVariable.notify_one();
+            return CONTEXT_REQUEST_TOKEN;
+        }));
+    m_audioInputProcessor->enableWarmContext(std::chrono::minutes(1));
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        ASSERT_TRUE(conditionVariable.wait_for(lock, TEST_TIMEOUT, [&] { return prefetchRequested; }));
+    }
+    avsCommon::avs::AVSContext context;
+    context.addState(tag, avsCommon::avs::CapabilityState("\"oldValue\""));
+    m_audioInputProcessor->onContextAvailable("", context, CONTEXT_REQUEST_TOKEN);
+    m_audioInputProcessor->onStateChanged(
+        tag,
+        avsCommon::avs::CapabilityState("\"newValue\""),
+        avsCommon::sdkInterfaces::AlexaStateChangeCauseType::APP_INTERACTION);
+
+    EXPECT_CALL(*m_mockObserver, onStateChanged(AudioInputProcessorObserverInterface::State::RECOGNIZING));
+    EXPECT_CALL(*m_mockUserInactivityMonitor, onUserActive()).Times(AtLeast(1));
+    EXPECT_CALL(*m_mockPowerResourceManager, acquire(IsSamePowerResource(COMPONENT_NAME), _)).Times(AtLeast(1));
+    EXPECT_CALL(*m_mockFocusManager, acquireChannel(CHANNEL_NAME, _)).WillOnce(InvokeWithoutArgs([this] {
+        m_audioInputProcessor->onFocusChanged(avsCommon::avs::FocusState::FOREGROUND, MixingBehavior::PRIMARY);
+        return true;
+    }));
+    EXPECT_CALL(*m_mockMessageSender, sendMessage(_))
+        .WillOnce(Invoke([&](std::shared_ptr<avsCommon::avs::MessageRequest> request) {
+            std::lock_guard<std::mutex> lock(mutex);
+            sentJson = request->getJsonContent();
+            conditionVariable.notify_one();
+        }));
+
+    RecognizeEvent recognize(*m_audioProvider, Initiator::TAP);
+    ASSERT_TRUE(recognize.send(m_audioInputProcessor).get());
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        ASSERT_TRUE(conditionVariable.wait_for(lock, TEST_TIMEOUT, [&] { return !sentJson.empty(); }));
+    }
+    EXPECT_NE(sentJson.find("newValue"), std::string::npos);
+    EXPECT_EQ(sentJson.find("oldValue"), std::string::npos);
+
+    EXPECT_CALL(*m_mockObserver, onStateChanged(AudioInputProcessorObserverInterface::State::IDLE));
+    EXPECT_CALL(*m_mockContextManager, removeContextManagerObserver(_));
+    m_audioInputProcessor->enableWarmContext(std::chrono::milliseconds::zero());
+    m_audioInputProcessor->resetState().get();
+}
+
+/**
+ * This function verifies that a change to a state in the warm context snapshot which was not proactively reported
+ * discards the snapshot and requests the context again, and that changes to other states are ignored.
+ */
+TEST_F(AudioInputProcessorTest, test_invalidatedStateRefreshesWarmContext) {
+    std::mutex mutex;
+    std::condition_variable conditionVariable;
+    size_t requests = 0;
+    const avsCommon::avs::CapabilityTag tag(NAMESPACE, "RecognizerState", "");
+
+    EXPECT_CALL(*m_mockContextManager, addContextManagerObserver(_));
+    EXPECT_CALL(*m_mockContextManager, getContextWithoutReportableStateProperties(_, _, _))
+        .Times(2)
+        .WillRepeatedly(InvokeWithoutArgs([&] {
+            std::lock_guard<std::mutex> lock(mutex);
+            requests++;
+            conditionVariable.notify_one();
+            return CONTEXT_REQUEST_TOKEN;
+        }));
+    m_audioInputProcessor->enableWarmContext(std::chrono::minutes(1));
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        ASSERT_TRUE(conditionVariable.wait_for(lock, TEST_TIMEOUT, [&] { return requests == 1; }));
+    }
+
+    // An invalidation while the request is in flight is already reflected in its result.
+    m_audioInputProcessor->onStateInvalidated(tag);
+    avsCommon::avs::AVSContext context;
+    context.addState(tag, avsCommon::avs::CapabilityState("{}"));
+    m_audioInputProcessor->onContextAvailable("", context, CONTEXT_REQUEST_TOKEN);
+
+    // States which are not in the snapshot don't matter.
+    m_audioInputProcessor->onStateInvalidated(avsCommon::avs::CapabilityTag(NAMESPACE, "OtherState", ""));
+    m_audioInputProcessor->onStateInvalidated(tag);
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        ASSERT_TRUE(conditionVariable.wait_for(lock, TEST_TIMEOUT, [&] { return requests == 2; }));
+    }
+
+    EXPECT_CALL(*m_mockContextManager, removeContextManagerObserver(_));
+    m_audioInputProcessor->enableWarmContext(std::chrono::milliseconds::zero());
+    m_audioInputProcessor->resetState().get();
+}
+
 }  // namespace test
 }  // namespace aip
 }  // namespace capabilityAgents
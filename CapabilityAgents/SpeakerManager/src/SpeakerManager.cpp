@@ -357,6 +357,8 @@ void SpeakerManager::executeSendSpeakerSettingsChangedEvent(
 
     auto event = buildJsonEventString(eventName, "", buffer.GetString());
     auto request = std::make_shared<MessageRequest>(event.second);
+    // The event carries the full speaker settings, so a later event of the same name supersedes an unsent one.
+    request->setCoalescingKey(NAMESPACE + "." + eventName);
     m_messageSender->sendMessage(request);
 }
 
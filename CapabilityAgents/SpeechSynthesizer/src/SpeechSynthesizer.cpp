@@ -620,8 +620,9 @@ void SpeechSynthesizer::executePreHandleAfterValidation(std::shared_ptr<SpeakDir
         return;
     }
 
-    Document payload;
-    if (payload.Parse(speakInfo->directive->getPayload()).HasParseError()) {
+    // The directive was parsed when it was created, so read its payload in place.
+    const Value& payload = speakInfo->directive->getPayloadValue();
+    if (!payload.IsObject()) {
         const std::string message("unableToParsePayload" + speakInfo->directive->getMessageId());
         ACSDK_ERROR(
             LX("executePreHandleFailed").d("reason", message).d("messageId", speakInfo->directive->getMessageId()));
@@ -710,7 +711,7 @@ void SpeechSynthesizer::executePreHandleAfterValidation(std::shared_ptr<SpeakDir
         auto captionIterator = payload.FindMember(KEY_CAPTION);
         if (payload.MemberEnd() != captionIterator) {
             if (captionIterator->value.IsObject()) {
-                rapidjson::Value& captionsPayload = payload[KEY_CAPTION];
+                const rapidjson::Value& captionsPayload = payload[KEY_CAPTION];
 
                 auto captionFormat = captions::CaptionFormat::UNKNOWN;
                 captionIterator = captionsPayload.FindMember(KEY_CAPTION_TYPE);
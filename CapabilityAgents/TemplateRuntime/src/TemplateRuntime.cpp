@@ -15,8 +15,6 @@
 
 #include <ostream>
 
-#include <rapidjson/error/en.h>
-
 #include <AVSCommon/AVS/CapabilityConfiguration.h>
 #include <AVSCommon/Utils/JSON/JSONUtils.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
@@ -348,12 +346,10 @@ void TemplateRuntime::handleRenderPlayerInfoDirective(std::shared_ptr<DirectiveI
         ACSDK_DEBUG5(LX("handleRenderPlayerInfoDirectiveInExecutor"));
         m_isRenderTemplateLastReceived = false;
 
-        rapidjson::Document payload;
-        rapidjson::ParseResult result = payload.Parse(info->directive->getPayload());
-        if (!result) {
+        const rapidjson::Value& payload = info->directive->getPayloadValue();
+        if (!payload.IsObject()) {
             ACSDK_ERROR(LX("handleRenderPlayerInfoDirectiveInExecutorParseFailed")
-                            .d("reason", rapidjson::GetParseError_En(result.Code()))
-                            .d("offset", result.Offset())
+                            .d("reason", "invalidPayload")
                             .d("messageId", info->directive->getMessageId()));
             sendExceptionEncounteredAndReportFailed(
                 info, "Unable to parse payload", ExceptionErrorType::UNEXPECTED_INFORMATION_RECEIVED);
@@ -53,8 +53,12 @@ public:
      * Constructor.
      *
      * @param dbFilePath The location of the SQLite database file.
+     * @param databaseOptions The options to open the database with.
      */
-    SQLiteMessageStorage(const std::string& databaseFilePath);
+    SQLiteMessageStorage(
+        const std::string& databaseFilePath,
+        const alexaClientSDK::storage::sqliteStorage::SQLiteDatabase::Options& databaseOptions =
+            alexaClientSDK::storage::sqliteStorage::SQLiteDatabase::Options());
 
     ~SQLiteMessageStorage();
 
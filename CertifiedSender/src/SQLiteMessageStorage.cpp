@@ -94,11 +94,15 @@ std::unique_ptr<SQLiteMessageStorage> SQLiteMessageStorage::create(
         return nullptr;
     }
 
-    return std::unique_ptr<SQLiteMessageStorage>(new SQLiteMessageStorage(certifiedSenderDatabaseFilePath));
+    return std::unique_ptr<SQLiteMessageStorage>(new SQLiteMessageStorage(
+        certifiedSenderDatabaseFilePath,
+        storage::sqliteStorage::SQLiteDatabase::Options::fromConfiguration(certifiedSenderConfigurationRoot)));
 }
 
-SQLiteMessageStorage::SQLiteMessageStorage(const std::string& certifiedSenderDatabaseFilePath) :
-        m_database{certifiedSenderDatabaseFilePath} {
+SQLiteMessageStorage::SQLiteMessageStorage(
+    const std::string& certifiedSenderDatabaseFilePath,
+    const storage::sqliteStorage::SQLiteDatabase::Options& databaseOptions) :
+        m_database{certifiedSenderDatabaseFilePath, databaseOptions} {
 }
 
 SQLiteMessageStorage::~SQLiteMessageStorage() {
@@ -56,6 +56,8 @@ static const std::string DATABASE_COLUMN_MESSAGE_TEXT_NAME = "message_text";
 static const std::string DATABASE_COLUMN_URI = "uri";
 /// The name of the 'timestamp' field is the creation time of the message.
 static const std::string DATABASE_COLUMN_TIMESTAMP = "timestamp";
+/// The number of messages stored, loaded and erased by the benchmark.
+static const int BENCHMARK_MESSAGE_COUNT = 500;
 /// The SQL string to create the alerts table.
 static const std::string CREATE_LEGACY_MESSAGES_TABLE_SQL_STRING =
     std::string("CREATE TABLE ") + MESSAGES_TABLE_NAME + " (" + DATABASE_COLUMN_ID_NAME + " INT PRIMARY KEY NOT NULL," +
@@ -106,6 +108,13 @@ public:
      */
     bool createOldMessages();
 
+    /**
+     * Utility function to store, load and erase messages one at a time, as @c CertifiedSender does.
+     *
+     * @param options The options of the database.
+     */
+    void runStoreLoadEraseBenchmark(const alexaClientSDK::storage::sqliteStorage::SQLiteDatabase::Options& options);
+
 protected:
     /// The message database object we will test.
     std::shared_ptr<MessageStorageInterface> m_storage;
@@ -433,6 +442,48 @@ TEST_F(MessageStorageTest, test_EraseMessageOverAgeAndSizeLimit) {
     EXPECT_EQ(static_cast<int>(dbMessagesAfter.size()), 0);
 }
 
+void MessageStorageTest::runStoreLoadEraseBenchmark(
+    const alexaClientSDK::storage::sqliteStorage::SQLiteDatabase::Options& options) {
+    cleanupLocalDbFile();
+    SQLiteMessageStorage storage(g_dbTestFilePath, options);
+    ASSERT_TRUE(storage.createDatabase());
+
+    std::vector<int> ids(BENCHMARK_MESSAGE_COUNT);
+    for (auto& id : ids) {
+        ASSERT_TRUE(storage.store(TEST_MESSAGE_ONE, TEST_MESSAGE_URI, &id));
+    }
+
+    std::queue<MessageStorageInterface::StoredMessage> messages;
+    ASSERT_TRUE(storage.load(&messages));
+    EXPECT_EQ(messages.size(), ids.size());
+
+    for (auto id : ids) {
+        ASSERT_TRUE(storage.erase(id));
+    }
+    storage.close();
+}
+
+/**
+ * Benchmark of storing, loading and erasing messages with the default database options.
+ */
+TEST_F(MessageStorageTest, testSlow_benchmarkStoreLoadEraseDefaultOptions) {
+    alexaClientSDK::storage::sqliteStorage::SQLiteDatabase::Options options;
+    options.statementCacheSize = 0;
+    runStoreLoadEraseBenchmark(options);
+}
+
+/**
+ * Benchmark of storing, loading and erasing messages with the statement cache, write-ahead log, @c synchronous=NORMAL
+ * and mmap enabled.
+ */
+TEST_F(MessageStorageTest, testSlow_benchmarkStoreLoadEraseTunedOptions) {
+    alexaClientSDK::storage::sqliteStorage::SQLiteDatabase::Options options;
+    options.writeAheadLog = true;
+    options.synchronousNormal = true;
+    options.mmapSize = 4 * 1024 * 1024;
+    runStoreLoadEraseBenchmark(options);
+}
+
 }  // namespace test
 }  // namespace certifiedSender
 }  // namespace alexaClientSDK
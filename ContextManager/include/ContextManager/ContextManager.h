@@ -23,6 +23,7 @@
 #include <mutex>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include <AVSCommon/AVS/CapabilityTag.h>
 #include <AVSCommon/AVS/StateRefreshPolicy.h>
@@ -145,6 +146,9 @@ private:  // Private type declarations.
         /// The refresh policy which is only used for legacy capabilities.
         avsCommon::avs::StateRefreshPolicy refreshPolicy;
 
+        /// The state serialized as an element of the context, or empty if there is no state to report.
+        std::string jsonFragment;
+
         /**
          * Constructor.
          *
@@ -181,6 +185,20 @@ private:  // Private type declarations.
     /// Alias for endpoint id.
     using EndpointIdentifier = avsCommon::sdkInterfaces::endpoints::EndpointIdentifier;
 
+    /**
+     * The last context serialized for an endpoint, which is reused while the states of the endpoint do not change.
+     */
+    struct ContextCache {
+        /// Whether a state of the endpoint changed since @c json was built.
+        bool dirty = true;
+
+        /// For each entry of the endpoint's @c CapabilitiesState, in iteration order, whether it was in the context.
+        std::vector<bool> included;
+
+        /// The serialized context.
+        std::shared_ptr<const std::string> json;
+    };
+
     /**
      * Structure used to save information about a request.
      */
@@ -230,9 +248,10 @@ private:  // Private method declarations.
      * @param capabilityIdentifier The capability identifier.
      * @param jsonState The state of the @c StateProviderInterface.
      * @param refreshPolicy The refresh policy for the state.
+     * @return Whether the value of the state changed.
      * @deprecated @c StateRefreshPolicy has been deprecated.
      */
-    void updateCapabilityState(
+    bool updateCapabilityState(
         const avsCommon::avs::CapabilityTag& capabilityIdentifier,
         const std::string& jsonState,
         const avsCommon::avs::StateRefreshPolicy& refreshPolicy);
@@ -242,12 +261,27 @@ private:  // Private method declarations.
      *
      * @param capabilityIdentifier The capability identifier.
      * @param capabilityState The capability state.
+     * @return Whether the value of the state changed.
      * @deprecated @c StateRefreshPolicy has been deprecated.
      */
-    void updateCapabilityState(
+    bool updateCapabilityState(
         const avsCommon::avs::CapabilityTag& capabilityIdentifier,
         const avsCommon::avs::CapabilityState& capabilityState);
 
+    /**
+     * Notifies the observers that a state which is not proactively reported has changed.
+     *
+     * @param capabilityIdentifier The capability identifier.
+     */
+    void notifyStateInvalidated(const avsCommon::avs::CapabilityTag& capabilityIdentifier);
+
+    /**
+     * Marks the cached context of an endpoint as out of date.  @c m_endpointsStateMutex must be held.
+     *
+     * @param endpointId The endpoint whose states changed.
+     */
+    void invalidateContextCacheLocked(const EndpointIdentifier& endpointId);
+
     /**
      * Request the @c ContextManager for context.
      *
@@ -314,6 +348,9 @@ private:  // Member variable declarations
     /// before accessing the map.
     std::unordered_map<EndpointIdentifier, CapabilitiesState> m_endpointsState;
 
+    /// The last context serialized for each endpoint.  Guarded like @c m_endpointsState.
+    std::unordered_map<EndpointIdentifier, ContextCache> m_contextCache;
+
     /// Mutex used to guard the pending state requests. This is only needed because of @c setState.
     std::mutex m_requestsMutex;
 
@@ -47,6 +47,20 @@ static const ContextRequestToken EMPTY_TOKEN = 0;
 
 static const std::string STATE_PROVIDER_TIMEOUT_METRIC_PREFIX = "ERROR.StateProviderTimeout.";
 
+/**
+ * Checks whether the value of a state changed, ignoring when it was sampled.
+ *
+ * @param before The state before the update.
+ * @param after The state after the update.
+ * @return Whether the value changed.
+ */
+static bool hasStateValueChanged(const Optional<CapabilityState>& before, const Optional<CapabilityState>& after) {
+    if (before.hasValue() != after.hasValue()) {
+        return true;
+    }
+    return before.hasValue() && before.value().valuePayload != after.value().valuePayload;
+}
+
 std::shared_ptr<ContextManagerInterface> ContextManager::createContextManagerInterface(
     const std::shared_ptr<DeviceInfo>& deviceInfo,
     const std::shared_ptr<avsCommon::utils::timing::MultiTimer>& multiTimer,
@@ -125,6 +139,7 @@ void ContextManager::addStateProvider(
     auto& endpointId = capabilityIdentifier.endpointId.empty() ? m_defaultEndpointId : capabilityIdentifier.endpointId;
     auto& capabilitiesState = m_endpointsState[endpointId];
     capabilitiesState[capabilityIdentifier] = StateInfo(std::move(stateProvider), Optional<CapabilityState>());
+    invalidateContextCacheLocked(endpointId);
 }
 
 void ContextManager::removeStateProvider(const avs::CapabilityTag& capabilityIdentifier) {
@@ -133,6 +148,7 @@ void ContextManager::removeStateProvider(const avs::CapabilityTag& capabilityIde
     auto& endpointId = capabilityIdentifier.endpointId.empty() ? m_defaultEndpointId : capabilityIdentifier.endpointId;
     auto& capabilitiesState = m_endpointsState[endpointId];
     capabilitiesState.erase(capabilityIdentifier);
+    invalidateContextCacheLocked(endpointId);
 }
 
 SetStateResult ContextManager::setState(
@@ -143,8 +159,10 @@ SetStateResult ContextManager::setState(
     ACSDK_DEBUG5(LX(__func__).sensitive("capability", capabilityIdentifier));
 
     if (EMPTY_TOKEN == stateRequestToken) {
-        m_executor.submit([this, capabilityIdentifier, jsonState, refreshPolicy] {
-            updateCapabilityState(capabilityIdentifier, jsonState, refreshPolicy);
+        m_executor.execute([this, capabilityIdentifier, jsonState, refreshPolicy] {
+            if (updateCapabilityState(capabilityIdentifier, jsonState, refreshPolicy)) {
+                notifyStateInvalidated(capabilityIdentifier);
+            }
         });
         return SetStateResult::SUCCESS;
     }
@@ -169,8 +187,10 @@ SetStateResult ContextManager::setState(
         return SetStateResult::STATE_PROVIDER_NOT_REGISTERED;
     }
 
-    m_executor.submit([this, capabilityIdentifier, jsonState, refreshPolicy, stateRequestToken] {
-        updateCapabilityState(capabilityIdentifier, jsonState, refreshPolicy);
+    m_executor.execute([this, capabilityIdentifier, jsonState, refreshPolicy, stateRequestToken] {
+        if (updateCapabilityState(capabilityIdentifier, jsonState, refreshPolicy)) {
+            notifyStateInvalidated(capabilityIdentifier);
+        }
         if (jsonState.empty() && (StateRefreshPolicy::ALWAYS == refreshPolicy)) {
             ACSDK_ERROR(LX("setStateFailed")
                             .d("missingState", capabilityIdentifier.nameSpace + "::" + capabilityIdentifier.name));
@@ -218,7 +238,7 @@ void ContextManager::reportStateChange(
     AlexaStateChangeCauseType cause) {
     ACSDK_DEBUG5(LX(__func__).sensitive("capability", capabilityIdentifier));
 
-    m_executor.submit([this, capabilityIdentifier, capabilityState, cause] {
+    m_executor.execute([this, capabilityIdentifier, capabilityState, cause] {
         updateCapabilityState(capabilityIdentifier, capabilityState);
         std::lock_guard<std::mutex> observerMutex{m_observerMutex};
         for (auto& observer : m_observers) {
@@ -235,6 +255,7 @@ void ContextManager::provideStateResponse(
 
     m_executor.submit([this, capabilityIdentifier, capabilityState, stateRequestToken] {
         std::function<void()> contextAvailableCallback = NoopCallback;
+        bool stateChanged = false;
         {
             std::lock_guard<std::mutex> requestsLock{m_requestsMutex};
             auto requestIt = m_pendingStateRequest.find(stateRequestToken);
@@ -255,7 +276,7 @@ void ContextManager::provideStateResponse(
                 return;
             }
 
-            updateCapabilityState(capabilityIdentifier, capabilityState);
+            stateChanged = updateCapabilityState(capabilityIdentifier, capabilityState);
 
             if (requestIt != m_pendingStateRequest.end()) {
                 requestIt->second.erase(capabilityIdentifier);
@@ -263,7 +284,10 @@ void ContextManager::provideStateResponse(
             contextAvailableCallback =
                 getContextAvailableCallbackIfReadyLocked(stateRequestToken, capabilityIdentifier.endpointId);
         }
-        /// Callback method should be called outside the lock.
+        /// Observers and callback method should be called outside the lock.
+        if (stateChanged) {
+            notifyStateInvalidated(capabilityIdentifier);
+        }
         contextAvailableCallback();
     });
 }
@@ -489,9 +513,13 @@ std::function<void()> ContextManager::getContextAvailableCallbackIfReadyLocked(
 
     AVSContext context;
     auto& requestEndpointId = endpointId.empty() ? m_defaultEndpointId : endpointId;
-    for (auto& capability : m_endpointsState[requestEndpointId]) {
-        auto stateProvider = capability.second.stateProvider;
-        auto stateInfo = capability.second;
+    auto& capabilitiesState = m_endpointsState[requestEndpointId];
+    auto& cache = m_contextCache[requestEndpointId];
+    std::vector<bool> included;
+    included.reserve(capabilitiesState.size());
+    for (auto& capability : capabilitiesState) {
+        auto& stateProvider = capability.second.stateProvider;
+        auto& stateInfo = capability.second;
         bool addState = false;
 
         if (stateInfo.legacyCapability) {
@@ -518,7 +546,39 @@ std::function<void()> ContextManager::getContextAvailableCallbackIfReadyLocked(
             ACSDK_DEBUG5(LX(__func__).sensitive("addState", capability.first));
             context.addState(capability.first, stateInfo.capabilityState.value());
         }
+        included.push_back(addState);
     }
+
+    // The serialized context only changes when a state changes, or when a provider starts or stops being reported.
+    // Otherwise reuse the last one; if not, join the fragments cached with each state, in the order of the context.
+    if (cache.dirty || !cache.json || cache.included != included) {
+        std::vector<const CapabilitiesState::value_type*> states;
+        states.reserve(capabilitiesState.size());
+        auto isIncluded = included.cbegin();
+        for (const auto& capability : capabilitiesState) {
+            if (*isIncluded++) {
+                states.push_back(&capability);
+            }
+        }
+        std::sort(
+            states.begin(),
+            states.end(),
+            [](const CapabilitiesState::value_type* lhs, const CapabilitiesState::value_type* rhs) {
+                return lhs->first < rhs->first;
+            });
+        std::vector<const std::string*> fragments;
+        fragments.reserve(states.size());
+        for (auto state : states) {
+            fragments.push_back(&state->second.jsonFragment);
+        }
+        cache.json = std::make_shared<const std::string>(AVSContext::fragmentsToJson(fragments));
+        cache.included = std::move(included);
+        cache.dirty = false;
+    } else {
+        ACSDK_DEBUG9(LX(__func__).d("result", "cachedContext").sensitive("endpointId", requestEndpointId));
+    }
+    context.setJson(cache.json);
+
     auto contextRequester = request.contextRequester;
 
     return [contextRequester, context, endpointId, requestToken]() {
@@ -528,7 +588,7 @@ std::function<void()> ContextManager::getContextAvailableCallbackIfReadyLocked(
     };
 }
 
-void ContextManager::updateCapabilityState(
+bool ContextManager::updateCapabilityState(
     const avsCommon::avs::CapabilityTag& capabilityIdentifier,
     const avsCommon::avs::CapabilityState& capabilityState) {
     std::lock_guard<std::mutex> statesLock{m_endpointsStateMutex};
@@ -539,7 +599,11 @@ void ContextManager::updateCapabilityState(
                    .sensitive("endpointId", endpointId)
                    .sensitive("identifier", capabilityIdentifier)
                    .sensitive("state", capabilityState.valuePayload));
-    capabilitiesState[capabilityIdentifier] = StateInfo(stateProvider, capabilityState);
+    auto& stateInfo = capabilitiesState[capabilityIdentifier];
+    bool changed = hasStateValueChanged(stateInfo.capabilityState, Optional<CapabilityState>(capabilityState));
+    stateInfo = StateInfo(stateProvider, capabilityState);
+    stateInfo.jsonFragment = AVSContext::stateToJson(capabilityIdentifier, capabilityState);
+    invalidateContextCacheLocked(endpointId);
     for (const auto& provider : m_endpointsState[endpointId]) {
         (void)provider;  // To avoid compiler warning in RELEASE builds where DEBUG log is compiled out
         ACSDK_DEBUG5(LX("updateCapabilityStateDetailed")
@@ -550,9 +614,10 @@ void ContextManager::updateCapabilityState(
                                  ? provider.second.capabilityState.value().valuePayload
                                  : "none"));
     }
+    return changed;
 }
 
-void ContextManager::updateCapabilityState(
+bool ContextManager::updateCapabilityState(
     const avsCommon::avs::CapabilityTag& capabilityIdentifier,
     const std::string& jsonState,
     const avsCommon::avs::StateRefreshPolicy& refreshPolicy) {
@@ -564,7 +629,13 @@ void ContextManager::updateCapabilityState(
                    .sensitive("endpointId", endpointId)
                    .sensitive("identifier", capabilityIdentifier)
                    .sensitive("state", jsonState));
-    capabilityInfo[capabilityIdentifier] = StateInfo(stateProvider, jsonState, refreshPolicy);
+    auto& stateInfo = capabilityInfo[capabilityIdentifier];
+    auto previousState = stateInfo.capabilityState;
+    stateInfo = StateInfo(stateProvider, jsonState, refreshPolicy);
+    if (stateInfo.capabilityState.hasValue()) {
+        stateInfo.jsonFragment = AVSContext::stateToJson(capabilityIdentifier, stateInfo.capabilityState.value());
+    }
+    invalidateContextCacheLocked(endpointId);
     for (const auto& provider : m_endpointsState[endpointId]) {
         (void)provider;  // To avoid compiler warning in RELEASE builds where DEBUG log is compiled out
         ACSDK_DEBUG5(LX("updateCapabilityStateDetailed")
@@ -575,6 +646,21 @@ void ContextManager::updateCapabilityState(
                                  ? provider.second.capabilityState.value().valuePayload
                                  : "none"));
     }
+    return hasStateValueChanged(previousState, stateInfo.capabilityState);
+}
+
+void ContextManager::notifyStateInvalidated(const CapabilityTag& capabilityIdentifier) {
+    std::lock_guard<std::mutex> observerMutex{m_observerMutex};
+    for (auto& observer : m_observers) {
+        observer->onStateInvalidated(capabilityIdentifier);
+    }
+}
+
+void ContextManager::invalidateContextCacheLocked(const EndpointIdentifier& endpointId) {
+    auto it = m_contextCache.find(endpointId);
+    if (it != m_contextCache.end()) {
+        it->second.dirty = true;
+    }
 }
 
 ContextManager::StateInfo::StateInfo(
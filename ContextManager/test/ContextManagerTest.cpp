@@ -13,6 +13,7 @@
  * permissions and limitations under the License.
  */
 
+#include <atomic>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
@@ -71,6 +72,7 @@ struct MockContextObserver : public ContextManagerObserverInterface {
     MOCK_METHOD3(
         onStateChanged,
         void(const avs::CapabilityTag& identifier, const avs::CapabilityState& state, AlexaStateChangeCauseType cause));
+    MOCK_METHOD1(onStateInvalidated, void(const avs::CapabilityTag& identifier));
 };
 
 /// Context Manager Test
@@ -479,6 +481,36 @@ TEST_F(ContextManagerTest, test_reportStateChangeShouldNotifyObserver) {
     EXPECT_TRUE(notificationEvent.wait(timeout));
 }
 
+/// Test that a change to the value of a state which is not proactively reported invalidates it for the observers.
+TEST_F(ContextManagerTest, test_setStateWithNewValueShouldInvalidateObserverState) {
+    auto provider = std::make_shared<MockLegacyStateProvider>();
+    auto capability = NamespaceAndName("Namespace", "Name");
+    m_contextManager->setStateProvider(capability, provider);
+    auto observer = std::make_shared<MockContextObserver>();
+    m_contextManager->addContextManagerObserver(observer);
+
+    std::atomic<int> invalidations{0};
+    EXPECT_CALL(*observer, onStateInvalidated(CapabilityTag(capability))).WillRepeatedly(InvokeWithoutArgs([&] {
+        invalidations++;
+    }));
+    m_contextManager->setState(capability, R"({"state":"first"})", StateRefreshPolicy::NEVER);
+    m_contextManager->setState(capability, R"({"state":"first"})", StateRefreshPolicy::NEVER);
+    m_contextManager->setState(capability, R"({"state":"second"})", StateRefreshPolicy::NEVER);
+
+    // The ContextManager handles updates in order, so once this change is reported the updates above are done.
+    utils::WaitEvent notificationEvent;
+    auto otherCapability = CapabilityTag("Namespace", "Other", "");
+    CapabilityState state{R"({"state":"target"})"};
+    EXPECT_CALL(*observer, onStateChanged(otherCapability, state, _)).WillOnce(InvokeWithoutArgs([&notificationEvent] {
+        notificationEvent.wakeUp();
+    }));
+    m_contextManager->reportStateChange(otherCapability, state, AlexaStateChangeCauseType::APP_INTERACTION);
+
+    const std::chrono::milliseconds timeout{100};
+    ASSERT_TRUE(notificationEvent.wait(timeout));
+    EXPECT_EQ(invalidations, 2);
+}
+
 /// Test that getContext can handle multiple getContext at the same time.
 TEST_F(ContextManagerTest, test_getContextInParallelShouldSucceed) {
     // Capability that belongs to the first endpoint.
@@ -668,6 +700,55 @@ TEST_F(ContextManagerTest, test_getContextShouldReturnCache) {
     EXPECT_EQ(statesFuture.get()[capability].valuePayload, state.valuePayload);
 }
 
+/**
+ * Test that the serialized context matches a context generated from the same states, that it is reused while the
+ * states do not change, and that it is rebuilt when a state changes.
+ */
+TEST_F(ContextManagerTest, test_getContextReusesSerializedContextUntilStateChanges) {
+    auto provider = std::make_shared<MockStateProvider>();
+    auto capability1 = CapabilityTag("Namespace1", "Name", "EndpointId");
+    auto capability2 = CapabilityTag("Namespace2", "Name", "EndpointId");
+    EXPECT_CALL(*provider, shouldQueryState()).WillRepeatedly(Return(false));
+    EXPECT_CALL(*provider, provideState(_, _)).Times(0);
+    m_contextManager->setStateProvider(capability1, provider);
+    m_contextManager->setStateProvider(capability2, provider);
+    m_contextManager->reportStateChange(
+        capability1, CapabilityState{R"({"state":"one"})"}, AlexaStateChangeCauseType::APP_INTERACTION);
+    m_contextManager->reportStateChange(
+        capability2, CapabilityState{R"({"state":"two"})"}, AlexaStateChangeCauseType::APP_INTERACTION);
+
+    // Returns the serialized context, and the serialization of a context built from the same states.
+    auto getContextJson = [this](const std::string& endpointId) {
+        auto requester = std::make_shared<MockContextRequester>();
+        std::promise<std::pair<std::string, std::string>> jsonPromise;
+        EXPECT_CALL(*requester, onContextAvailable(_, _, _))
+            .WillOnce(WithArg<1>(Invoke([&jsonPromise](const AVSContext& context) {
+                AVSContext generated;
+                for (auto& state : context.getStates()) {
+                    generated.addState(state.first, state.second);
+                }
+                jsonPromise.set_value(std::make_pair(context.toJson(), generated.toJson()));
+            })));
+        m_contextManager->getContext(requester, endpointId);
+        return jsonPromise.get_future().get();
+    };
+
+    auto first = getContextJson(capability1.endpointId);
+    EXPECT_EQ(first.first, first.second);
+    EXPECT_NE(first.first.find(R"({"state":"one"})"), std::string::npos);
+    EXPECT_NE(first.first.find(R"({"state":"two"})"), std::string::npos);
+
+    auto second = getContextJson(capability1.endpointId);
+    EXPECT_EQ(second.first, first.first);
+
+    m_contextManager->reportStateChange(
+        capability2, CapabilityState{R"({"state":"three"})"}, AlexaStateChangeCauseType::APP_INTERACTION);
+    auto third = getContextJson(capability1.endpointId);
+    EXPECT_EQ(third.first, third.second);
+    EXPECT_EQ(third.first.find(R"({"state":"two"})"), std::string::npos);
+    EXPECT_NE(third.first.find(R"({"state":"three"})"), std::string::npos);
+}
+
 }  // namespace test
 }  // namespace contextManager
 }  // namespace alexaClientSDK
@@ -19,6 +19,10 @@
 
 #include <map>
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include <AVSCommon/AVS/ContentType.h>
 #include <AVSCommon/AVS/MixingBehavior.h>
 #include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
@@ -34,6 +38,10 @@ namespace interruptModel {
  * determine the MixingBehavior to be taken by the ChannelObservers
  * corresponding to the lower priority channel being backgrounded when
  * a higher priority channel barges-in.
+ *
+ * The configuration is compiled once, at creation, into a table indexed by channel and content type, so
+ * @c getMixingBehavior() takes no locks and does not log.  Problems found while compiling the configuration are
+ * logged once and are available from @c getValidationReport().
  */
 class InterruptModel {
 public:
@@ -69,6 +77,14 @@ public:
         const std::string& highPriorityChannel,
         avsCommon::avs::ContentType highPriorityContentType) const;
 
+    /**
+     * Get the problems found in the interrupt model configuration when it was compiled.  Combinations affected by a
+     * problem have a @c MixingBehavior of @c UNDEFINED.
+     *
+     * @return A description of each problem found, empty if the configuration is valid.
+     */
+    const std::vector<std::string>& getValidationReport() const;
+
 private:
     /**
      * Constructor
@@ -76,8 +92,45 @@ private:
      */
     InterruptModel(avsCommon::utils::configuration::ConfigurationNode interactionConfiguration);
 
-    /// @c ConfigurationNode that contains the @c InterruptModelConfiguration
-    avsCommon::utils::configuration::ConfigurationNode m_interactionConfiguration;
+    /**
+     * Compile the interrupt model configuration into @c m_mixingBehaviors, recording any problems found in
+     * @c m_validationReport.
+     *
+     * @param interactionConfiguration interrupt model configuration for device.
+     */
+    void compile(const avsCommon::utils::configuration::ConfigurationNode& interactionConfiguration);
+
+    /**
+     * Get the index of a channel in @c m_mixingBehaviors, adding the channel if it is not known yet.
+     *
+     * @param channel The name of the channel.
+     * @return The index of the channel.
+     */
+    size_t getOrAddChannelIndex(const std::string& channel);
+
+    /**
+     * Get the position of an entry in @c m_mixingBehaviors.
+     *
+     * @param lowPriorityChannelIndex The index of the lower priority channel.
+     * @param lowPriorityContentType The content type of the lower priority channel.
+     * @param highPriorityChannelIndex The index of the channel barging in.
+     * @param highPriorityContentType The content type barging in.
+     * @return The position of the entry.
+     */
+    size_t getTableIndex(
+        size_t lowPriorityChannelIndex,
+        avsCommon::avs::ContentType lowPriorityContentType,
+        size_t highPriorityChannelIndex,
+        avsCommon::avs::ContentType highPriorityContentType) const;
+
+    /// The index of each channel named in the configuration.
+    std::unordered_map<std::string, size_t> m_channelIndices;
+
+    /// The @c MixingBehavior of every [lowPriorityChannel][contentType][highPriorityChannel][contentType] combination.
+    std::vector<avsCommon::avs::MixingBehavior> m_mixingBehaviors;
+
+    /// The problems found while compiling the configuration.
+    std::vector<std::string> m_validationReport;
 };
 }  // namespace interruptModel
 }  // namespace afml
@@ -34,6 +34,66 @@ static const std::string CURRENT_CHANNEL_CONTENT_TYPE_CONFIG_KEY = "contentType"
 static const std::string HIGHPRIORITY_CHANNEL_CONFIG_ROOT_KEY = "incomingChannel";
 static const std::string HIGHPRIORITY_CHANNEL_CONTENT_TYPE_CONFIG_KEY = "incomingContentType";
 
+/// The number of @c ContentTypes a channel may be configured for.
+static const size_t CONTENT_TYPES_COUNT = static_cast<size_t>(ContentType::NUM_CONTENT_TYPE);
+
+/**
+ * Get the index of a @c ContentType in the mixing behavior table.  Values out of range are looked up as
+ * @c ContentType::UNDEFINED, the same as @c contentTypeToString() does.
+ *
+ * @param contentType The @c ContentType.
+ * @return The index of @c contentType.
+ */
+static size_t getContentTypeIndex(ContentType contentType) {
+    auto index = static_cast<size_t>(contentType);
+    return index < CONTENT_TYPES_COUNT ? index : static_cast<size_t>(ContentType::UNDEFINED);
+}
+
+/**
+ * Convert a string to the @c ContentType it names.
+ *
+ * @param input The string to convert.
+ * @param[out] contentType The @c ContentType named by @c input.
+ * @return Whether @c input names a @c ContentType.
+ */
+static bool stringToContentType(const std::string& input, ContentType* contentType) {
+    for (size_t index = 0; index < CONTENT_TYPES_COUNT; ++index) {
+        if (contentTypeToString(static_cast<ContentType>(index)) == input) {
+            *contentType = static_cast<ContentType>(index);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Get the object stored under the only key expected in a JSON object of the interrupt model configuration.
+ *
+ * @param object The JSON object.
+ * @param key The expected key.
+ * @param path The path of @c object in the configuration, used to describe problems.
+ * @param[out] report The list to add any problems found to.
+ * @return The object stored under @c key, or @c nullptr if there is none.
+ */
+static const rapidjson::Value* getChildObject(
+    const rapidjson::Value& object,
+    const std::string& key,
+    const std::string& path,
+    std::vector<std::string>* report) {
+    const rapidjson::Value* child = nullptr;
+    for (auto it = object.MemberBegin(); it != object.MemberEnd(); ++it) {
+        std::string name = it->name.GetString();
+        if (name != key) {
+            report->push_back(path + "." + name + ": unexpected key");
+        } else if (!it->value.IsObject()) {
+            report->push_back(path + "." + name + ": not an object");
+        } else {
+            child = &it->value;
+        }
+    }
+    return child;
+}
+
 std::shared_ptr<InterruptModel> InterruptModel::createInterruptModel(const std::shared_ptr<ConfigurationNode>& config) {
     if (!config) {
         ACSDK_ERROR(LX("createInterruptModelFailed").m("invalid config"));
@@ -51,76 +111,158 @@ std::shared_ptr<InterruptModel> InterruptModel::create(ConfigurationNode interac
     return std::shared_ptr<InterruptModel>(new InterruptModel(interactionConfiguration));
 }
 
-InterruptModel::InterruptModel(ConfigurationNode interactionConfiguration) :
-        m_interactionConfiguration(interactionConfiguration) {
+InterruptModel::InterruptModel(ConfigurationNode interactionConfiguration) {
+    compile(interactionConfiguration);
 }
 
-MixingBehavior InterruptModel::getMixingBehavior(
-    const std::string& lowPrioChannel,
-    ContentType lowPrioContentType,
-    const std::string& highPrioChannel,
-    ContentType highPrioContentType) const {
-    ACSDK_INFO(LX(__func__)
-                   .d("lowPriochannel", lowPrioChannel)
-                   .d("lowPrioContentType", lowPrioContentType)
-                   .d("highPrioChannel", highPrioChannel)
-                   .d("highPrioContentType", highPrioContentType));
-
-    auto lowPrioChannelConfig = m_interactionConfiguration[lowPrioChannel];
-    if (!lowPrioChannelConfig) {
-        ACSDK_WARN(LX(__func__).d("Channel Not found", lowPrioChannel));
-        return MixingBehavior::UNDEFINED;
-    }
+void InterruptModel::compile(const ConfigurationNode& interactionConfiguration) {
+    /// A compiled entry of the configuration, waiting for the number of channels to be known.
+    struct Entry {
+        size_t lowPrioChannelIndex;
+        ContentType lowPrioContentType;
+        size_t highPrioChannelIndex;
+        ContentType highPrioContentType;
+        MixingBehavior mixingBehavior;
+    };
+    std::vector<Entry> entries;
 
-    auto lowPrioChannelInteractionConfig = lowPrioChannelConfig[CURRENT_CHANNEL_CONTENT_TYPE_CONFIG_KEY];
-    if (!lowPrioChannelInteractionConfig) {
-        ACSDK_WARN(LX(__func__).d("No InteractionConfig found for ", lowPrioChannel));
-        return MixingBehavior::UNDEFINED;
+    rapidjson::Document document;
+    if (document.Parse(interactionConfiguration.serialize()).HasParseError() || !document.IsObject()) {
+        m_validationReport.push_back(INTERRUPT_MODEL_CONFIG_KEY + ": not an object");
+    } else {
+        for (auto lowPrio = document.MemberBegin(); lowPrio != document.MemberEnd(); ++lowPrio) {
+            std::string lowPrioChannel = lowPrio->name.GetString();
+            auto lowPrioChannelIndex = getOrAddChannelIndex(lowPrioChannel);
+            if (!lowPrio->value.IsObject()) {
+                m_validationReport.push_back(lowPrioChannel + ": not an object");
+                continue;
+            }
+            auto lowPrioContentTypes = getChildObject(
+                lowPrio->value, CURRENT_CHANNEL_CONTENT_TYPE_CONFIG_KEY, lowPrioChannel, &m_validationReport);
+            if (!lowPrioContentTypes) {
+                continue;
+            }
+            for (auto lowPrioType = lowPrioContentTypes->MemberBegin(); lowPrioType != lowPrioContentTypes->MemberEnd();
+                 ++lowPrioType) {
+                auto lowPrioPath = lowPrioChannel + "." + CURRENT_CHANNEL_CONTENT_TYPE_CONFIG_KEY + "." +
+                                   lowPrioType->name.GetString();
+                ContentType lowPrioContentType;
+                if (!stringToContentType(lowPrioType->name.GetString(), &lowPrioContentType)) {
+                    m_validationReport.push_back(lowPrioPath + ": unknown content type");
+                    continue;
+                }
+                if (!lowPrioType->value.IsObject()) {
+                    m_validationReport.push_back(lowPrioPath + ": not an object");
+                    continue;
+                }
+                auto highPrioChannels = getChildObject(
+                    lowPrioType->value, HIGHPRIORITY_CHANNEL_CONFIG_ROOT_KEY, lowPrioPath, &m_validationReport);
+                if (!highPrioChannels) {
+                    continue;
+                }
+                for (auto highPrio = highPrioChannels->MemberBegin(); highPrio != highPrioChannels->MemberEnd();
+                     ++highPrio) {
+                    std::string highPrioChannel = highPrio->name.GetString();
+                    auto highPrioPath = lowPrioPath + "." + HIGHPRIORITY_CHANNEL_CONFIG_ROOT_KEY + "." + highPrioChannel;
+                    auto highPrioChannelIndex = getOrAddChannelIndex(highPrioChannel);
+                    if (!highPrio->value.IsObject()) {
+                        m_validationReport.push_back(highPrioPath + ": not an object");
+                        continue;
+                    }
+                    auto highPrioContentTypes = getChildObject(
+                        highPrio->value,
+                        HIGHPRIORITY_CHANNEL_CONTENT_TYPE_CONFIG_KEY,
+                        highPrioPath,
+                        &m_validationReport);
+                    if (!highPrioContentTypes) {
+                        continue;
+                    }
+                    for (auto highPrioType = highPrioContentTypes->MemberBegin();
+                         highPrioType != highPrioContentTypes->MemberEnd();
+                         ++highPrioType) {
+                        auto highPrioTypePath = highPrioPath + "." + HIGHPRIORITY_CHANNEL_CONTENT_TYPE_CONFIG_KEY +
+                                                "." + highPrioType->name.GetString();
+                        ContentType highPrioContentType;
+                        if (!stringToContentType(highPrioType->name.GetString(), &highPrioContentType)) {
+                            m_validationReport.push_back(highPrioTypePath + ": unknown content type");
+                            continue;
+                        }
+                        if (!highPrioType->value.IsString()) {
+                            m_validationReport.push_back(highPrioTypePath + ": not a string");
+                            continue;
+                        }
+                        std::string mixingBehaviorStr = highPrioType->value.GetString();
+                        auto mixingBehavior = avsCommon::avs::getMixingBehavior(mixingBehaviorStr);
+                        if (MixingBehavior::UNDEFINED == mixingBehavior &&
+                            mixingBehaviorToString(MixingBehavior::UNDEFINED) != mixingBehaviorStr) {
+                            m_validationReport.push_back(
+                                highPrioTypePath + ": invalid MixingBehavior " + mixingBehaviorStr);
+                            continue;
+                        }
+                        entries.push_back(
+                            {lowPrioChannelIndex,
+                             lowPrioContentType,
+                             highPrioChannelIndex,
+                             highPrioContentType,
+                             mixingBehavior});
+                    }
+                }
+            }
+        }
     }
 
-    auto lowPrioChannelContentTypeConfig = lowPrioChannelInteractionConfig[contentTypeToString(lowPrioContentType)];
-    if (!lowPrioChannelContentTypeConfig) {
-        ACSDK_WARN(LX(__func__)
-                       .m("No ContentType Config found")
-                       .d("channel", lowPrioChannel)
-                       .d("contentType", lowPrioContentType));
-        return MixingBehavior::UNDEFINED;
+    auto channelsCount = m_channelIndices.size();
+    m_mixingBehaviors.assign(
+        channelsCount * CONTENT_TYPES_COUNT * channelsCount * CONTENT_TYPES_COUNT, MixingBehavior::UNDEFINED);
+    for (const auto& entry : entries) {
+        m_mixingBehaviors[getTableIndex(
+            entry.lowPrioChannelIndex,
+            entry.lowPrioContentType,
+            entry.highPrioChannelIndex,
+            entry.highPrioContentType)] = entry.mixingBehavior;
     }
 
-    auto highPrioChannelConfigRoot = lowPrioChannelContentTypeConfig[HIGHPRIORITY_CHANNEL_CONFIG_ROOT_KEY];
-    if (!highPrioChannelConfigRoot) {
-        ACSDK_WARN(LX(__func__)
-                       .m("No Config found for")
-                       .d("highPrioChannel", highPrioChannel)
-                       .d("lowPrioChannel", lowPrioChannel));
-        return MixingBehavior::UNDEFINED;
+    for (const auto& problem : m_validationReport) {
+        ACSDK_WARN(LX("invalidInterruptModelConfiguration").d("problem", problem));
     }
+    ACSDK_INFO(LX("compiled")
+                   .d("channels", channelsCount)
+                   .d("entries", entries.size())
+                   .d("problems", m_validationReport.size()));
+}
 
-    auto highPrioChannelConfig = highPrioChannelConfigRoot[highPrioChannel];
-    if (!highPrioChannelConfig) {
-        ACSDK_WARN(LX(__func__).m("No Config found for").d("key", highPrioChannel).d("lowPrioChannel", lowPrioChannel));
-        return MixingBehavior::UNDEFINED;
-    }
+size_t InterruptModel::getOrAddChannelIndex(const std::string& channel) {
+    return m_channelIndices.emplace(channel, m_channelIndices.size()).first->second;
+}
 
-    auto highPrioChannelContentTypeRoot = highPrioChannelConfig[HIGHPRIORITY_CHANNEL_CONTENT_TYPE_CONFIG_KEY];
-    if (!highPrioChannelContentTypeRoot) {
-        ACSDK_WARN(
-            LX(__func__).m("No Config found for").d("key", highPrioContentType).d("lowPrioChannel", lowPrioChannel));
-        return MixingBehavior::UNDEFINED;
-    }
+size_t InterruptModel::getTableIndex(
+    size_t lowPrioChannelIndex,
+    ContentType lowPrioContentType,
+    size_t highPrioChannelIndex,
+    ContentType highPrioContentType) const {
+    auto channelsCount = m_channelIndices.size();
+    return ((lowPrioChannelIndex * CONTENT_TYPES_COUNT + getContentTypeIndex(lowPrioContentType)) * channelsCount +
+            highPrioChannelIndex) *
+               CONTENT_TYPES_COUNT +
+           getContentTypeIndex(highPrioContentType);
+}
 
-    std::string retMixingBehaviorStr;
-    if (!highPrioChannelContentTypeRoot.getString(contentTypeToString(highPrioContentType), &retMixingBehaviorStr)) {
-        ACSDK_WARN(LX(__func__).d("Key Not Found", contentTypeToString(highPrioContentType)));
+MixingBehavior InterruptModel::getMixingBehavior(
+    const std::string& lowPrioChannel,
+    ContentType lowPrioContentType,
+    const std::string& highPrioChannel,
+    ContentType highPrioContentType) const {
+    auto lowPrioChannelIt = m_channelIndices.find(lowPrioChannel);
+    auto highPrioChannelIt = m_channelIndices.find(highPrioChannel);
+    if (m_channelIndices.end() == lowPrioChannelIt || m_channelIndices.end() == highPrioChannelIt) {
         return MixingBehavior::UNDEFINED;
     }
+    return m_mixingBehaviors[getTableIndex(
+        lowPrioChannelIt->second, lowPrioContentType, highPrioChannelIt->second, highPrioContentType)];
+}
 
-    MixingBehavior retMixingBehavior = avsCommon::avs::getMixingBehavior(retMixingBehaviorStr);
-    if (MixingBehavior::UNDEFINED == retMixingBehavior) {
-        ACSDK_ERROR(LX(__func__).d("Invalid MixingBehavior specified", retMixingBehaviorStr));
-    }
-
-    return retMixingBehavior;
+const std::vector<std::string>& InterruptModel::getValidationReport() const {
+    return m_validationReport;
 }
 }  // namespace interruptModel
 }  // namespace afml
@@ -14,6 +14,8 @@
  * permissions and limitations under the License.
  */
 
+#include <set>
+
 #include <gtest/gtest.h>
 #include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
 #include "InterruptModel/InterruptModel.h"
@@ -34,6 +36,7 @@ using JSONStream = std::vector<std::shared_ptr<std::istream>>;
 static const std::string CONTENT_CHANNEL = "Content";
 static const std::string DIALOG_CHANNEL = "Dialog";
 static const std::string ALERT_CHANNEL = "Alert";
+static const std::string COMMUNICATIONS_CHANNEL = "Communications";
 static const ContentType MIXABLE_CONTENT_TYPE = ContentType::MIXABLE;
 static const ContentType NONMIXABLE_CONTENT_TYPE = ContentType::NONMIXABLE;
 static const ContentType INVALID_CONTENT_TYPE = ContentType::NUM_CONTENT_TYPE;
@@ -264,6 +267,52 @@ TEST_F(InterruptModelTest, test_InvalidIncomingMixingBehaviorReturnsUndefined) {
     ASSERT_EQ(MixingBehavior::UNDEFINED, retMixingBehavior);
 }
 
+TEST_F(InterruptModelTest, test_ConfiguredMixingBehaviorIsReturned) {
+    ASSERT_EQ(
+        MixingBehavior::MAY_DUCK,
+        m_interruptModel->getMixingBehavior(
+            CONTENT_CHANNEL, MIXABLE_CONTENT_TYPE, DIALOG_CHANNEL, MIXABLE_CONTENT_TYPE));
+    ASSERT_EQ(
+        MixingBehavior::MUST_PAUSE,
+        m_interruptModel->getMixingBehavior(
+            CONTENT_CHANNEL, NONMIXABLE_CONTENT_TYPE, DIALOG_CHANNEL, MIXABLE_CONTENT_TYPE));
+    ASSERT_EQ(
+        MixingBehavior::MAY_DUCK,
+        m_interruptModel->getMixingBehavior(
+            ALERT_CHANNEL, MIXABLE_CONTENT_TYPE, COMMUNICATIONS_CHANNEL, NONMIXABLE_CONTENT_TYPE));
+}
+
+TEST_F(InterruptModelTest, test_ValidationReportListsProblems) {
+    const auto& report = m_interruptModel->getValidationReport();
+    std::set<std::string> problems(report.begin(), report.end());
+    ASSERT_EQ(report.size(), problems.size());
+    ASSERT_EQ(5u, problems.size());
+    ASSERT_EQ(
+        1u,
+        problems.count(
+            "Communications.contentType.NONMIXABLE.incomingChannel.Dialog.incomingContentType.MIXABLE: "
+            "invalid MixingBehavior MAY_PAUSE"));
+    ASSERT_EQ(1u, problems.count("Content.contentType.MIXABLE.incomingChannel.Alert.incomingChannelType: unexpected key"));
+    ASSERT_EQ(
+        1u, problems.count("Content.contentType.NONMIXABLE.incomingChannel.Alert.incomingChannelType: unexpected key"));
+    ASSERT_EQ(1u, problems.count("VirtualChannel1.MIXABLE: unexpected key"));
+    ASSERT_EQ(
+        1u,
+        problems.count("VirtualChannel2.contentType.NONMIXABLE.incomingChannel.Alert.incomingContentType.MIXABLE: "
+                       "invalid MixingBehavior InvalidMixingBehavior"));
+}
+
+TEST_F(InterruptModelTest, test_DefaultConfigurationsAreValid) {
+    for (auto supportsDucking : {true, false}) {
+        ConfigurationNode::uninitialize();
+        JSONStream jsonStream({std::shared_ptr<std::istream>(InterruptModelConfiguration::getConfig(supportsDucking))});
+        ASSERT_TRUE(ConfigurationNode::initialize(jsonStream));
+        auto interruptModel = InterruptModel::create(ConfigurationNode::getRoot()[INTERRUPT_MODEL_KEY]);
+        ASSERT_NE(nullptr, interruptModel);
+        ASSERT_TRUE(interruptModel->getValidationReport().empty());
+    }
+}
+
 }  // namespace test
 }  // namespace interruptModel
 }  // namespace afml
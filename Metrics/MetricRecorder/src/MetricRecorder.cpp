@@ -62,7 +62,7 @@ void MetricRecorder::recordMetric(std::shared_ptr<alexaClientSDK::avsCommon::uti
         return;
     }
 
-    m_executor.submit([this, metricEvent]() {
+    m_executor.execute([this, metricEvent]() {
         for (const auto& sink : m_sinks) {
             sink->consumeMetric(metricEvent);
         }
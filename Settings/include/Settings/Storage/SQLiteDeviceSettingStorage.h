@@ -78,8 +78,11 @@ private:
      * Constructor.
      *
      * @param dbFilePath The file path of the SQLite database.
+     * @param databaseOptions The options to open the database with.
      */
-    SQLiteDeviceSettingStorage(const std::string& dbFilePath);
+    SQLiteDeviceSettingStorage(
+        const std::string& dbFilePath,
+        const alexaClientSDK::storage::sqliteStorage::SQLiteDatabase::Options& databaseOptions);
 
     /*
      * Creates a database table for the settings.
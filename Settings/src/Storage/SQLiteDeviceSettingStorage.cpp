@@ -108,10 +108,16 @@ std::unique_ptr<SQLiteDeviceSettingStorage> SQLiteDeviceSettingStorage::create(
         return nullptr;
     }
 
-    return std::unique_ptr<SQLiteDeviceSettingStorage>(new SQLiteDeviceSettingStorage(deviceSettingDbFilePath));
+    return std::unique_ptr<SQLiteDeviceSettingStorage>(new SQLiteDeviceSettingStorage(
+        deviceSettingDbFilePath,
+        alexaClientSDK::storage::sqliteStorage::SQLiteDatabase::Options::fromConfiguration(
+            deviceSettingDatabaseConfigurationRoot)));
 }
 
-SQLiteDeviceSettingStorage::SQLiteDeviceSettingStorage(const std::string& dbFilePath) : m_db{dbFilePath} {
+SQLiteDeviceSettingStorage::SQLiteDeviceSettingStorage(
+    const std::string& dbFilePath,
+    const alexaClientSDK::storage::sqliteStorage::SQLiteDatabase::Options& databaseOptions) :
+        m_db{dbFilePath, databaseOptions} {
 }
 
 SQLiteDeviceSettingStorage::~SQLiteDeviceSettingStorage() {
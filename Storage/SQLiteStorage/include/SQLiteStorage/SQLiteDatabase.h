@@ -22,6 +22,7 @@
 
 #include <sqlite3.h>
 
+#include <AVSCommon/Utils/Configuration/ConfigurationNode.h>
 #include <SQLiteStorage/SQLiteStatement.h>
 
 namespace alexaClientSDK {
@@ -81,6 +82,60 @@ public:
         bool m_transactionCompleted;
     };
 
+    /**
+     * Options applied to the database connection.  The defaults keep SQLite's own defaults (rollback journal, full
+     * synchronization, no memory mapping), and cache up to @c DEFAULT_STATEMENT_CACHE_SIZE prepared statements.
+     */
+    struct Options {
+        /**
+         * Constructor, which sets the default options.
+         */
+        Options();
+
+        /**
+         * Reads the options from the configuration node of a storage, where they sit next to its database file path:
+         *
+         * @code{.json}
+         *     "certifiedSender": {
+         *         "databaseFilePath": "/var/lib/alexa/certifiedSender.db",
+         *         "writeAheadLog": true,
+         *         "synchronousNormal": true,
+         *         "mmapSize": 1048576,
+         *         "statementCacheSize": 16
+         *     }
+         * @endcode
+         *
+         * Options missing from the node keep their default values.
+         *
+         * @param configurationNode The configuration node of the storage.
+         * @return The options.
+         */
+        static Options fromConfiguration(const avsCommon::utils::configuration::ConfigurationNode& configurationNode);
+
+        /**
+         * Whether to use a write-ahead log (@c journal_mode=WAL) instead of a rollback journal.  Writes append to the
+         * log instead of rewriting pages twice, and readers do not block the writer.  The log is kept in a @c -wal
+         * file next to the database.
+         */
+        bool writeAheadLog;
+
+        /**
+         * Whether to use @c synchronous=NORMAL instead of @c FULL.  With a write-ahead log, this only syncs when the
+         * log is checkpointed rather than on every transaction; a power loss may roll back the last transactions, but
+         * cannot corrupt the database.
+         */
+        bool synchronousNormal;
+
+        /// The number of bytes of the database file to access through memory mapping (@c mmap_size).  Zero disables it.
+        int mmapSize;
+
+        /// The maximum number of prepared statements kept for reuse.  Zero disables the statement cache.
+        size_t statementCacheSize;
+    };
+
+    /// The default maximum number of prepared statements kept for reuse.
+    static constexpr size_t DEFAULT_STATEMENT_CACHE_SIZE = 16;
+
     /**
      * Constructor.  The internal variables are initialized.
      *
@@ -89,6 +144,15 @@ public:
      */
     SQLiteDatabase(const std::string& filePath);
 
+    /**
+     * Constructor.  The internal variables are initialized.
+     *
+     * @param filePath The location of the file that the SQLite DB will use as it's backing storage when initialize or
+     * open are called.
+     * @param options The options to apply when the database is initialized or opened.
+     */
+    SQLiteDatabase(const std::string& filePath, const Options& options);
+
     /**
      * Destructor.
      *
@@ -157,11 +221,23 @@ public:
     /**
      * Create an SQLiteStatement object to execute the provided string.
      *
+     * Prepared statements are cached by their SQL string: when the returned statement is destroyed (or finalized), it
+     * is reset and kept, so that a later call with the same string does not prepare it again.  The least recently
+     * used statements are finalized when the cache is full.  SQL strings with values inlined rather than bound as
+     * parameters will rarely be reused.
+     *
      * @param sqlString The SQL command to execute.
      * @return A unique_ptr to the SQLiteStatement that represents the sqlString.
      */
     std::unique_ptr<SQLiteStatement> createStatement(const std::string& sqlString);
 
+    /**
+     * Obtain the number of @c createStatement() calls which reused a cached prepared statement.
+     *
+     * @return The number of statements reused from the cache.
+     */
+    size_t getStatementCacheHitCount() const;
+
     /**
      * Checks if the database is ready to be acted upon.
      *
@@ -177,6 +253,15 @@ public:
     std::unique_ptr<Transaction> beginTransaction();
 
 private:
+    /// The cache of prepared statements which are not in use.
+    class StatementCache;
+
+    /**
+     * Applies @c m_options to the open database connection.  The options only affect performance, so an option which
+     * cannot be applied is logged and skipped.
+     */
+    void applyOptions();
+
     /**
      * Commits the transaction started with @c beginTransaction.
      *
@@ -199,6 +284,15 @@ private:
     /// The sqlite database handle.
     sqlite3* m_dbHandle;
 
+    /// The options to apply when the database is initialized or opened.
+    const Options m_options;
+
+    /**
+     * The prepared statements which are not in use.  Shared with the statements created from it, which hand their
+     * handles back when they are destroyed.
+     */
+    std::shared_ptr<StatementCache> m_statementCache;
+
     /**
      * A shared_ptr to this that is used to manage viability of weak_ptrs to this.  This shared_ptr has a no-op deleter,
      * and does not manage the lifecycle of this instance.  Instead, ~SQLiteDatabase() resets this shared_ptr to signal
@@ -126,8 +126,11 @@ private:
      * Constructor.
      *
      * @param dbFilePath The location of the SQLite database file.
+     * @param databaseOptions The options to open the database with.
      */
-    SQLiteMiscStorage(const std::string& dbFilePath);
+    SQLiteMiscStorage(
+        const std::string& dbFilePath,
+        const SQLiteDatabase::Options& databaseOptions = SQLiteDatabase::Options());
 
     /**
      * Method that will get the key column type and value column type.
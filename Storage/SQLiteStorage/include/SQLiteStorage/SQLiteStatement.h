@@ -16,6 +16,7 @@
 #ifndef ALEXA_CLIENT_SDK_STORAGE_SQLITESTORAGE_INCLUDE_SQLITESTORAGE_SQLITESTATEMENT_H_
 #define ALEXA_CLIENT_SDK_STORAGE_SQLITESTORAGE_INCLUDE_SQLITESTORAGE_SQLITESTATEMENT_H_
 
+#include <functional>
 #include <list>
 #include <sqlite3.h>
 #include <string>
@@ -35,6 +36,9 @@ namespace sqliteStorage {
  * https://sqlite.org/c3ref/intro.html
  */
 class SQLiteStatement {
+    /// Allow @c SQLiteDatabase to create statements which hand their handle back to its statement cache.
+    friend class SQLiteDatabase;
+
 public:
     /**
      * Constructor.
@@ -175,11 +179,23 @@ public:
     int64_t getColumnInt64(int index) const;
 
     /**
-     * Releases the SQLite resources.
+     * Releases the SQLite resources.  A statement created by a @c SQLiteDatabase with a statement cache is reset and
+     * handed back to the cache rather than finalized.
      */
     void finalize();
 
 private:
+    /// A function which takes ownership of a statement handle once a @c SQLiteStatement no longer needs it.
+    using ReleaseFunction = std::function<void(sqlite3_stmt*)>;
+
+    /**
+     * Constructor which adopts an already prepared statement handle.
+     *
+     * @param handle The prepared statement handle, which has been reset and has no bound parameters.
+     * @param release The function which takes the handle back in @c finalize().
+     */
+    SQLiteStatement(sqlite3_stmt* handle, ReleaseFunction release);
+
     /// Our internal SQLite statement handle.
     sqlite3_stmt* m_handle;
 
@@ -189,6 +205,9 @@ private:
     /// A collection with all the string values that were bound to the current statement.
     /// @warning SQLite will store a raw pointer to the string buffer so we must keep the reference alive.
     std::list<std::string> m_boundValues;
+
+    /// The function which takes the handle back in @c finalize(), or empty if the handle should be finalized.
+    ReleaseFunction m_release;
 };
 
 }  // namespace sqliteStorage
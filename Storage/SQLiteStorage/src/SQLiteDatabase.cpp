@@ -17,6 +17,9 @@
 
 #include <AVSCommon/Utils/File/FileUtils.h>
 #include <AVSCommon/Utils/Logger/Logger.h>
+#include <list>
+#include <mutex>
+#include <unordered_map>
 #include <utility>
 #include "SQLiteStorage/SQLiteUtils.h"
 
@@ -34,10 +37,165 @@ static const std::string TAG("SQLiteDatabase");
  */
 #define LX(event) alexaClientSDK::avsCommon::utils::logger::LogEntry(TAG, event)
 
-SQLiteDatabase::SQLiteDatabase(const std::string& storageFilePath) :
+/// Configuration key enabling the write-ahead log.
+static const std::string WRITE_AHEAD_LOG_KEY = "writeAheadLog";
+
+/// Configuration key enabling @c synchronous=NORMAL.
+static const std::string SYNCHRONOUS_NORMAL_KEY = "synchronousNormal";
+
+/// Configuration key for the number of bytes to memory map.
+static const std::string MMAP_SIZE_KEY = "mmapSize";
+
+/// Configuration key for the maximum number of cached prepared statements.
+static const std::string STATEMENT_CACHE_SIZE_KEY = "statementCacheSize";
+
+/// The journal mode reported by SQLite once the write-ahead log is in use.
+static const std::string WAL_JOURNAL_MODE = "wal";
+
+constexpr size_t SQLiteDatabase::DEFAULT_STATEMENT_CACHE_SIZE;
+
+/**
+ * Prepared statements which are not in use, keyed by their SQL string, with the least recently used last.  Only one
+ * statement is kept per SQL string.
+ */
+class SQLiteDatabase::StatementCache {
+public:
+    /**
+     * Constructor.
+     *
+     * @param capacity The maximum number of statements to keep.
+     */
+    explicit StatementCache(size_t capacity) : m_capacity{capacity}, m_dbHandle{nullptr}, m_hitCount{0} {
+    }
+
+    /**
+     * Destructor.  Finalizes the statements.
+     */
+    ~StatementCache() {
+        reset(nullptr);
+    }
+
+    /**
+     * Finalizes the statements, and sets the database connection new statements must belong to.
+     *
+     * @param dbHandle The database connection, or @c nullptr if the database is closed.
+     */
+    void reset(sqlite3* dbHandle) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& entry : m_entries) {
+            sqlite3_finalize(entry.second);
+        }
+        m_entries.clear();
+        m_index.clear();
+        m_dbHandle = dbHandle;
+    }
+
+    /**
+     * Removes the statement for a SQL string from the cache.
+     *
+     * @param sqlString The SQL string.
+     * @return The statement, or @c nullptr if there is none.
+     */
+    sqlite3_stmt* take(const std::string& sqlString) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_index.find(sqlString);
+        if (it == m_index.end()) {
+            return nullptr;
+        }
+        auto handle = it->second->second;
+        m_entries.erase(it->second);
+        m_index.erase(it);
+        m_hitCount++;
+        return handle;
+    }
+
+    /**
+     * Adds a statement which is no longer in use to the cache, or finalizes it if it cannot be kept.
+     *
+     * @param sqlString The SQL string of the statement.
+     * @param handle The statement, which has been reset and has no bound parameters.
+     */
+    void give(const std::string& sqlString, sqlite3_stmt* handle) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (0 == m_capacity || sqlite3_db_handle(handle) != m_dbHandle || m_index.count(sqlString) > 0) {
+            lock.unlock();
+            sqlite3_finalize(handle);
+            return;
+        }
+        m_entries.emplace_front(sqlString, handle);
+        m_index[sqlString] = m_entries.begin();
+        if (m_entries.size() > m_capacity) {
+            sqlite3_finalize(m_entries.back().second);
+            m_index.erase(m_entries.back().first);
+            m_entries.pop_back();
+        }
+    }
+
+    /**
+     * Obtain the number of statements taken from the cache.
+     *
+     * @return The number of statements taken from the cache.
+     */
+    size_t getHitCount() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_hitCount;
+    }
+
+private:
+    /// The statements, most recently used first.
+    using Entries = std::list<std::pair<std::string, sqlite3_stmt*>>;
+
+    /// The maximum number of statements to keep.
+    const size_t m_capacity;
+
+    /// Serializes access to the members below, as statements may be destroyed on any thread.
+    mutable std::mutex m_mutex;
+
+    /// The database connection statements must belong to in order to be kept.
+    sqlite3* m_dbHandle;
+
+    /// The statements.
+    Entries m_entries;
+
+    /// The statements, by SQL string.
+    std::unordered_map<std::string, Entries::iterator> m_index;
+
+    /// The number of statements taken from the cache.
+    size_t m_hitCount;
+};
+
+SQLiteDatabase::Options::Options() :
+        writeAheadLog{false},
+        synchronousNormal{false},
+        mmapSize{0},
+        statementCacheSize{DEFAULT_STATEMENT_CACHE_SIZE} {
+}
+
+SQLiteDatabase::Options SQLiteDatabase::Options::fromConfiguration(
+    const avsCommon::utils::configuration::ConfigurationNode& configurationNode) {
+    Options options;
+    configurationNode.getBool(WRITE_AHEAD_LOG_KEY, &options.writeAheadLog, options.writeAheadLog);
+    configurationNode.getBool(SYNCHRONOUS_NORMAL_KEY, &options.synchronousNormal, options.synchronousNormal);
+    configurationNode.getInt(MMAP_SIZE_KEY, &options.mmapSize, options.mmapSize);
+    int statementCacheSize = static_cast<int>(options.statementCacheSize);
+    configurationNode.getInt(STATEMENT_CACHE_SIZE_KEY, &statementCacheSize, statementCacheSize);
+    if (statementCacheSize < 0) {
+        ACSDK_WARN(LX("fromConfiguration").d("reason", "negativeStatementCacheSize").d("value", statementCacheSize));
+        statementCacheSize = 0;
+    }
+    options.statementCacheSize = static_cast<size_t>(statementCacheSize);
+    return options;
+}
+
+SQLiteDatabase::SQLiteDatabase(const std::string& storageFilePath) : SQLiteDatabase(storageFilePath, Options()) {
+}
+
+SQLiteDatabase::SQLiteDatabase(const std::string& storageFilePath, const Options& options) :
         m_storageFilePath{storageFilePath},
         m_transactionIsInProgress{false},
-        m_dbHandle{nullptr} {
+        m_dbHandle{nullptr},
+        m_options(options),
+        m_statementCache{std::make_shared<StatementCache>(options.statementCacheSize)} {
     m_sharedThisPlaceholder = std::shared_ptr<SQLiteDatabase>(this, [](SQLiteDatabase*) {});
 }
 
@@ -65,6 +223,7 @@ bool SQLiteDatabase::initialize() {
         return false;
     }
 
+    applyOptions();
     return true;
 }
 
@@ -85,9 +244,29 @@ bool SQLiteDatabase::open() {
         return false;
     }
 
+    applyOptions();
     return true;
 }
 
+void SQLiteDatabase::applyOptions() {
+    m_statementCache->reset(m_dbHandle);
+
+    if (m_options.writeAheadLog) {
+        // journal_mode reports the mode actually in use, which is unchanged if the write-ahead log is not supported.
+        auto statement = createStatement("PRAGMA journal_mode=WAL;");
+        if (!statement || !statement->step() || statement->getColumnText(0) != WAL_JOURNAL_MODE) {
+            ACSDK_WARN(
+                LX("applyOptionsFailed").d("reason", "writeAheadLogNotEnabled").d("file path", m_storageFilePath));
+        }
+    }
+    if (m_options.synchronousNormal && !performQuery("PRAGMA synchronous=NORMAL;")) {
+        ACSDK_WARN(LX("applyOptionsFailed").d("reason", "synchronousNormalNotSet").d("file path", m_storageFilePath));
+    }
+    if (m_options.mmapSize > 0 && !performQuery("PRAGMA mmap_size=" + std::to_string(m_options.mmapSize) + ";")) {
+        ACSDK_WARN(LX("applyOptionsFailed").d("reason", "mmapSizeNotSet").d("file path", m_storageFilePath));
+    }
+}
+
 bool SQLiteDatabase::isDatabaseReady() {
     return (m_dbHandle != nullptr);
 }
@@ -136,6 +315,7 @@ void SQLiteDatabase::close() {
             rollbackTransaction();
         }
 
+        m_statementCache->reset(nullptr);
         closeSQLiteDatabase(m_dbHandle);
         m_dbHandle = nullptr;
     }
@@ -143,16 +323,45 @@ void SQLiteDatabase::close() {
 
 std::unique_ptr<alexaClientSDK::storage::sqliteStorage::SQLiteStatement> SQLiteDatabase::createStatement(
     const std::string& sqlString) {
+    if (0 == m_options.statementCacheSize) {
+        std::unique_ptr<alexaClientSDK::storage::sqliteStorage::SQLiteStatement> statement(
+            new SQLiteStatement(m_dbHandle, sqlString));
+        if (!statement->isValid()) {
+            ACSDK_ERROR(LX("createStatementFailed").d("sqlString", sqlString));
+            statement = nullptr;
+        }
+        return statement;
+    }
+
+    std::weak_ptr<StatementCache> weakCache = m_statementCache;
+    auto release = [weakCache, sqlString](sqlite3_stmt* handle) {
+        auto cache = weakCache.lock();
+        if (cache) {
+            cache->give(sqlString, handle);
+        } else {
+            sqlite3_finalize(handle);
+        }
+    };
+
+    auto handle = m_statementCache->take(sqlString);
+    if (handle) {
+        return std::unique_ptr<SQLiteStatement>(new SQLiteStatement(handle, std::move(release)));
+    }
+
     std::unique_ptr<alexaClientSDK::storage::sqliteStorage::SQLiteStatement> statement(
         new SQLiteStatement(m_dbHandle, sqlString));
     if (!statement->isValid()) {
         ACSDK_ERROR(LX("createStatementFailed").d("sqlString", sqlString));
-        statement = nullptr;
+        return nullptr;
     }
-
+    statement->m_release = std::move(release);
     return statement;
 }
 
+size_t SQLiteDatabase::getStatementCacheHitCount() const {
+    return m_statementCache->getHitCount();
+}
+
 std::unique_ptr<SQLiteDatabase::Transaction> SQLiteDatabase::beginTransaction() {
     if (m_transactionIsInProgress) {
         ACSDK_ERROR(LX("beginTransactionFailed").d("reason", "Only one transaction at a time is allowed"));
@@ -150,14 +150,16 @@ std::unique_ptr<SQLiteMiscStorage> SQLiteMiscStorage::create(const Configuration
         return nullptr;
     }
 
-    return create(miscDbFilePath);
+    return std::unique_ptr<SQLiteMiscStorage>(new SQLiteMiscStorage(
+        miscDbFilePath, SQLiteDatabase::Options::fromConfiguration(miscDatabaseConfigurationRoot)));
 }
 
 std::unique_ptr<SQLiteMiscStorage> SQLiteMiscStorage::create(const std::string& databasePath) {
     return std::unique_ptr<SQLiteMiscStorage>(new SQLiteMiscStorage(databasePath));
 }
 
-SQLiteMiscStorage::SQLiteMiscStorage(const std::string& dbFilePath) : m_db{dbFilePath} {
+SQLiteMiscStorage::SQLiteMiscStorage(const std::string& dbFilePath, const SQLiteDatabase::Options& databaseOptions) :
+        m_db{dbFilePath, databaseOptions} {
 }
 
 SQLiteMiscStorage::~SQLiteMiscStorage() {
@@ -16,6 +16,7 @@
 #include "SQLiteStorage/SQLiteStatement.h"
 
 #include <AVSCommon/Utils/Logger/Logger.h>
+#include <utility>
 
 namespace alexaClientSDK {
 namespace storage {
@@ -54,6 +55,12 @@ SQLiteStatement::SQLiteStatement(sqlite3* dbHandle, const std::string& sqlString
     }
 }
 
+SQLiteStatement::SQLiteStatement(sqlite3_stmt* handle, ReleaseFunction release) :
+        m_handle{handle},
+        m_stepResult{SQLITE_OK},
+        m_release{std::move(release)} {
+}
+
 SQLiteStatement::~SQLiteStatement() {
     finalize();
 }
@@ -204,6 +211,16 @@ int64_t SQLiteStatement::getColumnInt64(int index) const {
 }
 
 void SQLiteStatement::finalize() {
+    if (m_handle && m_release) {
+        // Unbind the parameters before the strings they point to are released.
+        sqlite3_reset(m_handle);
+        sqlite3_clear_bindings(m_handle);
+        m_boundValues.clear();
+        m_release(m_handle);
+        m_handle = nullptr;
+        return;
+    }
+
     if (m_handle) {
         int rcode = sqlite3_finalize(m_handle);
         m_handle = nullptr;
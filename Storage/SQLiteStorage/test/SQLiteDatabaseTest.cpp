@@ -239,6 +239,103 @@ TEST(SQLiteDatabaseTest, test_createDeleteTable) {
     db1.close();
 }
 
+/// Test that a statement is prepared once, and reused with its parameters cleared once it is destroyed.
+TEST(SQLiteDatabaseTest, test_createStatementReusesPreparedStatement) {
+    auto dbFilePath = generateDbFilePath();
+    SQLiteDatabase db(dbFilePath);
+    ASSERT_TRUE(db.initialize());
+    ASSERT_TRUE(db.performQuery("CREATE TABLE " + TEST_TABLE_NAME + " (key TEXT PRIMARY KEY NOT NULL);"));
+
+    const std::string insertSqlString = "INSERT INTO " + TEST_TABLE_NAME + " (key) VALUES (?);";
+    for (int i = 0; i < 3; ++i) {
+        auto statement = db.createStatement(insertSqlString);
+        ASSERT_NE(statement, nullptr);
+        ASSERT_TRUE(statement->bindStringParameter(1, "key" + std::to_string(i)));
+        ASSERT_TRUE(statement->step());
+    }
+    EXPECT_EQ(db.getStatementCacheHitCount(), 2U);
+
+    // A reused statement has no parameters left bound, so the NOT NULL constraint fails.
+    auto statement = db.createStatement(insertSqlString);
+    ASSERT_NE(statement, nullptr);
+    EXPECT_FALSE(statement->step());
+    statement.reset();
+
+    statement = db.createStatement("SELECT COUNT(*) FROM " + TEST_TABLE_NAME + ";");
+    ASSERT_NE(statement, nullptr);
+    ASSERT_TRUE(statement->step());
+    EXPECT_EQ(statement->getColumnInt(0), 3);
+    statement.reset();
+
+    db.close();
+}
+
+/// Test that statements are not reused when the statement cache is disabled.
+TEST(SQLiteDatabaseTest, test_statementCacheDisabled) {
+    SQLiteDatabase::Options options;
+    options.statementCacheSize = 0;
+    SQLiteDatabase db(generateDbFilePath(), options);
+    ASSERT_TRUE(db.initialize());
+
+    for (int i = 0; i < 3; ++i) {
+        auto statement = db.createStatement("SELECT 1;");
+        ASSERT_NE(statement, nullptr);
+        ASSERT_TRUE(statement->step());
+    }
+    EXPECT_EQ(db.getStatementCacheHitCount(), 0U);
+
+    db.close();
+}
+
+/// Test that cached statements do not prevent the database from being closed, and are not reused once reopened.
+TEST(SQLiteDatabaseTest, test_closeWithCachedStatements) {
+    auto dbFilePath = generateDbFilePath();
+    SQLiteDatabase db(dbFilePath);
+    ASSERT_TRUE(db.initialize());
+    ASSERT_NE(db.createStatement("SELECT 1;"), nullptr);
+    db.close();
+
+    ASSERT_TRUE(db.open());
+    auto statement = db.createStatement("SELECT 1;");
+    ASSERT_NE(statement, nullptr);
+    ASSERT_TRUE(statement->step());
+    EXPECT_EQ(db.getStatementCacheHitCount(), 0U);
+    statement.reset();
+
+    db.close();
+}
+
+/// Test that the write-ahead log, synchronous and mmap options are applied when the database is opened.
+TEST(SQLiteDatabaseTest, test_openWithOptions) {
+    auto dbFilePath = generateDbFilePath();
+    SQLiteDatabase::Options options;
+    options.writeAheadLog = true;
+    options.synchronousNormal = true;
+    options.mmapSize = 1024 * 1024;
+    {
+        SQLiteDatabase db(dbFilePath);
+        ASSERT_TRUE(db.initialize());
+        db.close();
+    }
+
+    SQLiteDatabase db(dbFilePath, options);
+    ASSERT_TRUE(db.open());
+
+    auto statement = db.createStatement("PRAGMA journal_mode;");
+    ASSERT_NE(statement, nullptr);
+    ASSERT_TRUE(statement->step());
+    EXPECT_EQ(statement->getColumnText(0), "wal");
+
+    // NORMAL is 1, FULL is 2.
+    statement = db.createStatement("PRAGMA synchronous;");
+    ASSERT_NE(statement, nullptr);
+    ASSERT_TRUE(statement->step());
+    EXPECT_EQ(statement->getColumnInt(0), 1);
+    statement.reset();
+
+    db.close();
+}
+
 }  // namespace test
 }  // namespace sqliteStorage
 }  // namespace storage
@@ -123,11 +123,13 @@ private:
      * @param dbFilePath The location of the SQLite database file.
      * @param alertsAudioFactory A factory that can produce default alert sounds.
      * @param metricRecorder The @c MetricRecorderInterface used to record metrics.
+     * @param databaseOptions The options to open the database with.
      */
     SQLiteAlertStorage(
         const std::string& dbFilePath,
         const std::shared_ptr<avsCommon::sdkInterfaces::audio::AlertsAudioFactoryInterface>& alertsAudioFactory,
-        std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder);
+        std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder,
+        const alexaClientSDK::storage::sqliteStorage::SQLiteDatabase::Options& databaseOptions);
 
     /**
      * A utility function to help us load alerts from different versions of the alerts table.  Currently, versions
@@ -750,7 +750,7 @@ int AlertsCapabilityAgent::getAlertVolume() {
 
 bool AlertsCapabilityAgent::handleSetAlert(
     const std::shared_ptr<avsCommon::avs::AVSDirective>& directive,
-    const rapidjson::Document& payload,
+    const rapidjson::Value& payload,
     std::string* alertToken) {
     ACSDK_DEBUG9(LX("handleSetAlert"));
     std::string alertType;
@@ -833,7 +833,7 @@ bool AlertsCapabilityAgent::handleSetAlert(
 
 bool AlertsCapabilityAgent::handleDeleteAlert(
     const std::shared_ptr<avsCommon::avs::AVSDirective>& directive,
-    const rapidjson::Document& payload,
+    const rapidjson::Value& payload,
     std::string* alertToken) {
     ACSDK_DEBUG5(LX(__func__));
     if (!retrieveValue(payload, DIRECTIVE_PAYLOAD_TOKEN_KEY, alertToken)) {
@@ -854,7 +854,7 @@ bool AlertsCapabilityAgent::handleDeleteAlert(
 
 bool AlertsCapabilityAgent::handleDeleteAlerts(
     const std::shared_ptr<avsCommon::avs::AVSDirective>& directive,
-    const rapidjson::Document& payload) {
+    const rapidjson::Value& payload) {
     ACSDK_DEBUG5(LX(__func__));
 
     std::list<std::string> alertTokens;
@@ -895,7 +895,7 @@ bool AlertsCapabilityAgent::handleDeleteAlerts(
 
 bool AlertsCapabilityAgent::handleSetVolume(
     const std::shared_ptr<avsCommon::avs::AVSDirective>& directive,
-    const rapidjson::Document& payload) {
+    const rapidjson::Value& payload) {
     ACSDK_DEBUG5(LX(__func__));
     int64_t volumeValue = 0;
     if (!retrieveValue(payload, DIRECTIVE_PAYLOAD_VOLUME, &volumeValue)) {
@@ -912,7 +912,7 @@ bool AlertsCapabilityAgent::handleSetVolume(
 
 bool AlertsCapabilityAgent::handleAdjustVolume(
     const std::shared_ptr<avsCommon::avs::AVSDirective>& directive,
-    const rapidjson::Document& payload) {
+    const rapidjson::Value& payload) {
     ACSDK_DEBUG5(LX(__func__));
     int64_t adjustValue = 0;
     if (!retrieveValue(payload, DIRECTIVE_PAYLOAD_VOLUME, &adjustValue)) {
@@ -937,7 +937,7 @@ bool AlertsCapabilityAgent::handleAdjustVolume(
 
 bool AlertsCapabilityAgent::handleSetAlarmVolumeRamp(
     const std::shared_ptr<avsCommon::avs::AVSDirective>& directive,
-    const rapidjson::Document& payload) {
+    const rapidjson::Value& payload) {
     std::string jsonValue;
     if (!retrieveValue(payload, DIRECTIVE_PAYLOAD_ALARM_VOLUME_RAMP, &jsonValue)) {
         std::string errorMessage =
@@ -1098,10 +1098,9 @@ void AlertsCapabilityAgent::executeHandleDirectiveImmediately(std::shared_ptr<Di
     ACSDK_DEBUG1(LX("executeHandleDirectiveImmediately"));
     auto& directive = info->directive;
 
-    rapidjson::Document payload;
-    payload.Parse(directive->getPayload());
-
-    if (payload.HasParseError()) {
+    // The directive was parsed when it was created, so read its payload in place.
+    const rapidjson::Value& payload = directive->getPayloadValue();
+    if (!payload.IsObject()) {
         std::string errorMessage = "Unable to parse payload";
         ACSDK_ERROR(LX("executeHandleDirectiveImmediatelyFailed").m(errorMessage));
         sendProcessingDirectiveException(directive, errorMessage);
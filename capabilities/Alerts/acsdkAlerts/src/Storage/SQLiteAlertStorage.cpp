@@ -413,16 +413,20 @@ std::unique_ptr<SQLiteAlertStorage> SQLiteAlertStorage::create(
         return nullptr;
     }
 
-    return std::unique_ptr<SQLiteAlertStorage>(
-        new SQLiteAlertStorage(alertDbFilePath, alertsAudioFactory, metricRecorder));
+    return std::unique_ptr<SQLiteAlertStorage>(new SQLiteAlertStorage(
+        alertDbFilePath,
+        alertsAudioFactory,
+        metricRecorder,
+        SQLiteDatabase::Options::fromConfiguration(alertsConfigurationRoot)));
 }
 
 SQLiteAlertStorage::SQLiteAlertStorage(
     const std::string& dbFilePath,
     const std::shared_ptr<avsCommon::sdkInterfaces::audio::AlertsAudioFactoryInterface>& alertsAudioFactory,
-    std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder) :
+    std::shared_ptr<avsCommon::utils::metrics::MetricRecorderInterface> metricRecorder,
+    const SQLiteDatabase::Options& databaseOptions) :
         m_alertsAudioFactory{alertsAudioFactory},
-        m_db{dbFilePath},
+        m_db{dbFilePath, databaseOptions},
         m_metricRecorder{metricRecorder},
         m_retryTimer{RETRY_TABLE} {
 }
@@ -66,6 +66,38 @@ static const std::string VALID_ALERTS_DB_CONFIG_JSON = R"(
 )";
 // clang-format on
 
+/// The name of the database file for the benchmark.
+static const std::string BENCHMARK_DATABASE_FILE_NAME = "SQLiteAlertStorageBenchmark.db";
+
+/// Configuration of the benchmark database with the default options.
+// clang-format off
+static const std::string DEFAULT_OPTIONS_ALERTS_DB_CONFIG_JSON = R"(
+    {
+        "alertsCapabilityAgent": {
+            "databaseFilePath": ")" + BENCHMARK_DATABASE_FILE_NAME + R"(",
+            "statementCacheSize": 0
+        }
+    }
+)";
+// clang-format on
+
+/// Configuration of the benchmark database with the statement cache, write-ahead log, synchronous=NORMAL and mmap.
+// clang-format off
+static const std::string TUNED_OPTIONS_ALERTS_DB_CONFIG_JSON = R"(
+    {
+        "alertsCapabilityAgent": {
+            "databaseFilePath": ")" + BENCHMARK_DATABASE_FILE_NAME + R"(",
+            "writeAheadLog": true,
+            "synchronousNormal": true,
+            "mmapSize": 4194304
+        }
+    }
+)";
+// clang-format on
+
+/// The number of alerts stored, loaded and erased by the benchmark.
+static const int BENCHMARK_ALERT_COUNT = 200;
+
 // clang-format off
 static const std::string INVALID_ALERTS_DB_CONFIG_JSON = R"(
     {
@@ -240,6 +272,9 @@ public:
     /// Utility function to check if a table is empty.
     bool isTableEmpty(SQLiteDatabase* db, const std::string& tableName);
 
+    /// Utility function to store, load and erase alerts one at a time, with the given configuration.
+    void runStoreLoadEraseBenchmark(const std::string& configJson);
+
     /// The @c SQLiteAlertStorage instance to test.
     std::shared_ptr<SQLiteAlertStorage> m_alertStorage;
 
@@ -855,6 +890,59 @@ TEST_F(SQLiteAlertStorageTest, test_clearDatabase) {
     db.close();
 }
 
+void SQLiteAlertStorageTest::runStoreLoadEraseBenchmark(const std::string& configJson) {
+    if (fileExists(BENCHMARK_DATABASE_FILE_NAME)) {
+        removeFile(BENCHMARK_DATABASE_FILE_NAME);
+    }
+    ConfigurationNode::uninitialize();
+    ConfigurationNode::initialize({std::make_shared<std::istringstream>(configJson)});
+    auto storage =
+        SQLiteAlertStorage::create(ConfigurationNode::getRoot(), m_mockAlertsAudioFactory, m_mockMetricRecorder);
+    ASSERT_NE(storage, nullptr);
+    ASSERT_TRUE(storage->createDatabase());
+
+    std::vector<std::shared_ptr<Alert>> alerts;
+    for (int i = 0; i < BENCHMARK_ALERT_COUNT; ++i) {
+        auto alert = std::make_shared<MockAlert>(TEST_ALERT_TYPE_ALARM);
+        Alert::StaticData staticData;
+        Alert::DynamicData dynamicData;
+        staticData.token = TOKEN_ALARM + std::to_string(i);
+        dynamicData.timePoint.setTime_ISO_8601(SCHEDULED_TIME_ISO_STRING_ALARM);
+        dynamicData.originalTime = ORIGINAL_TIME_ALARM;
+        alert->setAlertData(&staticData, &dynamicData);
+        alerts.push_back(alert);
+    }
+
+    for (auto& alert : alerts) {
+        ASSERT_TRUE(storage->store(alert));
+    }
+
+    std::vector<std::shared_ptr<Alert>> loadedAlerts;
+    ASSERT_TRUE(storage->load(&loadedAlerts, nullptr));
+    EXPECT_EQ(loadedAlerts.size(), alerts.size());
+
+    for (auto& alert : alerts) {
+        ASSERT_TRUE(storage->erase(alert));
+    }
+    storage->close();
+    removeFile(BENCHMARK_DATABASE_FILE_NAME);
+}
+
+/**
+ * Benchmark of storing, loading and erasing alerts with the default database options.
+ */
+TEST_F(SQLiteAlertStorageTest, testSlow_benchmarkStoreLoadEraseDefaultOptions) {
+    runStoreLoadEraseBenchmark(DEFAULT_OPTIONS_ALERTS_DB_CONFIG_JSON);
+}
+
+/**
+ * Benchmark of storing, loading and erasing alerts with the statement cache, write-ahead log, @c synchronous=NORMAL
+ * and mmap enabled.
+ */
+TEST_F(SQLiteAlertStorageTest, testSlow_benchmarkStoreLoadEraseTunedOptions) {
+    runStoreLoadEraseBenchmark(TUNED_OPTIONS_ALERTS_DB_CONFIG_JSON);
+}
+
 }  // namespace test
 }  // namespace acsdkAlerts
 }  // namespace alexaClientSDK
@@ -420,13 +420,13 @@ private:
     /// @}
 
     /**
-     * This function deserializes a @c Directive's payload into a @c rapidjson::Document.
+     * This function obtains the parsed payload of a @c Directive, and reports a failure if it is not a JSON object.
      *
-     * @param info The @c DirectiveInfo to read the payload string from.
-     * @param[out] document The @c rapidjson::Document to parse the payload into.
-     * @return @c true if parsing was successful, else @c false.
+     * @param info The @c DirectiveInfo to read the payload from.
+     * @param[out] payload Set to the parsed payload, which remains valid while @c info holds the directive.
+     * @return @c true if the payload is a JSON object, else @c false.
      */
-    bool parseDirectivePayload(std::shared_ptr<DirectiveInfo> info, rapidjson::Document* document);
+    bool parseDirectivePayload(std::shared_ptr<DirectiveInfo> info, const rapidjson::Value** payload);
 
     /**
      * This function pre-handles a @c PLAY directive.
@@ -23,7 +23,6 @@
 #include "acsdkAudioPlayer/Util.h"
 
 #include <rapidjson/stringbuffer.h>
-#include <rapidjson/error/en.h>
 
 #include <AVSCommon/AVS/CapabilityConfiguration.h>
 #include <AVSCommon/AVS/EventBuilder.h>
@@ -1069,15 +1068,16 @@ void AudioPlayer::doShutdown() {
     m_captionManager.reset();
 }
 
-bool AudioPlayer::parseDirectivePayload(std::shared_ptr<DirectiveInfo> info, rapidjson::Document* document) {
-    rapidjson::ParseResult result = document->Parse(info->directive->getPayload());
-    if (result) {
+bool AudioPlayer::parseDirectivePayload(std::shared_ptr<DirectiveInfo> info, const rapidjson::Value** payload) {
+    // The directive was parsed when it was created, so there is no need to parse its payload again.
+    auto& payloadValue = info->directive->getPayloadValue();
+    if (payloadValue.IsObject()) {
+        *payload = &payloadValue;
         return true;
     }
 
     ACSDK_ERROR(LX("parseDirectivePayloadFailed")
-                    .d("reason", rapidjson::GetParseError_En(result.Code()))
-                    .d("offset", result.Offset())
+                    .d("reason", "invalidPayload")
                     .d("messageId", info->directive->getMessageId()));
     sendExceptionEncounteredAndReportFailed(
         info, "Unable to parse payload", ExceptionErrorType::UNEXPECTED_INFORMATION_RECEIVED);
@@ -1146,10 +1146,11 @@ void AudioPlayer::preHandlePlayDirective(std::shared_ptr<DirectiveInfo> info) {
     if (info) {
         ACSDK_DEBUG9(LX("prePLAY").d("payload", info->directive->getPayload()));
     }
-    rapidjson::Document payload;
-    if (!info || !parseDirectivePayload(info, &payload)) {
+    const rapidjson::Value* payloadValue = nullptr;
+    if (!info || !parseDirectivePayload(info, &payloadValue)) {
         return;
     }
+    const auto& payload = *payloadValue;
     std::shared_ptr<PlayDirectiveInfo> playItem = std::make_shared<PlayDirectiveInfo>(
         info->directive->getMessageId(),
         info->directive->getDialogRequestId().empty() ? m_lastDialogRequestId : info->directive->getDialogRequestId());
@@ -1391,10 +1392,11 @@ void AudioPlayer::handlePlayDirective(std::shared_ptr<DirectiveInfo> info) {
         ACSDK_DEBUG9(LX("PLAY").d("payload", info->directive->getPayload()));
     }
 
-    rapidjson::Document payload;
-    if (!info || !parseDirectivePayload(info, &payload)) {
+    const rapidjson::Value* payloadValue = nullptr;
+    if (!info || !parseDirectivePayload(info, &payloadValue)) {
         return;
     }
+    const auto& payload = *payloadValue;
 
     rapidjson::Value::ConstMemberIterator audioItemJson;
     if (!jsonUtils::findNode(payload, "audioItem", &audioItemJson)) {
@@ -1487,10 +1489,11 @@ void AudioPlayer::handleStopDirective(std::shared_ptr<DirectiveInfo> info) {
 
 void AudioPlayer::handleClearQueueDirective(std::shared_ptr<DirectiveInfo> info) {
     ACSDK_DEBUG1(LX("handleClearQueue"));
-    rapidjson::Document payload;
-    if (!info || !parseDirectivePayload(info, &payload)) {
+    const rapidjson::Value* payloadValue = nullptr;
+    if (!info || !parseDirectivePayload(info, &payloadValue)) {
         return;
     }
+    const auto& payload = *payloadValue;
 
     ClearBehavior clearBehavior;
     if (!jsonUtils::retrieveValue(payload, "clearBehavior", &clearBehavior)) {
@@ -1503,10 +1506,11 @@ void AudioPlayer::handleClearQueueDirective(std::shared_ptr<DirectiveInfo> info)
 
 void AudioPlayer::handleUpdateProgressReportIntervalDirective(std::shared_ptr<DirectiveInfo> info) {
     ACSDK_DEBUG1(LX("handleUpdateProgressReportIntervalDirective"));
-    rapidjson::Document payload;
-    if (!info || !parseDirectivePayload(info, &payload)) {
+    const rapidjson::Value* payloadValue = nullptr;
+    if (!info || !parseDirectivePayload(info, &payloadValue)) {
         return;
     }
+    const auto& payload = *payloadValue;
 
     int64_t milliseconds;
     if (!jsonUtils::retrieveValue(payload, "progressReportIntervalInMilliseconds", &milliseconds)) {
@@ -77,8 +77,11 @@ private:
      * Constructor.
      *
      * @param filepath The filepath of the sqlite file.
+     * @param databaseOptions The options to open the database with.
      */
-    SQLiteBluetoothStorage(const std::string& filepath);
+    SQLiteBluetoothStorage(
+        const std::string& filepath,
+        const alexaClientSDK::storage::sqliteStorage::SQLiteDatabase::Options& databaseOptions);
 
     /**
      * Closes the SQLiteDatabase instance. This must be called with @c m_mutex obtained.
@@ -89,7 +89,8 @@ std::unique_ptr<SQLiteBluetoothStorage> SQLiteBluetoothStorage::create(
         return nullptr;
     }
 
-    return std::unique_ptr<SQLiteBluetoothStorage>(new SQLiteBluetoothStorage(filePath));
+    return std::unique_ptr<SQLiteBluetoothStorage>(new SQLiteBluetoothStorage(
+        filePath, storage::sqliteStorage::SQLiteDatabase::Options::fromConfiguration(bluetoothConfigurationRoot)));
 }
 
 bool SQLiteBluetoothStorage::createDatabase() {
@@ -573,7 +574,10 @@ void SQLiteBluetoothStorage::closeLocked() {
     m_db.close();
 }
 
-SQLiteBluetoothStorage::SQLiteBluetoothStorage(const std::string& filePath) : m_db{filePath} {
+SQLiteBluetoothStorage::SQLiteBluetoothStorage(
+    const std::string& filePath,
+    const storage::sqliteStorage::SQLiteDatabase::Options& databaseOptions) :
+        m_db{filePath, databaseOptions} {
 }
 
 }  // namespace acsdkBluetooth
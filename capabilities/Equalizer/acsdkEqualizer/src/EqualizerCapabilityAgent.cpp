@@ -415,6 +415,8 @@ void EqualizerCapabilityAgent::onEqualizerStateChanged(const EqualizerState& sta
     m_contextManager->setState(EQUALIZER_STATE, payload, avsCommon::avs::StateRefreshPolicy::NEVER);
     auto eventJson = buildJsonEventString(EVENT_EQUALIZERCHANGED.name, "", payload);
     auto request = std::make_shared<MessageRequest>(eventJson.second);
+    // The event carries the full equalizer state, so a later one supersedes an unsent one.
+    request->setCoalescingKey(EVENT_EQUALIZERCHANGED.nameSpace + "." + EVENT_EQUALIZERCHANGED.name);
 
     m_messageSender->sendMessage(request);
 }
@@ -57,8 +57,12 @@ public:
      * Constructor.
      *
      * @param dbFilePath The location of the SQLite database file.
+     * @param databaseOptions The options to open the database with.
      */
-    SQLiteNotificationsStorage(const std::string& databaseFilePath);
+    SQLiteNotificationsStorage(
+        const std::string& databaseFilePath,
+        const alexaClientSDK::storage::sqliteStorage::SQLiteDatabase::Options& databaseOptions =
+            alexaClientSDK::storage::sqliteStorage::SQLiteDatabase::Options());
 
     ~SQLiteNotificationsStorage();
 
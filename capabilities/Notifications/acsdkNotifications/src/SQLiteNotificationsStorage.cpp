@@ -94,11 +94,15 @@ std::unique_ptr<SQLiteNotificationsStorage> SQLiteNotificationsStorage::create(
         return nullptr;
     }
 
-    return std::unique_ptr<SQLiteNotificationsStorage>(new SQLiteNotificationsStorage(notificationDatabaseFilePath));
+    return std::unique_ptr<SQLiteNotificationsStorage>(new SQLiteNotificationsStorage(
+        notificationDatabaseFilePath,
+        storage::sqliteStorage::SQLiteDatabase::Options::fromConfiguration(notificationConfigurationRoot)));
 }
 
-SQLiteNotificationsStorage::SQLiteNotificationsStorage(const std::string& databaseFilePath) :
-        m_database{databaseFilePath} {
+SQLiteNotificationsStorage::SQLiteNotificationsStorage(
+    const std::string& databaseFilePath,
+    const storage::sqliteStorage::SQLiteDatabase::Options& databaseOptions) :
+        m_database{databaseFilePath, databaseOptions} {
 }
 
 bool SQLiteNotificationsStorage::createDatabase() {
@@ -133,6 +133,9 @@ include_once(Rapidjson)
 # Setup Low Power Mode variables.
 include_once(LowPowerMode)
 
+# Setup Work Stealing Executor variables.
+include_once(WorkStealingExecutor)
+
 # Setup External Media Player Adapters variables.
 include_once(ExternalMediaPlayerAdapters)
 
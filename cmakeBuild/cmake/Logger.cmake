@@ -13,10 +13,36 @@
 #     -DACSDK_EMIT_SENSITIVE_LOGS=ON
 # Note that this option is only honored in DEBUG builds.
 #
+# To compile out debug logs below a given level, include the following option on the cmake command line:
+#     -DACSDK_LOG_MIN_LEVEL=<LEVEL>
+# where <LEVEL> is one of DEBUG9 (the default) through DEBUG0, or INFO to compile out all debug logs.
+# A module can set its own minimum level, which takes precedence, by adding the following to its CMakeLists.txt:
+#     acsdk_log_min_level(<target> <LEVEL>)
+#
 
 option(ACSDK_LOG "Enabled logging within the SDK" OFF)
 option(ACSDK_DEBUG_LOG "Enables logging of DEBUG level logs" OFF)
 option(ACSDK_EMIT_SENSITIVE_LOGS "Enable Logging of sensitive information." OFF)
+set(ACSDK_LOG_MIN_LEVEL "" CACHE STRING "Lowest level of debug logs compiled in (DEBUG9 through DEBUG0, or INFO).")
+
+set(ACSDK_LOG_MIN_LEVEL_VALUES DEBUG9 DEBUG8 DEBUG7 DEBUG6 DEBUG5 DEBUG4 DEBUG3 DEBUG2 DEBUG1 DEBUG0 INFO)
+
+# Compile out debug logs from the sources of <target> below <level>, one of ACSDK_LOG_MIN_LEVEL_VALUES.
+function(acsdk_log_min_level target level)
+    list(FIND ACSDK_LOG_MIN_LEVEL_VALUES ${level} levelIndex)
+    if (levelIndex EQUAL -1)
+        message(FATAL_ERROR "FATAL_ERROR: Invalid log level ${level} for ${target}.")
+    endif()
+    target_compile_definitions(${target} PRIVATE ACSDK_LOG_MODULE_MIN_LEVEL=ACSDK_LOG_LEVEL_${level})
+endfunction()
+
+if (ACSDK_LOG_MIN_LEVEL)
+    list(FIND ACSDK_LOG_MIN_LEVEL_VALUES ${ACSDK_LOG_MIN_LEVEL} levelIndex)
+    if (levelIndex EQUAL -1)
+        message(FATAL_ERROR "FATAL_ERROR: Invalid ACSDK_LOG_MIN_LEVEL=${ACSDK_LOG_MIN_LEVEL}.")
+    endif()
+    add_definitions(-DACSDK_LOG_MIN_LEVEL=ACSDK_LOG_LEVEL_${ACSDK_LOG_MIN_LEVEL})
+endif()
 
 if (ACSDK_EMIT_SENSITIVE_LOGS)
     string(TOUPPER ${CMAKE_BUILD_TYPE} BUILD_TYPE_UPPER)
@@ -0,0 +1,14 @@
+# Setup Work Stealing Executor compiler options.
+#
+# To run every default constructed Executor as a strand on a shared, fixed size work stealing thread pool, specify:
+# cmake <path-to-source> -DWORK_STEALING_EXECUTOR=ON
+#
+# The pool has one thread per hardware thread. Components whose tasks block waiting on other executors can exhaust
+# these threads, so this should only be enabled once all such components have been verified.
+
+option(WORK_STEALING_EXECUTOR "Run Executors on a shared work stealing thread pool" OFF)
+
+if(WORK_STEALING_EXECUTOR)
+    message("Enabling Work Stealing Executor on ${PROJECT_NAME}")
+    add_definitions(-DENABLE_WORK_STEALING_EXECUTOR)
+endif()
@@ -28,7 +28,7 @@ LogEntry& LogEntry::d(const char* key, const std::vector<unsigned char>& value)
     prefixKeyValuePair();
     std::string hexValue;
     alexaClientSDK::acsdkCodecUtils::encodeHex(value, hexValue);
-    m_stream << key << KEY_VALUE_SEPARATOR << hexValue;
+    stream() << key << KEY_VALUE_SEPARATOR << hexValue;
     return *this;
 }
 
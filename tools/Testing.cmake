@@ -74,5 +74,6 @@ endmacro()
 # Add Custom Targets
 add_custom_target(fast-test COMMAND ${CMAKE_CTEST_COMMAND} -E "testSlow|testTimer" --output-on-failure VERBATIM)
 add_custom_target(find-slow-test COMMAND ${CMAKE_CTEST_COMMAND} -E "testSlow|testTimer" --output-on-failure --timeout 1 VERBATIM)
+# Benchmarks are slow tests named testSlow_benchmark*, one per variant measured; slow-test reports the time of each.
 add_custom_target(slow-test COMMAND ${CMAKE_CTEST_COMMAND} -R "testSlow" --output-on-failure)
 add_custom_target(timer-test COMMAND ${CMAKE_CTEST_COMMAND} -R "testTimer" --output-on-failure)